@@ -1,10 +1,13 @@
 #include "AI.h"
 #include "IO.h"
 #include "MO.h"
+#include "Predict.h"
 #include "Signal.h"
+#include "Threads.h"
 #include "Time.h"
 #include "TT.h"
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -21,61 +24,77 @@ int ai_use_killer     = AI_DEFAULT_KILLER;
 int ai_use_pvs        = AI_DEFAULT_PVS;
 int ai_use_mtdf       = AI_DEFAULT_MTDF;
 int ai_use_deepening  = AI_DEFAULT_DEEPENING;
+int ai_poll_nodes     = AI_DEFAULT_POLL;
 #endif
 
-/* Global flag to abort search: */
-static volatile bool aborted = false;
+bool ai_interruptible = true;
 
-/* Number of states evaluated since last call to ai_select_move(): */
-static int eval_count = 0;
+/* Engine whose search is aborted by a keyboard interrupt: */
+static AI_Engine *interrupt_engine = NULL;
+
+void ai_engine_init(AI_Engine *engine, TTable *tt)
+{
+	memset(engine, 0, sizeof(*engine));
+	engine->use_mo         = ai_use_mo;
+	engine->use_killer     = tt ? ai_use_killer : 0;
+	engine->use_pvs        = ai_use_pvs;
+	engine->use_mtdf       = ai_use_mtdf;
+	engine->use_deepening  = ai_use_deepening;
+	engine->poll_nodes     = ai_poll_nodes;
+	engine->weights        = eval_weights;
+	engine->tt             = tt;
+	engine->start_depth    = 1;
+	predict_reset(&engine->predictor);
+}
+
+void ai_engine_clone(AI_Engine *engine, const AI_Engine *source)
+{
+	ai_engine_init(engine, source->tt);
+	engine->use_mo         = source->use_mo;
+	engine->use_killer     = source->use_killer;
+	engine->use_pvs        = source->use_pvs;
+	engine->use_mtdf       = source->use_mtdf;
+	engine->use_deepening  = source->use_deepening;
+	engine->poll_nodes     = source->poll_nodes;
+	engine->weights        = source->weights;
+}
 
 /* Returns the transposition table entry for the given hash code. */
-static TTEntry *tt_entry(hash_t hash)
+static TTEntry *tt_entry(const TTable *tt, hash_t hash)
 {
-	TTEntry *entry = &tt[(size_t)(hash ^ (hash >> 32))&(tt_size - 1)];
+	TTEntry *entry =
+		&tt->entries[(size_t)(hash ^ (hash >> 32))&(tt->size - 1)];
 #ifdef PROBING
 	int max_tries = 16;
 	while (entry->hash && entry->hash != hash) {
 		if (--max_tries > 0) {
 			/* N.B. this is technically undefined behaviour: */
                         entry -= hash&15;
-			if (entry < tt) entry += tt_size;
+			if (entry < tt->entries) entry += tt->size;
 			break;
 		}
-		if (++entry == &tt[tt_size]) entry = tt;
+		if (++entry == &tt->entries[tt->size]) entry = tt->entries;
 	}
 #endif
 	return entry;
 }
 
-/* Resets the random number generator, using a fixed (but randomly chosen) seed.
-   This is a hack used to guarantee that functions like ai_select_move() are
-   deterministic, but unpredictable, so that the games played by the AI vary
-   a bit (even if the opponent's moves do not). */
-static void reset_rng()
+/* Resets the engine's random number generator, using a fixed (but randomly
+   chosen) seed. This is a hack used to guarantee that functions like
+   ai_select_move() are deterministic, but unpredictable, so that the games
+   played by the AI vary a bit (even if the opponent's moves do not). */
+static void reset_rng(AI_Engine *e)
 {
-	static int rng_seed = 0;
-	while (rng_seed == 0) rng_seed = rand();
-	srand(rng_seed);
+	while (e->rng_seed == 0) e->rng_seed = rand();
+	e->rng_state = (unsigned)e->rng_seed;
 }
 
-/* Evaluates the current board by calling the appropriate function depending
-   on the game phase. If the game value is exact, *exact is set to true;
-   otherwise, it is left unmodified. */
-static val_t evaluate(const Board *board, bool *exact)
+/* Evaluates the current board with the engine's weights, and counts the
+   evaluation. */
+static val_t evaluate(AI_Engine *e, const Board *board, bool *exact)
 {
-	++eval_count;
-	if (board->moves >= N) {  /* stacking phase */
-		return eval_stacking(board, exact);
-	} else {  /* placement phase */
-		*exact = false;
-		if (board->moves > D) {  /* some player's pieces placed */
-			return eval_placing(board);
-		} else {  /* only Dvonn pieces placed; too early to evaluate */
-			*exact = false;
-			return 0;
-		}
-	}
+	++e->eval_count;
+	return eval_position(board, &e->weights, exact);
 }
 
 /* Implements depth-first minimax search with (fail soft) alpha-beta pruning.
@@ -87,6 +106,9 @@ static val_t evaluate(const Board *board, bool *exact)
 
    If `return_best' is not NULL, then the best move is assigned to *return_best.
 
+   Moves are generated in the move stack starting at `moves'; entries beyond
+   those are used by recursive calls.
+
    If the game value is not exact (that is, some mid-game positions were
    evaluated to determine it) then *return_exact is set to false. If the value
    is exact (only end-game positions were evaluated) it is left unchanged.
@@ -95,14 +117,15 @@ static val_t evaluate(const Board *board, bool *exact)
    more positions than stricly necessary. This enables re-using transposition
    table entries as often as possible.
 
-   Note that the search may be aborted by setting the global variable `aborted'
-   to `true'. In that case, dfs() returns 0, and the caller (which includes
-   dfs() itself) must ensure that the value is not used as a valid result! This
-   means that all calls to dfs() should be followed by checking `aborted' before
-   using the return value.
+   Note that the search may be aborted by setting the engine's `aborted' flag
+   to `true', which happens when the deadline has passed (which is checked every
+   `poll_nodes' nodes) or on a keyboard interrupt. In that case, dfs() returns
+   0, and the caller (which includes dfs() itself) must ensure that the value is
+   not used as a valid result! This means that all calls to dfs() should be
+   followed by checking `e->aborted' before using the return value.
 */
-static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
-                  Move *return_best, bool *return_exact)
+static val_t dfs( AI_Engine *e, Board *board, int depth, val_t lo, val_t hi,
+                  Move *return_best, bool *return_exact, Move *moves)
 {
 	hash_t hash = (hash_t)-1;
 	IF_TT_DEBUG( unsigned char data[50] )
@@ -110,13 +133,24 @@ static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
 	val_t res = val_min;
 	Move best_move = move_null;
 	bool exact = true;
+	int ply = board->moves - e->root_moves;
 
 	assert(lo < hi);
+	assert(moves < e->move_stack + AI_MOVE_STACK_SIZE);
+	assert(ply >= 0 && ply < AI_STATS_PLIES);
+
+	++e->node_count;
+	++e->stats.nodes[ply];
+	if (--e->poll_countdown <= 0) {
+		e->poll_countdown = e->poll_nodes;
+		if (e->deadline > 0 && time_used() >= e->deadline) e->aborted = true;
+	}
+	if (e->aborted) return 0;
 
-	if (ai_use_tt) { /* look up in transposition table: */
+	if (e->tt) { /* look up in transposition table: */
 		hash = hash_board(board);
 		IF_TT_DEBUG( serialize_board(board, data) )
-		entry = tt_entry(hash);
+		entry = tt_entry(e->tt, hash);
 		IF_TT_DEBUG( ++tt_stats.queries )
 		IF_TT_DEBUG( if (entry->hash != hash) ++tt_stats.missing )
 		if (entry->hash == hash) {
@@ -132,10 +166,12 @@ static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
 				if (entry->lo == entry->hi || entry->lo >= hi) {
 					if (return_best) *return_best = entry->killer;
 					if (entry->depth <= AI_MAX_DEPTH) *return_exact = false;
+					++e->stats.tt_hits[ply];
 					return entry->lo;
 				} else if (entry->hi <= lo) {
 					if (return_best) *return_best = entry->killer;
 					if (entry->depth <= AI_MAX_DEPTH) *return_exact = false;
+					++e->stats.tt_hits[ply];
 					return entry->hi;
 				}
 				if (entry->lo > lo) lo = entry->lo;  /* dubious? */
@@ -143,68 +179,98 @@ static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
 				IF_TT_DEBUG( ++tt_stats.partial )
 			}
 			best_move = entry->killer;
+			++e->stats.tt_partial[ply];
+		} else {
+			++e->stats.tt_misses[ply];
 		}
 	}
 	if (depth == 0) {  /* evaluate intermediate position */
-		res = evaluate(board, &exact);
+		res = evaluate(e, board, &exact);
 	} else if (board->moves == N - 1) {
 		/* Special case: the N'th move is always unique, but the next player
 		   does not change! Handle this special case here: */
-		Move moves[M];
 		int nmove = generate_moves(board, moves);
 		assert(nmove == 1);
 		board_do(board, &moves[0]);
-		res = dfs(board, depth, lo > res ? lo : res, hi, NULL, &exact);
+		res = dfs( e, board, depth, lo > res ? lo : res, hi, NULL, &exact,
+		           moves + nmove );
 		board_undo(board, &moves[0]);
-		if (aborted) return 0;
+		if (e->aborted) return 0;
 		best_move = moves[0];
 	} else {  /* evaluate interior node */
-		Move moves[M];
-		int n, nmove = generate_moves(board, moves);
+		/* With heuristic move ordering, the killer move is searched before
+		   the other moves are generated, so that none need to be generated or
+		   ordered when it causes a cut-off. (Not at the top level, where moves
+		   are shuffled first.) */
+		Move killer = (e->use_killer) ? best_move : move_null;
+		bool staged = e->use_mo == 1 && board->moves > N && !return_best &&
+		              !move_is_null(&killer);
+		int n, nmove = 0, stage = STAGE_DONE;
+
+		if (staged) {
+			stage = STAGE_KILLER;
+		} else {
+			nmove = generate_moves(board, moves);
+		}
 
 		if (nmove > 1) {  /* order moves */
 
 			/* At the top level, shuffle moves in a semi-random fashion: */
 			if (return_best) {
-				reset_rng();
-				shuffle_moves(moves, nmove);
+				reset_rng(e);
+				shuffle_moves(moves, nmove, &e->rng_state);
 			}
 
-			/* Move ordering: */
-			if (ai_use_mo && (ai_use_mo < 2 || depth > 1)) {
-				order_moves(board, moves, nmove);
+			/* Move ordering (evaluated ordering counts as evaluations): */
+			if (e->use_mo && (e->use_mo < 2 || depth > 1)) {
+				order_moves(board, moves, nmove, e->use_mo, &e->weights);
+				if (e->use_mo == 2) e->eval_count += nmove;
 			}
 
 			/* Killer heuristic: */
-			if (ai_use_killer && !move_is_null(&best_move)) {
+			if (e->use_killer && !move_is_null(&best_move)) {
 				move_to_front(moves, nmove, best_move);
 			}
 		}
 
-		for (n = 0; n < nmove; ++n) {
+		for (n = 0; ; ++n) {
 			val_t val, lb = (res > lo) ? res : lo;
 
+			/* Generate the next stage of moves, if necessary: */
+			while (n == nmove && stage != STAGE_DONE) {
+				nmove += generate_stage(board, moves + nmove, stage++, killer);
+			}
+			if (n == nmove) break;
+			assert(moves + nmove < e->move_stack + AI_MOVE_STACK_SIZE);
+
 			board_do(board, &moves[n]);
-			if (!ai_use_pvs || n == 0 || res < lo) {
-				val = -dfs(board, depth - 1, -hi, -lb, NULL, &exact);
+			if (!e->use_pvs || n == 0 || res < lo) {
+				val = -dfs( e, board, depth - 1, -hi, -lb, NULL, &exact,
+				            moves + nmove );
 			} else {
-				val = -dfs(board, depth - 1, -lb - val_eps, -lb, NULL, &exact);
+				val = -dfs( e, board, depth - 1, -lb - val_eps, -lb, NULL,
+				            &exact, moves + nmove );
 				if (val > lb && val < hi) {
-					val = -dfs(board, depth - 1, -hi, -val, NULL, &exact);
+					val = -dfs( e, board, depth - 1, -hi, -val, NULL, &exact,
+					            moves + nmove );
 				}
 			}
 			board_undo(board, &moves[n]);
-			if (aborted) return 0;
+			if (e->aborted) return 0;
 
 			/* Update value bounds: */
 			if (val > res) {
 				res = val;
 				best_move = moves[n];
-				if (res >= hi) break;
+				if (res >= hi) {
+					++e->stats.cutoffs[ n < AI_STATS_INDICES
+					                   ? n : AI_STATS_INDICES - 1 ];
+					break;
+				}
 			}
 		}
 	}
-	if (ai_use_tt) {
+	if (e->tt) {
 		/* Replacement policy: replace existing position with a new one if its
 		   relevance is greater or equal, where relevance is defined as: */
 		int eff_depth = exact ? AI_MAX_DEPTH + 1 : depth;
@@ -223,6 +289,12 @@ static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
 
 			if (entry->hash != hash || entry->depth != eff_depth)
 			{
+#ifdef THREADS
+				/* The table may be shared with other threads: */
+				if (entry->hash == 0) __sync_fetch_and_add(&e->tt->used, 1);
+#else
+				if (entry->hash == 0) ++e->tt->used;
+#endif
 				entry->hash  = hash;
 				entry->lo    = val_min;
 				entry->hi    = val_max;
@@ -240,24 +312,27 @@ static val_t dfs( Board *board, int depth, val_t lo, val_t hi,
 	return res;
 }
 
-/* Callback handler for the timeout alarm. */
+/* Signal handler for keyboard interrupts. */
 static void set_aborted()
 {
-	aborted = true;
+	if (interrupt_engine) interrupt_engine->aborted = true;
 }
 
-bool ai_select_move( Board *board,
+bool ai_select_move( AI_Engine *e, Board *board,
 	const AI_Limit *limit, AI_Result *result )
 {
-	static int depth = 1;  /* iterative deepening start depth */
-
 	signal_handler_t new_handler, old_handler;
 	Move moves[M];
 	int nmove = generate_moves(board, moves);
+	int depth = e->start_depth;
 	double start = time_used();
 	double prev_used = 0.0;
-	double ratio = 5.0;
-	bool alarm_set = false, signal_handler_set = false;
+	double ratio = 0.0;  /* ratio of nodes searched by last two iterations */
+	int prev_nodes = 0;  /* nodes searched by the previous iteration */
+	int iteration = 0;   /* number of iterations completed */
+	int stable = 0;      /* number of iterations the best move was unchanged */
+	bool signal_handler_set = false;
+	GameStats old_game_stats = game_stats;
 
 	/* Check if we have any moves to make: */
 	if (nmove == 0) {
@@ -271,14 +346,17 @@ bool ai_select_move( Board *board,
 	result->value   = 0;
 	result->depth   = 0;
 	result->eval    = 0;
+	result->nodes   = 0;
 	result->time    = 0;
 	result->aborted = false;
 	result->exact   = false;
+	memset(&e->stats, 0, sizeof(e->stats));
+	e->root_moves = board->moves;
 
 	/* Special handling for placing of neutral Dvonn stones: */
 	if (board->moves < D) {
-		reset_rng();
-		shuffle_moves(moves, nmove);
+		reset_rng(e);
+		shuffle_moves(moves, nmove, &e->rng_state);
 		if (board->moves == 0) {
 			/* Place first Dvonn randomly */
 			result->move = moves[0];
@@ -302,31 +380,36 @@ bool ai_select_move( Board *board,
 
 	/* Killer heuristic is most effective when the transposition table
 	   contains the information from one ply ago, instead of two plies: */
-	if (ai_use_tt && ai_use_killer == 1 && depth > 2) --depth;
+	if (e->tt && e->use_killer == 1 && depth > 2) --depth;
 
 	if (limit->depth > 0 && limit->depth < depth) depth = limit->depth;
 
 	/* Round to least multiple of deepening increment: */
-	if (depth%ai_use_deepening > 0) {
-		if (depth < ai_use_deepening) {
-			depth = ai_use_deepening;
+	if (depth%e->use_deepening > 0) {
+		if (depth < e->use_deepening) {
+			depth = e->use_deepening;
 		} else {
-			depth += ai_use_deepening - depth%ai_use_deepening;
+			depth += e->use_deepening - depth%e->use_deepening;
 		}
 	}
 
-	eval_count = 0;
-	aborted = false;
+	e->eval_count = 0;
+	e->node_count = 0;
+	e->aborted = false;
+	e->deadline = 0;
+	e->poll_countdown = e->poll_nodes;
 	for (;;) {
 		/* DFS for best value and move: */
 		Move move = move_null;
 		bool exact = true;
 		val_t value;
 		double used;
+		int start_nodes = e->node_count, nodes;
 
-		if (!ai_use_mtdf)
+		if (!e->use_mtdf)
 		{
-			value = dfs(board, depth, val_min, val_max, &move, &exact);
+			value = dfs( e, board, depth, val_min, val_max, &move, &exact,
+			             e->move_stack );
 		}
 		else
 		{
@@ -336,17 +419,33 @@ bool ai_select_move( Board *board,
 			{
 				val_t beta = value;
 				if (beta == lo) ++beta;
-				value = dfs(board, depth, beta - 1, beta, &move, &exact);
+				value = dfs( e, board, depth, beta - 1, beta, &move, &exact,
+				             e->move_stack );
 				fprintf(stderr, "[%d:%d] %d\n", lo, hi, value);
 				if (value < beta) hi = value; else lo = value;
 			}
 			fprintf(stderr, "[%d:%d] %d\n", lo, hi, value);
 		}
 		used = time_used() - start;
-		if (prev_used > 0) ratio = used/prev_used;
-		prev_used = used;
-		if (aborted) {
+		nodes = e->node_count - start_nodes;
+		e->stats.iterations[depth] += nodes;
+		if (e->stats.iteration_count <= AI_MAX_DEPTH) {
+			AI_Iteration *it =
+				&e->stats.iteration_log[e->stats.iteration_count++];
+			it->depth   = depth;
+			it->move    = move;
+			it->value   = value;
+			it->exact   = exact;
+			it->aborted = e->aborted;
+			it->nodes   = e->node_count;
+			it->eval    = e->eval_count;
+			it->time    = used;
+			it->predicted = 0;
+		}
+		if (e->aborted) {
 			result->aborted = true;
+			result->eval = e->eval_count;
+			result->nodes = e->node_count;
 			result->time = used;
 			fprintf(stderr, "WARNING: aborted after %.3fs!\n", used);
 			--depth;
@@ -355,20 +454,39 @@ bool ai_select_move( Board *board,
 
 		assert(!move_is_null(&move));
 
+		/* Update the iteration time model. The first iteration is skipped,
+		   because it benefits from transposition table entries left by the
+		   previous search, which distorts the ratio. For the same reason,
+		   iterations that searched fewer nodes than there are moves (which
+		   were answered from the transposition table, e.g. because another
+		   thread searched the same position) are skipped too: */
+		ratio = (prev_nodes > 0) ? (double)nodes/prev_nodes : 0.0;
+		if ( iteration++ > 1 && !e->use_mtdf &&
+		     prev_nodes > nmove && nodes > nmove ) {
+			predict_update(&e->predictor, board, depth, ratio);
+		}
+		if (iteration > 1 && move_compare(&move, &result->move) == 0) {
+			++stable;
+		} else {
+			stable = 0;
+		}
+
 		/* Update results so far: */
 		result->move    = move;
 		result->depth   = depth;
 		result->value   = value;
-		result->eval    = eval_count;
+		result->eval    = e->eval_count;
+		result->nodes   = e->node_count;
 		result->time    = used;
 		result->aborted = false;
 		result->exact   = exact;
+		e->stats.depth  = depth;
 
 		/* Report intermediate result: */
 		if (board->moves >= N) {
 			fprintf(stderr, "m:%s d:%d v:"VAL_FMT"%s e:%d u:%.3fs r:%.1f\n",
 				format_move(&move), depth, value, exact ? " (exact)" : "",
-				eval_count, used, ratio);
+				e->eval_count, used, ratio);
 		}
 
 		if (limit && limit->time > 0 && used > limit->time) {
@@ -381,35 +499,54 @@ bool ai_select_move( Board *board,
 		/* Determine whether to search again with increased depth: */
 		if (exact || depth == AI_MAX_DEPTH || nmove == 1) break;
 		if (limit) {
-			if (limit->eval > 0 && eval_count >= limit->eval) break;
+			if (limit->eval > 0 && e->eval_count >= limit->eval) break;
 			if (limit->depth > 0 && depth >= limit->depth) break;
 			if (limit->time > 0) {
-				double end = used*( (ai_use_deepening < 2)
-					? ((depth%2 == 0) ? 2*ratio : ratio/2) : ratio*ratio );
-				if (end >= limit->time) break;
-				if (!alarm_set++) {
-					set_alarm(limit->time - used, set_aborted, NULL);
-				}
+				/* Predict the time of the next iteration, and only start it if
+				   it will probably finish in time. If the best move has been
+				   stable for a while, it is unlikely to change, so then the
+				   time is better saved for later moves: */
+				double upper, next;
+
+				predict_ratio(&e->predictor, board, depth + 1,
+				              &upper);
+				next = (used - prev_used)*upper;
+				e->stats.iteration_log[e->stats.iteration_count - 1].predicted =
+					next;
+				if (used + next >= limit->time) break;
+				if (stable >= 3 && used + next >= limit->time/2) break;
+				e->deadline = start + limit->time;
 			}
 		}
-		if (!signal_handler_set++) {
+		if (ai_interruptible && !signal_handler_set++) {
+			interrupt_engine = e;
 			signal_handler_init(&new_handler, set_aborted);
 			signal_swap_handlers(SIGINT, &new_handler, &old_handler);
 		}
-		if (!ai_use_mtdf)
+		prev_used  = used;
+		prev_nodes = nodes;
+		if (!e->use_mtdf)
 		{
 			++depth;
 		}
 		else
 		{
-			depth = depth + ai_use_deepening;
+			depth = depth + e->use_deepening;
 		}
 	}
-	if (alarm_set) clear_alarm();
-	if (signal_handler_set) signal_swap_handlers(SIGINT, &old_handler, NULL);
+	e->start_depth = depth;
+	e->stats.stacks = game_stats.stacks - old_game_stats.stacks;
+	e->stats.removal_checks =
+		game_stats.removal_checks - old_game_stats.removal_checks;
+	e->stats.removal_visits =
+		game_stats.removal_visits - old_game_stats.removal_visits;
+	if (signal_handler_set) {
+		signal_swap_handlers(SIGINT, &old_handler, NULL);
+		interrupt_engine = NULL;
+	}
 #ifdef TT_DEBUG
 	{
-		long long pop = tt_population_count();
+		long long pop = e->tt ? tt_population_count(e->tt) : 0;
 		fprintf(stderr, "TT stats:\n");
 		fprintf(stderr, "\tqueries:       %20lld\n", tt_stats.queries);
 		fprintf(stderr, "\t  missing:     %20lld\n", tt_stats.missing);
@@ -421,37 +558,167 @@ bool ai_select_move( Board *board,
 		fprintf(stderr, "\t  upgraded:    %20lld\n", tt_stats.upgraded);
 		fprintf(stderr, "\t  overwritten: %20lld\n", tt_stats.overwritten);
 		fprintf(stderr, "\tpopulation:    %20lld (%5.2f%%)\n",
-			pop, 100.0*pop/tt_size);
+			pop, e->tt ? 100.0*pop/e->tt->size : 0.0);
 		assert(tt_stats.updates <=  /* inequality occurs when aborting search */
 			tt_stats.missing + tt_stats.shallow + tt_stats.partial);
 		assert(pop == tt_stats.updates - tt_stats.discarded -
 			tt_stats.updated - tt_stats.upgraded - tt_stats.overwritten);
 	}
 #endif
-	aborted = false;
+	e->aborted = false;
+	e->deadline = 0;
 	return true;
 }
 
+double ai_stats_ebf(const AI_Stats *stats)
+{
+	const AI_Iteration *it = stats->iteration_log;
+	int n = stats->iteration_count - 1;
+	double cur, prev;
+
+	/* Find the last completed iteration: */
+	while (n >= 0 && it[n].aborted) --n;
+
+	/* The first iteration is skipped, because it typically benefits from
+	   transposition table entries left by the previous search: */
+	if (n < 2) return 0;
+	cur  = it[n].nodes - it[n - 1].nodes;
+	prev = it[n - 1].nodes - it[n - 2].nodes;
+	if (cur <= 0 || prev <= 0) return 0;
+	return pow(cur/prev, 1.0/(it[n].depth - it[n - 1].depth));
+}
+
+/* Prints a JSON array of the first `count' elements of `values'. */
+static void print_json_array(FILE *fp, const long long *values, int count)
+{
+	int n;
+
+	fprintf(fp, "[");
+	for (n = 0; n < count; ++n) {
+		fprintf(fp, "%s%lld", n > 0 ? "," : "", values[n]);
+	}
+	fprintf(fp, "]");
+}
+
+void ai_stats_print_json(FILE *fp, const AI_Stats *stats)
+{
+	long long nodes = 0;
+	int plies = AI_STATS_PLIES, depths = AI_MAX_DEPTH + 1, n;
+
+	while (plies > 0 && stats->nodes[plies - 1] == 0) --plies;
+	while (depths > 0 && stats->iterations[depths - 1] == 0) --depths;
+	for (n = 0; n < plies; ++n) nodes += stats->nodes[n];
+	fprintf(fp, "{\"depth\":%d,\"nodes\":%lld,\"ebf\":%.3f",
+		stats->depth, nodes, ai_stats_ebf(stats));
+	fprintf(fp, ",\"nodes_by_ply\":");
+	print_json_array(fp, stats->nodes, plies);
+	fprintf(fp, ",\"tt_hits_by_ply\":");
+	print_json_array(fp, stats->tt_hits, plies);
+	fprintf(fp, ",\"tt_partial_by_ply\":");
+	print_json_array(fp, stats->tt_partial, plies);
+	fprintf(fp, ",\"tt_misses_by_ply\":");
+	print_json_array(fp, stats->tt_misses, plies);
+	fprintf(fp, ",\"cutoffs_by_index\":");
+	print_json_array(fp, stats->cutoffs, AI_STATS_INDICES);
+	fprintf(fp, ",\"nodes_by_depth\":");
+	print_json_array(fp, stats->iterations, depths);
+	fprintf(fp, ",\"stacks\":%lld,\"removal_checks\":%lld"
+		",\"removal_visits\":%lld}\n", stats->stacks,
+		stats->removal_checks, stats->removal_visits);
+}
+
+void ai_reset(AI_Engine *engine)
+{
+	ai_reset_search(engine);
+	if (engine->tt) tt_clear(engine->tt);
+}
+
+void ai_reset_search(AI_Engine *engine)
+{
+	engine->start_depth = 1;
+	engine->rng_seed = 0;
+}
+
 val_t ai_evaluate(const Board *board)
 {
 	bool dummy;
-	return evaluate(board, &dummy);
+	return eval_position(board, &eval_weights, &dummy);
+}
+
+/* Range of descriptors evaluated by a single batch evaluation thread: */
+typedef struct BatchRange {
+	const unsigned char (*records)[50];
+	val_t *values;
+	int count;
+} BatchRange;
+
+/* Evaluates a range of descriptors, reusing a single scratch board. */
+static void *evaluate_range(void *arg)
+{
+	const BatchRange *range = arg;
+	Board board;
+	bool exact;
+	int i;
+
+	for (i = 0; i < range->count; ++i) {
+		if (deserialize_board(range->records[i], &board)) {
+			range->values[i] = eval_position(&board, &eval_weights, &exact);
+		} else {
+			range->values[i] = 0;
+		}
+	}
+	return NULL;
+}
+
+void ai_evaluate_batch( const unsigned char (*records)[50], int count,
+	val_t *values, int nthread )
+{
+#ifdef THREADS
+	pthread_t threads[AI_MAX_THREADS];
+	BatchRange ranges[AI_MAX_THREADS];
+	bool running[AI_MAX_THREADS];
+	int t;
+
+	if (nthread > AI_MAX_THREADS) nthread = AI_MAX_THREADS;
+	if (nthread > count) nthread = count;
+	for (t = 0; t < nthread; ++t) {
+		int begin = (long long)count*t/nthread;
+		int end   = (long long)count*(t + 1)/nthread;
+		ranges[t].records = records + begin;
+		ranges[t].values  = values + begin;
+		ranges[t].count   = end - begin;
+		running[t] = t > 0 && pthread_create(&threads[t], NULL,
+		                                     evaluate_range, &ranges[t]) == 0;
+	}
+	/* Evaluate the first range (and any that failed to start) here: */
+	for (t = 0; t < nthread; ++t) {
+		if (!running[t]) evaluate_range(&ranges[t]);
+	}
+	for (t = 0; t < nthread; ++t) {
+		if (running[t]) pthread_join(threads[t], NULL);
+	}
+#else
+	BatchRange range = { records, values, count };
+	(void)nthread;  /* ignored */
+	evaluate_range(&range);
+#endif
 }
 
-int ai_extract_pv(Board *board, Move *moves, int nmove)
+int ai_extract_pv( const AI_Engine *engine, Board *board,
+	Move *moves, int nmove )
 {
 	int n;
 	hash_t hash;
 	TTEntry *entry;
 
-	if (!ai_use_tt) return 0;
+	if (!engine->tt) return 0;
 
 	for (n = 0; n < nmove && generate_all_moves(board, NULL) > 0 ; ++n)
 	{
 		hash = hash_board(board);
-		entry = tt_entry(hash);
-		if (entry->hash != hash || move_is_null(&entry->killer)) break;
-		assert(valid_move(board, &entry->killer));
+		entry = tt_entry(engine->tt, hash);
+		if (entry->hash != hash || move_is_null(&entry->killer) ||
+		    !valid_move(board, &entry->killer)) break;
 		moves[n] = entry->killer;
 		board_do(board, &moves[n]);
 	}
@@ -3,17 +3,25 @@
 
 #include "Game.h"
 #include "Eval.h"
+#include "Predict.h"
+#include "TT.h"
+#include <stdio.h>
 
 /* Maximum search depth: */
 #define AI_MAX_DEPTH 32
 
-/* Search algorithm parameters: */
+/* Maximum number of threads used by functions that take a thread count: */
+#define AI_MAX_THREADS 64
+
+/* Search algorithm parameters (the variables below are the defaults used by
+   ai_engine_init(); each engine has its own copy): */
 #define AI_DEFAULT_TT        21
 #define AI_DEFAULT_MO         1
 #define AI_DEFAULT_KILLER     1
 #define AI_DEFAULT_PVS        1
 #define AI_DEFAULT_MTDF       0
 #define AI_DEFAULT_DEEPENING  1
+#define AI_DEFAULT_POLL    1000
 
 #ifdef FIXED_PARAMS
 #define ai_use_tt        AI_DEFAULT_TT
@@ -22,6 +30,7 @@
 #define ai_use_pvs       AI_DEFAULT_PVS
 #define ai_use_mtdf      AI_DEFAULT_MTDF
 #define ai_use_deepening AI_DEFAULT_DEEPENING
+#define ai_poll_nodes    AI_DEFAULT_POLL
 #else  /* ndef FIXED_PARAMS */
 extern int ai_use_tt;         /* size as a power of 2, or 0 to disable */
 extern int ai_use_mo;         /* use move reordering? (0, 1 or 2) */
@@ -29,6 +38,7 @@ extern int ai_use_killer;     /* use killer heuristic? (0 or 1) */
 extern int ai_use_pvs;        /* use principal variation search? (0 or 1) */
 extern int ai_use_mtdf;       /* use MTD(f)? (0 or 1) */
 extern int ai_use_deepening;  /* use iterative deepening (0 or increment) */
+extern int ai_poll_nodes;     /* nodes searched between checks of the time */
 #endif
 
 /* Limits on the search performed by the AI when selecting moves.
@@ -67,11 +77,130 @@ typedef struct AI_Result {
 	val_t  value;    /* value of the move at the last completed search */
 	int    depth;    /* maximum search depth completed */
 	int    eval;     /* total number of positions evaluated */
+	int    nodes;    /* total number of nodes searched */
 	double time;     /* total time used */
 	bool   aborted;  /* whether search was aborted */
 	bool   exact;    /* whether the entire game tree was searched */
 } AI_Result;
 
+/* Summary of one iteration of iterative deepening, as recorded in AI_Stats.
+   If the iteration was aborted, only depth, nodes, eval and time are valid. */
+typedef struct AI_Iteration {
+	int    depth;    /* search depth */
+	Move   move;     /* best move found */
+	val_t  value;    /* value of the best move */
+	bool   exact;    /* whether the value is exact */
+	bool   aborted;  /* whether the iteration was aborted */
+	int    nodes;    /* total nodes searched so far */
+	int    eval;     /* total positions evaluated so far */
+	double time;     /* total time used so far */
+	double predicted;  /* predicted time of the next iteration (if any) */
+} AI_Iteration;
+
+/* Number of plies (counted from the root) for which statistics are kept: */
+#define AI_STATS_PLIES (AI_MAX_DEPTH + 2)
+
+/* Number of move indices for which cut-offs are counted separately: */
+#define AI_STATS_INDICES 8
+
+/* Statistics on the last search performed by an engine. These are always
+   collected; the counters are cheap compared to the work per node. */
+typedef struct AI_Stats {
+	int       depth;                          /* maximum depth completed */
+	long long nodes[AI_STATS_PLIES];          /* nodes searched, by ply */
+	long long tt_hits[AI_STATS_PLIES];        /* values taken from the TT */
+	long long tt_partial[AI_STATS_PLIES];     /* positions found but searched */
+	long long tt_misses[AI_STATS_PLIES];      /* positions not in the TT */
+	long long cutoffs[AI_STATS_INDICES];      /* cut-offs, by move index (the
+	                                             last entry counts all later
+	                                             moves too) */
+	long long iterations[AI_MAX_DEPTH + 1];   /* nodes, by search depth */
+	int       iteration_count;                /* entries in iteration_log */
+	AI_Iteration iteration_log[AI_MAX_DEPTH + 1];  /* iterations performed */
+	long long stacks;          /* stacking moves executed (see GameStats) */
+	long long removal_checks;  /* searches for disconnected fields */
+	long long removal_visits;  /* fields visited during those searches */
+} AI_Stats;
+
+/* Size of an engine's move stack. Every ply of the search stores its moves
+   directly after those of its parent, using only as many entries as it has
+   moves, so the stack must hold the moves of all plies along a path from the
+   root, of which there are at most AI_PATH_PLIES (the extra plies account for
+   the root and the unique N'th move). Their total is bounded as follows:
+
+    - there are fewer than N placing moves to choose from, and a pass is the
+      only move when it is possible;
+    - after k stacking moves, there are at most k stacks of height 2 or more,
+      and the player to move has at most min(P, N - k) stacks (where P is
+      AI_PLAYER_STACKS, the number of pieces of each player);
+    - a stack of height 1 can move only if one of its neighbours is empty,
+      so it has at most 5 moves (and a taller stack at most 6).
+
+   So the position after k stacking moves has at most 5*P + min(k, P) moves
+   while k <= N - P, and at most 6*(N - k) moves after that. This is more than
+   for any placing move or pass, and less at k = AI_PATH_PLIES than at k = 0,
+   so no path has more moves than AI_PATH_PLIES stacking moves from k = 0, for
+   which the sum is computed below. One more entry is used temporarily when a
+   stage of moves is generated without the killer move (see generate_stage()).
+*/
+#define AI_PATH_PLIES    (AI_MAX_DEPTH + 2)
+#define AI_PLAYER_STACKS ((N - D)/2)
+#if AI_PATH_PLIES <= N - AI_PLAYER_STACKS || AI_PATH_PLIES > N
+#error "AI_MOVE_STACK_SIZE does not hold for this AI_MAX_DEPTH"
+#endif
+#define AI_MOVE_STACK_SIZE ( \
+	5*AI_PLAYER_STACKS*AI_PLAYER_STACKS + \
+	AI_PLAYER_STACKS*(AI_PLAYER_STACKS - 1)/2 + \
+	6*AI_PLAYER_STACKS*(N - 2*AI_PLAYER_STACKS + 1) + \
+	3*(AI_PLAYER_STACKS + N - AI_PATH_PLIES)* \
+	  (AI_PLAYER_STACKS + AI_PATH_PLIES - N - 1) + 1 )
+
+/* A search engine: the parameters and state of the search. Engines are
+   independent, so several can be used in one process (e.g. to play games
+   between different configurations, or to search in several threads), except
+   that they may share a transposition table. */
+typedef struct AI_Engine {
+	/* Search parameters (see the ai_use_* defaults above): */
+	int     use_mo;          /* use move reordering? (0, 1 or 2) */
+	int     use_killer;      /* use killer heuristic? (0 or 1) */
+	int     use_pvs;         /* use principal variation search? (0 or 1) */
+	int     use_mtdf;        /* use MTD(f)? (0 or 1) */
+	int     use_deepening;   /* use iterative deepening (0 or increment) */
+	int     poll_nodes;      /* nodes searched between checks of the time */
+	EvalWeights weights;     /* evaluation function weights */
+	TTable  *tt;             /* transposition table, or NULL to disable */
+
+	/* State kept between searches (see ai_reset()): */
+	int     start_depth;     /* iterative deepening start depth */
+	int     rng_seed;        /* seed used to shuffle moves (0 if not chosen) */
+	unsigned rng_state;      /* state of the RNG used to shuffle moves */
+	Predictor predictor;     /* model of the time taken by iterations */
+
+	/* State of the current search: */
+	volatile bool aborted;   /* flag to abort search */
+	double  deadline;        /* value of time_used() to abort at, or 0 */
+	int     poll_countdown;  /* nodes to search before checking the time */
+	int     eval_count;      /* states evaluated during this search */
+	int     node_count;      /* nodes visited during this search */
+	int     root_moves;      /* moves played at the root of this search */
+	AI_Stats stats;          /* statistics of the last search */
+	Move    move_stack[AI_MOVE_STACK_SIZE];  /* moves of all plies */
+} AI_Engine;
+
+/* Whether ai_select_move() aborts the search on a keyboard interrupt. This
+   installs a signal handler for the duration of the search, which is not
+   thread-safe, so it must be disabled when searching in several threads. */
+extern bool ai_interruptible;
+
+/* Initializes an engine with the default search parameters, using the given
+   transposition table (which may be NULL, which disables the table and the
+   killer heuristic, or shared with other engines). */
+void ai_engine_init(AI_Engine *engine, TTable *tt);
+
+/* Initializes an engine with the same parameters and transposition table as
+   `source', but a fresh search state. */
+void ai_engine_clone(AI_Engine *engine, const AI_Engine *source);
+
 /* Selects the next best move to make.
 
    Uses iterative deepening negamax search with various optimizations. If
@@ -79,18 +208,53 @@ typedef struct AI_Result {
    as described as above.
 
    The result of the search (most importantly the selected move) is stored in
-   `result'.
+   `result', and statistics on the search in engine->stats.
+
+   Different engines may search concurrently, in different threads, even if
+   they share a transposition table (entries are not locked, so a concurrent
+   update may corrupt an entry's value, but moves taken from the table are
+   always checked before they are played).
 
    This function returns false only if there are no moves to make. */
-bool ai_select_move( Board *board,
+bool ai_select_move( AI_Engine *engine, Board *board,
 	const AI_Limit *limit, AI_Result *result );
 
-/* Evaluates the current board. Mainly useful for analysis/debugging. */
+/* Resets the state that the engine keeps between calls to ai_select_move():
+   the iterative deepening start depth, the seed used to shuffle moves (which
+   is chosen again using rand() when next needed) and the transposition table.
+   Afterwards, searches are reproducible given the RNG seed. */
+void ai_reset(AI_Engine *engine);
+
+/* Resets the state kept between calls to ai_select_move(), like ai_reset(),
+   but keeps the transposition table (which may be in use by other engines).
+   Used before searching an unrelated position. */
+void ai_reset_search(AI_Engine *engine);
+
+/* Returns the effective branching factor of a search, as estimated from the
+   number of nodes searched by the last two iterations completed (not counting
+   the first iteration), or 0 if too few iterations were completed. */
+double ai_stats_ebf(const AI_Stats *stats);
+
+/* Writes the given statistics to `fp' as a single-line JSON object. */
+void ai_stats_print_json(FILE *fp, const AI_Stats *stats);
+
+/* Evaluates the current board with the default evaluation weights. Mainly
+   useful for analysis/debugging. */
 val_t ai_evaluate(const Board *board);
 
+/* Evaluates `count' positions given as 50-byte descriptors (as written by
+   serialize_board()) and stores the results in `values'. Each descriptor is
+   unpacked into a scratch board and evaluated as by ai_evaluate(); invalid
+   descriptors are given value 0. If `nthread' > 1 (and the program was
+   compiled with THREADS) the work is divided between that many threads.
+   Intended for tuning and data generation. */
+void ai_evaluate_batch( const unsigned char (*records)[50], int count,
+	val_t *values, int nthread );
+
 /* Attempts to extract the first `nmove' moves of the principal variation for
-   the given state from the transposition table and returns how many moves
-   could be extracted, which may be less than requested. */
-int ai_extract_pv(Board *board, Move *moves, int nmove);
+   the given state from the engine's transposition table and returns how many
+   moves could be extracted, which may be less than requested. */
+int ai_extract_pv( const AI_Engine *engine, Board *board,
+	Move *moves, int nmove );
 
 #endif /* ndef AI_H_INCLUDED */
@@ -0,0 +1,501 @@
+#include "Analysis.h"
+#include "IO.h"
+#include "Server.h"
+#include "Telemetry.h"
+#include "Threads.h"
+#include "Time.h"
+#include "Workers.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* Characters separating the words of a request: */
+#define REQUEST_SEPARATORS " \t\r\n"
+
+/* Client of the service, shared by the requests it submitted: */
+typedef struct Client {
+	FILE     *in, *out;  /* requests are read from `in', replies to `out' */
+	AI_Limit limit;      /* default limits */
+	int      refs;       /* requests pending, plus one while reading */
+#ifdef THREADS
+	pthread_mutex_t mutex;  /* serializes replies */
+#endif
+} Client;
+
+/* A request waiting to be analyzed: */
+typedef struct Request {
+	struct Request *next;    /* next request in the queue */
+	Client         *client;  /* client that submitted the request */
+	char           id[64];   /* request id */
+	Board          board;    /* position to analyze */
+	AI_Limit       limit;    /* search limits */
+} Request;
+
+/* Engine copied by the workers (set by pool_start()): */
+static const AI_Engine *pool_engine = NULL;
+
+#ifdef THREADS
+/* Worker pool, with a queue of requests shared by all workers: */
+static struct Pool {
+	pthread_mutex_t mutex;
+	pthread_cond_t  queued;    /* signalled when a request is queued */
+	pthread_cond_t  idle;      /* signalled when no requests are pending */
+	Request         *head, *tail;
+	int             pending;   /* requests queued or being analyzed */
+	bool            stopping;  /* whether workers should exit when idle */
+	int             nthread;
+	pthread_t       threads[AI_MAX_THREADS];
+} pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+           PTHREAD_COND_INITIALIZER, NULL, NULL, 0, false, 0, { 0 } };
+#else
+/* Engine used to analyze requests directly: */
+static AI_Engine inline_engine;
+#endif
+
+/* Writes a reply line to a client. */
+static void send_reply(Client *client, const char *line)
+{
+#ifdef THREADS
+	pthread_mutex_lock(&client->mutex);
+#endif
+	fputs(line, client->out);
+	fputc('\n', client->out);
+	fflush(client->out);
+#ifdef THREADS
+	pthread_mutex_unlock(&client->mutex);
+#endif
+}
+
+/* Releases a reference to a client, and closes the connection when the last
+   reference is released. */
+static void client_release(Client *client)
+{
+	if (__sync_sub_and_fetch(&client->refs, 1) > 0) return;
+	fclose(client->in);
+	fclose(client->out);
+#ifdef THREADS
+	pthread_mutex_destroy(&client->mutex);
+#endif
+	free(client);
+}
+
+/* Size of the buffer for a reply (not including the id): */
+#define REPLY_SIZE 512
+
+/* Analyzes `board' with the given engine and limits, and writes the result
+   (formatted as a reply, as described in Analysis.h, but without the id) to
+   `reply'. */
+static void analyze_position( AI_Engine *engine, Board *board,
+	const AI_Limit *limit, char reply[REPLY_SIZE] )
+{
+	AI_Result result;
+	Move pv[AI_MAX_DEPTH];
+	int n, npv, len;
+
+	ai_reset_search(engine);
+	if (!ai_select_move(engine, board, limit, &result)) {
+		snprintf(reply, REPLY_SIZE, "error no moves available");
+		return;
+	}
+	telemetry_search(engine, board, limit, &result);
+
+	/* The root entry may have been replaced by another search, so the
+	   principal variation is extracted after the selected move: */
+	pv[0] = result.move;
+	board_do(board, &pv[0]);
+	npv = 1 + ai_extract_pv(engine, board, pv + 1, AI_MAX_DEPTH - 1);
+	board_undo(board, &pv[0]);
+
+	len = snprintf(reply, REPLY_SIZE, "bestmove %s value "VAL_FMT" depth %d"
+		" exact %d nodes %d evals %d time %.3f pv", format_move(&result.move),
+		result.value, result.depth, (int)result.exact, result.nodes,
+		result.eval, result.time);
+	for (n = 0; n < npv && len < REPLY_SIZE - 6; ++n) {
+		len += sprintf(reply + len, " %s", format_move(&pv[n]));
+	}
+}
+
+/* Analyzes a request, sends the reply, and frees the request. */
+static void analyze_request(AI_Engine *engine, Request *req)
+{
+	char reply[REPLY_SIZE], line[sizeof(req->id) + REPLY_SIZE];
+
+	analyze_position(engine, &req->board, &req->limit, reply);
+	snprintf(line, sizeof(line), "%s %s", req->id, reply);
+	send_reply(req->client, line);
+	client_release(req->client);
+	free(req);
+}
+
+#ifdef THREADS
+/* Thread function of the workers: analyzes queued requests until the pool is
+   stopped. */
+static void *worker(void *arg)
+{
+	AI_Engine engine;
+	Request *req;
+
+	(void)arg;  /* unused */
+	ai_engine_clone(&engine, pool_engine);
+	pthread_mutex_lock(&pool.mutex);
+	for (;;) {
+		while (pool.head == NULL && !pool.stopping) {
+			pthread_cond_wait(&pool.queued, &pool.mutex);
+		}
+		if (pool.head == NULL) break;
+		req = pool.head;
+		pool.head = req->next;
+		if (pool.head == NULL) pool.tail = NULL;
+		pthread_mutex_unlock(&pool.mutex);
+		analyze_request(&engine, req);
+		pthread_mutex_lock(&pool.mutex);
+		if (--pool.pending == 0) pthread_cond_broadcast(&pool.idle);
+	}
+	pthread_mutex_unlock(&pool.mutex);
+	return NULL;
+}
+#endif
+
+/* Starts the worker pool, with copies of the given engine. */
+static void pool_start(const AI_Engine *engine, int nthread)
+{
+	ai_interruptible = false;
+	pool_engine = engine;
+#ifdef THREADS
+	if (nthread < 1) nthread = 1;
+	if (nthread > AI_MAX_THREADS) nthread = AI_MAX_THREADS;
+	pool.stopping = false;
+	for (pool.nthread = 0; pool.nthread < nthread; ++pool.nthread) {
+		if (pthread_create( &pool.threads[pool.nthread], NULL,
+		                    worker, NULL ) != 0) {
+			perror("pthread_create");
+			break;
+		}
+	}
+	if (pool.nthread == 0) {
+		fprintf(stderr, "Couldn't start any worker threads!\n");
+		exit(EXIT_FAILURE);
+	}
+	fprintf(stderr, "Started %d worker thread%s.\n", pool.nthread,
+		pool.nthread == 1 ? "" : "s");
+#else
+	(void)nthread;  /* ignored */
+	ai_engine_clone(&inline_engine, engine);
+#endif
+}
+
+/* Waits until all pending requests have been answered, and stops the worker
+   pool. */
+static void pool_stop(void)
+{
+#ifdef THREADS
+	int t;
+
+	pthread_mutex_lock(&pool.mutex);
+	while (pool.pending > 0) pthread_cond_wait(&pool.idle, &pool.mutex);
+	pool.stopping = true;
+	pthread_cond_broadcast(&pool.queued);
+	pthread_mutex_unlock(&pool.mutex);
+	for (t = 0; t < pool.nthread; ++t) pthread_join(pool.threads[t], NULL);
+	pool.nthread = 0;
+#endif
+}
+
+/* Submits a request for analysis by the worker pool (or analyzes it directly
+   if compiled without THREADS). */
+static void submit(Request *req)
+{
+	__sync_add_and_fetch(&req->client->refs, 1);
+#ifdef THREADS
+	req->next = NULL;
+	pthread_mutex_lock(&pool.mutex);
+	if (pool.tail) pool.tail->next = req; else pool.head = req;
+	pool.tail = req;
+	++pool.pending;
+	pthread_cond_signal(&pool.queued);
+	pthread_mutex_unlock(&pool.mutex);
+#else
+	analyze_request(&inline_engine, req);
+#endif
+}
+
+/* Parses a request line and submits it, or replies with an error if the
+   request is invalid. */
+static void handle_request(Client *client, char *line)
+{
+	char reply[1024];
+	char *id, *state, *arg, *save;
+	Color next_player;
+	Request *req;
+
+	id = strtok_r(line, REQUEST_SEPARATORS, &save);
+	if (id == NULL) return;  /* empty line */
+	state = strtok_r(NULL, REQUEST_SEPARATORS, &save);
+	if (strlen(id) >= sizeof(req->id)) {
+		snprintf(reply, sizeof(reply), "%.32s... error id too long", id);
+		send_reply(client, reply);
+		return;
+	}
+	if (state == NULL) {
+		snprintf(reply, sizeof(reply), "%s error missing state", id);
+		send_reply(client, reply);
+		return;
+	}
+	req = malloc(sizeof(Request));
+	if (req == NULL) {
+		snprintf(reply, sizeof(reply), "%s error out of memory", id);
+		send_reply(client, reply);
+		return;
+	}
+	req->client = client;
+	strcpy(req->id, id);
+	req->limit.depth = 0;
+	req->limit.eval  = 0;
+	req->limit.time  = 0;
+	if (!parse_state(state, &req->board, &next_player)) {
+		snprintf(reply, sizeof(reply), "%s error could not parse state", id);
+		goto failed;
+	}
+	if (next_player == NONE) {
+		snprintf(reply, sizeof(reply), "%s error game over", id);
+		goto failed;
+	}
+	while ((arg = strtok_r(NULL, REQUEST_SEPARATORS, &save)) != NULL) {
+		if (sscanf(arg, "depth=%d", &req->limit.depth) == 1) continue;
+		if (sscanf(arg, "eval=%d", &req->limit.eval) == 1) continue;
+		if (sscanf(arg, "time=%lf", &req->limit.time) == 1) continue;
+		snprintf(reply, sizeof(reply), "%s error invalid argument: %s",
+			id, arg);
+		goto failed;
+	}
+	if (!req->limit.depth && !req->limit.eval && !req->limit.time) {
+		req->limit = client->limit;
+		if (!req->limit.depth && !req->limit.eval && !req->limit.time) {
+			snprintf(reply, sizeof(reply), "%s error no limits given", id);
+			goto failed;
+		}
+	}
+	submit(req);
+	return;
+
+failed:
+	send_reply(client, reply);
+	free(req);
+}
+
+/* Reads and submits requests from a client until the end of input. */
+static void read_requests(Client *client)
+{
+	char line[1024];
+
+	while (fgets(line, sizeof(line), client->in) != NULL) {
+		handle_request(client, line);
+	}
+}
+
+void analysis_run( const AI_Engine *engine, FILE *in, FILE *out,
+	const AI_Limit *limit, int nthread )
+{
+	Client client;
+
+	client.in    = in;
+	client.out   = out;
+	client.limit = *limit;
+	client.refs  = 1;  /* never released: in and out are not ours to close */
+#ifdef THREADS
+	pthread_mutex_init(&client.mutex, NULL);
+#endif
+	pool_start(engine, nthread);
+	read_requests(&client);
+	pool_stop();
+#ifdef THREADS
+	pthread_mutex_destroy(&client.mutex);
+#endif
+}
+
+#ifdef THREADS
+/* Thread function serving a single connection. */
+static void *serve_client(void *arg)
+{
+	Client *client = arg;
+
+	read_requests(client);
+	client_release(client);
+	return NULL;
+}
+#endif
+
+bool analysis_listen( const AI_Engine *engine, const char *path,
+	const AI_Limit *limit, int nthread )
+{
+	int fd = server_socket(path), conn;
+	Client *client;
+
+	if (fd < 0) return false;
+	pool_start(engine, nthread);
+	for (;;) {
+		conn = accept(fd, NULL, NULL);
+		if (conn < 0) {
+			perror("accept");
+			continue;
+		}
+		client = malloc(sizeof(Client));
+		if (client == NULL) {
+			close(conn);
+			continue;
+		}
+		client->in    = fdopen(conn, "r");
+		client->out   = fdopen(dup(conn), "w");
+		client->limit = *limit;
+		client->refs  = 1;
+		if (client->in == NULL || client->out == NULL) {
+			perror("fdopen");
+			if (client->in != NULL) fclose(client->in);
+			if (client->out != NULL) fclose(client->out);
+			free(client);
+			continue;
+		}
+#ifdef THREADS
+		{
+			pthread_t thread;
+
+			pthread_mutex_init(&client->mutex, NULL);
+			if (pthread_create(&thread, NULL, serve_client, client) != 0) {
+				perror("pthread_create");
+				client_release(client);
+				continue;
+			}
+			pthread_detach(thread);
+		}
+#else
+		read_requests(client);
+		client_release(client);
+#endif
+	}
+}
+
+/* Positions analyzed by analysis_file(), shared by its threads: */
+typedef struct FileTask {
+	char           (*lines)[REPLY_SIZE];  /* states, replaced by replies */
+	bool           *done;     /* whether each reply is ready */
+	int            count;     /* number of positions */
+	int            next;      /* index of the next position (atomic) */
+	int            written;   /* number of replies written */
+	const AI_Engine *engine;  /* engine copied by each thread */
+	const AI_Limit *limit;    /* search limits */
+	FILE           *out;      /* replies are written here */
+#ifdef THREADS
+	pthread_mutex_t mutex;    /* serializes output */
+#endif
+} FileTask;
+
+/* Thread function for analysis_file(): analyzes positions, and writes all
+   replies that are ready in order of input. */
+static void *analyze_lines(void *arg)
+{
+	FileTask *task = arg;
+	AI_Engine engine;
+	char reply[REPLY_SIZE];
+	Board board;
+	Color next_player;
+	int n;
+
+	ai_engine_clone(&engine, task->engine);
+	while ((n = __sync_fetch_and_add(&task->next, 1)) < task->count) {
+		if (!parse_state(task->lines[n], &board, &next_player)) {
+			snprintf(reply, sizeof(reply), "error could not parse state");
+		} else if (next_player == NONE) {
+			snprintf(reply, sizeof(reply), "error game over");
+		} else {
+			analyze_position(&engine, &board, task->limit, reply);
+		}
+#ifdef THREADS
+		pthread_mutex_lock(&task->mutex);
+#endif
+		strcpy(task->lines[n], reply);
+		task->done[n] = true;
+		while (task->written < task->count && task->done[task->written]) {
+			fprintf(task->out, "%s\n", task->lines[task->written++]);
+		}
+		fflush(task->out);
+#ifdef THREADS
+		pthread_mutex_unlock(&task->mutex);
+#endif
+	}
+	return NULL;
+}
+
+/* Reads the first word of each non-empty line of the given file into a newly
+   allocated array, and returns the number of lines read (or -1 on failure). */
+static int read_states(const char *path, char (**lines)[REPLY_SIZE])
+{
+	char line[1024], *word;
+	int count = 0, capacity = 0;
+	FILE *fp = fopen(path, "rt");
+
+	*lines = NULL;
+	if (fp == NULL) return -1;
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		word = strtok(line, REQUEST_SEPARATORS);
+		if (word == NULL) continue;
+		if (count == capacity) {
+			char (*grown)[REPLY_SIZE];
+
+			capacity = capacity ? 2*capacity : 1024;
+			grown = realloc(*lines, capacity*sizeof(**lines));
+			if (grown == NULL) {
+				count = -1;
+				break;
+			}
+			*lines = grown;
+		}
+		snprintf((*lines)[count++], REPLY_SIZE, "%s", word);
+	}
+	fclose(fp);
+	return count;
+}
+
+bool analysis_file( const AI_Engine *engine, const char *path, FILE *out,
+	const AI_Limit *limit, int nthread )
+{
+	FileTask task;
+	double start = time_used(), used;
+
+	if (!limit->depth && !limit->eval && !limit->time) {
+		fprintf(stderr, "No search limits given!\n");
+		return false;
+	}
+	task.count = read_states(path, &task.lines);
+	if (task.count < 0) {
+		fprintf(stderr, "Couldn't read positions from %s!\n", path);
+		free(task.lines);
+		return false;
+	}
+	task.done = calloc(task.count + 1, sizeof(bool));
+	if (task.done == NULL) {
+		fprintf(stderr, "Failed to allocate memory for %d positions!\n",
+			task.count);
+		free(task.lines);
+		return false;
+	}
+	task.next    = 0;
+	task.written = 0;
+	task.engine  = engine;
+	task.limit   = limit;
+	task.out     = out;
+#ifdef THREADS
+	pthread_mutex_init(&task.mutex, NULL);
+#endif
+	nthread = workers_run(analyze_lines, &task, nthread);
+#ifdef THREADS
+	pthread_mutex_destroy(&task.mutex);
+#endif
+	used = time_used() - start;
+	fprintf(stderr, "%d positions analyzed in %.3fs using %d thread%s: "
+		"%.1f positions/second\n", task.count, used, nthread,
+		nthread == 1 ? "" : "s", used > 0 ? task.count/used : 0.0);
+	free(task.done);
+	free(task.lines);
+	return true;
+}
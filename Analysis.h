@@ -0,0 +1,49 @@
+#ifndef ANALYSIS_H_INCLUDED
+#define ANALYSIS_H_INCLUDED
+
+#include "AI.h"
+#include <stdio.h>
+
+/* The analysis service analyzes positions submitted by clients, many at a
+   time. Each request is a single line of the form:
+
+	<id> <state> [depth=<d>] [eval=<n>] [time=<s>]
+
+   where <id> is a word chosen by the client to identify the request, <state>
+   is a state description as per ENCODING.txt, and the limits are as for
+   AI_Limit (if none are given, the limits passed to the service are used).
+   Each request is answered with a single line starting with its id:
+
+	<id> bestmove <move> value <value> depth <depth> exact <0|1> nodes <nodes>
+	     evals <evals> time <time> pv <move>..
+	<id> error <message>
+
+   Requests are analyzed by a pool of worker threads, each with its own engine
+   (a copy of the engine passed to the service, sharing its transposition
+   table), and each reply is sent as soon as the analysis has finished, so the
+   order of replies may differ from the order of requests. (When compiled
+   without THREADS, requests are analyzed one at a time, in order.) */
+
+/* Serves requests read from `in', writing replies to `out', using `nthread'
+   worker threads with copies of `engine' and `limit' as the default limits.
+   Returns after the end of input has been reached and all requests have been
+   answered. */
+void analysis_run( const AI_Engine *engine, FILE *in, FILE *out,
+	const AI_Limit *limit, int nthread );
+
+/* Listens on a UNIX domain socket created at `path' and serves requests from
+   all connections concurrently, as analysis_run() does. Returns only if the
+   socket could not be set up. */
+bool analysis_listen( const AI_Engine *engine, const char *path,
+	const AI_Limit *limit, int nthread );
+
+/* Analyzes the positions in the file at `path', which contains one state
+   description per line, with the given limits, using `nthread' threads (with
+   copies of `engine', sharing its transposition table). For each position, a
+   reply as described above (but without the id) is written to `out', in the
+   order of the input. Prints the number of positions analyzed per second.
+   Returns false if no limits were given or the file could not be read. */
+bool analysis_file( const AI_Engine *engine, const char *path, FILE *out,
+	const AI_Limit *limit, int nthread );
+
+#endif /* ndef ANALYSIS_H_INCLUDED */
@@ -0,0 +1,115 @@
+#include "Bench.h"
+#include "AI.h"
+#include "IO.h"
+#include "Time.h"
+#include "TT.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Fills `records' with `count' serialized positions, taken from games in which
+   both players select moves uniformly at random (using rand()). */
+static void random_positions(unsigned char (*records)[50], int count)
+{
+	Board board;
+	Move moves[M];
+	int nmove, n = 0;
+
+	while (n < count) {
+		board_clear(&board);
+		while (n < count && generate_all_moves(&board, NULL) > 0) {
+			nmove = generate_moves(&board, moves);
+			board_do(&board, &moves[rand()%nmove]);
+			if (board.moves > D) serialize_board(&board, records[n++]);
+		}
+	}
+}
+
+void bench_eval(int count, int nthread)
+{
+	unsigned char (*records)[50];
+	val_t *values;
+	double start, used;
+	long long sum = 0;
+	int n;
+
+	records = malloc(count*sizeof(*records));
+	values  = malloc(count*sizeof(*values));
+	if (records == NULL || values == NULL) {
+		fprintf(stderr, "Failed to allocate memory for %d positions!\n", count);
+		exit(EXIT_FAILURE);
+	}
+	random_positions(records, count);
+
+	start = time_used();
+	ai_evaluate_batch((const unsigned char (*)[50])records, count,
+		values, nthread);
+	used = time_used() - start;
+
+	/* The sum of values is printed to verify that results are consistent: */
+	for (n = 0; n < count; ++n) sum += values[n];
+	printf("%d evaluations in %.3fs using %d thread%s: "
+		"%.0f evaluations/second (checksum: %lld)\n",
+		count, used, nthread, nthread == 1 ? "" : "s",
+		used > 0 ? count/used : 0.0, sum);
+
+	free(values);
+	free(records);
+}
+
+/* Seed used to initialize the RNG for bench_search(): */
+#define BENCH_SEED 12345
+
+/* Positions searched by bench_search(), with their search depths: */
+static const struct BenchPosition {
+	const char *descr;  /* game phase described */
+	const char *state;  /* state description, as per ENCODING.txt */
+	int depth;          /* search depth */
+} bench_positions[] = {
+	{ "opening",   "BAAAAAAABAAAAAAAAAAAAABAACAAAAADAAAAAAAAAABAAAAAAA", 6 },
+	{ "placement", "BAAAAAAAAAACCCDCCCDAADBDDCCCBDAADDCBDDDCAAADCDCAAA", 7 },
+	{ "stacking",  "CDADCCDDDCACHCDCCCDDDGBDDCCCBDCCDDCBDDDCCAHGADCCCD", 7 },
+	{ "middle",    "CAAAACDDDCAAKAGLCCDDDABKDCCCBDCCDDCBDDDHCAHGADCCCA", 8 },
+	{ "middle",    "CAAAACADDAAAKAGLHCADAABKAHCCBDCHDDCBDGKHCAHGADCACA", 9 },
+	{ "endgame",   "CAAAACAAAAAAKAGaAAAAAABKAHCCBAAHDDCBDGTHAAHGAAHACA", 12 },
+	{ "endgame",   "CAAAACAAAAAAKAAaAAAAAABTATACBAAHDDCBKPWAAAAGAAAAAA", 16 } };
+
+#define BENCH_POSITIONS (int)(sizeof(bench_positions)/sizeof(*bench_positions))
+
+void bench_search(AI_Engine *engine)
+{
+	long long total_nodes = 0;
+	double total_time = 0;
+	int n;
+
+	srand(BENCH_SEED);
+	printf(" # phase      depth  move       value       nodes    time"
+		"          nps\n");
+	for (n = 0; n < BENCH_POSITIONS; ++n) {
+		const struct BenchPosition *pos = &bench_positions[n];
+		AI_Limit limit = { pos->depth, 0, 0.0 };
+		AI_Result result;
+		Board board;
+		Color next_player;
+
+		if (!parse_state(pos->state, &board, &next_player)) {
+			fprintf(stderr, "Couldn't parse state: `%s'!\n", pos->state);
+			exit(EXIT_FAILURE);
+		}
+		ai_reset(engine);
+		if (!ai_select_move(engine, &board, &limit, &result)) {
+			fprintf(stderr, "No moves available in state: `%s'!\n",
+				pos->state);
+			exit(EXIT_FAILURE);
+		}
+		printf("%2d %-10s %5d  %-7s %8d %11d %6.3fs %12.0f\n", n + 1,
+			pos->descr, result.depth, format_move(&result.move),
+			(int)result.value, result.nodes, result.time,
+			result.time > 0 ? result.nodes/result.time : 0.0);
+		total_nodes += result.nodes;
+		total_time  += result.time;
+	}
+	printf("Total: %lld nodes in %.3fs: %.0f nodes/second\n",
+		total_nodes, total_time,
+		total_time > 0 ? total_nodes/total_time : 0.0);
+	printf("Signature: %lld\n", total_nodes);
+}
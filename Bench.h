@@ -0,0 +1,19 @@
+#ifndef BENCH_H_INCLUDED
+#define BENCH_H_INCLUDED
+
+#include "AI.h"
+
+/* Measures the throughput of ai_evaluate_batch() by evaluating `count'
+   positions taken from random games (which depend on the RNG seed) using
+   `nthread' threads, and prints the number of evaluations per second. */
+void bench_eval(int count, int nthread);
+
+/* Searches a fixed set of positions (from all phases of the game) to fixed
+   depths with a fixed RNG seed, and prints the nodes searched, time used and
+   nodes per second for each, followed by the totals. The total node count
+   depends only on the search algorithm and its parameters (not on the speed of
+   the host) and thus serves as a signature to verify that builds are
+   equivalent. N.B. this resets the engine's state (see ai_reset()). */
+void bench_search(AI_Engine *engine);
+
+#endif /* ndef BENCH_H_INCLUDED */
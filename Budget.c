@@ -0,0 +1,96 @@
+#include "Budget.h"
+#include <math.h>
+
+/* Typical number of moves available in the stacking phase (the median over
+   positions from self-play games): */
+#define TYPICAL_MOVES 28
+
+/* Additional time allocated in proportion to the fraction of moves that
+   disconnect fields: */
+#define THREAT_WEIGHT 0.5
+
+/* Bounds on the complexity factor: */
+#define MIN_FACTOR 0.5
+#define MAX_FACTOR 2.0
+
+/* Factor used when at most this many moves are available: */
+#define FEW_MOVES         2
+#define FEW_MOVES_FACTOR  0.25
+
+/* Maximum fraction of the time left to spend on a single move: */
+#define MAX_FRACTION 0.25
+
+/* Returns an estimate of the maximum number of moves left for the player in
+   the stacking phase. This is not a strict upperbound, but overestimates more
+   often than not. The number of moves in the game is divided by 2 because I
+   play half of the moves (and my opponent the other half) and 10 is subtracted
+   for overestimation and the fact that last few moves are trivial. */
+static int max_moves_left(const Board *board)
+{
+	int n, res = 0;
+
+	for (n = 0; n < N; ++n) {
+		/* Assume stacks of at most five pieces can move. */
+		if (!board->fields[n].removed && board->fields[n].pieces <= 5) ++res;
+	}
+	res = res/2 - 10;
+	return res < 2 ? 2 : res;
+}
+
+/* Counts the moves that cause fields other than the source field to be
+   removed (because they are disconnected from all Dvonn pieces). */
+static int count_threats(const Board *board, const Move *moves, int nmove)
+{
+	Board tmp = *board;
+	int n, res = 0, alive = __builtin_popcountll(board->alive);
+
+	for (n = 0; n < nmove; ++n) {
+		if (move_passes(&moves[n])) continue;
+		board_do(&tmp, &moves[n]);
+		if (__builtin_popcountll(tmp.alive) < alive - 1) ++res;
+		board_undo(&tmp, &moves[n]);
+	}
+	return res;
+}
+
+void budget_move(const Board *board, double time_left, Budget *budget)
+{
+	Move moves[M];
+	double factor;
+
+	budget->moves      = generate_moves(board, moves);
+	budget->threats    = count_threats(board, moves, budget->moves);
+	budget->moves_left = max_moves_left(board);
+	budget->base       = time_left/budget->moves_left;
+
+	if (budget->moves <= FEW_MOVES) {
+		factor = FEW_MOVES_FACTOR;
+	} else {
+		factor = sqrt((double)budget->moves/TYPICAL_MOVES)*
+			(1 + THREAT_WEIGHT*budget->threats/budget->moves);
+		if (factor < MIN_FACTOR) factor = MIN_FACTOR;
+		if (factor > MAX_FACTOR) factor = MAX_FACTOR;
+	}
+	budget->factor = factor;
+	budget->time   = factor*budget->base;
+	if (budget->time > MAX_FRACTION*time_left) {
+		budget->time = MAX_FRACTION*time_left;
+	}
+	if (budget->time < 1e-3) budget->time = 1e-3;  /* out of time! */
+}
+
+bool budget_limit( const Board *board, double time_left,
+	AI_Limit *limit, Budget *budget )
+{
+	if (board->moves < N) {  /* placement phase */
+		limit->eval  = 1000;
+		limit->depth = N - board->moves;
+		limit->time  = 0;
+		return false;
+	}
+	budget_move(board, time_left, budget);
+	limit->eval  = 0;
+	limit->depth = 0;
+	limit->time  = budget->time;
+	return true;
+}
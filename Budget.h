@@ -0,0 +1,32 @@
+#ifndef BUDGET_H_INCLUDED
+#define BUDGET_H_INCLUDED
+
+#include "Game.h"
+#include "AI.h"
+
+/* Time allocated to a single move in the stacking phase, and the quantities
+   it was derived from (so that allocation decisions can be reviewed). */
+typedef struct Budget {
+	int    moves_left;  /* estimated number of moves left for the player */
+	int    moves;       /* number of moves available */
+	int    threats;     /* number of moves that disconnect other fields */
+	double base;        /* time left divided by moves_left */
+	double factor;      /* complexity factor applied to the base time */
+	double time;        /* time allocated */
+} Budget;
+
+/* Allocates time for the next move on `board' (which must be in the stacking
+   phase) given the total time left for the rest of the game. Positions with
+   more moves available or more moves that disconnect fields get more time,
+   and positions with few moves available get less. */
+void budget_move(const Board *board, double time_left, Budget *budget);
+
+/* Sets `*limit' to the search limits used in matches for the next move on
+   `board', given the total time left for the rest of the game. In the
+   placement phase, search is limited by depth and number of evaluations only;
+   in the stacking phase, time is allocated with budget_move() (which stores
+   its details in `*budget'). Returns whether time was allocated. */
+bool budget_limit( const Board *board, double time_left,
+	AI_Limit *limit, Budget *budget );
+
+#endif /* ndef BUDGET_H_INCLUDED */
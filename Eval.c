@@ -1,9 +1,9 @@
 #include "Eval.h"
+#include "Threads.h"
 #include <math.h>
 #include <assert.h>
 
-#ifndef FIXED_PARAMS
-struct EvalWeights eval_weights = {
+EvalWeights eval_weights = {
 	EVAL_DEFAULT_WEIGHT_STACKS,
 	EVAL_DEFAULT_WEIGHT_MOVES,
 	EVAL_DEFAULT_WEIGHT_TO_LIFE,
@@ -11,7 +11,6 @@ struct EvalWeights eval_weights = {
 	EVAL_DEFAULT_WEIGHT_FIELD_BASE,
 	EVAL_DEFAULT_WEIGHT_FIELD_BONUS,
 	EVAL_DEFAULT_WEIGHT_FIELD_SHIFT };
-#endif
 
 int eval_dvonn_spread(const Board *board)
 {
@@ -33,9 +32,9 @@ int eval_dvonn_spread(const Board *board)
 /* Evaluate the board during the placing phase. */
 val_t eval_placing(const Board *board)
 {
-	static long long prev_dvonns = -1LL;
-	static int min_dist_to_dvonn[N];
-	static int tot_dist_to_dvonn[N];
+	static THREAD_LOCAL long long prev_dvonns = -1LL;
+	static THREAD_LOCAL int min_dist_to_dvonn[N];
+	static THREAD_LOCAL int tot_dist_to_dvonn[N];
 
 	int n, player = next_player(board);
 	val_t score[2] = { 0, 0 };
@@ -61,6 +60,7 @@ val_t eval_placing(const Board *board)
 				}
 			}
 		}
+		prev_dvonns = board->dvonns;
 	}
 
 	/* Scan board for player's stones and value them: */
@@ -97,26 +97,43 @@ val_t eval_placing(const Board *board)
 }
 
 /* Evaluate a board during the stacking phase. */
-val_t eval_stacking(const Board *board, bool *exact)
+val_t eval_stacking(const Board *board, const EvalWeights *weights, bool *exact)
 {
-	static val_t field_value[N];
-	static long long prev_dvonns = -1LL;
+	static THREAD_LOCAL val_t field_value[N];
+	static THREAD_LOCAL long long prev_dvonns = -1LL;
+#ifndef FIXED_PARAMS
+	static THREAD_LOCAL EvalWeights prev_weights;
+#endif
 
 	int n, m;
-	const int *step;
+	long long dsts;
 	const Field *f, *g;
 	int player = next_player(board);
 	bool game_over = true;
 	val_t score = 0, stacks = 0, moves = 0, to_life = 0, to_enemy = 0;
 
+#ifndef FIXED_PARAMS
+	/* The field values depend on the weights too, which may differ between
+	   calls (e.g. when engines with different weights play each other): */
+	if ( weights->field_base  != prev_weights.field_base  ||
+	     weights->field_bonus != prev_weights.field_bonus ||
+	     weights->field_shift != prev_weights.field_shift ) {
+		prev_weights = *weights;
+		prev_dvonns = -1LL;
+	}
+#else
+	(void)weights;  /* unused */
+#endif
 	if (board->dvonns != prev_dvonns) {
 		/* Recalculate value of fields: */
-		for (n = 0; n < N; ++n) field_value[n] = EVAL_WEIGHT_FIELD_BASE;
+		for (n = 0; n < N; ++n) {
+			field_value[n] = EVAL_WEIGHT_FIELD_BASE(weights);
+		}
 		for (n = 0; n < N; ++n) {
 			if (board->fields[n].dvonns) {
 				for (m = 0; m < N; ++m) {
-					field_value[m] += EVAL_WEIGHT_FIELD_BONUS >>
-						(EVAL_WEIGHT_FIELD_SHIFT*distance(n, m));
+					field_value[m] += EVAL_WEIGHT_FIELD_BONUS(weights) >>
+						(EVAL_WEIGHT_FIELD_SHIFT(weights)*distance(n, m));
 				}
 			}
 		}
@@ -127,12 +144,12 @@ val_t eval_stacking(const Board *board, bool *exact)
 	do {                                                                      \
 		score  X f->pieces;                                                   \
 		stacks X field_value[n];                                              \
-		for (step = board_steps[f->pieces][n]; *step; ++step) {               \
-			m = n + *step;                                                    \
-			g = f + *step;                                                    \
-			if (g->removed) continue;                                         \
+		dsts = board_step_masks[f->pieces][n] & board->alive;                 \
+		if (f->mobile && dsts) game_over = false;                             \
+		for ( ; dsts; dsts &= dsts - 1) {                                     \
+			m = mask_first(dsts);                                             \
+			g = &board->fields[m];                                            \
 			if (f->mobile) {                                                  \
-				game_over = false;                                            \
 				if (g->dvonns) to_life X field_value[m];                      \
 				if ((f->player ^ g->player) > 0) to_enemy X field_value[m];   \
 			}                                                                 \
@@ -148,10 +165,25 @@ val_t eval_stacking(const Board *board, bool *exact)
 
 	if (game_over) return 1000000*score;
 	*exact = false;
-	return stacks   * EVAL_WEIGHT_STACKS
-	     + moves    * EVAL_WEIGHT_MOVES
-	     + to_life  * EVAL_WEIGHT_TO_LIFE
-	     + to_enemy * EVAL_WEIGHT_TO_ENEMY;
+	return stacks   * EVAL_WEIGHT_STACKS(weights)
+	     + moves    * EVAL_WEIGHT_MOVES(weights)
+	     + to_life  * EVAL_WEIGHT_TO_LIFE(weights)
+	     + to_enemy * EVAL_WEIGHT_TO_ENEMY(weights);
 
 #undef EVAL_FIELD
 }
+
+val_t eval_position( const Board *board, const EvalWeights *weights,
+	bool *exact )
+{
+	if (board->moves >= N) {  /* stacking phase */
+		return eval_stacking(board, weights, exact);
+	} else {  /* placement phase */
+		*exact = false;
+		if (board->moves > D) {  /* some player's pieces placed */
+			return eval_placing(board);
+		} else {  /* only Dvonn pieces placed; too early to evaluate */
+			return 0;
+		}
+	}
+}
@@ -19,18 +19,7 @@ typedef int val_t;
 #define EVAL_DEFAULT_WEIGHT_FIELD_BONUS 64
 #define EVAL_DEFAULT_WEIGHT_FIELD_SHIFT  2
 
-#ifdef FIXED_PARAMS
-
-#define EVAL_WEIGHT_STACKS       EVAL_DEFAULT_WEIGHT_STACKS
-#define EVAL_WEIGHT_MOVES        EVAL_DEFAULT_WEIGHT_MOVES
-#define EVAL_WEIGHT_TO_LIFE      EVAL_DEFAULT_WEIGHT_TO_LIFE
-#define EVAL_WEIGHT_TO_ENEMY     EVAL_DEFAULT_WEIGHT_TO_ENEMY
-#define EVAL_WEIGHT_FIELD_BASE   EVAL_DEFAULT_WEIGHT_FIELD_BASE
-#define EVAL_WEIGHT_FIELD_BONUS  EVAL_DEFAULT_WEIGHT_FIELD_BONUS
-#define EVAL_WEIGHT_FIELD_SHIFT  EVAL_DEFAULT_WEIGHT_FIELD_SHIFT
-
-#else /* ndef FIXED_PARAMS */
-
+/* Weights of the terms of the evaluation function in the stacking phase: */
 typedef struct EvalWeights {
 	val_t stacks;    /* controlled stacks (mobile or not) */
 	val_t moves;     /* moves including for immobile stacks */
@@ -41,15 +30,30 @@ typedef struct EvalWeights {
 	val_t field_shift;  /* by how much to shift bonus dependent on distance */
 } EvalWeights;
 
+/* Default weights (copied by ai_engine_init()): */
 extern EvalWeights eval_weights;
 
-#define EVAL_WEIGHT_STACKS       eval_weights.stacks
-#define EVAL_WEIGHT_MOVES        eval_weights.moves
-#define EVAL_WEIGHT_TO_LIFE      eval_weights.to_life
-#define EVAL_WEIGHT_TO_ENEMY     eval_weights.to_enemy
-#define EVAL_WEIGHT_FIELD_BASE   eval_weights.field_base
-#define EVAL_WEIGHT_FIELD_BONUS  eval_weights.field_bonus
-#define EVAL_WEIGHT_FIELD_SHIFT  eval_weights.field_shift
+/* Weights used by the evaluation functions, given a pointer to EvalWeights.
+   With FIXED_PARAMS, the default weights are compiled in instead. */
+#ifdef FIXED_PARAMS
+
+#define EVAL_WEIGHT_STACKS(w)       EVAL_DEFAULT_WEIGHT_STACKS
+#define EVAL_WEIGHT_MOVES(w)        EVAL_DEFAULT_WEIGHT_MOVES
+#define EVAL_WEIGHT_TO_LIFE(w)      EVAL_DEFAULT_WEIGHT_TO_LIFE
+#define EVAL_WEIGHT_TO_ENEMY(w)     EVAL_DEFAULT_WEIGHT_TO_ENEMY
+#define EVAL_WEIGHT_FIELD_BASE(w)   EVAL_DEFAULT_WEIGHT_FIELD_BASE
+#define EVAL_WEIGHT_FIELD_BONUS(w)  EVAL_DEFAULT_WEIGHT_FIELD_BONUS
+#define EVAL_WEIGHT_FIELD_SHIFT(w)  EVAL_DEFAULT_WEIGHT_FIELD_SHIFT
+
+#else /* ndef FIXED_PARAMS */
+
+#define EVAL_WEIGHT_STACKS(w)       ((w)->stacks)
+#define EVAL_WEIGHT_MOVES(w)        ((w)->moves)
+#define EVAL_WEIGHT_TO_LIFE(w)      ((w)->to_life)
+#define EVAL_WEIGHT_TO_ENEMY(w)     ((w)->to_enemy)
+#define EVAL_WEIGHT_FIELD_BASE(w)   ((w)->field_base)
+#define EVAL_WEIGHT_FIELD_BONUS(w)  ((w)->field_bonus)
+#define EVAL_WEIGHT_FIELD_SHIFT(w)  ((w)->field_shift)
 
 #endif
 
@@ -61,10 +65,18 @@ int eval_dvonn_spread(const Board *board);
 /* Evaluate board position in placement phase (called by AI). */
 val_t eval_placing(const Board *board);
 
-/* Evaluate board position in stacking phase (called by AI).
+/* Evaluate board position in stacking phase (called by AI) with the given
+   weights.
 
    If the `board' does not desribe an end-game position, *exact is set to false;
    otherwise, it is left unchanged. */
-val_t eval_stacking(const Board *board, bool *exact);
+val_t eval_stacking( const Board *board, const EvalWeights *weights,
+	bool *exact );
+
+/* Evaluates the board with the given weights, by calling the appropriate
+   function depending on the game phase. If the game value is not exact,
+   *exact is set to false; otherwise, it is left unchanged. */
+val_t eval_position( const Board *board, const EvalWeights *weights,
+	bool *exact );
 
 #endif /* ndef EVAL_H_INCLUDED */
@@ -271,6 +271,659 @@ const int *board_steps[50][49] = {
 	  a+  0, a+  0, a+  0, a+  0, a+  0, a+  0, a+  0, a+  0, a+  0 }  /* 49 */
 };
 
+const long long board_step_masks[50][49] = {
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 0 */
+	{ 0x0000000000602LL, 0x0000000000c05LL, 0x000000000180aLL, 0x0000000003014LL,
+	  0x0000000006028LL, 0x000000000c050LL, 0x00000000180a0LL, 0x0000000030140LL,
+	  0x0000000060080LL, 0x0000000180401LL, 0x0000000300a03LL, 0x0000000601406LL,
+	  0x0000000c0280cLL, 0x0000001805018LL, 0x000000300a030LL, 0x0000006014060LL,
+	  0x000000c0280c0LL, 0x0000018050180LL, 0x0000030020100LL, 0x0000040100200LL,
+	  0x00000c0280600LL, 0x0000180500c00LL, 0x0000300a01800LL, 0x0000601403000LL,
+	  0x0000c02806000LL, 0x000180500c000LL, 0x000300a018000LL, 0x0006014030000LL,
+	  0x000c028060000LL, 0x0008010040000LL, 0x0010080180000LL, 0x0030140300000LL,
+	  0x0060280600000LL, 0x00c0500c00000LL, 0x0180a01800000LL, 0x0301403000000LL,
+	  0x0602806000000LL, 0x0c0500c000000LL, 0x180a018000000LL, 0x1004030000000LL,
+	  0x00200c0000000LL, 0x0050180000000LL, 0x00a0300000000LL, 0x0140600000000LL,
+	  0x0280c00000000LL, 0x0501800000000LL, 0x0a03000000000LL, 0x1406000000000LL,
+	  0x080c000000000LL },  /* 1 */
+	{ 0x0000000280004LL, 0x0000000500008LL, 0x0000000a00011LL, 0x0000001400022LL,
+	  0x0000002800044LL, 0x0000005000088LL, 0x000000a000110LL, 0x0000014000020LL,
+	  0x0000028000040LL, 0x0000080000800LL, 0x0000140001000LL, 0x0000280002200LL,
+	  0x0000500004400LL, 0x0000a00008800LL, 0x0001400011000LL, 0x0002800022000LL,
+	  0x0005000044000LL, 0x000a000008000LL, 0x0004000010000LL, 0x0010000200001LL,
+	  0x0020000400002LL, 0x0050000880005LL, 0x00a000110000aLL, 0x0140002200014LL,
+	  0x0280004400028LL, 0x0500008800050LL, 0x0a000110000a0LL, 0x1400022000140LL,
+	  0x0800004000080LL, 0x1000008000100LL, 0x0000100000400LL, 0x0000200000a00LL,
+	  0x0000440001400LL, 0x0000880002800LL, 0x0001100005000LL, 0x000220000a000LL,
+	  0x0004400014000LL, 0x0008800028000LL, 0x0001000050000LL, 0x0002000020000LL,
+	  0x0040000280000LL, 0x0080000500000LL, 0x0110000a00000LL, 0x0220001400000LL,
+	  0x0440002800000LL, 0x0880005000000LL, 0x110000a000000LL, 0x0200014000000LL,
+	  0x0400028000000LL },  /* 2 */
+	{ 0x0000100000008LL, 0x0000240000010LL, 0x0000480000020LL, 0x0000900000041LL,
+	  0x0001200000082LL, 0x0002400000104LL, 0x0004800000008LL, 0x0009000000010LL,
+	  0x0002000000020LL, 0x0020000001000LL, 0x0040000002000LL, 0x0090000004000LL,
+	  0x0120000008200LL, 0x0240000010400LL, 0x0480000020800LL, 0x0900000041000LL,
+	  0x1200000002000LL, 0x0400000004000LL, 0x0800000008000LL, 0x0000000400000LL,
+	  0x0000000800000LL, 0x0000001000000LL, 0x0000002080000LL, 0x0000004100000LL,
+	  0x0000008200000LL, 0x0000010400000LL, 0x0000020800000LL, 0x0000001000000LL,
+	  0x0000002000000LL, 0x0000004000000LL, 0x0000200000002LL, 0x0000400000004LL,
+	  0x0000800000009LL, 0x0001040000012LL, 0x0002080000024LL, 0x0004100000048LL,
+	  0x0008200000090LL, 0x0000400000120LL, 0x0000800000040LL, 0x0001000000080LL,
+	  0x0080000000800LL, 0x0100000001200LL, 0x0200000002400LL, 0x0410000004800LL,
+	  0x0820000009000LL, 0x1040000012000LL, 0x0080000024000LL, 0x0100000048000LL,
+	  0x0200000010000LL },  /* 3 */
+	{ 0x0040000000010LL, 0x0080000000020LL, 0x0110000000040LL, 0x0220000000080LL,
+	  0x0440000000101LL, 0x0880000000002LL, 0x1100000000004LL, 0x0200000000008LL,
+	  0x0400000000010LL, 0x0000000002000LL, 0x0000000004000LL, 0x0000000008000LL,
+	  0x0000000010000LL, 0x0000000020200LL, 0x0000000040400LL, 0x0000000000800LL,
+	  0x0000000001000LL, 0x0000000002000LL, 0x0000000004000LL, 0x0000000800000LL,
+	  0x0000001000000LL, 0x0000002000000LL, 0x0000004000000LL, 0x0000008080000LL,
+	  0x0000010100000LL, 0x0000020200000LL, 0x0000000400000LL, 0x0000000800000LL,
+	  0x0000001000000LL, 0x0000002000000LL, 0x0000400000000LL, 0x0000800000000LL,
+	  0x0001000000000LL, 0x0002000000000LL, 0x0004040000000LL, 0x0008080000000LL,
+	  0x0000100000000LL, 0x0000200000000LL, 0x0000400000000LL, 0x0000800000000LL,
+	  0x0100000000004LL, 0x0200000000008LL, 0x0400000000011LL, 0x0800000000022LL,
+	  0x1010000000044LL, 0x0020000000088LL, 0x0040000000110LL, 0x0080000000020LL,
+	  0x0100000000040LL },  /* 4 */
+	{ 0x0000000000020LL, 0x0000000000040LL, 0x0000000000080LL, 0x0000000000100LL,
+	  0x0000000000000LL, 0x0000000000001LL, 0x0000000000002LL, 0x0000000000004LL,
+	  0x0000000000008LL, 0x0000000004000LL, 0x0000000008000LL, 0x0000000010000LL,
+	  0x0000000020000LL, 0x0000000040000LL, 0x0000000000200LL, 0x0000000000400LL,
+	  0x0000000000800LL, 0x0000000001000LL, 0x0000000002000LL, 0x0000001000000LL,
+	  0x0000002000000LL, 0x0000004000000LL, 0x0000008000000LL, 0x0000010000000LL,
+	  0x0000020080000LL, 0x0000000100000LL, 0x0000000200000LL, 0x0000000400000LL,
+	  0x0000000800000LL, 0x0000001000000LL, 0x0000800000000LL, 0x0001000000000LL,
+	  0x0002000000000LL, 0x0004000000000LL, 0x0008000000000LL, 0x0000040000000LL,
+	  0x0000080000000LL, 0x0000100000000LL, 0x0000200000000LL, 0x0000400000000LL,
+	  0x0200000000000LL, 0x0400000000000LL, 0x0800000000000LL, 0x1000000000000LL,
+	  0x0000000000000LL, 0x0010000000000LL, 0x0020000000000LL, 0x0040000000000LL,
+	  0x0080000000000LL },  /* 5 */
+	{ 0x0000000000040LL, 0x0000000000080LL, 0x0000000000100LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000001LL, 0x0000000000002LL,
+	  0x0000000000004LL, 0x0000000008000LL, 0x0000000010000LL, 0x0000000020000LL,
+	  0x0000000040000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000200LL,
+	  0x0000000000400LL, 0x0000000000800LL, 0x0000000001000LL, 0x0000002000000LL,
+	  0x0000004000000LL, 0x0000008000000LL, 0x0000010000000LL, 0x0000020000000LL,
+	  0x0000000000000LL, 0x0000000080000LL, 0x0000000100000LL, 0x0000000200000LL,
+	  0x0000000400000LL, 0x0000000800000LL, 0x0001000000000LL, 0x0002000000000LL,
+	  0x0004000000000LL, 0x0008000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000040000000LL, 0x0000080000000LL, 0x0000100000000LL, 0x0000200000000LL,
+	  0x0400000000000LL, 0x0800000000000LL, 0x1000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0010000000000LL, 0x0020000000000LL,
+	  0x0040000000000LL },  /* 6 */
+	{ 0x0000000000080LL, 0x0000000000100LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000001LL,
+	  0x0000000000002LL, 0x0000000010000LL, 0x0000000020000LL, 0x0000000040000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000200LL, 0x0000000000400LL, 0x0000000000800LL, 0x0000004000000LL,
+	  0x0000008000000LL, 0x0000010000000LL, 0x0000020000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000080000LL, 0x0000000100000LL,
+	  0x0000000200000LL, 0x0000000400000LL, 0x0002000000000LL, 0x0004000000000LL,
+	  0x0008000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000040000000LL, 0x0000080000000LL, 0x0000100000000LL,
+	  0x0800000000000LL, 0x1000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0010000000000LL,
+	  0x0020000000000LL },  /* 7 */
+	{ 0x0000000000100LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000001LL, 0x0000000020000LL, 0x0000000040000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000200LL, 0x0000000000400LL, 0x0000008000000LL,
+	  0x0000010000000LL, 0x0000020000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000080000LL,
+	  0x0000000100000LL, 0x0000000200000LL, 0x0004000000000LL, 0x0008000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000040000000LL, 0x0000080000000LL,
+	  0x1000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0010000000000LL },  /* 8 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000040000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000200LL, 0x0000010000000LL,
+	  0x0000020000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000080000LL, 0x0000000100000LL, 0x0008000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000040000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 9 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000020000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000080000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 10 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 11 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 12 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 13 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 14 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 15 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 16 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 17 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 18 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 19 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 20 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 21 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 22 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 23 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 24 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 25 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 26 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 27 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 28 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 29 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 30 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 31 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 32 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 33 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 34 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 35 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 36 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 37 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 38 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 39 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 40 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 41 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 42 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 43 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 44 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 45 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 46 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 47 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL },  /* 48 */
+	{ 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL, 0x0000000000000LL,
+	  0x0000000000000LL }  /* 49 */
+};
+
 const char board_distance[49][49] = {
 	{      0,  1,  2,  3,  4,  5,  6,  7,  8,
 	     1,  1,  2,  3,  4,  5,  6,  7,  8,  9,
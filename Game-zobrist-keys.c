@@ -1,984 +1,1964 @@
-static const unsigned long long zobrist_init_key = 0x463d22bdfb73a68full;
-static const unsigned long long zobrist_player_key = 0x1e0b092362c17a27ull;
-static const unsigned long long zobrist_phase_key = 0xd5bd5cc7c9fbb584ull;
-static const unsigned zobrist_field_key[4*(N+1)*N] = {
-	 0x6924fe4au, 0x0c1d8256u, 0x25350dfeu, 0x98bf7bf8u, 0x11ab5fd5u, 0xd7727113u, 0xc17121c3u, 0x3a82cacbu, 0x1dc22406u, 0x70cf72f1u,
-	 0x3c3379ccu, 0x3bafefd8u, 0x56bfd929u, 0x391ca2bfu, 0xd0f11b5cu, 0x74aa6622u, 0x98bf8675u, 0x305afb33u, 0x82b7adf2u, 0x7ebb359du,
-	 0xe122db01u, 0xcc4903a9u, 0xc227fdbdu, 0xe03c9db3u, 0xa382e3a4u, 0x567088a7u, 0xc9fd7359u, 0x6e01e343u, 0xd01ef3fau, 0xf59ceba5u,
-	 0xcd24ab5eu, 0x33db117du, 0x91f7755au, 0x2c299748u, 0x41e2c2c9u, 0x1420d3aau, 0x3a022a94u, 0x339f3fe6u, 0x4c194184u, 0x2119cd88u,
-	 0xb35515cau, 0xafc192f8u, 0x28b94060u, 0x22beff0fu, 0xe00dcef2u, 0x2056bc43u, 0xe7182d3fu, 0x86cc7fc7u, 0xac8e958eu, 0xfedc1eb7u,
-	 0xe917d931u, 0x445aa1c4u, 0xcd5ba2fau, 0xd1eac76cu, 0x86a8ec3fu, 0xae7053bdu, 0xc4e09dd6u, 0x6ae4a363u, 0x661c3b0du, 0x55ceb248u,
-	 0x1976be06u, 0x3c46b94cu, 0x788ab1fbu, 0x9faf6357u, 0x328655f3u, 0xb557cf3fu, 0x5f403d0au, 0x3c59db26u, 0xdaae9518u, 0x5d55babau,
-	 0xb776280bu, 0x440775cdu, 0xbc0bd1bbu, 0x96532864u, 0xd2c55e9bu, 0x58d6a457u, 0xab1cc5ddu, 0x0774dee1u, 0xb5b743ebu, 0x138b299fu,
-	 0xb6522be1u, 0x3431a5bcu, 0xdfd53187u, 0xfddeba42u, 0xb09ccea5u, 0x5d8654f4u, 0x7ffc8e08u, 0x4022547bu, 0xcd055e37u, 0x81aa3425u,
-	 0xe5810a26u, 0xe19db516u, 0x5bff59dbu, 0xe6b4bacau, 0x7fd7c8b9u, 0x95e6ddf2u, 0xc95f88c4u, 0x3f30d529u, 0xa842baf6u, 0x48d356b3u,
-	 0x562869acu, 0x3f867f33u, 0x9498cb58u, 0x44a07f8au, 0x0bf1710du, 0x7df783d8u, 0x5109943du, 0x02fe15e0u, 0x0ccd633cu, 0x62dc41a6u,
-	 0xea78db1eu, 0x6a42baebu, 0x768aaa98u, 0xe28eec84u, 0xf636def8u, 0x6d0df527u, 0x125a673du, 0xfb4cd9f9u, 0xbf934940u, 0x78863bacu,
-	 0xcf57e73cu, 0x935ff121u, 0x1cbbc8c0u, 0x234a185du, 0xbb223b34u, 0xb45d521au, 0x7ffcfbe8u, 0x65146cc2u, 0x589eb7c9u, 0x10e664aeu,
-	 0x5b27b273u, 0x398d4715u, 0x4ebd9401u, 0xbe3eb10eu, 0xc24547cau, 0x8b0af63cu, 0xb5dbb487u, 0xec4b4c17u, 0x2c672bb5u, 0x1ef4db71u,
-	 0x2578fecfu, 0x3b2f3db8u, 0xe11ca340u, 0x6a4ba860u, 0x900a12beu, 0xc8a9f981u, 0xc139e165u, 0xb9ee2b3du, 0x8371ef84u, 0xc0255af0u,
-	 0x97bb8fb1u, 0xdc8e2f89u, 0x6a34bea4u, 0xe0032e75u, 0xb6e465e5u, 0x28f1f71eu, 0x2b32dd05u, 0xbb1f8971u, 0x6fc7ce4eu, 0xbefa8921u,
-	 0x655f81efu, 0x7d8a1998u, 0x3d1e4446u, 0x43d4e32du, 0x5a11ae4au, 0x1df7b145u, 0xf59375ebu, 0x2405113eu, 0xf023b13cu, 0x9a46274eu,
-	 0x397352bdu, 0x09899040u, 0x014774dcu, 0xc3d4e515u, 0xeea9d1adu, 0x1e8a2b40u, 0x6ac871d4u, 0x5679d9c2u, 0x6c9f5b4au, 0xf42a32d5u,
-	 0xaade0784u, 0x342f820du, 0xc5bb3237u, 0xc1ab1dfbu, 0xf3d9ce0au, 0x07743ad1u, 0xc64a8cb6u, 0xdc238860u, 0x14b6c56eu, 0xfd1c65aau,
-	 0x742cbd5eu, 0xc4c99f4fu, 0xa118d810u, 0x2ab3e94cu, 0x392035e7u, 0x0c568c13u, 0xaeae48dcu, 0xd4bd7e55u, 0x76667cceu, 0xa3e1f53eu,
-	 0x88457537u, 0x1eb0ccb9u, 0x82100efeu, 0xc679d82eu, 0xe85c32e6u, 0xbe8fff11u, 0x024f7121u, 0x7c2cc0d0u, 0x6f2339feu, 0xe787119fu,
-	 0xb053b8b3u, 0xdb665493u, 0xc77b2d41u, 0x7c83cd8eu, 0x0c726524u, 0x7266181au, 0xc9fc7645u, 0xbbd7df87u, 0x5ad40585u, 0xdd1ff408u,
-	 0xa5c17e44u, 0x3aaa10bfu, 0x88cf1643u, 0x02644c07u, 0x4f6ecca5u, 0x9fd3a610u, 0xd978037cu, 0x157a0856u, 0x17083a84u, 0x844354f4u,
-	 0x79f12fd5u, 0xffa2f325u, 0xcadb8283u, 0x5aa6c813u, 0xf9add432u, 0x9446b613u, 0xa176f6d9u, 0xcbcd8176u, 0x88821eb8u, 0xa990a99fu,
-	 0x4580aed3u, 0xe854747du, 0xe2c1123bu, 0xb9165d15u, 0x0f904668u, 0x455937d1u, 0x0569e5b0u, 0x1896b68fu, 0x99673ce6u, 0xf94a7fe1u,
-	 0xb3263615u, 0x1127b1d4u, 0x16af256fu, 0xa2d1349au, 0x2a65fb45u, 0xf063d883u, 0x383150ebu, 0x66ad1db6u, 0x2e940848u, 0x8e0e3df0u,
-	 0x444fc1f7u, 0x48cfc4d2u, 0x0bfdbe55u, 0xa13d48beu, 0xa4b0e143u, 0x3d3e9974u, 0xc278003fu, 0x43828ee5u, 0x066ced0cu, 0xbe880cccu,
-	 0x69555c8au, 0xdd47bafau, 0x0fc0627du, 0x4b104cd8u, 0x838b31aau, 0x456fe026u, 0x595d72feu, 0x0e4b852cu, 0x7e9e35c3u, 0x04d28f0bu,
-	 0x4d164c3eu, 0x511fbed2u, 0xa3a53c2fu, 0xf3ab5115u, 0x1d348d26u, 0x89b765aau, 0x3dfa95a5u, 0xf15a9c59u, 0x8473d0adu, 0x72e304fcu,
-	 0x02d58dc8u, 0x2f877db5u, 0x3cfbb881u, 0x3ef823dcu, 0x810529ebu, 0x17500450u, 0x9c68f6ecu, 0x3922a3dcu, 0xb040d743u, 0x1f9f8286u,
-	 0xc7ac703fu, 0x8de3ffb6u, 0x8de143bcu, 0xc9ea8259u, 0x475d2588u, 0xf629f450u, 0x716eda87u, 0xcd17a509u, 0x09b9e861u, 0x9bb1fd97u,
-	 0xcccc83dau, 0x4658b917u, 0xa2f1bffcu, 0x1102d151u, 0xf95e8d53u, 0x6b09caa2u, 0x159e5216u, 0x0d441affu, 0x63d9f641u, 0xbef006abu,
-	 0xf3d704b4u, 0x7647bf82u, 0x84de8e8au, 0xffc85275u, 0x9a198a31u, 0x9654f3e0u, 0x1257fcb0u, 0x1f17cb79u, 0xbdce9db6u, 0xed72a42bu,
-	 0xaa2e9e9fu, 0xb66c7f41u, 0xc4d9e9a6u, 0xa92edc80u, 0x7f8199e8u, 0xe3da9937u, 0x1ad97cd0u, 0x58089116u, 0xa5fa1f0bu, 0xbec4293du,
-	 0xeaca5cc1u, 0x241f31d3u, 0x779ed1c1u, 0xfb5b79c5u, 0x76d7a791u, 0x7e3e6125u, 0x974c18a0u, 0x9ee47d21u, 0x7374da8cu, 0x459a21bcu,
-	 0xc190aaa3u, 0xcda5ad00u, 0x1176db06u, 0xd1bff60cu, 0x9e152826u, 0xba1df344u, 0x427076d0u, 0x2750fa3fu, 0x7ecb45c6u, 0x5d4a0935u,
-	 0x6f1b84c2u, 0x965174f0u, 0xa3a7c859u, 0x5282ef5du, 0xad289886u, 0x0d3e9db5u, 0x4e2e6993u, 0x0af68746u, 0x5edeebe7u, 0xd4b0077eu,
-	 0x72d5a9ccu, 0x0e1befd4u, 0xce6615a5u, 0xbc15aab0u, 0x254c37d1u, 0x32c876deu, 0x58976ad3u, 0x07246293u, 0xa4f93298u, 0xb2ea0489u,
-	 0x5c545d3cu, 0xa268fdbbu, 0x97ec1b3eu, 0x8dcf7aedu, 0xf85c32b9u, 0x3998a180u, 0x38f0cfaeu, 0x956c8db5u, 0x08f765a8u, 0x8e0ea070u,
-	 0x14e60201u, 0xa930057du, 0x6938eebdu, 0x02f6a61au, 0xe855354du, 0x278b4bc1u, 0x2d85ab26u, 0x084b0663u, 0x5b701cb6u, 0xe516f5a6u,
-	 0x63054e55u, 0xeffd715cu, 0xc12e183bu, 0x25d9026fu, 0xcf2fe080u, 0x9d575f7fu, 0xf017b366u, 0x3262187eu, 0x05878358u, 0x5290d016u,
-	 0x133c13beu, 0x10987c46u, 0xcb89f4f8u, 0x6fe53450u, 0xf36d7b6bu, 0x0257ce23u, 0xa66680cfu, 0x8d238471u, 0x5c615486u, 0x230d30bdu,
-	 0xe8076bcfu, 0xd75bcab6u, 0x2b046432u, 0x341047ddu, 0x50f3b0f8u, 0x9ad7d799u, 0x2b6597b5u, 0x15c07fa5u, 0x9ee72a66u, 0x1fc3bc73u,
-	 0xea3b8aa2u, 0x9b97bd83u, 0x1db3d395u, 0xe5e2b90fu, 0x8dfa6d58u, 0xd90c8782u, 0xd839f84au, 0x89eafe99u, 0xbc6f023au, 0x4786c1b1u,
-	 0x1a6b87feu, 0x3cd04a88u, 0x9c28430bu, 0x948f88d7u, 0x38fbf1e1u, 0xe335e4a4u, 0x65af96b3u, 0x4ccf78dau, 0xead27674u, 0xb4a386a9u,
-	 0x977edc5eu, 0xfa4449c4u, 0xb750d114u, 0xa9fffca1u, 0x2d085b8fu, 0xf78e9c8eu, 0xd2cbd4d9u, 0x12e7b33bu, 0x29c3f545u, 0x046b369bu,
-	 0x5537400bu, 0x5395de79u, 0x7af7b2eau, 0x7f400cc2u, 0xf2b8ee24u, 0xe649b363u, 0x49b48d8fu, 0xac111805u, 0x2d461d57u, 0xa40ce09bu,
-	 0x33d78eceu, 0xd9880449u, 0x87f96ad4u, 0x98f7ba3eu, 0x3cae6d4du, 0xe6c01624u, 0x2bfaf1feu, 0xae2c4fa3u, 0xa358c197u, 0x983f39b2u,
-	 0x9d99a29du, 0x73b5ecb9u, 0xad292b01u, 0x52ee83ebu, 0xfc43834bu, 0x0c1c2d17u, 0x575ab984u, 0x88897b55u, 0xb2baf7f4u, 0x08e6229eu,
-	 0xeda5d7e6u, 0x62da2349u, 0x11ef68feu, 0x85df8029u, 0x9cafc15bu, 0x9067a3cbu, 0xa097acf1u, 0xffd50f63u, 0x4926212du, 0x2262a0dfu,
-	 0x9461dd3du, 0x35e7a27du, 0xb3eb39ffu, 0xc89d7a98u, 0xa8b78138u, 0x90c681ffu, 0xd78f2e91u, 0xc868d2d1u, 0xeb4f454bu, 0x3365bce4u,
-	 0x2ac28513u, 0xcd47454au, 0x782f74c7u, 0xa69483fbu, 0x9d62fb04u, 0x607c956du, 0xa6029135u, 0xc776ea0fu, 0x304f8dcau, 0x6df41e07u,
-	 0xdeda108cu, 0xcf8ce1ebu, 0xa88b2e01u, 0xb93fdbf0u, 0xe8811707u, 0xcaf0e832u, 0xef99ec48u, 0x8d23fe02u, 0x4beed036u, 0x708982aeu,
-	 0x6d6b111cu, 0x3667dcf3u, 0x43147f5bu, 0x57cc7669u, 0x2647dad0u, 0xc92b45cbu, 0xbd0e12aeu, 0x3c06d4b5u, 0x587c12b3u, 0xaf2656aeu,
-	 0xe01cea1bu, 0xed2f26d4u, 0xee2b2475u, 0xaf8e792au, 0xea2a203cu, 0xcf55a03eu, 0x1885c0fdu, 0xe60d3decu, 0x0a1e3b98u, 0x8db59624u,
-	 0x87a4fb14u, 0xa187c978u, 0x97298b89u, 0xb4bade86u, 0x37433f7du, 0xd1ed040du, 0x1b40139cu, 0xc9eabb09u, 0x84b5a8fdu, 0xab521c59u,
-	 0x9c0b2729u, 0xc0bb3f9bu, 0x080a3bbfu, 0xa2d2b195u, 0x9303576au, 0xb0a7e827u, 0x73a8f2f2u, 0xfdf714ffu, 0xcf7254bfu, 0xb999dd11u,
-	 0xcbe21ecbu, 0x493a3eb9u, 0xc4d99bdfu, 0x6468f69eu, 0xc0247d8bu, 0xf417bb91u, 0xb55b268fu, 0xd7ce20a7u, 0x45bc771du, 0x92a9274du,
-	 0xe5b8b6fdu, 0xc714a6c7u, 0x4ddc6db5u, 0xca3f24dfu, 0x61144c7fu, 0x0c65762fu, 0x7f496e5cu, 0xc254020au, 0xb4aa8ae5u, 0x93df26e3u,
-	 0x144ed4e0u, 0xf0fe7d09u, 0xa57de3dau, 0x52e18a7fu, 0xb466b3dfu, 0x6bc16363u, 0xbce0af15u, 0x38686853u, 0x58daa32au, 0xd1e93fb9u,
-	 0x7d6306f9u, 0x499e2b1cu, 0x274c2440u, 0x576f16f6u, 0x0374c1b7u, 0x7ea63d4du, 0xe1ccbe48u, 0x4ed38c1eu, 0xa78012f3u, 0xe8fcdb12u,
-	 0x74d715ceu, 0x5470712du, 0xefd9791eu, 0x93d3ec8cu, 0xc225e7beu, 0x7a902e23u, 0x2e8836f8u, 0xca361815u, 0x6762e3f0u, 0xf8baab1fu,
-	 0x66c6e54fu, 0xe37c88fau, 0x207f96e8u, 0x3ee82875u, 0xd9e653a9u, 0xd886b2d2u, 0xfd29ddcbu, 0xf5b85eacu, 0x672ab587u, 0xfe640fafu,
-	 0x5de793dcu, 0x4f9c59deu, 0x0d4529d3u, 0x1231d5c6u, 0xeece6645u, 0x2c1b4efcu, 0x9900888eu, 0x8c4efbd2u, 0x28c8da9fu, 0x0332027bu,
-	 0x99611b23u, 0xddc9c3adu, 0x76dc6ad8u, 0x9dc05a8bu, 0x18fce0d2u, 0xf7520099u, 0xd399e60fu, 0xbaea9e9fu, 0x708a1456u, 0x143c57a6u,
-	 0x3ad57d84u, 0x9261bee2u, 0xd3c64b75u, 0xcd80c7c7u, 0xaccf9fe3u, 0xb3dde07bu, 0x7e22afe3u, 0xe2c938cfu, 0xab50272au, 0x4e37d07eu,
-	 0x6b22b636u, 0x150117eeu, 0x585ee1f8u, 0x0253e2d6u, 0x6028586du, 0xccf77ff2u, 0x43ce063au, 0xeb795c82u, 0x0789debcu, 0xb2805e9du,
-	 0x1ff69833u, 0x0ba87e6au, 0x9dcc7ed3u, 0x60913b46u, 0xe8363d0du, 0xebeed7edu, 0x083c40ccu, 0x8fa22caau, 0x9ae990f6u, 0x29e44c07u,
-	 0xc3441b2bu, 0x7ee1abf9u, 0xa395b6d5u, 0xf511608bu, 0x9871fff0u, 0x9f970e35u, 0xb7864077u, 0xca35caabu, 0x3151fa34u, 0x6db6439eu,
-	 0x5fc737b2u, 0xa023e79bu, 0xefa83e2cu, 0x3df2e7f5u, 0xb4244827u, 0xc5420103u, 0xb80cc82au, 0x95ef1ad5u, 0xda949076u, 0x5196b90bu,
-	 0x7c7aa183u, 0xaa96de00u, 0x899ae60cu, 0x2c46ce6bu, 0xed22a738u, 0x6b69b96bu, 0x1165343eu, 0x70081d71u, 0x7ec38b6eu, 0x4105d078u,
-	 0x94a479c9u, 0x14018729u, 0x7b8fde5du, 0x83db4487u, 0x1671e613u, 0xbbd61b3du, 0xaa5ae70bu, 0x066882fau, 0xb3f36b86u, 0xbf8e9aefu,
-	 0x29c30a55u, 0xc45fa694u, 0xda68c782u, 0xaa4f4c9du, 0x5b65ffefu, 0xaf8aa770u, 0xcf588440u, 0xd932fe98u, 0x8b974af3u, 0xae851612u,
-	 0xb73f1a1fu, 0x649823f4u, 0xfd390701u, 0x5cb31c9eu, 0xa8b5a61bu, 0x39ee66feu, 0xef5c1d70u, 0x1eeb51aau, 0x516d593bu, 0xb26dea0bu,
-	 0x4dd55777u, 0x769d8ee0u, 0xe496e7d1u, 0xa3aeb723u, 0xb714616cu, 0x96d93a18u, 0x072fd87fu, 0x46619415u, 0x423ec908u, 0x1e18546eu,
-	 0xa0cca68fu, 0x0e80d2b9u, 0x27e933b6u, 0xe449c528u, 0xd125c571u, 0x2676b44eu, 0x418314a5u, 0x6c05de2au, 0x84b872f2u, 0xb47fd239u,
-	 0x8d689a02u, 0x3ecd65a4u, 0xe3c5c55fu, 0xaf31fce0u, 0xbadac532u, 0xc8811acfu, 0xdad7ae2bu, 0xcf3b02c5u, 0x57b6702eu, 0x07404b33u,
-	 0xb227f82au, 0x81a48973u, 0x50e6fba7u, 0x97af03d8u, 0x5fb83754u, 0xcfaba5e8u, 0x89bef415u, 0xd3c9df21u, 0x5c8d402bu, 0x69208fafu,
-	 0x6c7783a7u, 0x88e262c3u, 0x39cabdc2u, 0x16e625e0u, 0x564c7654u, 0x68b8d63eu, 0x7ebc24ceu, 0xe358d51au, 0x6e7b167eu, 0x88af6b58u,
-	 0x338f341du, 0xb0220171u, 0xedfe7f17u, 0x72a34480u, 0xff53d5c7u, 0xaff722d1u, 0xa573c8dbu, 0xa7ddd107u, 0xd78d37e5u, 0x90eee2e1u,
-	 0x87633d72u, 0x507515a0u, 0xcc7a32ecu, 0xe07d9cd6u, 0xd1ad7275u, 0x746a5bcdu, 0x714d1875u, 0x8d5168b9u, 0xbfa5e46du, 0x11526d04u,
-	 0x3a1b4a2bu, 0x0830d39eu, 0x07479598u, 0x3efdce12u, 0x0c900e8cu, 0x3253c6f0u, 0x5e99490bu, 0x0a225225u, 0x063646b8u, 0xbf787c69u,
-	 0xfd768deeu, 0x6890c189u, 0x7fe52c40u, 0x2304bfb6u, 0x04176786u, 0xa30b432au, 0xf34c7a81u, 0x43631141u, 0xad8a0389u, 0x1f8ffe29u,
-	 0x38b0e365u, 0xb82873fbu, 0x363d739du, 0x87bbb10fu, 0x9d2f4c0du, 0xc2d28028u, 0x29e3fecbu, 0x81e5c2d7u, 0x163cb676u, 0xf7ec84c7u,
-	 0x1753bcdcu, 0xa2d46f53u, 0x946150b1u, 0xa0e226b1u, 0x94f425efu, 0x881e8b5eu, 0xd47876a9u, 0x288ec4e2u, 0x060c0854u, 0x08141baau,
-	 0x06d760feu, 0x89b6dcd7u, 0x6a065d80u, 0x526ef3c7u, 0x3c6dceb6u, 0x9efa7ea9u, 0x54f166d7u, 0x301f49ceu, 0x0cc09541u, 0x31eabdf3u,
-	 0xe049a493u, 0xb6394a34u, 0x019f58a0u, 0xbe11471au, 0x3776ea28u, 0xd5ca705au, 0xea2d5594u, 0xc11f9bb3u, 0x4b9ba1f3u, 0xa12095d2u,
-	 0xf7cce594u, 0x17a0639au, 0x879ca5fau, 0x13bdee68u, 0x0efc2c14u, 0x52fb68e1u, 0x9117f17bu, 0x1be2f827u, 0x0b13bb7au, 0x3c3a1370u,
-	 0x845ca7b7u, 0x85a4cd0fu, 0x3c04f074u, 0x438471f8u, 0x27a92feeu, 0x5b6b38b8u, 0x1d9d68acu, 0xa311d9cdu, 0xf5f59d47u, 0x49dd20c1u,
-	 0x6429950au, 0xff490c3eu, 0xb6fa2946u, 0x978e50ccu, 0xa218c0cfu, 0xc7c74a60u, 0xfd80b21au, 0x33bb4b84u, 0x4db2ea12u, 0x93cd120eu,
-	 0x2061c5a5u, 0xa96df420u, 0xc3e76279u, 0x517105e2u, 0x41351a4cu, 0xead5e253u, 0x8c515b1cu, 0x86a477a6u, 0x93cb6290u, 0x33a6cb74u,
-	 0x924d089bu, 0x9e4b9fafu, 0x3d65bbabu, 0xf1443f70u, 0x88637414u, 0x787eab29u, 0x67804fa2u, 0x2c3fc719u, 0xcfb29dbdu, 0x5dd907cbu,
-	 0x9ef4fcfeu, 0x37f5b4f3u, 0xdda26882u, 0x0c686590u, 0xf74a08d2u, 0x484535a0u, 0xef93e65bu, 0xcd892210u, 0x3dcc6bbbu, 0x29a8986eu,
-	 0xc06c2f47u, 0x33954452u, 0x98d714f9u, 0xcb9497ffu, 0x9c26727au, 0xef04e1f6u, 0xc3bf2b57u, 0x6b3d8be4u, 0xbbbd5cf6u, 0xb65b6f99u,
-	 0x9a95f2cau, 0xf8c22724u, 0x61668993u, 0x3fbcbb5bu, 0x62bf6e06u, 0x5a1b4b62u, 0x3f19cdc9u, 0x45171fb2u, 0x0050c1edu, 0xa17fd95cu,
-	 0xa44b8442u, 0xbe945bf8u, 0x98534db4u, 0x91e2cce4u, 0x1c68d223u, 0x046a740du, 0xbaca78a4u, 0xcdd7c7a1u, 0xc96add61u, 0xf70ea13fu,
-	 0x149a081eu, 0x2adda0fbu, 0xe6bd736cu, 0x1cf52e63u, 0x1e5bf8ecu, 0xc0c6c78bu, 0x2f040a18u, 0xee1dab97u, 0xc668b508u, 0x25f960bau,
-	 0xc36d7316u, 0x858a3aa3u, 0xd97fd055u, 0x423340d2u, 0xad815999u, 0x99fc31dcu, 0x55b04a3cu, 0x67338d28u, 0xc1438a21u, 0x795fd374u,
-	 0xbc2e274du, 0x23d749f7u, 0x6997440cu, 0xed326442u, 0xb5abccbau, 0x62784253u, 0xc13e3a9eu, 0x907a60e9u, 0x218c1189u, 0x65d3089fu,
-	 0xfc11235cu, 0x570b946eu, 0xa69d0ce1u, 0x91891a00u, 0xa3572e3eu, 0x929f8a33u, 0x6847df68u, 0x92641ab2u, 0x9edbaa9au, 0xbe4a43f7u,
-	 0x62695b84u, 0x542004a8u, 0x37977677u, 0x5a0918e5u, 0xa4ddc034u, 0x93587dfcu, 0xe6bfb04eu, 0xefb559c9u, 0xa57d47d7u, 0x53fea306u,
-	 0x63948002u, 0x131544c1u, 0x5473c435u, 0xfad49f01u, 0x5ed681a1u, 0x9ebb4cf7u, 0x388ac88bu, 0xbca3c47au, 0x4db8628fu, 0xc0da40f4u,
-	 0x6c1afd56u, 0x4ca9e48cu, 0x6931b898u, 0xef4b8156u, 0x44514475u, 0x8b0bfdb5u, 0x4c83e17fu, 0x66834926u, 0xd70c80ebu, 0x9a839823u,
-	 0xf5bdaa55u, 0xe94d4458u, 0xa7f1f4bbu, 0xab508c43u, 0x6c90a1b0u, 0xcb151eccu, 0x4d82a5a4u, 0x30818755u, 0xa34be6d2u, 0xa293bdc6u,
-	 0xeb4791e9u, 0x91c5ed96u, 0xd80da891u, 0xbae47c3au, 0xc23dc792u, 0xad559290u, 0x55d9a2a4u, 0x559644b4u, 0x33ddb385u, 0x937c80d0u,
-	 0xf8dba16bu, 0x248bbc8eu, 0xc720c721u, 0x09f8953au, 0x5cdc57d4u, 0xe8cfe4e4u, 0x75839951u, 0xbf96ec3fu, 0xe1ae6d3au, 0xbf857298u,
-	 0x9894c075u, 0x4115509au, 0xbcade39fu, 0x22e8b0f2u, 0xeaa897dau, 0x3cb77bddu, 0x4f3c0109u, 0xf9f12d5bu, 0xca64a30bu, 0x9b28e08fu,
-	 0x7737fef0u, 0x82a0e353u, 0x9552ccc4u, 0xe35547e2u, 0xf4a1bd03u, 0xb431bff2u, 0xc62ef6cbu, 0x99627e35u, 0xe85f3812u, 0x02838f54u,
-	 0xf0c5602cu, 0x79b49853u, 0x4af04562u, 0xc1b3b8a4u, 0x5ad29333u, 0x99db86a5u, 0x049128edu, 0xa6c229bdu, 0x4e13ad06u, 0xdd1f58f1u,
-	 0x389e4a30u, 0x088b3a1du, 0xe2c27d54u, 0xe33aba0cu, 0x181c496fu, 0xe83d640fu, 0x0536875fu, 0xbc42dfc4u, 0x3168cdabu, 0xfbdb876bu,
-	 0x58b3c6bfu, 0x06e5ffbbu, 0x51dc7fffu, 0x209f4324u, 0x33051f34u, 0xe840e602u, 0x1476d382u, 0x101cbd03u, 0xb533076bu, 0xc24f8d4fu,
-	 0xbe8f9fc1u, 0xba95e4c5u, 0xea6ed823u, 0x9c836a25u, 0x329bbd90u, 0x63b10fd4u, 0xc1405280u, 0x79ca7d4au, 0x9caea3aeu, 0x83b30637u,
-	 0xe119f0a2u, 0xa302803bu, 0xb99ae55du, 0xc004bd60u, 0x91e3f590u, 0x64d60b89u, 0xce6379b3u, 0x1e857ad6u, 0x41d7ed69u, 0x3a71586cu,
-	 0xd88a9270u, 0x31ab08eeu, 0xed5a16eeu, 0x7afa69a7u, 0xecc3f2f2u, 0xa87fe81bu, 0xd91c643cu, 0x50434336u, 0x1013a600u, 0x4b74227cu,
-	 0x50a6db28u, 0x8657367cu, 0x085f3c55u, 0x49b6ce7bu, 0xdbc993e0u, 0x21b0d9a5u, 0xed9b9cc4u, 0x85ef056bu, 0xbe590f16u, 0xb3b8241au,
-	 0xca943f43u, 0xb6bbbdc1u, 0x241ac0f1u, 0xc2e579a5u, 0x00d5743bu, 0xb3211a4fu, 0xfe2af8c3u, 0xbce7a985u, 0x3fb8bcd9u, 0x8b6482eau,
-	 0xf7189806u, 0xf429432fu, 0x8854bf51u, 0x658c6ed5u, 0x10da8b5bu, 0x4ed866d9u, 0xed244062u, 0x3a77fa29u, 0xcdbf6e07u, 0xddbea582u,
-	 0x7e7cc595u, 0x88672dffu, 0x44663350u, 0x89434528u, 0x51ef5b09u, 0x48be3437u, 0xee350e13u, 0xccd4db3au, 0xf9b01ac3u, 0xd065d156u,
-	 0xf07e39b3u, 0x202c6ddau, 0xe0f58265u, 0xcf881868u, 0xa4bac229u, 0x4b5f793bu, 0x2d426635u, 0x8a6c2bbfu, 0xa6776056u, 0x39c0e2f6u,
-	 0x306b054cu, 0xdb2282c3u, 0xd2f89236u, 0x29bce426u, 0xe3f8761cu, 0xe00e71a5u, 0x96598fd9u, 0x47151449u, 0xd2831c62u, 0x6b742d7bu,
-	 0xe8cee08eu, 0x18035b40u, 0xecc9f4a2u, 0x2cb5823du, 0x27d99613u, 0xcd58538fu, 0x97c477fau, 0x1ef82965u, 0xf0275f59u, 0x2b528dfau,
-	 0x7ae28870u, 0x583ff5f8u, 0x44851aafu, 0x8c52c8b5u, 0x3147f0f4u, 0xa121d5a0u, 0xc7e0feb0u, 0xd66e8269u, 0x9b955f40u, 0x2fdc47e7u,
-	 0x0abd3fa9u, 0x8e08efaeu, 0xd1094ff7u, 0xb75c2c3eu, 0x577d4b89u, 0xa11bf763u, 0x216c8ce8u, 0x7334b2afu, 0x425dfc0cu, 0xd105200eu,
-	 0x272575b2u, 0x5e4387dau, 0x4f07533du, 0x11321510u, 0x49816e1cu, 0x4fb1e410u, 0x16a14a6du, 0x4b74d928u, 0x303c5588u, 0xdbe678b4u,
-	 0xc079a0e6u, 0x21ddeb77u, 0x3ccd97fbu, 0xe2b168b3u, 0x962cbf8bu, 0xd5489608u, 0x8250c738u, 0x774dbd6bu, 0x3926a756u, 0x1dbd54bbu,
-	 0x0d602df4u, 0x357f3f58u, 0x11eb1bdfu, 0x5b66faddu, 0xd64b6c48u, 0x634bcd72u, 0x28eb0c9cu, 0x40aa0122u, 0x2a3b7fb1u, 0xbb2a956au,
-	 0x35e5d7ceu, 0x157a0b95u, 0x1a61260au, 0x4df3928cu, 0xf7a78c7au, 0x3e6c83ecu, 0x1a0df1dcu, 0x0db7172au, 0x66606ad0u, 0x3ed16012u,
-	 0x3d202c99u, 0x4f6028b6u, 0xa573b18du, 0xe3b75ae7u, 0x86c8a1deu, 0x9e021379u, 0xf9e5e9e5u, 0xed204a7du, 0x54f9b29du, 0x07564280u,
-	 0x278923d8u, 0x5b94f830u, 0xe2005b6eu, 0x14cdeafdu, 0xdaf880fau, 0x81c7825eu, 0x40c379a1u, 0x8a56087fu, 0xfa95c9ddu, 0xef753904u,
-	 0x68ded118u, 0xa984e877u, 0xc06585feu, 0xd18bcd8au, 0xf1073126u, 0x483f1204u, 0xcd283c3eu, 0x66a4b914u, 0xdba0c618u, 0x9e34ffbcu,
-	 0xf7d9c0a9u, 0xd66baadeu, 0x56096c8au, 0xfc65446du, 0xb42a9f07u, 0x052c151fu, 0xacef8ea1u, 0xfa61223au, 0x40c976e4u, 0x7bdc1a62u,
-	 0x424db881u, 0x38d5bdcbu, 0x9b6963f9u, 0x7ea29680u, 0x6f9a6dabu, 0x392916e2u, 0x1f741c6fu, 0x1cd53835u, 0xbefe3b69u, 0xd873fde5u,
-	 0xf8a19ff4u, 0x261a0147u, 0x9d82a31eu, 0xf184e07du, 0xe490bae2u, 0x6855a151u, 0x7f9b4d0fu, 0xdf136026u, 0x63caae21u, 0xcc37f976u,
-	 0x8c50c127u, 0x41b9fc74u, 0x2679cc99u, 0x960ee56cu, 0xe7b3bcf5u, 0xb0a61e98u, 0x052e32efu, 0x3671d8b0u, 0x45c6b1f5u, 0x8fd4e2c3u,
-	 0x9d00a6bcu, 0x7821854au, 0x10d7088bu, 0x8330eb4eu, 0xc4b20c5cu, 0xe039554eu, 0x62da59a3u, 0xe0d449cau, 0x6511d376u, 0x7063e968u,
-	 0xe71ae5cdu, 0xb4689830u, 0xb7653835u, 0xdcdf47bdu, 0x7fb74b73u, 0xfb186e3du, 0xe5d686dcu, 0x3620b708u, 0x77e72c7fu, 0xed02d922u,
-	 0x4d841e39u, 0x6c6f2c69u, 0xe4453c5du, 0x843904bdu, 0xf8e30434u, 0xe8d7ca4bu, 0xe3313789u, 0xb28918feu, 0x95df0180u, 0xef4f844bu,
-	 0x7510979du, 0xa492747cu, 0x7b034bb4u, 0x447d09aau, 0x8914dfd0u, 0xfda693cfu, 0x4de2e911u, 0x98329f76u, 0x454e8b15u, 0x98727cc9u,
-	 0xf8182806u, 0x173bf867u, 0x07e5816du, 0x8eb8ec4bu, 0x1151c76au, 0x498ee34au, 0x6dc519d4u, 0xeb615e93u, 0xfc9d19fcu, 0xde77965fu,
-	 0xd55e6fedu, 0x9af9cbf2u, 0xd20a7c5cu, 0x35ef94c1u, 0xab541b25u, 0xa49cb349u, 0xa722d1b5u, 0x704b2f8cu, 0x2f52cfb3u, 0x184553e5u,
-	 0x51f9d22fu, 0x8fb98718u, 0x406f2530u, 0xe14f3859u, 0xabc62b0au, 0x4dc10207u, 0x898ae341u, 0x52bea469u, 0x7bd1cc64u, 0x7db9c0c6u,
-	 0xf2b8c58bu, 0xc4aaf194u, 0xb5c69ee4u, 0xa572e5c6u, 0xb6e34e60u, 0x6687bf17u, 0xee9ca67cu, 0xbeb3227au, 0x7b5a674bu, 0x060fc341u,
-	 0x50cbef4au, 0xcb7ffcbeu, 0xb0bd3264u, 0xeb85e332u, 0x759d003cu, 0x5a4a4229u, 0x67d5393eu, 0x94455923u, 0x0454bfb7u, 0x3fb99ea4u,
-	 0x942e50adu, 0x18081d25u, 0x226708e8u, 0xcb70cbc1u, 0x803bd7d5u, 0x2d3c927bu, 0xfaa2c559u, 0xca98cabau, 0x8ea53c6cu, 0x57656d08u,
-	 0x48fad889u, 0xfd465867u, 0x307740a7u, 0x88006d98u, 0xb8a26805u, 0xb0d45545u, 0x27b4b6cfu, 0x014e8ed4u, 0xbb272f11u, 0x5f6c8e8eu,
-	 0x4bde02dbu, 0x6bc59d5bu, 0x8f167085u, 0xc916b012u, 0x388907b1u, 0xb982ac3bu, 0x8c58e769u, 0xa5fe646eu, 0xf2bfd1abu, 0xbbbd4dc3u,
-	 0x8f89ea69u, 0xb6935464u, 0x0968e438u, 0x27a2daa9u, 0xa57fb8d9u, 0x7dab6130u, 0xcf3d7a86u, 0x8177844cu, 0xc064f3f5u, 0x5a1b371cu,
-	 0x46fbe3c8u, 0x57d20b96u, 0xdab605a9u, 0xa5fb0eb7u, 0x7c58ec73u, 0x43322f5au, 0xeea89b99u, 0x5dd84505u, 0x635ab6d3u, 0xf47416c4u,
-	 0x29d914d6u, 0x4a173c27u, 0x68a90247u, 0xd9cdfed5u, 0xce45288du, 0xd8982bf3u, 0xea4510feu, 0xa15c0913u, 0xe0908932u, 0x9230d651u,
-	 0x1be32ff2u, 0xc248e882u, 0xd2aa8290u, 0xd51742a0u, 0x56332e72u, 0x1f04c68eu, 0xc7cb7f9eu, 0x133c780bu, 0x9a454359u, 0x1b0d390du,
-	 0xba912601u, 0x7d9e2e54u, 0xf24fce9cu, 0x7edba37au, 0x0316cb0au, 0x38dcab6eu, 0x6607db51u, 0xba5c96afu, 0xa3eb499eu, 0xf52b6cc8u,
-	 0x40fab27du, 0x02f9bf2eu, 0x2c5c1de3u, 0x4b6a6802u, 0x92cbeeaeu, 0x2a54c391u, 0x24ec8dfcu, 0xeff0b4b7u, 0xb2d91728u, 0xe85c4084u,
-	 0x35860fbcu, 0x1bbefffeu, 0x3b635da4u, 0xed079fabu, 0x41e3b671u, 0xadfb52ceu, 0x11f93910u, 0xd7516dcbu, 0x01d59f8bu, 0x5e33d280u,
-	 0x97e98100u, 0xcf88ef17u, 0x7a622c42u, 0xfec30c2eu, 0xd76c0d6eu, 0x9927a666u, 0x7066715cu, 0x3b7ad983u, 0x0398714au, 0xb2f9523cu,
-	 0x42d5af5fu, 0x8ff536d8u, 0x287f42e0u, 0x00f3d3a6u, 0x784cbc14u, 0xf8c57d92u, 0x4127c875u, 0xc51b1f53u, 0x558b1772u, 0x3603ffa8u,
-	 0xfb0436e4u, 0x285e8bb5u, 0xbca0dc6eu, 0x24aa016du, 0x3c39243eu, 0x6d1805f3u, 0x8799fd90u, 0x431071c7u, 0x605cb4d6u, 0x7618395du,
-	 0xff7f8a2cu, 0xdef6faa1u, 0x6c42a966u, 0x6a922fbeu, 0x7b978243u, 0x9badbe0au, 0xf3805fc5u, 0x66ef2b53u, 0x7a8f5213u, 0xe6a52099u,
-	 0x87c3a580u, 0x4311c441u, 0x196ef35au, 0x0559c2ebu, 0xd50c9e9bu, 0x6805d8aau, 0x9c8a5655u, 0x4c0ac9d5u, 0x1c90ed45u, 0x5642fbbeu,
-	 0x2fb1b40cu, 0xcf73a956u, 0xdd0814c7u, 0x33822c9cu, 0x306572bfu, 0x305c5d79u, 0x543f3642u, 0xa25f86f2u, 0x32c02c9fu, 0x09e35398u,
-	 0x341be4bdu, 0xdf8b6b27u, 0xb797cd30u, 0x06212b22u, 0xb3719069u, 0x0907007au, 0x578317d7u, 0x60e437dcu, 0xf593f664u, 0x5252ef01u,
-	 0xd5e20bf6u, 0x8494e881u, 0x1b7cf161u, 0xe7a1036bu, 0x569e9995u, 0x680f1731u, 0xe6a7d832u, 0xb8de6996u, 0x3e34ce02u, 0x414b54a7u,
-	 0xe2ef1dacu, 0x7ee5a8f2u, 0x2810fe51u, 0x21544595u, 0xcbe22a2cu, 0x0892e7dcu, 0xab66d9e3u, 0xf08a2864u, 0x8b293dccu, 0xce85e583u,
-	 0xdf104ce2u, 0xd09a8a40u, 0x44ad517eu, 0x49d4db4eu, 0xd4f4b33au, 0x5c770a33u, 0xfc1ad401u, 0x9362a381u, 0x2047c8f2u, 0xf52d4199u,
-	 0xc98c8a7bu, 0xd8cd75c5u, 0x3a2dcd09u, 0x1e9c467eu, 0x0e2d124fu, 0xf0406e54u, 0x6dcef901u, 0x36e96fdcu, 0xff713e8eu, 0xac13f385u,
-	 0xb64a9568u, 0xb20f2febu, 0x920a8ad5u, 0xc82dc8f8u, 0x0c3149c0u, 0x2740416eu, 0x06a6ea60u, 0x9aeb0f32u, 0xf71561dfu, 0x3986098cu,
-	 0xe0babd77u, 0x343b02c1u, 0x725642e6u, 0xb96f898du, 0x973e1371u, 0x0258f41eu, 0x5ecb053au, 0x3b790332u, 0x7090b147u, 0x2ca0b472u,
-	 0x3a0f4f64u, 0x122c1450u, 0x90952f20u, 0xf2af5ec6u, 0x78215b27u, 0x74fde933u, 0x63f89ce7u, 0x6d5e9a67u, 0x09e7e8edu, 0xfccfdce0u,
-	 0x4f7720edu, 0xd12af15eu, 0x63131273u, 0x5ff9c77bu, 0x5205fc99u, 0xddaf5587u, 0xdd2661f7u, 0xc25fcd43u, 0x817d5d5eu, 0x4ff47bacu,
-	 0x468653d2u, 0xc945b063u, 0x994676f6u, 0x5726b69eu, 0x4b09ea7cu, 0xeaee1ce5u, 0x7eeb30b2u, 0x676c0fa1u, 0x55fb3f8fu, 0xcd18388eu,
-	 0xaf0b18d0u, 0x6119a589u, 0x5081ed51u, 0xf2943c7bu, 0x697b8372u, 0x8bdc249au, 0x3b692852u, 0x8144efbbu, 0x6c0824d6u, 0x46191122u,
-	 0x1f56e023u, 0x1fee54dcu, 0x7bec9b97u, 0x6d52e560u, 0x256715b5u, 0xbb4fdeb9u, 0x0c3fdcb2u, 0xdae6fe53u, 0x78a1216au, 0xe0543195u,
-	 0x1b3def2fu, 0x7296f878u, 0x5cf0d0b2u, 0x9958debbu, 0xedceabe8u, 0xaf50c130u, 0x03e2568du, 0x506097efu, 0x98d3846du, 0x93d5d546u,
-	 0x9bbb1c61u, 0xce04e18eu, 0x88667ad8u, 0x6f4eb936u, 0x5a3495c8u, 0x7716f880u, 0xfd88c5edu, 0x983efa10u, 0xccc0688au, 0xd6367c44u,
-	 0x60696c1du, 0x125c738bu, 0x84f3fac2u, 0x3aa00cc9u, 0xc7b3a1adu, 0xc8500e2cu, 0x4ee185f8u, 0xb1521b0cu, 0x14257d05u, 0x5ed00428u,
-	 0x6684cbacu, 0x4f1d9ad9u, 0xb86160b1u, 0x9d6b7eefu, 0x102016b7u, 0x5cfa25fdu, 0x62645cfau, 0x84ffb316u, 0x2b68d795u, 0xe00f33e3u,
-	 0x140a6293u, 0x88b73faau, 0xeee7d571u, 0x3d507493u, 0xe3a216fcu, 0xe35908bdu, 0x8ccab9f2u, 0xa2d5cd67u, 0x2691e01au, 0xf43fcf61u,
-	 0x88ac26efu, 0x97cccd44u, 0xcb2a77bcu, 0x2c9f61a2u, 0x2a66db39u, 0x5375ead0u, 0xb842ee50u, 0xa9cad6d8u, 0xf43d108eu, 0xdcfd11d8u,
-	 0xe117a89eu, 0xad583911u, 0xfa264450u, 0x9e1680cau, 0xef203163u, 0x96c6cbd3u, 0x706e0fbdu, 0x0ba86401u, 0xefaf20cau, 0x8682144bu,
-	 0xbe4cc98au, 0xb10fe661u, 0xb1de4e1bu, 0x709a37f9u, 0x260ffed2u, 0x5e55a4f6u, 0x932c8302u, 0xf5366301u, 0x1ed389dfu, 0x279aeec5u,
-	 0x6824f849u, 0x9845994au, 0xaffbe329u, 0x0dcc0dd3u, 0x32b8157cu, 0x8c2c4edfu, 0x7d073c84u, 0x85ea5e33u, 0x6fc2d879u, 0x2c96d422u,
-	 0x10c74702u, 0xf2b58ce2u, 0x605e59dbu, 0x40040aa0u, 0xb9289235u, 0x79cc3d3eu, 0x8bfcb994u, 0x420fbb20u, 0xe5e8ba4fu, 0xd2b58d93u,
-	 0x46bf7c41u, 0x5ea49d2au, 0x8f68f03eu, 0x31c5fe17u, 0xbaa12f41u, 0x54ac4640u, 0x8e173501u, 0xe21a1b85u, 0x8b6f334du, 0x545fc46cu,
-	 0x2f0517e4u, 0x8bca3aa6u, 0xd1c44419u, 0x327b6eb7u, 0xe9e03e74u, 0xc86eaf9au, 0x98b9887au, 0x6d05b37du, 0x4d932ba5u, 0x96d6dbceu,
-	 0xa8b31302u, 0xd9195fdcu, 0xb4d0ff58u, 0x50468eeeu, 0xf31cd75du, 0xe90d1f8bu, 0xb8f8575bu, 0x62dfcab2u, 0x8e771222u, 0x63d2db05u,
-	 0xefbf5156u, 0x108c3c2cu, 0x1b62c128u, 0xfcecc64bu, 0x9d2a8953u, 0xb40d17d6u, 0xc3946b3au, 0x3ef9ce33u, 0x37b43559u, 0x29c0d1f5u,
-	 0xccbb60edu, 0xa88c5ea9u, 0x843b528eu, 0xb8c647cbu, 0x19348cf8u, 0x35f685a9u, 0xd0391572u, 0x05c4cf1eu, 0xa28738e0u, 0x22d1e8ddu,
-	 0x473168afu, 0x08d7abbbu, 0x6aa78bc2u, 0x44ee0735u, 0xb7a02b47u, 0x16922ddbu, 0x72999ca1u, 0x87e1014bu, 0x5358c7dau, 0x6c2baf8bu,
-	 0x799f18c8u, 0x3f557456u, 0x78245f14u, 0xf4b23dfau, 0x998db728u, 0x58438c98u, 0x5c8e67ccu, 0x0fee8b86u, 0xb31ea1d8u, 0xe6dacd16u,
-	 0x3cb2e07eu, 0x417924f6u, 0x645fd84fu, 0x926ed688u, 0x3f2e1582u, 0xf7dc245du, 0xa6cd2a11u, 0x3c18d2e8u, 0x69f2a415u, 0xd1696479u,
-	 0x853a2d89u, 0x1296fd67u, 0x2a69f58cu, 0x0b4cc362u, 0x7aaddbacu, 0x96d01708u, 0x91c47627u, 0xebad85a4u, 0x4987d149u, 0x2bec8e82u,
-	 0x69f34a6au, 0x2eaeadebu, 0x75812b66u, 0xfa3324e6u, 0xd31d7e70u, 0x2983ea5fu, 0x884e196cu, 0x4544cc49u, 0xd3574e30u, 0x4299b089u,
-	 0xaf687031u, 0x407f4f1du, 0xadef4d40u, 0x95f8d368u, 0xa4d35bc5u, 0xea1f460cu, 0x475f9eebu, 0x7d53d335u, 0x3d49c711u, 0xa7855f63u,
-	 0xd9c36bb0u, 0x78381613u, 0x16e8438fu, 0x58756eb3u, 0xd7da64beu, 0x01811679u, 0xda3cd691u, 0xf26d7662u, 0x167d4992u, 0x014f3372u,
-	 0xaf8fa64fu, 0x51668e5eu, 0xbd1b0d6fu, 0xf17f336bu, 0x60d174a1u, 0x5155e146u, 0x4730c191u, 0x87e61736u, 0x38304e85u, 0x0bab7174u,
-	 0x6d383c23u, 0xfd4c9023u, 0x3bf75da5u, 0x36302b5eu, 0xe6587b08u, 0x5fffea19u, 0x40bf5fdbu, 0xaf35f468u, 0x48054cacu, 0xbc13c6f1u,
-	 0x56b8b173u, 0x578a0c47u, 0xc8e30e80u, 0xf7cc9aa5u, 0x9e0bdc59u, 0x3d9dd79eu, 0x55e82504u, 0x0a9b0524u, 0x91ab466eu, 0x03427eb5u,
-	 0x3a3e7a31u, 0xe8c1db33u, 0x5458d17cu, 0x43e36e0fu, 0x5cbf681fu, 0x23260e53u, 0xbe0a395fu, 0xd9cc738fu, 0x728ca654u, 0x29890101u,
-	 0xe5ebd0b9u, 0x8d410d3fu, 0xb8e86f08u, 0xc5033be6u, 0x9f3472b8u, 0x98e30881u, 0x12809785u, 0xd1ab097du, 0x384f2729u, 0xf186c53du,
-	 0xb95228d3u, 0x77a0cabfu, 0x43204912u, 0xfb9123c1u, 0x5fb9e04cu, 0xd225dbd8u, 0x4c473f66u, 0xea5ea255u, 0x5fc5cfb0u, 0x17a9b67eu,
-	 0xb6d6c81eu, 0x59f39d2eu, 0x31db9cfeu, 0x22534cb1u, 0x7d824c2fu, 0xb729f7f1u, 0x3ae4a944u, 0x371d73dfu, 0x49587fc2u, 0xa2e2c25cu,
-	 0x8e7e51a4u, 0xd5646351u, 0x8348f69au, 0xcc622bbeu, 0x1430003au, 0xef48c5b9u, 0x925afa86u, 0xe90ea50cu, 0xd5f73ac2u, 0xbe8a1095u,
-	 0x006aa920u, 0x882d52f7u, 0x50b6072fu, 0x96fa56e3u, 0x1e79fe74u, 0xff31a048u, 0x662c8bbcu, 0x9ebaa116u, 0xfff70158u, 0x6ecd921au,
-	 0x5e14e56au, 0x2ff849dfu, 0xbb2394e6u, 0x99d7d2d8u, 0xeef47e46u, 0x312d3d97u, 0x306686d2u, 0xd35ffe90u, 0x6a005fb4u, 0x6eec876fu,
-	 0x421db68cu, 0x50cc6504u, 0xe1129cddu, 0xc983bcd9u, 0x9d001475u, 0x681150f2u, 0x6c5d35adu, 0x6a6ab298u, 0xcead92bau, 0x79ff02ffu,
-	 0x11630555u, 0x39bb7609u, 0xa2fc7f7cu, 0x02ccb78bu, 0xb590045eu, 0x1a63a8ebu, 0x375cb1ccu, 0xba95c8edu, 0xc984d9e1u, 0x98d903b2u,
-	 0xf607ed31u, 0x9d0f81d7u, 0x7ada1b12u, 0xc7d819b8u, 0x825aecf9u, 0x013484f4u, 0x61de2a8bu, 0x8f7ab5ddu, 0x95379804u, 0x548033bdu,
-	 0xd5aa03d2u, 0xf0fadc4fu, 0x12818940u, 0x8f5a3228u, 0x4f366a9au, 0x79357066u, 0xc5f4b140u, 0x9af89318u, 0x2af0520bu, 0x9e4d223bu,
-	 0x7e88a051u, 0x049a8e9au, 0x5f1bc1b0u, 0x8a65ad19u, 0x2d4b618au, 0x4fa752fdu, 0xfc21452fu, 0x1f0e4140u, 0x8526f567u, 0x8d720f23u,
-	 0x7020e273u, 0xe04fd06du, 0x5039644cu, 0x8b3872feu, 0x3d270dc6u, 0x98d4888cu, 0xf13f108fu, 0x745fcd37u, 0xde43e0fau, 0xb2336903u,
-	 0x5be1f6beu, 0x2d9b153fu, 0xf8fc3744u, 0x6b8eab16u, 0x35c23a72u, 0x9182afeeu, 0xe7e19b94u, 0xa5922f39u, 0x27330804u, 0x3b93e669u,
-	 0x921231abu, 0x4d0c2103u, 0x4157cb71u, 0x75cf1f85u, 0xb41f1aabu, 0x0d513b3du, 0xe0e8d400u, 0x6a973d79u, 0xa885906au, 0xf8b186cau,
-	 0xcb56542du, 0xe3033f82u, 0xfbd14b70u, 0x93f6f35au, 0xde0a8264u, 0x8d4bcaa6u, 0x5a53a405u, 0x58dcfa8fu, 0xdbe20b14u, 0x451f5067u,
-	 0x82f9ee6du, 0x07a7060au, 0x6a2dc650u, 0x21300241u, 0xc2212ed7u, 0xbc4134ffu, 0xea8d84f5u, 0x7b34afb5u, 0x82fca013u, 0xf7990bc1u,
-	 0x3a3344fau, 0x98e65075u, 0x4969ef6du, 0x3acb542cu, 0xd1b187f5u, 0xc84c7e8cu, 0x8f1d5fcdu, 0x26bab24bu, 0x356677d9u, 0x0a4fe242u,
-	 0x24e51d03u, 0x6d5f44a0u, 0xc44f7411u, 0x47398adcu, 0x4a22c621u, 0x35f2e4c8u, 0x7d41566eu, 0xa08a86a6u, 0x6dfc16f3u, 0x6c579a17u,
-	 0x89050669u, 0x46f027c2u, 0x5b21a357u, 0xd6943b46u, 0xe629d500u, 0x6eb87a4eu, 0xd3dbfb98u, 0xc816aeb3u, 0xa5938ffdu, 0x9f3c974du,
-	 0xc7672003u, 0xb0a3c422u, 0xebdc856cu, 0xb99f8c06u, 0x750dc85eu, 0x77f0e4cau, 0xba16d056u, 0x8e6f7435u, 0x4cc18018u, 0xf64c5a9cu,
-	 0xdd22a3d0u, 0x0c19c490u, 0x1d4e0ba1u, 0x3b2e6c6du, 0x5ecae046u, 0xa42c5f85u, 0xe19de471u, 0xd93d9e43u, 0x8ebeed59u, 0xacc7317bu,
-	 0x9493077au, 0x6827a7f2u, 0x17fddbabu, 0x710c7f4du, 0x025f249bu, 0x0ff0f00au, 0xdfc71799u, 0x172e96a6u, 0xc18ad018u, 0xe90e73b2u,
-	 0x3224d30au, 0xe356cdbdu, 0x08e51172u, 0x9fd83a5au, 0x3e5da169u, 0x139ba4d1u, 0x22a77a1du, 0xfa7bf6b1u, 0xbb1be93cu, 0x78ffcf3fu,
-	 0x5646b2d5u, 0xc6562990u, 0xfd396f60u, 0x304238c5u, 0x0a57070eu, 0xe8ea4382u, 0x69c2ee12u, 0x439c55fau, 0x7f486cfbu, 0xb139403bu,
-	 0x449a3738u, 0x1980c815u, 0x6a74253cu, 0x020b41a1u, 0x76b7ef04u, 0xc7930c8fu, 0x8ecb2df3u, 0x60612ea9u, 0x6733ea0au, 0x2450e00eu,
-	 0x70021697u, 0x4c66309fu, 0x679ffb56u, 0x2479456du, 0xd75c461du, 0xfca344e3u, 0xf0c79e1du, 0xd948dbb9u, 0x3d3a4616u, 0xdecf55f6u,
-	 0x5b2ab0b5u, 0x6b7b3eefu, 0xabc7bee9u, 0xdaf01fe7u, 0xa4041d2bu, 0x2b4d9f4fu, 0xa89596bbu, 0x16b340b5u, 0x5377bf94u, 0xd166c70fu,
-	 0x22766063u, 0x4439f3aeu, 0xcd034f55u, 0xce6000f5u, 0xcf8b26a0u, 0xfa33400au, 0x95de71cau, 0x251f996bu, 0xb400a836u, 0xfacd90deu,
-	 0x2bd2c9b5u, 0xdf905fe7u, 0xcddd8842u, 0xa5112ecau, 0x005c162bu, 0x6ac10b8cu, 0xc996da1du, 0xc2adba0bu, 0x18629a44u, 0xee9e27ceu,
-	 0x2839f94du, 0xe66b0bcfu, 0x031d7378u, 0xc939a940u, 0x1fed764du, 0xc657f26fu, 0xe32810bau, 0x9f58b2bdu, 0x84e385c9u, 0x7ea2b886u,
-	 0x9f9cb152u, 0x61db4e88u, 0xfc09cbc7u, 0xd0226bb6u, 0xa4fccc19u, 0x80fe0d0fu, 0x65b39a83u, 0x1bfa35d8u, 0xc123cc98u, 0x1007a8e1u,
-	 0x88c020c1u, 0x5960f446u, 0x4d9549b8u, 0xd128ff85u, 0x58009caeu, 0x7d6e46d0u, 0x43c16b52u, 0x246421bfu, 0x7c2ad134u, 0x3641e63cu,
-	 0xb4cee51cu, 0xebd546a1u, 0x0c111d4fu, 0x63549839u, 0x02d8929au, 0x34010865u, 0x5f372e2eu, 0x3223963eu, 0xd47be79du, 0x0df2069cu,
-	 0x635ac9f5u, 0x3f606e89u, 0x54c48104u, 0x7839ac99u, 0x905f7a44u, 0x62e3384cu, 0xfb8be3bfu, 0x1de328dcu, 0x7f6a2442u, 0x91ce83b5u,
-	 0x1e559551u, 0xd074bfaau, 0x8062fb45u, 0xcc76c2d4u, 0x8a0fa8cdu, 0xc12d67d9u, 0x2b93afcdu, 0x19ff63afu, 0xb4640936u, 0xaa7890a1u,
-	 0x6af96177u, 0x74f140d4u, 0x1828f19fu, 0xdd879b76u, 0x0da44567u, 0x5873d92bu, 0x8285ba36u, 0xb3855bf1u, 0xe8c43d8du, 0x5c48bbe1u,
-	 0xb9e9a530u, 0x959208a0u, 0xe7d6b015u, 0x4d747397u, 0x514154a2u, 0xb7bc95e3u, 0x660ec453u, 0xc1e2cf44u, 0x593f8836u, 0xf4a55ed7u,
-	 0xe9142490u, 0x01df50fdu, 0x8162a8fcu, 0x35faf621u, 0x972054feu, 0x016b0196u, 0x09a6de32u, 0x78453569u, 0xf71aec8eu, 0x662d6c9eu,
-	 0xbac06f72u, 0x68b89065u, 0x407faa1du, 0x92f00129u, 0x2690131bu, 0x04ddc4adu, 0xda4eec8du, 0xe9c55d2eu, 0x26c86de2u, 0x8ea6d0f7u,
-	 0xed79fb25u, 0xfe2fe45du, 0xc61111d5u, 0x50e9f53fu, 0x9accc910u, 0xbf64fa4du, 0x314d0d18u, 0xff982f43u, 0x3d5d8c48u, 0xfa3d617cu,
-	 0x93f65ebbu, 0x09621cdfu, 0xf9472a15u, 0x5ff82948u, 0xa8a59ee7u, 0x759202c5u, 0xc58cdc42u, 0x0dcce018u, 0xe004ae8au, 0x6a410726u,
-	 0xf0bab4a4u, 0x992e539eu, 0x065680c2u, 0x762334cdu, 0xd9a7d344u, 0xfadbe714u, 0x3d5fde9eu, 0xe3dc29fdu, 0xe8add92eu, 0x81da3a84u,
-	 0x492f33b6u, 0x0fa6d53du, 0xe2709e50u, 0x525936e8u, 0x00926f69u, 0x8af34df1u, 0x632188e9u, 0x864f6dd7u, 0xc1809847u, 0x42887c03u,
-	 0x7f8a56f1u, 0x0b8710c5u, 0x568d2118u, 0xf697b6ffu, 0xefd7ab21u, 0x2c5f389eu, 0x1af28990u, 0xcaaf4a54u, 0xf67d2115u, 0x286bd7eau,
-	 0x6e9393c5u, 0x6d5315e4u, 0x1e423a7eu, 0xbaed6ff3u, 0x54e5f870u, 0x4fa00239u, 0xd14587b9u, 0x900e83e9u, 0xc56f87d9u, 0x43c7c318u,
-	 0x073886cfu, 0xc2b36a9fu, 0xf73393b8u, 0x8f009c2du, 0x3fcffb72u, 0xf59dab7bu, 0xb6402cc9u, 0x0eadc710u, 0x08a97ac9u, 0xf9228e5au,
-	 0xd318484bu, 0xca9e1be6u, 0x544028feu, 0x6f7620c8u, 0x421bc553u, 0x02f56366u, 0x92357d02u, 0xa6ead710u, 0xf709778bu, 0x805960bcu,
-	 0xa749ccf9u, 0xd0f52bdfu, 0x4550b842u, 0x5952bf47u, 0xba0b0119u, 0xb55e2becu, 0x74ed6d75u, 0xeb64e601u, 0x0cdb2e30u, 0xd47bc0ccu,
-	 0x254b4976u, 0x9ca80d89u, 0xceb1ded3u, 0x32caaec0u, 0x99a21bceu, 0x14f4e91au, 0xb92b1cb0u, 0x8bea95c8u, 0x13521748u, 0xaa2f2e28u,
-	 0x2a3eeb96u, 0xb34518adu, 0xdcaf4a46u, 0x6e63cb53u, 0xd7ae4d35u, 0xa2429c21u, 0x8b2ef125u, 0x605503a7u, 0x7287a362u, 0x3b29dfb9u,
-	 0x5c9a5084u, 0xca6e1683u, 0x59c84476u, 0x1f7baa42u, 0x43ae4f4bu, 0xe42ab0b5u, 0xadd7182cu, 0x49d04c66u, 0x716bd07au, 0x42cc6638u,
-	 0x160789b1u, 0xe4184213u, 0xfc81e668u, 0x5b4c3adau, 0x5582ffceu, 0xfb5ec7b7u, 0xa6b7ea0au, 0xe080c1f4u, 0x69fd01d5u, 0x86b76698u,
-	 0xfc3aedd0u, 0xa9e7a600u, 0xecc222cau, 0x0f0ea124u, 0x3a8866c8u, 0xb463196eu, 0xe0997faau, 0x45bdeaf6u, 0x31ff628cu, 0x90bff15du,
-	 0xb2fddf36u, 0xd88cf04au, 0x2d1b7426u, 0xb683582fu, 0xf47ebc6du, 0xe52fa47eu, 0x16d4f49cu, 0xdec50824u, 0x7f634cdau, 0xbf8b9c6eu,
-	 0xa167f4e1u, 0xc6d40926u, 0x539acdbcu, 0x6020a140u, 0x0bed263cu, 0xc26144adu, 0x3a641ce4u, 0xc066ae3cu, 0xeb8872e8u, 0x3739fa67u,
-	 0xb3f10277u, 0x94a31e90u, 0x3bcb75ebu, 0x91846540u, 0xa6dcf021u, 0xa4f2613cu, 0x82be65b3u, 0xf63c917eu, 0xccd35af3u, 0x9bab07e9u,
-	 0xffa5a7f2u, 0x2947f030u, 0xf041307au, 0x5645bdf9u, 0x1d0ec7e6u, 0x6751bd91u, 0x2bd006f0u, 0x2417ebb0u, 0xd61ed5fcu, 0x946a74d9u,
-	 0x03eafa0au, 0x655692b3u, 0x671000deu, 0x82478e11u, 0xa1fc6ce1u, 0x7d1d3532u, 0xa5bed3ceu, 0x921bf2a2u, 0x0bb22501u, 0x6943984au,
-	 0x3f8f1ac8u, 0x7f060bc0u, 0xa74c1734u, 0xe4d90c77u, 0x335ac24cu, 0xc14e5bf2u, 0xd67853f7u, 0xd2be0cefu, 0x5454a698u, 0x23fc0938u,
-	 0xb6f19298u, 0x086162eeu, 0xa31b99ccu, 0xcb1c50a8u, 0x096af6deu, 0x96cf932fu, 0x075e9089u, 0x8b5d38cdu, 0xe2743a2du, 0x4f9a41b8u,
-	 0x3cec87bfu, 0x48861048u, 0xc0624d27u, 0xb7ffb68au, 0x5ab4ad0eu, 0x2342be8du, 0x5639b3f9u, 0x298c37c5u, 0xc5f79e43u, 0x01516aa0u,
-	 0x9fd23469u, 0x30d4a688u, 0xfe602939u, 0x352b15c2u, 0xb5cdda6du, 0x7f03d46cu, 0xfca06ecdu, 0x012fe6e1u, 0xc3df19a5u, 0x86b91fd1u,
-	 0x4622af73u, 0x0d5a7907u, 0xc2fa185bu, 0xb46a8870u, 0x55fc7e64u, 0xb9ea1435u, 0xcb47c1f1u, 0xd9f6ce88u, 0x0db586f6u, 0x2aa1eb77u,
-	 0x98fae3c3u, 0x0f446f02u, 0x8279c3d8u, 0xa35b123du, 0x30ee2472u, 0x29f2c49au, 0xf692c7c0u, 0x4bb1dc7eu, 0x8212d6b9u, 0x4a3ded6au,
-	 0xf141bcbdu, 0xc2f0dcb8u, 0x7585ad40u, 0x667b270bu, 0x34c38d13u, 0x35d80637u, 0x9672b43cu, 0xf6b0917fu, 0xc054271cu, 0xa598545du,
-	 0xe856762eu, 0xa78ec02du, 0xf29ecad1u, 0x6cda9ecau, 0x907a9617u, 0x77831baau, 0xdfddabccu, 0x11d7027du, 0x84dea1afu, 0x9c1678b6u,
-	 0x2be3bfc5u, 0x64c343fbu, 0x1ec54663u, 0xa021bf39u, 0xb40305c8u, 0x39ee5bf0u, 0x809bb138u, 0x6d7ac203u, 0xe1d89804u, 0x92bea8d3u,
-	 0xd8bbcd73u, 0x63bd63b4u, 0x99ccbb36u, 0xbe1efcd8u, 0x03f2ae46u, 0xea828dfcu, 0x692aeffcu, 0xb2a100ddu, 0x968f4737u, 0x22caf363u,
-	 0x92db9af1u, 0xbad2b5afu, 0xf66b05a5u, 0x67a93e3fu, 0x8f8eb203u, 0x63ac3604u, 0x37f2a3bbu, 0xc91aef58u, 0x37f9bc44u, 0x178f5699u,
-	 0x45a17efcu, 0x36eeb9efu, 0x842739dbu, 0xaf1d938eu, 0xedfc4026u, 0x2190ec45u, 0x478c939cu, 0x2b5062abu, 0xf2a51dfbu, 0xfb173857u,
-	 0x54205f3fu, 0xf6c307ebu, 0x930bd1bbu, 0xb6fd4ce0u, 0x86e1de63u, 0x15074395u, 0xe1d4c800u, 0x9612ef1eu, 0x483676b2u, 0xbeebe6bbu,
-	 0xa587e0d2u, 0xf083af62u, 0x2599f34fu, 0x70d5ccdau, 0x353bf604u, 0x6108b52eu, 0x447f60c3u, 0xb962862au, 0x1095af8cu, 0x2a601aabu,
-	 0x894ec1cbu, 0xd1a96d2fu, 0x8d5c7d32u, 0x7bbb1b70u, 0x948f144fu, 0x41ff5907u, 0xe09e9bddu, 0x200e1b84u, 0x1e28c618u, 0xba93e873u,
-	 0x9704abdcu, 0x91c41846u, 0x88db553fu, 0x07a1714cu, 0x7a00a92du, 0x0d2767c8u, 0x974c7740u, 0x5c7d1ba8u, 0x21742854u, 0x96a45a81u,
-	 0x58440f41u, 0x69c496a3u, 0x83b63a8au, 0x31a1fb25u, 0xf8d37c8cu, 0x904a928cu, 0x46fd5330u, 0x62844437u, 0xd1f59c43u, 0x368c0926u,
-	 0x28c54bf1u, 0xee36764au, 0xdbae22d2u, 0x36defc25u, 0x263bfb37u, 0x71efd61au, 0xa5ad40e2u, 0xe8dcee21u, 0x30a1bb7cu, 0x9719203bu,
-	 0x4bea54d2u, 0xa74e4544u, 0x4c2c6bcdu, 0xe3dbc6a3u, 0x038cec57u, 0xfcaab7eau, 0x793e5a99u, 0x062c2b09u, 0x0969667au, 0x88a8f331u,
-	 0x69df2c2au, 0xfc30a974u, 0x117698f8u, 0x224ee947u, 0x785d5b03u, 0x6f577c3bu, 0xe7b2ea03u, 0x1ebe93cbu, 0x66e0f637u, 0x32756866u,
-	 0x0e3a4613u, 0xe7bb892eu, 0xabf80564u, 0xf8ef16d5u, 0x8641720eu, 0x7f973030u, 0xeeb64728u, 0xae712e0bu, 0x1c16deebu, 0x540a72a4u,
-	 0x4c046a92u, 0x2380004cu, 0x8975b779u, 0x15795a8eu, 0xae4f3b1du, 0x297edd6cu, 0xea073702u, 0xe36ba03eu, 0xfcb77858u, 0xfde7cf7cu,
-	 0x4d91cba6u, 0x4aa6e4b8u, 0x44416e2du, 0x6b3c7a7au, 0x9cb122feu, 0xdb678e3bu, 0xe6f4715fu, 0x46d1d25au, 0x12e58d01u, 0xe252b844u,
-	 0x520d4219u, 0x3a1f1711u, 0xed17fd6cu, 0x9d3fbd4bu, 0xe88a23aeu, 0x0af4aa3du, 0x441c2cf9u, 0x40c5f592u, 0x58ee47d6u, 0xc4513efeu,
-	 0xfaca9e8au, 0xe0b59874u, 0x03a8e431u, 0x86cc0be8u, 0x53835df8u, 0x58bafb2eu, 0x21739798u, 0x230c86bdu, 0xec6ef6fcu, 0x184445ecu,
-	 0xaeddb08du, 0x532cf593u, 0xeee31040u, 0x1bb52435u, 0xd0ce5ee1u, 0x043e541bu, 0x87863b12u, 0x7ae34b6au, 0x4161be9eu, 0x3d9444b9u,
-	 0x6e9ae691u, 0x06fc9a1cu, 0x5ba570b4u, 0x7977b5f0u, 0x2aab1bfdu, 0xf9f5ee4au, 0xd5f9b99eu, 0x20c4897cu, 0x70f54efeu, 0xe2935152u,
-	 0xb323913cu, 0x5d2a3665u, 0xdeba7028u, 0x2b522e1fu, 0xd6d93548u, 0xa0700c10u, 0x4cba2892u, 0x81a2f6d1u, 0x7908f704u, 0x4cf74783u,
-	 0xcc079b6du, 0xa042518du, 0x66615c04u, 0x591afaadu, 0x1a56927du, 0xdb02976du, 0x8567c3a4u, 0x828a515bu, 0x41eb1a0bu, 0x57e5c7f1u,
-	 0x66f06578u, 0x1f0cdacau, 0x4986292du, 0x470b55a0u, 0xb97af2ceu, 0xf80fd412u, 0x827d1214u, 0x339009bau, 0xc1bae1ccu, 0x6ecbe09bu,
-	 0xb02c87c2u, 0xc8e625d5u, 0x9f65a1f1u, 0x4f2a3447u, 0xfefe87efu, 0xfb06a51cu, 0xf9afd4fcu, 0xf5a99ac2u, 0xd370c1d9u, 0x13d0bee9u,
-	 0xe263bc2cu, 0x12955cc0u, 0xca3f9e66u, 0xbed0621cu, 0xfdf9ea3au, 0x1ade3d8fu, 0xc097dcafu, 0x53b63591u, 0x1147e1c9u, 0xbd094050u,
-	 0xea3028c5u, 0x3d97aec4u, 0xfc48b371u, 0x506bf04cu, 0x402b28beu, 0xb6c12ab7u, 0xffa4f336u, 0x3c6f620bu, 0x06208a44u, 0xbd81aa2au,
-	 0xd2edfe3eu, 0x5f10dd0au, 0xdb712e47u, 0xad11d92bu, 0x2cba7a5au, 0x1e024225u, 0x29ef004fu, 0x773aa701u, 0x2d09226bu, 0xcc2af6a9u,
-	 0x9fc1adccu, 0x519e744fu, 0x7128e27cu, 0x994fe236u, 0xc250ce14u, 0xccb8f95eu, 0x31e948b7u, 0x95b08101u, 0xc83252cfu, 0xda1b5bc8u,
-	 0xbf56cbd0u, 0xe7fe0c4cu, 0x4b9eba43u, 0x17073dc5u, 0xcb40598cu, 0x1d540e8du, 0xc2bb18c1u, 0x1fd4a291u, 0x7fc6e0b6u, 0x038cfad2u,
-	 0x520b2cf7u, 0x234e4c4fu, 0xbab4ca5eu, 0xe56cd019u, 0x089f017fu, 0xdccf237fu, 0x15db6c33u, 0x61946ea2u, 0x5b2f6135u, 0x2cb24431u,
-	 0xf175d918u, 0x90f52999u, 0x69b629e5u, 0xf7d39e5fu, 0x99ba7101u, 0x637fbe17u, 0x1cc21d6cu, 0x6f72db61u, 0x6000894du, 0x8fb9cf09u,
-	 0x587c4d20u, 0xd19c2f4fu, 0xe6197f64u, 0x93778e2cu, 0x900020acu, 0xb37dc171u, 0xfc90bde1u, 0x6c3f03b1u, 0x10a992f8u, 0x8358552cu,
-	 0x0cf23299u, 0xb8b05743u, 0x63960bedu, 0xc7b39ec7u, 0x5e4148bbu, 0xb3f4ba49u, 0xd6b8c2e0u, 0x7e467cd6u, 0x9d773588u, 0x743c14f4u,
-	 0x56001b9au, 0x326490feu, 0x9c8da7fbu, 0xc33bcc62u, 0x53aea71fu, 0xd7476b3cu, 0xe1cb3d6au, 0x7b26c418u, 0x4f24f711u, 0x95ad4745u,
-	 0x2d95c7aeu, 0x26ad1663u, 0xdc02a6f6u, 0xab04a174u, 0xd22b96cdu, 0xb4d4f10eu, 0x4e2d1fb6u, 0x581a5540u, 0xd33c5351u, 0x0c43c558u,
-	 0x6b6232b0u, 0x7e68622au, 0x1dd36a19u, 0x46ba9220u, 0x6090f9a5u, 0xde350583u, 0x2bbfecd7u, 0xf582ad2bu, 0x119932ebu, 0x4120575du,
-	 0xaa48c413u, 0x2fa6ab16u, 0xc83931f4u, 0x936684a1u, 0x3ba19314u, 0x479db928u, 0x9657d3f1u, 0x7d3859ccu, 0x893f2529u, 0xaf8b4ea3u,
-	 0x389c50e5u, 0x049cb5e6u, 0x8289d1e1u, 0x21272969u, 0x20319e6bu, 0xe10a315cu, 0xe1f32febu, 0xb50dcb2fu, 0xfb5a5a1eu, 0x9ea54644u,
-	 0x49b27bacu, 0x3ef341ebu, 0xf7a7b319u, 0x4c7b3f39u, 0xe9fb963au, 0xaa3b965du, 0x3cd06a06u, 0x3ee017bdu, 0xce277b07u, 0xb5bf86abu,
-	 0xa60e2ecbu, 0xd9626a5fu, 0x7978526eu, 0x1626f5c9u, 0xb0044281u, 0xecc708bau, 0x04a75735u, 0x0a08e45cu, 0x3bd0bd02u, 0x4c97c2e7u,
-	 0xcf78aea7u, 0xf8300ac7u, 0xce5b35cfu, 0x2f70d451u, 0xe74637bdu, 0xdb446dabu, 0xf2763b04u, 0x54ab737au, 0x133ce95au, 0x95390020u,
-	 0x4182464eu, 0x5415045bu, 0x931a3663u, 0xff7dd95cu, 0xf76b1619u, 0x942c39f3u, 0x34656328u, 0x5f5db94du, 0xd908f149u, 0x5317d36cu,
-	 0xbf377a5cu, 0x01c4eae7u, 0x1e19b34cu, 0x0ac278d9u, 0x565b1502u, 0xf05471a5u, 0xaf8f91eau, 0x8fc3b14du, 0x65c1f651u, 0x3e8e3cc9u,
-	 0x2a50c0c2u, 0x2b607bdeu, 0x540d6d86u, 0x539ac515u, 0xc27f82c6u, 0x8dcc780bu, 0x794ce76eu, 0x83973723u, 0xe9db738fu, 0xf6974077u,
-	 0x6a3274fbu, 0xbfd82e7au, 0x8e4e0aebu, 0xffa34740u, 0xf8156dc4u, 0x9c243c73u, 0x3e253881u, 0x7d8c65e3u, 0xfdd038a9u, 0x4d3e54edu,
-	 0x9528ee0du, 0x40d41ba6u, 0xe0fe5c47u, 0x6ed65565u, 0xde39fa08u, 0x16855f7cu, 0xdbdd552eu, 0x0106dcdbu, 0x366890ecu, 0xe89bccbau,
-	 0x4cacf6f6u, 0x56e2c126u, 0x3ff91eb2u, 0x6a8b31b0u, 0x8099d5f9u, 0x0aac3058u, 0x81a6b798u, 0x4a5b9fcdu, 0x73afc7dfu, 0x9bf64f2au,
-	 0x52136d3cu, 0xccefbc17u, 0x41b16a64u, 0x34ad7fb9u, 0x109ae61fu, 0x472d0918u, 0x60b411b8u, 0x694d4fcau, 0x87d25c03u, 0x5a3f7700u,
-	 0xb1dde3a8u, 0x3924d8edu, 0x3148e599u, 0x8a9ef129u, 0xb1641983u, 0xf8cddc12u, 0x71a27a2fu, 0xb2efbae9u, 0x400dfe7du, 0x6ffbab76u,
-	 0x7856e590u, 0x85a96002u, 0xd64b6ba4u, 0xa6a8aa38u, 0xc0e8a5c0u, 0x4b099edfu, 0x5e649a89u, 0xe84849d2u, 0x63f52a27u, 0xdcd2de8du,
-	 0x2a10a224u, 0xc859672fu, 0xbd1b530fu, 0x6e183386u, 0x9f490d82u, 0x57b247d6u, 0xaaa3bce1u, 0xc41a1c73u, 0x35d69b1cu, 0xa8d49245u,
-	 0xd04ad69cu, 0x68b64d39u, 0x059f6530u, 0x7b1921bcu, 0xb0d891dbu, 0xd66227bbu, 0xef211814u, 0x6e0b751du, 0x8c73f0dau, 0xfd9befebu,
-	 0xaf7b7187u, 0x519ee6f3u, 0xac438cc8u, 0x0041fed0u, 0x957ba245u, 0xd2d34fcfu, 0xede7e9fdu, 0x2ecb32f5u, 0x031e2963u, 0x5c74431bu,
-	 0x645425cfu, 0x8a2090c4u, 0xfae5bd79u, 0xe66ecb0au, 0x05e4d1fdu, 0x86622e60u, 0x77b93d3du, 0x136a36f7u, 0x720de4c9u, 0x26fa485eu,
-	 0xcce165d3u, 0x537489c5u, 0xff2f7f0du, 0x12741269u, 0xcad8c332u, 0x79f815e8u, 0xf07e6becu, 0x08613472u, 0x0429d01fu, 0x0144b300u,
-	 0x9c076a38u, 0x28391f93u, 0xaa26acf9u, 0xd530f51eu, 0x78ca827cu, 0x08ba1648u, 0xb648ce89u, 0x25f491e3u, 0xea71db6bu, 0xb2b9a702u,
-	 0x147920dbu, 0x2d1a757du, 0x134fde54u, 0x0798926cu, 0xab7b7df4u, 0x3741710du, 0x5afda92fu, 0xb5a1bae1u, 0x2757e853u, 0xdbdf6f67u,
-	 0x39e40c41u, 0x66259696u, 0x08cce2a7u, 0x28d7b603u, 0x4856bd6eu, 0xa75dc85fu, 0x5194b79eu, 0x00ede80bu, 0x3a7c1d41u, 0x0a2d5454u,
-	 0x280ffedeu, 0xbf84547fu, 0xf5255274u, 0x7f6c6024u, 0x24efc16eu, 0xd41ed5d3u, 0x8f0fc892u, 0x64449cd6u, 0xb6a40180u, 0x1e5075dcu,
-	 0x21aea68fu, 0x6a804775u, 0x809e2a17u, 0xdd1f57d7u, 0x02849a02u, 0x6de9112eu, 0x3ac9b48fu, 0xc5bbeba8u, 0xf22d71e4u, 0x7405889bu,
-	 0x5f4b57c8u, 0xd4af2541u, 0x970789f0u, 0xa884d741u, 0xe0d1fcf1u, 0x22801902u, 0xcdead722u, 0x7cc887dfu, 0x0f56c638u, 0xa7c2167bu,
-	 0x2eede455u, 0x4dc03c23u, 0x93a1ebc0u, 0x71ee7536u, 0x96a34aafu, 0x474a7c45u, 0xcd2d0285u, 0x6a9ff53eu, 0x060bfd2cu, 0x56d17954u,
-	 0xc4af568bu, 0x66361cc9u, 0x42457147u, 0xcbddbb7fu, 0xba04cd38u, 0x1762d095u, 0xd56fdb67u, 0x5af5f280u, 0x4e39b4e0u, 0x4e5c225au,
-	 0xcd84baa1u, 0x65bd734fu, 0x0926ef63u, 0xdc32874bu, 0xb830f5f9u, 0xa73a1032u, 0xdd8a609du, 0xcb39c084u, 0xc28d9eb1u, 0xf0b2a386u,
-	 0x19f82c5au, 0x6b74a8eeu, 0x684b889du, 0x2a97ec7au, 0xddcd5084u, 0x534a3972u, 0x4c621d97u, 0xc88fc926u, 0x5120f070u, 0x7cde69efu,
-	 0x968df4b0u, 0x2a264b1eu, 0x96a741b1u, 0x0d8682c2u, 0x1ccb698bu, 0x38b4859au, 0xfd77ca9du, 0xe89815c9u, 0x314aa6aau, 0xe490f20bu,
-	 0x3b772168u, 0x34df0b33u, 0xfadf90f2u, 0x30b327dbu, 0x75da90d3u, 0x3736fcddu, 0x602389beu, 0xc155c287u, 0x8fafad7eu, 0x1d6a8794u,
-	 0x54dbb128u, 0x220b9f6au, 0x88c44bcbu, 0xc57a0e8du, 0xe8a43c0du, 0xff6e6bb3u, 0x32058e4cu, 0xa60649ebu, 0x3f654769u, 0x173924ccu,
-	 0x271906dbu, 0x32d7feacu, 0x90cd2f67u, 0x97573b5cu, 0xd3a77152u, 0x7e865783u, 0xb63fffedu, 0x585c8ba6u, 0xbcda2157u, 0x6b63c67au,
-	 0xa3d44b5eu, 0x4d46ae53u, 0x89c83458u, 0x3d8d8d5eu, 0x9b8c765au, 0x8595396au, 0x29495183u, 0x3eddb7b9u, 0x078e7673u, 0x79b59c51u,
-	 0x554b2fc3u, 0x0555326cu, 0x14b9eb56u, 0xac0940d9u, 0x856f9250u, 0xae3f8dbcu, 0xef591e42u, 0x75dcc03eu, 0x72077825u, 0x170d14c8u,
-	 0xa6cf71a6u, 0xbdce2aedu, 0x741a5dfau, 0x6586278eu, 0xf6c40c43u, 0x8d05f9ccu, 0xbe9dc080u, 0x919b52bfu, 0x06513e33u, 0x5ddb3c8eu,
-	 0x578d9dbau, 0x71755038u, 0xc766bec6u, 0x73264139u, 0x4937c3e7u, 0x7421dcc7u, 0xbc71daecu, 0x34915098u, 0x86937ca4u, 0x3e68521eu,
-	 0xe39caa25u, 0xe33c9c35u, 0xe713b440u, 0xf0595402u, 0x8b4a3c2cu, 0x97a3be62u, 0x6009bf51u, 0x5f83ae34u, 0xcd711028u, 0x4a7ab46bu,
-	 0xa2752226u, 0xc2ebe20eu, 0x1bcdcdd4u, 0x49539fe6u, 0x9b3f1f6cu, 0x044395c4u, 0x1939d329u, 0x0cd76bafu, 0x14d43dd6u, 0x724b8b7du,
-	 0x44b7bcdfu, 0x1e50b688u, 0x650a19cdu, 0x8f4796dbu, 0xb31928a8u, 0xc403bea0u, 0x9f670b61u, 0x1611f511u, 0x3ddbaad9u, 0x799277efu,
-	 0xada4cbbau, 0x6224dd7au, 0xfa11be66u, 0xc35abd45u, 0x14991a5du, 0xfd0191d1u, 0x2dff443eu, 0x5f3fe8e3u, 0x662783c8u, 0x84597298u,
-	 0x52c5227eu, 0xb791d7d3u, 0x4ca2c1fcu, 0xd9fcbd6du, 0x4a09aee9u, 0xb299fa24u, 0x7fef91b0u, 0x96bc4bb6u, 0xbfc70bd4u, 0xfda170a0u,
-	 0xc9196a63u, 0x2a39eb55u, 0x770f7dcdu, 0x23bdb170u, 0xce044254u, 0x34cdf2d9u, 0x461a8361u, 0x14874d22u, 0x1ae5d98bu, 0x0036b9f5u,
-	 0x6635e55fu, 0x0322f31du, 0x01845680u, 0xc2ab066fu, 0x3950a8f8u, 0x23d78fdeu, 0xf37891eau, 0x982c11f6u, 0xcf555f03u, 0x4d719863u,
-	 0x08a131e8u, 0x82b2b0e4u, 0xadd5630au, 0xb7940f03u, 0xd947facdu, 0xd32c1ba0u, 0x2f542d2fu, 0x2e112bf9u, 0x4a060695u, 0x1697ae68u,
-	 0xbaf98f28u, 0xbb93d51bu, 0x65fba944u, 0xc1a5c863u, 0xc570b18au, 0xf3e443f7u, 0x4968fc84u, 0x60b99ee8u, 0xd517ad4bu, 0x9def0672u,
-	 0x354c5c25u, 0xdb11c08fu, 0xb94fed7cu, 0x50cf0df4u, 0x786068c0u, 0x450ecb26u, 0x1ed345c2u, 0x3f5af233u, 0x6701cfe5u, 0x89edfe94u,
-	 0xebc9a08eu, 0x91b910c1u, 0xd616a3f8u, 0x16ddf990u, 0x505ef574u, 0x8b4b20f1u, 0x71029837u, 0xab5eb74du, 0x9bc01035u, 0x3b18f899u,
-	 0x551718b4u, 0x975726e3u, 0x541744dfu, 0xd3e9df1fu, 0x143be453u, 0xbbdc4bb6u, 0xad8cfd32u, 0x7503e5e1u, 0xc697e5a9u, 0x718c3179u,
-	 0x3d58d1f1u, 0xc6860700u, 0xf03aa9deu, 0x44ec2feau, 0xd237a246u, 0xe93c837cu, 0x526077d3u, 0xe055f9fdu, 0x1b26a10eu, 0xc7b1f904u,
-	 0xe569e780u, 0x3fa9cfddu, 0x087a96e5u, 0xec2683acu, 0x9e7040a4u, 0xc887874eu, 0x676f1decu, 0xf5aa79a5u, 0x5b95f54au, 0x05c2453au,
-	 0xe7c19291u, 0xefe2cac3u, 0x0e0f0863u, 0x0cfde19du, 0x2dc468e4u, 0x4ce15cb8u, 0x2a814e9au, 0xab274a80u, 0x851f8293u, 0xd8bdf4d1u,
-	 0x3f277ce2u, 0x27c853adu, 0xcb1c2b55u, 0xc21a2144u, 0xcb5b49deu, 0x9c940550u, 0x99e6f8e8u, 0x5dbf5d60u, 0x1d6f6acdu, 0xbca70976u,
-	 0x217aba47u, 0x0f4472a0u, 0x35f3d67du, 0x3fec5653u, 0x310ac684u, 0x50db3d71u, 0x9c6c7ca7u, 0xd4661b0eu, 0xe5f602e4u, 0x319e03f2u,
-	 0x760c9c6fu, 0x084d2496u, 0x5e2f718du, 0x2407d88eu, 0xc28ad398u, 0xc631046eu, 0x6cae7262u, 0x20a6679au, 0xedd46cc9u, 0x3143aaf3u,
-	 0xd103f432u, 0x3038929fu, 0xe36e21a1u, 0x5ead64b3u, 0x195e9ca8u, 0xe4dc59efu, 0x3fa7f76au, 0x4b17a4c2u, 0x013ff322u, 0x1e39010fu,
-	 0x0a36aa13u, 0x6c615897u, 0x614b4293u, 0x34d2d507u, 0xaa0ba817u, 0x377ad6c3u, 0x9303eaa0u, 0x58c0ab9fu, 0xb27afcc3u, 0x0657f7c3u,
-	 0xb0b2ffa0u, 0xa0c97796u, 0xd627a940u, 0x98b796afu, 0x808f6db7u, 0xb3fc06e3u, 0x1a38debdu, 0x0361a6d2u, 0xa7ac666bu, 0xd65b2548u,
-	 0x466e8eabu, 0x9e5b3cc4u, 0xb9c5b281u, 0x6ada714au, 0x39883dccu, 0x11127267u, 0xd0f8a093u, 0xa670b3d9u, 0xef9a11d9u, 0x594bb36au,
-	 0xadcc36e0u, 0xb4b6b5e4u, 0x8fce6f48u, 0x6fa838deu, 0x0f47fcd7u, 0x6a5e66b2u, 0x55769f8fu, 0xc5495223u, 0x952c3787u, 0x58e58878u,
-	 0x3fc3cb85u, 0x104389cbu, 0x012c2356u, 0x050e85fcu, 0x35e74b49u, 0x273aca88u, 0xd1604f7eu, 0xb30613d0u, 0xe1707d7cu, 0xbfc44f88u,
-	 0x5b87eb70u, 0xa05392b1u, 0xb14d9eeau, 0x7e0ac6d1u, 0xf05ad31du, 0x022122d4u, 0x185864f7u, 0x18ef9b49u, 0x7b03375bu, 0xae69d409u,
-	 0xc4e9299cu, 0xa6f4b7d5u, 0x2c091721u, 0xd5516eecu, 0x9107996bu, 0xd824bb92u, 0xda1ac678u, 0x0e6350b5u, 0xac36fe10u, 0x0a14b51cu,
-	 0xc5396a55u, 0xfdc7fa39u, 0xe6db808eu, 0xbddb7fd6u, 0x88719710u, 0x699cdd0eu, 0x7f4a94ccu, 0xb03b3d7bu, 0x1d4c6922u, 0x6229d11cu,
-	 0x934b45f6u, 0xa40c970cu, 0x9bf219c8u, 0xbe94e50eu, 0x3c95269eu, 0x5c8ac87fu, 0xb8d00b66u, 0x6e4f8494u, 0x527deaa4u, 0x7fa4d4b7u,
-	 0xd54174c4u, 0x6cfcef2du, 0x5c894c2au, 0xfb95ffa6u, 0x016a92d3u, 0xa547dc7bu, 0x589dc7ffu, 0xb215c717u, 0x213ef7d6u, 0xd342cc3fu,
-	 0xb8758b7eu, 0x06ed836cu, 0x54c3df33u, 0x16654f18u, 0x3354318du, 0x75e4c6c3u, 0xecd29e8du, 0x648134d6u, 0x4046f164u, 0x88ddf88du,
-	 0x8d5da699u, 0xc2591ac9u, 0xbcf9cb62u, 0x9a4422fcu, 0xec5ec645u, 0xd122204eu, 0xc8eebf3eu, 0xe6ae5d1cu, 0x6cb3d2afu, 0x0958fc7du,
-	 0x5dcac9fcu, 0xe4036fdau, 0x78f7caa7u, 0xb7472d87u, 0x008b0366u, 0x35d4aad7u, 0x269bf892u, 0xdadcc28bu, 0xe98a53b8u, 0xa73217a7u,
-	 0x2a34021du, 0x5f352b8cu, 0x38899572u, 0x008c32feu, 0xfe246e26u, 0x7baba084u, 0x8cf4cbebu, 0x984a5102u, 0xbe416a83u, 0xfd006daau,
-	 0x9270f791u, 0x9a053f5eu, 0x54e6dd73u, 0x11d48af9u, 0xd783c9bcu, 0xef6145a1u, 0x48637013u, 0x0625f5d8u, 0x0c9c8465u, 0x210d821du,
-	 0xe505cfe4u, 0xff615d62u, 0x423cebd6u, 0x5873d42eu, 0x7307a569u, 0x4aeb3dc3u, 0x22d6e38eu, 0xf50f64a7u, 0x3a64555fu, 0x977780e8u,
-	 0x45a96576u, 0x706c99ebu, 0xa86b982eu, 0x142b41efu, 0x9ee9a99du, 0x87448af9u, 0x25adc5c3u, 0xc678406bu, 0xef93fe6au, 0x73259f8au,
-	 0xcf6aec5bu, 0xa98f3888u, 0x338bd8a6u, 0x20c8dcd9u, 0x2276c2c4u, 0x9fc0ac12u, 0xee673753u, 0x8eb700d9u, 0xe88586fau, 0x76ed8298u,
-	 0x70f0c55bu, 0x19d206dau, 0x8f0f9d44u, 0x0b38f4dbu, 0x0c23f45au, 0xefe1bc09u, 0xc7ac2e1bu, 0x87e93cbcu, 0x528e97acu, 0xd99bf85eu,
-	 0xfe1e24a5u, 0x46bd5551u, 0xa2f1f28du, 0xdf56d5c6u, 0x627baa25u, 0x339dc3eau, 0xa538ff11u, 0xa852ae70u, 0xaaf7b882u, 0x6cefc2b2u,
-	 0x3be01eb0u, 0xc484560au, 0x86243052u, 0x167e2273u, 0x154eed98u, 0xabf19f01u, 0x730fd21fu, 0xa8a62aedu, 0x30480f0au, 0x3a5146bfu,
-	 0xa59d9312u, 0x84d1b17au, 0x847554c7u, 0x1b4a3f5cu, 0xa1602961u, 0x8449240cu, 0x921e9450u, 0xab6ced1fu, 0x0bd1bdb4u, 0x19542e88u,
-	 0x9bc8322cu, 0x61ae1af7u, 0xdb80bf3eu, 0xdc0b83a4u, 0xd2ca0bb6u, 0x748249a1u, 0x33841049u, 0x7577128eu, 0x995971edu, 0x0439938du,
-	 0x28f3ea25u, 0x573fea88u, 0xa4860cf6u, 0x9ac81776u, 0x5af1e335u, 0x2618683bu, 0x906b7a0du, 0x6549839cu, 0xf5d1cc65u, 0x799f0607u,
-	 0x0e9b8372u, 0x926c50e3u, 0xdc2145e4u, 0x5fafa924u, 0x5bfdba79u, 0xed4d3079u, 0x145c23b3u, 0x5b0b9030u, 0xf94f9003u, 0x02993e26u,
-	 0x013d3d4fu, 0x372e66e6u, 0x208c53e8u, 0xaf7575acu, 0x8541749bu, 0x732569ceu, 0x2dafdafau, 0x094a4066u, 0x3e2a84f0u, 0x3d865697u,
-	 0x02929f16u, 0xb4bdaa5bu, 0x4319c035u, 0xc3f4acc4u, 0xcb02426cu, 0x0c58fd59u, 0x50e67674u, 0x3731ffe5u, 0x9bdc0002u, 0xfcd372a8u,
-	 0xecde340cu, 0xdf85e092u, 0x86e4ff7eu, 0x2701aab3u, 0x676b8484u, 0x3c1b1f6cu, 0x3540beb2u, 0xf0cd3f96u, 0x4dfd391eu, 0xe9c385f4u,
-	 0x344a2c59u, 0x8319b3a2u, 0xc94aaea1u, 0x8ec2ae7fu, 0x6a4adfafu, 0x3896fd60u, 0x64a08484u, 0x20ae14aeu, 0x33e102b3u, 0x1b209b03u,
-	 0x70a581fbu, 0xc54fb22du, 0xea834b56u, 0x1a5e981bu, 0x688be7ecu, 0x94682c56u, 0x57a8e372u, 0xaaa6e16au, 0x563c40edu, 0x5d1f8b68u,
-	 0x92cda8f0u, 0x482c7870u, 0x1d5dbb3au, 0xafacd131u, 0x14ac84ebu, 0x9e79b3b7u, 0x38ce345cu, 0x45a55626u, 0xbba325ffu, 0x46249dd8u,
-	 0x4ef38c21u, 0xbb38e98au, 0xa189a83au, 0xa0725670u, 0x416e397cu, 0xd308b024u, 0x9e477c60u, 0xe7dbae21u, 0x36a68ab0u, 0x30f96b18u,
-	 0xdddb90f0u, 0x0ca44677u, 0x6792b7f7u, 0xadfdf43eu, 0xa88f9213u, 0x7371262eu, 0xef21b2aau, 0x4d638ba7u, 0x22f5918cu, 0xf5c30d6du,
-	 0xf732a813u, 0xf5298a25u, 0xcc747448u, 0xb60abcdbu, 0xf0da7999u, 0xc1b03a45u, 0x5ea271b8u, 0x80c5400cu, 0x217343fdu, 0x3bc19c93u,
-	 0x2aa8e762u, 0x7fe9e468u, 0x9da91439u, 0x19199751u, 0x08601376u, 0xe7c0edbdu, 0x5ece0f37u, 0xfeceda4fu, 0xda83cbe3u, 0xda2de496u,
-	 0xababb67eu, 0xf5274011u, 0x5d1fbf89u, 0x202ea03fu, 0x6c3a8a39u, 0x3c4dd0c5u, 0x523922f4u, 0x7ee7ac35u, 0x4db7f27eu, 0x75ba0cdeu,
-	 0xfa34972eu, 0xde88da38u, 0xbf809dd9u, 0xbde01d34u, 0xeb3b1a95u, 0x2b0a7cfau, 0x2a294512u, 0x0916dedau, 0xfc2a1a5du, 0xe8bd8277u,
-	 0x243a4a6bu, 0x7e44f48eu, 0xee0d341du, 0x05746190u, 0x56278765u, 0x83073ab7u, 0x6456d862u, 0xd25ec820u, 0xf0d1b9f3u, 0x433f3bb0u,
-	 0x19a0ecefu, 0x4604f538u, 0xab3fd5b7u, 0xd14d3da6u, 0xa0c0ac98u, 0x8e0da8efu, 0x5b763cecu, 0xcc86a920u, 0xa36254f0u, 0xa88c69a6u,
-	 0x9c03617du, 0x67897dfcu, 0xd9a08ed8u, 0x34a86ddeu, 0x9e39487au, 0x86a832f8u, 0x1149be06u, 0x4698ea3bu, 0x6816a529u, 0x58113be8u,
-	 0x22c501ddu, 0x70825cf8u, 0x23374f31u, 0x0f6c9619u, 0xf609eb2au, 0x8e78a130u, 0xfa0895c5u, 0xcabf528du, 0x7bae34d5u, 0x509e5d6au,
-	 0x626b2522u, 0xc41e884eu, 0xbea89557u, 0xe8db79c5u, 0x39fb7477u, 0x99b16d54u, 0x80243dcfu, 0x660866d9u, 0x3dbb72dfu, 0x05dc4515u,
-	 0x902f6934u, 0xcc3857a6u, 0x4151e3ecu, 0x47c837c1u, 0x2474c742u, 0x04246430u, 0xbfd2a485u, 0x0124451du, 0x53cdc2ffu, 0x6e108ca7u,
-	 0x6a11feb6u, 0x1f0ad4c0u, 0xbb7101aau, 0x65067b35u, 0x35fbb60eu, 0x765ab94cu, 0x8b62dbf9u, 0x12585955u, 0xbdd2127fu, 0xee923c5eu,
-	 0xc514a121u, 0x894a3a98u, 0x196e9836u, 0x064238dau, 0x1e9c0439u, 0xd8cbd068u, 0xa2b47f60u, 0x5222010eu, 0xaf12d632u, 0x17eaca1eu,
-	 0xbb11dfe6u, 0xdcca0c87u, 0xdcf124c3u, 0x6501af91u, 0xb9ede96fu, 0xf83d6833u, 0x43edcd34u, 0xfc3e44a1u, 0x02ac503cu, 0x981c6cc5u,
-	 0xd9ddfab9u, 0x5742ae07u, 0x4cbcd3deu, 0x85e51bc7u, 0x790fbab4u, 0xe81ee6aeu, 0xfdfc2516u, 0xac89588bu, 0x89755064u, 0x5ecb67f7u,
-	 0xf514e055u, 0x625c4971u, 0x5a08d5efu, 0x05c87838u, 0x5fac41c2u, 0x690c3d30u, 0x5e012809u, 0x2243d365u, 0xd0b54188u, 0x7e1666e2u,
-	 0xbd256274u, 0xc133ded5u, 0xe1df9a94u, 0xde20634bu, 0xf902d859u, 0x9b7c1c22u, 0xad883ed2u, 0x40a5e231u, 0xa706fc89u, 0xfaddbef7u,
-	 0x5d7d0fa7u, 0xa006fbb4u, 0xbfd5f146u, 0x63b2b048u, 0xd235ea0eu, 0x162e104eu, 0x8927e5f7u, 0xbf6f5ab6u, 0x7c966303u, 0x047fc442u,
-	 0x5f3af203u, 0x2831c1f0u, 0x1043696cu, 0xbdbfa024u, 0xfa34650cu, 0x68c77ce6u, 0x1be744c7u, 0x31f13b30u, 0xcfd5cfe4u, 0x9e9494abu,
-	 0x2240fd68u, 0x4eccd984u, 0x3cc1ad9au, 0x15892d85u, 0x612771bau, 0x266f0604u, 0xde1f8380u, 0x9848ce2bu, 0x13eef982u, 0x24e7ef69u,
-	 0xcec48a97u, 0xbf74caddu, 0x240ff08bu, 0x1ecc5159u, 0x2ad1dfdbu, 0x2e7ad6abu, 0x19934768u, 0x7fd19cdbu, 0x30003209u, 0x2076dd82u,
-	 0x8392fd8cu, 0x499284bfu, 0xc5dc52e9u, 0x5505ff10u, 0x5618c15eu, 0x608ab002u, 0x7db691a6u, 0xc73ca623u, 0xaa4d4406u, 0xab6a0030u,
-	 0xa89cab4fu, 0x7438eb42u, 0xa776369du, 0x76fd49bfu, 0xa32aa64fu, 0x0ade8c8au, 0x681ed193u, 0x18fcf11eu, 0x764a1a2cu, 0x10ef2009u,
-	 0xe471c704u, 0x9d7d7469u, 0x1866bbafu, 0xa6dec646u, 0xb388a70du, 0x9ae35428u, 0x51932f51u, 0x40e15e42u, 0xedc9bc44u, 0x40041631u,
-	 0xbc2826a7u, 0xcc8074acu, 0x2862dc45u, 0x0ccf6b87u, 0x33eb7455u, 0x961dedd2u, 0xafce39cbu, 0xb2136b99u, 0x41c49dddu, 0xf9cba2fau,
-	 0xa83d88bfu, 0x4bf3bb85u, 0x12663738u, 0x6483791du, 0xe2dbc917u, 0xe13638feu, 0xc5133a88u, 0xfceb026du, 0x98ea49ebu, 0x19030013u,
-	 0xdfaacaf3u, 0xe1bfd8fbu, 0x20c1de50u, 0xcff5019bu, 0x9ddb595cu, 0x9e47aecbu, 0x92d0982cu, 0xb30b78e5u, 0xeb482e7bu, 0xe7ede0cau,
-	 0xc4f487b6u, 0xa7fc0fa6u, 0x0d1b06d8u, 0xe1280a9eu, 0xe9b8a209u, 0xbfee5225u, 0xbaf60778u, 0x73740b5bu, 0xdf6deceeu, 0xeb8ba0ebu,
-	 0x0f07848eu, 0xcd72f83cu, 0xd5f8b8cbu, 0x99de0bbfu, 0x23c6b30du, 0xc0170741u, 0x37e58f81u, 0x4719c65cu, 0xabfbf97fu, 0x2aeab126u,
-	 0x577fb27au, 0xa00fea75u, 0x26f38c08u, 0xaf03fd48u, 0xbd032b00u, 0xef1317d1u, 0x39ceb07au, 0x9d6b3198u, 0x41c37002u, 0x323e9df7u,
-	 0xe44d766du, 0x56982fedu, 0x9f9cb7b5u, 0x8f8de878u, 0x7b46d002u, 0xc509334eu, 0x3f01b7bcu, 0xa745e4b7u, 0x7307819eu, 0x0f9b6e63u,
-	 0x4f479104u, 0x249182e2u, 0x7631a4c0u, 0x3f477919u, 0x536f6762u, 0x71a03d3bu, 0x398a6aa7u, 0xc683cfd2u, 0xc4ef987cu, 0x26d2f390u,
-	 0x4a9c5798u, 0x480f2fcau, 0x3d61f98fu, 0x17b51bb3u, 0x12e3a2cau, 0x15d05ff4u, 0x3889d7f7u, 0x8d05cb60u, 0x66eebb8bu, 0xd4b350cbu,
-	 0xb55ca24fu, 0xdd66c1d9u, 0xe9ba1482u, 0x4f5ad2aeu, 0x7e6ad3a3u, 0xc7d4cd64u, 0x37c9c64bu, 0x47494be3u, 0x9e313695u, 0xe183b3b6u,
-	 0x65a6b6e5u, 0x59cb402du, 0x7e8d9150u, 0xd8261052u, 0x70bfd3c1u, 0xefc6a77du, 0x3ad046d1u, 0x20ece20eu, 0x202620e0u, 0x9c85cd5fu,
-	 0xb75f6f55u, 0x76a3a1efu, 0x4325faefu, 0x9d761f51u, 0x4f80d274u, 0x4127edeau, 0x1701d24du, 0x174136feu, 0xded7882eu, 0x7a72f11au,
-	 0x5198308eu, 0x041dc357u, 0xd457d820u, 0x187dab4au, 0xb66e0101u, 0xd7f2c3bau, 0x7e0d41d4u, 0x42239f1au, 0x32896031u, 0x5aeb46fdu,
-	 0x235df2bfu, 0x252e773bu, 0x9518e663u, 0xe92ee96fu, 0x044d1557u, 0xc2bed20au, 0xd28ec4b6u, 0x709a8ff9u, 0x502d8b50u, 0xd54af630u,
-	 0x8fd77a0cu, 0x2993827cu, 0x395fa86fu, 0x41a2033au, 0x793ebb7du, 0xa2c30f8fu, 0x5c91d69fu, 0x249e494eu, 0x15d1f103u, 0xf16c0dd8u,
-	 0x236b2713u, 0x63c5f87cu, 0x6546c6cau, 0x3105dc3bu, 0x03305914u, 0x07c7ec74u, 0xc4e8f452u, 0x62df9c02u, 0x64c2add9u, 0x030097d6u,
-	 0xd0f60dd0u, 0x57a325aeu, 0xef5c4ba5u, 0x62657556u, 0x0fc3777fu, 0x298266ceu, 0x9b774680u, 0x7396b384u, 0x9f1a382eu, 0xf5319be5u,
-	 0xfa805a90u, 0xffba6995u, 0xc370429fu, 0x3310fd9du, 0xbe156d6fu, 0x6a0bd4f4u, 0x49af9a13u, 0x3691d275u, 0xe49cf893u, 0x509a4407u,
-	 0x69230d34u, 0x0c331bb7u, 0x523e998cu, 0x9eae0822u, 0x1d3aa5d3u, 0x7f512c60u, 0x1e1ea135u, 0xe0085186u, 0x0ac6dce0u, 0xcff77fefu,
-	 0x0500f5fdu, 0xbaf2bbbeu, 0xfd31c58cu, 0x9ebf46ebu, 0x125129dbu, 0xb9f55c95u, 0xb21df536u, 0x98f19a43u, 0xc833b729u, 0xeb76cde1u,
-	 0x892362d8u, 0x6f74094cu, 0xa9f546e1u, 0x17af83e6u, 0x0dce98f9u, 0x49cc0843u, 0x1c049ee4u, 0x6d75a452u, 0xbf198fbfu, 0x4e879d24u,
-	 0x9a5469b4u, 0x4e048e25u, 0x69a091b3u, 0x138d3d65u, 0xbe284576u, 0xe072364eu, 0x46b50d4fu, 0xe06872d6u, 0xf0015183u, 0x9e7c563du,
-	 0xf6f207bfu, 0x2e460954u, 0xe8edf771u, 0x685a9e2du, 0x93cb5470u, 0x5fce9196u, 0xc6a08caau, 0xdcb0051bu, 0x74004718u, 0xbbbe36e6u,
-	 0xe559e111u, 0x9f7c097eu, 0xf8689267u, 0x7de122c0u, 0x7c3cc9a7u, 0x44b867a0u, 0x8868196eu, 0x4c373598u, 0x11de4536u, 0x52304481u,
-	 0xc6559d12u, 0xbd48c117u, 0x52a56602u, 0xaa97e153u, 0xb7f3397cu, 0x7d397b55u, 0x7c2d925bu, 0xe9476861u, 0x00d4aa50u, 0x3b29ab52u,
-	 0x714af117u, 0xecf2b018u, 0x5aaba1a5u, 0x358a21a2u, 0xe4af27bau, 0xc789315au, 0x87a2ad10u, 0x429aa6f9u, 0x0919a2d9u, 0xfa75b0a5u,
-	 0x913f98e0u, 0x6a366635u, 0x3c03de5au, 0xc699d50eu, 0x55e18ce2u, 0x60139f1cu, 0x840dd1fcu, 0xd272d776u, 0xc110a9d3u, 0xa1f077a7u,
-	 0x2aabc349u, 0xb4710625u, 0xa5ea47a2u, 0xa1144a47u, 0x2087d355u, 0x1da51a85u, 0x752b0ed8u, 0x36d3c6cdu, 0x29f1da4cu, 0xfc31f713u,
-	 0x45bcd505u, 0xcfc9b812u, 0x249e241cu, 0xbb57af33u, 0x0796e620u, 0x525c458au, 0x787da9fdu, 0xf4a32cd4u, 0x6a610ad3u, 0xd36c82ddu,
-	 0x9bd83e44u, 0x7c09e385u, 0x9755ee58u, 0xe0d45405u, 0xf8397d0bu, 0x92a9fedeu, 0x66ce1dd4u, 0xe3b8d5f6u, 0x58a0e070u, 0x0354e61bu,
-	 0x7f2f40adu, 0x05a3ee19u, 0x3d7a6f74u, 0x58c552d7u, 0x753e1048u, 0x9549d92au, 0xa251c95eu, 0x13ae635eu, 0x4fe3e324u, 0x3a76c218u,
-	 0x1a733272u, 0x7ae27be2u, 0x09aee7abu, 0x2e8ad9beu, 0x2b19be31u, 0xa545230du, 0x37902e32u, 0xb6138df0u, 0xa12ad0c0u, 0x5cf9955au,
-	 0xf7f505d6u, 0xb10e2c0eu, 0xf3f89114u, 0xc55ed9b7u, 0x3232c807u, 0x73e9f95au, 0x29d836b5u, 0x33196755u, 0xa11be5b7u, 0x527f9a0au,
-	 0xa0010a46u, 0x40e304a5u, 0xdd9fbd6cu, 0xc1f6c60cu, 0xcad59ab0u, 0xbd0f7909u, 0xd5eea735u, 0xba05f72cu, 0xa76e0529u, 0x7dddd420u,
-	 0xbea60a7eu, 0xc7fb8853u, 0x24c29f18u, 0xbaf49955u, 0x38ecada7u, 0xb7b4c0cfu, 0x15d0fdd5u, 0x07102af2u, 0xd1602ba3u, 0x9214ee66u,
-	 0x22167f9bu, 0x0d534d62u, 0x5eb72a87u, 0xfe09dbbcu, 0xa4feefdbu, 0x1fb27b4du, 0xacc8c07au, 0xb7d358fbu, 0xd1111f92u, 0x4b575bf5u,
-	 0x2e3038c0u, 0x540b7377u, 0x2bc20f82u, 0x7f0dcc7eu, 0x47ca8bd0u, 0xb72f80afu, 0x01d28afbu, 0x040ebd53u, 0x719f762bu, 0xc87c6599u,
-	 0xa1ae3c17u, 0x873864b7u, 0x8be777aeu, 0x1b6f4deeu, 0x83335207u, 0x48393255u, 0x21c61fc4u, 0xc598b6b5u, 0x68875416u, 0x50db3a15u,
-	 0x96babeb6u, 0x4440ba4du, 0x897de080u, 0x44d4661eu, 0x5ad0e52eu, 0x9cf5e01du, 0x4743cc6fu, 0xf280001cu, 0x17f2410au, 0x89391b44u,
-	 0x4e1baff6u, 0x1210059au, 0x0afed35fu, 0xdd23483au, 0xd4e4ed66u, 0xd2257d8bu, 0x7f1f50cbu, 0x8d83f90eu, 0x99705d73u, 0x32b549e6u,
-	 0xfb7752dau, 0x1d16a83fu, 0xaf931463u, 0x3af98022u, 0x08b491fcu, 0x328bf536u, 0x44fc391cu, 0x6ec588b3u, 0xf4f27ee1u, 0x477564d5u,
-	 0x934c04a4u, 0x83910c18u, 0xbafd040cu, 0x5c545aedu, 0x119a5207u, 0x77922652u, 0x2fd8cbb7u, 0xe97f3ef0u, 0x240cd323u, 0xd5694827u,
-	 0x4b55cb57u, 0x35f96131u, 0x8d03e039u, 0xcbd2221du, 0xdffb99ccu, 0xe6581ca6u, 0xdc101d57u, 0x03f531c9u, 0xe3651d54u, 0x98cf8963u,
-	 0x686c22d0u, 0x2d9122ccu, 0x8423265du, 0xc807265fu, 0xc3a74ae0u, 0x79685c6cu, 0x2293724eu, 0x93414eceu, 0x7fd7c7a3u, 0x766e8b3bu,
-	 0x22754280u, 0x509638b3u, 0x6632ffa1u, 0x7da9a242u, 0x8b7e160fu, 0xeabf21d9u, 0x1cf5af25u, 0x658a4935u, 0xfefc7485u, 0x2357298eu,
-	 0x8cabca51u, 0x4ee0552eu, 0xa8b9ccc9u, 0xabb3dcd9u, 0x76299832u, 0x03c62ab1u, 0xdd58f76cu, 0x496200e5u, 0x366c7e13u, 0x23e36cafu,
-	 0x8a25f2f6u, 0x1f0312b7u, 0x5a838fd8u, 0xe609df40u, 0x054de6e3u, 0xd2777e6bu, 0x3cd66559u, 0x04c6bbabu, 0xff25b95bu, 0x0cda55feu,
-	 0x921057e3u, 0xbf74f68bu, 0x6ef52a40u, 0x5f31bd09u, 0x6af26468u, 0xf1100356u, 0x4b2f9f23u, 0x5baab3a2u, 0x6aabad5bu, 0x60cad05eu,
-	 0x30c86b9fu, 0x295b3316u, 0xf6a0d2e8u, 0x3c7a48b9u, 0x13317d8eu, 0x16bd30ecu, 0x83c59110u, 0x76f526b4u, 0x2abffd82u, 0xe0cb05d9u,
-	 0xfd1eac45u, 0x42a1b67du, 0x89f4537du, 0xad792538u, 0xad07e1aau, 0x69e749d5u, 0xc2e64358u, 0xc5f87925u, 0x0a884f76u, 0x3366a398u,
-	 0xd5422973u, 0xfe2b4ff2u, 0x298fbdbbu, 0x9a806400u, 0x041323d1u, 0x006a7315u, 0xc9d2b64eu, 0xc018456au, 0x5cc7ae35u, 0x9bfd7162u,
-	 0x1a283966u, 0x37d0e94au, 0x9abdbc09u, 0x9d852092u, 0xb3616dbeu, 0x55eb0447u, 0x35e87454u, 0x588c7d52u, 0x500a4e9bu, 0x4bf86654u,
-	 0xb528152du, 0xfe12510au, 0xd0cdfba6u, 0xeff43d34u, 0x69d6ff46u, 0x71ea961au, 0x34468e49u, 0xd06da4c6u, 0xc8a96e06u, 0xe609b995u,
-	 0x61b9ad1cu, 0x7b8086bbu, 0x7ead6ab1u, 0x92723a97u, 0x19e930bcu, 0xe5590435u, 0x1cc0a790u, 0x993ac4bdu, 0x17afda81u, 0xa213c789u,
-	 0xc03c52a9u, 0x6a725df9u, 0x6a8d558cu, 0x5c05ff09u, 0x268b8f93u, 0xea9aded4u, 0x3999b6a3u, 0x6a47a0bfu, 0xb99f2e14u, 0xaf9f359cu,
-	 0xbd303aa0u, 0x9f09d9edu, 0x2f38eb07u, 0xb4c774c7u, 0x048f4e2au, 0xe8a71441u, 0xf835cdcau, 0x75de05f9u, 0x365d42a8u, 0xc35ee1cau,
-	 0xbcc01ab7u, 0xd2da7e69u, 0x539dd543u, 0x99ea9792u, 0x021a41d5u, 0x0bd0c5b8u, 0x48f06e0eu, 0x9b11bbdau, 0xdef2fdf3u, 0x177bea20u,
-	 0x6b9ab2e1u, 0xadb787f0u, 0xd297c180u, 0x77f4e3a0u, 0xd8868085u, 0x8058c638u, 0xb724bfd0u, 0x48ec5855u, 0x3b8b82dbu, 0xc6d62215u,
-	 0x069c688cu, 0xb2383ddfu, 0xb4e263f8u, 0xf3c9c2a9u, 0x7fc68d37u, 0x2a9cbdb5u, 0x5e594d43u, 0x923184b7u, 0x980696e7u, 0x569af152u,
-	 0x3794760fu, 0xd1d89110u, 0xad5e7c75u, 0x463678ffu, 0x7903fdbdu, 0xaf1415c6u, 0xb4d8bbd8u, 0x3b399197u, 0xc048fc32u, 0x1269d321u,
-	 0x3c7fa395u, 0x4e2ad34bu, 0xa7e1f11fu, 0x1da00869u, 0xaab5c758u, 0xc1be21f8u, 0xd02a6560u, 0x2a3b02ddu, 0xe80f2e49u, 0xddf5f568u,
-	 0xa7824d1bu, 0x06009c45u, 0x71d19084u, 0xb94d08e0u, 0xa7fc2411u, 0x0f81a104u, 0x28c01882u, 0xd103414eu, 0x47cd8da5u, 0x49a03352u,
-	 0x750dd98cu, 0x6efa98b3u, 0x37234bd2u, 0x6fb7cc3eu, 0x707d51feu, 0x44e43478u, 0xd4ea3c62u, 0x7871c78cu, 0x4a376c9du, 0x166fea49u,
-	 0xaaeab7a1u, 0xb5da4438u, 0xb06bee83u, 0xf5613d6au, 0x8115cef2u, 0x6af6ddb9u, 0xd2260996u, 0x622e5d25u, 0x66ee39deu, 0xa4cff766u,
-	 0x6f696800u, 0x28593fdfu, 0x8b587bc0u, 0xbeabf527u, 0x2eba0f02u, 0x42c3ece9u, 0x5d453fd6u, 0x4b627ccfu, 0x013cfc2du, 0x32e260c4u,
-	 0x3a0148f3u, 0x57e06c97u, 0xcb174264u, 0xcebd9730u, 0x041f175fu, 0xae823c2bu, 0xc4f1674fu, 0xd7cb78cau, 0xbb16994bu, 0x3dfb4d89u,
-	 0x12cc7aaeu, 0x36a12232u, 0x4c1fbc75u, 0xf3762119u, 0x5e42403eu, 0x7624ce45u, 0xe7ac1ce6u, 0x2e96b40fu, 0x971cc3f3u, 0x1f73e984u,
-	 0x83f6c7d1u, 0x50845c38u, 0xebc2cc01u, 0xe454ded6u, 0x6a78b672u, 0xc910d6a4u, 0x49c12d26u, 0x9ea25cf3u, 0x36fef863u, 0x13734836u,
-	 0xadf666a9u, 0x2c83f768u, 0x767d2363u, 0xc4210b0du, 0xe67c06c7u, 0xf6ce1292u, 0x3be41eeau, 0x2958a980u, 0xbe86bad0u, 0xbdbba261u,
-	 0x5fd04e05u, 0x55394991u, 0x40967818u, 0x2a6f6194u, 0xafdd250eu, 0x1c89d95fu, 0xc1d1edd8u, 0x398c5dd1u, 0x5f677fafu, 0xb0893efdu,
-	 0x11119871u, 0xc4e93fc4u, 0x6bca51f2u, 0x66b30e52u, 0xb4989383u, 0xdad1baa7u, 0x5cc090bau, 0x17ca78afu, 0x8a0ec3cau, 0xff64bc7au,
-	 0x60da83c1u, 0x8575d04eu, 0xda1de8f7u, 0x2c45b97cu, 0x07c661b8u, 0x8ed1faefu, 0x524dc08du, 0xbe122393u, 0x3d5dd38au, 0x600ec09fu,
-	 0xf54c6724u, 0xf994cd0bu, 0x22f1eb7bu, 0x49ae574cu, 0x26d0df00u, 0xd1177761u, 0xe7366428u, 0x44d69361u, 0x34ccc744u, 0xc17b4fbdu,
-	 0xbe46e022u, 0x7935e5e5u, 0x61c8568bu, 0x8595249eu, 0xf8b2a4a3u, 0x99b1b6b2u, 0x8ecd6928u, 0xe17ad731u, 0x8106a7a7u, 0x36243da9u,
-	 0x15fb07d3u, 0x75c4c71au, 0xab86f8d6u, 0x368b8bb1u, 0x47be8fb6u, 0x68190e0cu, 0xc96e3052u, 0xd976e9beu, 0x2d8dda07u, 0x758c481du,
-	 0x7d33baccu, 0x877ba32du, 0xd45e2694u, 0xa2d24ed8u, 0x68f37c90u, 0xcc9bb291u, 0xe12798ccu, 0x8001db19u, 0xd746d598u, 0x36d8f0afu,
-	 0xd1fa365au, 0x9e81aa0bu, 0x9d9bf67du, 0x649d493bu, 0xb5cadac4u, 0xef33eef3u, 0x2e0eb9a7u, 0x9747596eu, 0x02c6b98bu, 0x6191fb56u,
-	 0x6c5d3e22u, 0x2a0e4b49u, 0x41db794cu, 0xca864dc0u, 0xf923a029u, 0xfaea15c4u, 0xad61c19eu, 0x10864921u, 0xa07961b3u, 0x5ae3198cu,
-	 0x7cba5c8bu, 0x8df1fb08u, 0x09422233u, 0xb5e59b08u, 0xd8cea71eu, 0x7a38a041u, 0x031736ffu, 0x1e4f5cdau, 0x4cf84636u, 0xdcab73e0u,
-	 0x469b8fbeu, 0xf72d0b6cu, 0xee4027c8u, 0x6da45943u, 0x83977f4fu, 0x790addecu, 0x01483609u, 0x0467e5a2u, 0x7dda9c19u, 0xc379c88eu,
-	 0xbf35bf71u, 0xb35a42e1u, 0xc40a0235u, 0x2c304fabu, 0x228c1719u, 0xb46e8763u, 0xccbca242u, 0x55842844u, 0xe3addd60u, 0xdaa6d2f9u,
-	 0x68e6b1a0u, 0x0c941fc2u, 0xcfb12677u, 0x53c4393au, 0xc33f4fbcu, 0xe59444e3u, 0xaa5c2fc1u, 0x307045d8u, 0x990a0250u, 0xaed10947u,
-	 0xe6ae666fu, 0x01349d2bu, 0x4e8dce77u, 0xc872f5f3u, 0x73305bd4u, 0x710a9665u, 0xa190c8d0u, 0x25dd5df1u, 0x3ac2cf69u, 0xef7f23c3u,
-	 0xeafe5eb0u, 0x889af6e6u, 0x0ce101e4u, 0x0595ca96u, 0xbd2200c9u, 0x5c06c72fu, 0xa8401546u, 0xfeb9532bu, 0x6dff9513u, 0x4ef929bfu,
-	 0xadcdccefu, 0xcc191da0u, 0xbbdfdc42u, 0xb6f4d787u, 0xf1168c20u, 0xdcc11d43u, 0x6e71547bu, 0x6008440cu, 0x5cacee54u, 0xc586bc33u,
-	 0x71252a08u, 0xe4fc889bu, 0x18a90f2fu, 0x95ba249cu, 0x7fedd97bu, 0xdaa3f68fu, 0x3836c64au, 0xe86b311cu, 0x2470afdcu, 0x05588375u,
-	 0x4cdf850fu, 0x227ab6c9u, 0xaa703197u, 0x7947f4cdu, 0xc53ee7cau, 0x83c4b101u, 0x594b507cu, 0xf228e510u, 0x311e7a0au, 0xa7f7370au,
-	 0xf30b961eu, 0x0274bd0au, 0xd8dca9ebu, 0x3cd4f519u, 0x0eb06129u, 0xbb07bdadu, 0x3b9d44fbu, 0xa467312bu, 0x598f1619u, 0x14500fc9u,
-	 0x529a0b9fu, 0x99dee5a0u, 0x869efd30u, 0xad327fe1u, 0x2d7e543bu, 0x18eb0d99u, 0xad2866a0u, 0xa6fd2aa6u, 0x6104b057u, 0xca44785cu,
-	 0xad873fd0u, 0x711a97aau, 0x9eaa8f4bu, 0x25b44518u, 0xb22fbfb4u, 0x2fd83be7u, 0x12a9db73u, 0x579d9738u, 0x276db634u, 0x993ce8beu,
-	 0x6904b137u, 0x822bbd37u, 0x21672d76u, 0xb76f6838u, 0xeecb2850u, 0x0f678c58u, 0xa109dddbu, 0xcbac5d9du, 0x23a0b96eu, 0xe913a7c9u,
-	 0x7f520566u, 0x0c1484b8u, 0xfc8e9fc8u, 0x4de9f6f9u, 0xa090a138u, 0xc03701fau, 0x41cfa764u, 0x2b5246aeu, 0xffcd465fu, 0x6e204846u,
-	 0xdd1abb8cu, 0x16b9647bu, 0xcd6aafc0u, 0x3e02f156u, 0x0afbdaf4u, 0x3295890fu, 0xc38ab9ceu, 0x8d55d823u, 0x4a73fe5eu, 0xcfa2f88du,
-	 0x40d97952u, 0x42e46372u, 0xd779decfu, 0x1008207fu, 0x37f0c3c5u, 0x17ce3313u, 0x7f9cf04au, 0xe11b640au, 0x0cd06209u, 0x4d3f7c1du,
-	 0xb7e952adu, 0x9b911a68u, 0xc21be4a6u, 0x0a7ab71cu, 0x169bed9eu, 0xde6c107au, 0x2cb44a88u, 0x2d853393u, 0xf86057a6u, 0xb37fc1b9u,
-	 0x07cb6095u, 0xe3548190u, 0xb8afaf05u, 0x377fd099u, 0x5f9dcff4u, 0x99f109ceu, 0xa2241012u, 0x3988e1dau, 0x7f625fd5u, 0xed49f845u,
-	 0x431365e0u, 0xd36c51e4u, 0xf5a7e895u, 0xa67b242eu, 0x6c0c61fau, 0x3c581eadu, 0x0f461005u, 0xa1901e07u, 0xaef31a8fu, 0xb87c8838u,
-	 0xa6db22f7u, 0x8168ed3eu, 0x55dea985u, 0xe4b0452au, 0x5a0863fau, 0x5583c758u, 0x91fd8e9eu, 0xb6c5d243u, 0xfb8f5f49u, 0xe0000e27u,
-	 0xd6fa8895u, 0xf304ba06u, 0xcfa25ecfu, 0x913ecc6cu, 0x821e80adu, 0x80f44b04u, 0x6d4b42d5u, 0xe1f57fc8u, 0x5f2ac09au, 0xd9b9a3f2u,
-	 0x9eabe8d7u, 0x60099edbu, 0xba6cb1e7u, 0xf654988fu, 0x5548e258u, 0x6af87cefu, 0x3436f3acu, 0x6e3c971fu, 0xf1d90c18u, 0x4c02e9e9u,
-	 0x54067d49u, 0x5daf03d1u, 0x75c25c96u, 0x3a0d3880u, 0x3a06b626u, 0x860d49c8u, 0x94c17951u, 0xa89e74cfu, 0xda2c9026u, 0x183c8573u,
-	 0x129a8189u, 0xcbdabc20u, 0xa8799d9du, 0x5b2b3781u, 0x300a1244u, 0x36074879u, 0x3b737c66u, 0x5f11057au, 0xd0fa33d1u, 0x58c339a7u,
-	 0x8d094096u, 0xddf3e9c8u, 0xe28ffc21u, 0xcaaf467au, 0x91951eaau, 0xab67a2fcu, 0xe48df674u, 0xc26bbd8eu, 0x0190f799u, 0x40b1ca83u,
-	 0x16a51d46u, 0xddd78928u, 0x035b8563u, 0xd64f8905u, 0xc47ba745u, 0x34b5713fu, 0xf3355728u, 0x84344cadu, 0xccaa5f96u, 0x56755066u,
-	 0x1d0d7456u, 0x799cd14du, 0x11b06f5du, 0x83237c96u, 0x92583ffcu, 0xdcb85b89u, 0x380fe98du, 0x56bd91f2u, 0xb2833a17u, 0x27d3f5c9u,
-	 0x4c1ad43au, 0x103445dau, 0x0dc30affu, 0x94ccc922u, 0x4d2fbb19u, 0x28d9e84cu, 0x47b1965fu, 0x94afdc60u, 0x8cec0e29u, 0x19428179u,
-	 0x066a7ae6u, 0x0e36d5a7u, 0xe0a18b56u, 0x00e26a69u, 0x08055d4fu, 0xbbd02f87u, 0x249870fau, 0x2fc6c205u, 0xab160111u, 0xae8b091bu,
-	 0x20633a80u, 0x2d36d235u, 0xbbbee0f1u, 0xdecaf028u, 0x91157e80u, 0x0ca910e6u, 0x70659258u, 0xc7ba7c3au, 0xb59599e1u, 0x8bee922au,
-	 0x4839c2abu, 0xd8fba97au, 0xcd9774a9u, 0x99deee86u, 0x33a025dcu, 0x9900c575u, 0x8e8bb729u, 0xf17535bdu, 0x6931e9a9u, 0xf3800bddu,
-	 0x48655401u, 0x576ff1deu, 0x9c09ad96u, 0x9e95f4b1u, 0x85e5c1c8u, 0xdad6500fu, 0x27f30660u, 0x2d427eafu, 0x2d25389eu, 0x40d9311eu,
-	 0xf6a1c520u, 0xcb61d7e5u, 0xc3d9deacu, 0xe057ddd6u, 0x4548c5c0u, 0xe97ac8cdu, 0x4403a487u, 0x12c722e0u, 0x0947feaeu, 0xdce3be56u,
-	 0xd7cd49d3u, 0xb81f36fcu, 0x4a6cdf0du, 0x764f5978u, 0x51a8d159u, 0xf47938c1u, 0x85b3f512u, 0xca410eddu, 0x71485768u, 0x34f61125u,
-	 0xb591a4b5u, 0x1a44c644u, 0x3846cca9u, 0x934d0892u, 0x7d1439a6u, 0xfba9fba0u, 0xeccb29dau, 0x39a02134u, 0xafdfee0du, 0xaefd9544u,
-	 0xe4721f49u, 0xbe0ba1e2u, 0x4e3ba7c8u, 0x5e2e84e4u, 0x4d0923ebu, 0x78ad4b7eu, 0x1ab54419u, 0xf6240b41u, 0x537476beu, 0x4821c7f4u,
-	 0x53a9b891u, 0xb0bc5976u, 0xfeab1c88u, 0x9c00b5e4u, 0x58b84c93u, 0xa7bcf2c9u, 0xab65bf7au, 0x8015b296u, 0xb7e6111cu, 0xd77269a3u,
-	 0x26aeff1au, 0xc62b9b9fu, 0xff738af4u, 0x53321bd9u, 0x3ceb8ca1u, 0x4f790111u, 0xeade0b5eu, 0x485cd190u, 0x7d8d5f90u, 0x9309b783u,
-	 0x9a496f56u, 0x3d42a315u, 0x7a64bebfu, 0x6c7c3928u, 0xbaa32816u, 0x8cd58c5fu, 0x84906f3bu, 0xdc8f7265u, 0x7c284d3fu, 0xf543f11bu,
-	 0xa6ba48bbu, 0x3b178f4du, 0x007d9403u, 0xb18acb78u, 0xbc6ac13fu, 0x2ce402a3u, 0x6d64f20du, 0x7206ba22u, 0x2a12e9bcu, 0x67ec30f6u,
-	 0xf6fc1877u, 0x1d63c05du, 0x5ef335c0u, 0x68baacffu, 0x8812fd13u, 0xc9322edau, 0x0624e26au, 0xc44dc517u, 0xc122b298u, 0x1a89e1c7u,
-	 0xb5037eb6u, 0x3501f617u, 0xbbb56060u, 0xf1705a4bu, 0xd25304b0u, 0x408e678bu, 0xf836070du, 0xad9e873du, 0x76a27f12u, 0x70ef18ccu,
-	 0x099d42d6u, 0x8573be78u, 0x1358b73eu, 0x6bf1ec48u, 0xff526987u, 0x46cbb231u, 0x211520c6u, 0x62c8dd7au, 0xc92eab85u, 0xfbb9ebe3u,
-	 0xefc5fa46u, 0x615b0cc6u, 0x17abf4e0u, 0xd3eb2808u, 0x07ef9834u, 0xd4ca543au, 0x34e325d4u, 0x87b7422eu, 0x3dd9b66eu, 0xef51d65fu,
-	 0xc1fe2e89u, 0xb05eb50du, 0xac073f04u, 0x9f44fafcu, 0x47b1ed5cu, 0xfb72fb01u, 0xe3c0a5d9u, 0x5fdc014cu, 0x0a9d5b16u, 0xe2070952u,
-	 0x66c69f5bu, 0x42c932b0u, 0x2bd2a6f5u, 0x42fc6263u, 0xae0abf81u, 0x954daccfu, 0x3561c4f4u, 0x56883ab3u, 0x209cbbcau, 0xbe65bdc3u,
-	 0xc873e850u, 0x898be78fu, 0x7f9b0603u, 0x0ba483f4u, 0x9bdd148fu, 0x5cb7b74fu, 0x86ccb10du, 0x4d0d8e27u, 0x0a91bef0u, 0x707c8831u,
-	 0x7d0e3613u, 0xd287602fu, 0xee09e587u, 0xf9910e37u, 0xfa5dd6a4u, 0x36a6ca11u, 0xd4dab649u, 0xe4e70e04u, 0x778a5474u, 0x4397ee1fu,
-	 0x79263cc1u, 0x6295a78cu, 0x16ea768bu, 0x77edbb73u, 0xcfa741a4u, 0xaa512f23u, 0x3724717du, 0xa57ea455u, 0x66c4c9beu, 0xf371c26eu,
-	 0x17c29e2cu, 0xfe23971au, 0x855e66ceu, 0x87dc8cc9u, 0xa7913d87u, 0xdab0900bu, 0xdcc81c80u, 0x44914934u, 0xf49537f7u, 0xa1ffb609u,
-	 0x1db701e0u, 0x90e26364u, 0xd646be19u, 0x7f475765u, 0xf5813766u, 0x36927ec6u, 0xb0d501b7u, 0x18a23f03u, 0xa5ba32ebu, 0x83f1350du,
-	 0xee7b669au, 0x9cb60679u, 0x76d7ffeau, 0xf145aa52u, 0x508add9au, 0xf6fca41au, 0xd36ee00au, 0x6bdb9251u, 0x35294b0bu, 0xee113fb1u,
-	 0xe55db7a0u, 0xfcef6a10u, 0x216d502bu, 0x66a6114bu, 0x7dd669ccu, 0xb10beff1u, 0x26ed0528u, 0x4809890bu, 0xa5991cbbu, 0x01316b49u,
-	 0x6d2ff7d1u, 0x39c8c4f7u, 0x61265c3bu, 0x5e55f3a6u, 0x2f096cc4u, 0x10fdee84u, 0xf3eb0ac9u, 0x10add90fu, 0x0104363au, 0x727dc494u,
-	 0x59a0556cu, 0x6e8952a8u, 0x19f7fc68u, 0x6c44f7d7u, 0xfbde24beu, 0x3f5a5981u, 0xb6ea2fa4u, 0x0979798du, 0x0fe0d145u, 0x48e1df27u,
-	 0x77aa668eu, 0xc8783321u, 0x8b170c0eu, 0x19a9a3d6u, 0x3911b45cu, 0xc6e8eb34u, 0x5ef87ea6u, 0x90ae586fu, 0xa9867fbeu, 0x5fa8e0bau,
-	 0x6e997c86u, 0x54112b19u, 0x83f16c6du, 0xcdc522bdu, 0x42f20cc6u, 0xeaf604edu, 0x1b7784dfu, 0x74f4d2b6u, 0x455e3910u, 0xd9f9563du,
-	 0x501cb925u, 0x538abfb3u, 0xa8e60842u, 0x073e383eu, 0x2830b084u, 0x4505ef87u, 0x545b75d0u, 0x7077a386u, 0x95118382u, 0x9c2332c3u,
-	 0x74ef556au, 0x4ccccca0u, 0xaabf6feau, 0xaf763436u, 0x7b3ba8bau, 0x2bcdf902u, 0x2d07ec3du, 0xbbc0f9e7u, 0x05f0fea0u, 0x0c840147u,
-	 0x8c6986cfu, 0xb547c65eu, 0xe5279550u, 0x17fbf7d4u, 0x73fb869du, 0x82be8002u, 0x7b1dbdc7u, 0xcd7e5fb8u, 0x96a302a6u, 0x926140b2u,
-	 0x6b1c8c1eu, 0x57e0d607u, 0xc4a4ec63u, 0x2c3de7bdu, 0x8bc1ba2bu, 0x7e33067bu, 0x7352229bu, 0x38695185u, 0xc3a9ceb9u, 0xa2cad886u,
-	 0x78208fa0u, 0xc42e27a8u, 0x8061326bu, 0x89ab93afu, 0x19f7c617u, 0xf21b96aeu, 0x248a8299u, 0x9799b383u, 0xf4a5f49eu, 0x3d198af0u,
-	 0x37cc5920u, 0x186505aau, 0x301acf06u, 0x73809d26u, 0xffc16869u, 0xb86be5d3u, 0xaa22e4fdu, 0xe8223e16u, 0x0aab5e41u, 0x91b4918cu,
-	 0xf480835cu, 0xb5e14da2u, 0x56184ebcu, 0x5958ebf0u, 0x60b27ebbu, 0xae04b37du, 0x7e03d170u, 0x552281ebu, 0x96da03ffu, 0x284d6b73u,
-	 0x51085981u, 0xd14f3c00u, 0xa604b601u, 0x0b260bdeu, 0x41637390u, 0xc2e5f311u, 0x648e3647u, 0x6dad3887u, 0x48eac422u, 0x21a85f3du,
-	 0x6d289a2cu, 0xa0d4cc63u, 0xbc2ceaa0u, 0xbee816b5u, 0x827e27adu, 0xdf926027u, 0xb331bfe4u, 0x7a941c6bu, 0x39fa45adu, 0x015f733fu,
-	 0x886fbe42u, 0x43a69fafu, 0xb95917aeu, 0x6b1f6cc9u, 0x55d9b4cfu, 0xf0981ed4u, 0x8a2e207eu, 0xcb724ba6u, 0x8d28d683u, 0xca5dae81u,
-	 0x9ccb71dcu, 0xdfd32aa1u, 0x5f4a5b01u, 0x9c76a9f3u, 0xe98ea3f1u, 0xc3d0dd2bu, 0x320c5120u, 0xfb623afbu, 0x783b5d9bu, 0x0ab5e487u,
-	 0x080c1294u, 0x05564b60u, 0xd1b4d5f8u, 0x5f824882u, 0x69f78bbfu, 0x1e799520u, 0x2a61e95fu, 0x0bd66c82u, 0x082abb57u, 0xf7d0da22u,
-	 0x95645e8au, 0x40e4233eu, 0xea055d83u, 0xc3d1de63u, 0x946289aeu, 0xe5d660e3u, 0x3eca32acu, 0x51f8fe6eu, 0x93a86cfeu, 0xeaf1b15au,
-	 0xba6fdacbu, 0x287d814cu, 0x6472b775u, 0x5c8e8609u, 0x58b29eb3u, 0x6a7feb05u, 0xde24cc74u, 0x9a286e00u, 0x886ba9cbu, 0x05010dafu,
-	 0xacbf85eau, 0xfd3e922du, 0xf74daadfu, 0xde3eab55u, 0x08039401u, 0xdf2a0862u, 0x242883aeu, 0x18a3adf6u, 0x0f013be4u, 0x37103f1au,
-	 0x47213c6fu, 0x059289bau, 0x1eb7b124u, 0x51135c2au, 0x8b349bbfu, 0x4b9aa6f6u, 0x76dfa0d7u, 0xa59b5959u, 0x7d7d9512u, 0x28b8dfd3u,
-	 0x98258b71u, 0xf5f3b3b8u, 0x0e8b44e6u, 0xb5ba86f4u, 0x1cbc02f2u, 0x41f29280u, 0x8d2c2dc0u, 0xe9061653u, 0x5146094du, 0xaf0aa778u,
-	 0x82ce621fu, 0xa4776692u, 0x8eeb146eu, 0xfd1436e6u, 0xa4d6f745u, 0xdb438bc6u, 0xf6c116fdu, 0xbcc850b4u, 0x1bded45cu, 0xdefdd143u,
-	 0x4fb0a47cu, 0xa8c8b081u, 0x8d9eba1bu, 0xa025d00au, 0x3e0e9a14u, 0x0f167eadu, 0x230a048fu, 0x21d73028u, 0x6e3e1431u, 0xbe34d5b4u,
-	 0x8322fe46u, 0x915343cdu, 0xf21b5b13u, 0xc3bc7039u, 0x3fc4377fu, 0xdff8be01u, 0x2cb399ccu, 0x5027aba8u, 0xfb0c08d5u, 0x260e2b49u,
-	 0x88996edbu, 0xb5b2248du, 0xa320626du, 0x3795e249u, 0x60ecdf84u, 0x77ed8bc7u, 0xbd671871u, 0xd2ebd1cbu, 0x402f3244u, 0xa755ecc1u,
-	 0x4f20dc1bu, 0xd274d35bu, 0x2a36e663u, 0x5cdc610du, 0x0355c3d7u, 0x5a33a143u, 0xb24de182u, 0x81f56a08u, 0xa09888c2u, 0x369228a7u,
-	 0xc9718369u, 0x3c3a9f62u, 0x93bab58du, 0xb8536565u, 0x8dfa145eu, 0x79e0bf28u, 0xaab5f5cdu, 0xadb44e86u, 0x4c9b9667u, 0xda05d93eu,
-	 0xf1fc1e52u, 0x92089f4cu, 0xd3c44e7cu, 0x4d438004u, 0xf384dc25u, 0xffd0db85u, 0xd63f1fd5u, 0xf9408274u, 0xcd1b7d81u, 0x04a93885u,
-	 0xc179d90du, 0x529e568au, 0x6a8a9380u, 0xff67f80cu, 0x924fcc36u, 0x915e6c3bu, 0xdb10de68u, 0x9471e675u, 0x48321c1fu, 0xa9d34b5du,
-	 0x80488408u, 0x984bb16du, 0x44785629u, 0x5405551du, 0x6dbd252bu, 0x8eb95bf3u, 0x021c387cu, 0x22f3c6f0u, 0x84036e6au, 0x83f210b5u,
-	 0x936df3bau, 0x5ee0b0cbu, 0x9b6545a9u, 0x06a8a51bu, 0x9561adebu, 0x67b0f501u, 0x1d1b3436u, 0x41636fbcu, 0xf5562c9eu, 0x2c7fbb35u,
-	 0xaea3f825u, 0x08c596a5u, 0xae1731d0u, 0x658c63b5u, 0x532df13au, 0xb0a5bcedu, 0xd3d8dfc8u, 0x4893c62du, 0xc829b55cu, 0x09ef8242u,
-	 0x6c658dabu, 0x0ede0e38u, 0x5e58c0e1u, 0x78092e69u, 0x3e87ac1du, 0x484800b1u, 0x616e9896u, 0xdbd14362u, 0xf8d95559u, 0x144dcbf4u,
-	 0xdf32bbfcu, 0x1bb9ef07u, 0x698a5095u, 0x6235c7deu, 0x16c38600u, 0x9ec21671u, 0x8ea6ece1u, 0x343e1922u, 0xacd81b7eu, 0xa82d27e0u,
-	 0x5bb49c70u, 0x62be5dd9u, 0x9879d468u, 0x88204d92u, 0x6c6e07d0u, 0xd155b89eu, 0xbec75664u, 0x14e17bb3u, 0x984fad85u, 0x5d1aeb16u,
-	 0x52d87369u, 0x6a8406cdu, 0x364b7125u, 0xfc25a5a2u, 0x0dbffbfdu, 0x0c2c1100u, 0xa286352fu, 0x7b09d7aeu, 0x9e164219u, 0xb10052b6u,
-	 0x76e34991u, 0x1e7520bfu, 0x17412135u, 0x1f9e2b8cu, 0x281d0656u, 0xaf221b06u, 0xb28a37b5u, 0xc4257207u, 0x365c2836u, 0x0cdec0fdu,
-	 0x27cb0b79u, 0x17b6ce76u, 0xb8c1e83bu, 0xd5a60874u, 0x2c816c96u, 0xaf06ec6bu, 0x77dd2ffcu, 0x8dc21889u, 0xe0e20e74u, 0x65dfb10cu,
-	 0x4a71814du, 0x8ec3d298u, 0x12980b04u, 0xf7e46372u, 0x18648d9bu, 0xfe9d313cu, 0x2971eac7u, 0xe94a28eau, 0x01161eedu, 0xb09a690du,
-	 0xc9ab8f17u, 0x2b268874u, 0x1932c6bbu, 0x98cffa3fu, 0x802e54b9u, 0xe75d766cu, 0x7c80ecfeu, 0x342f7588u, 0x66475b51u, 0xb6ff4953u,
-	 0xb49195b7u, 0xcc3b1b23u, 0x02355280u, 0xc695b81du, 0xfa36a545u, 0x57787e45u, 0x7b7ebebau, 0x09ce85e7u, 0x0cb9b191u, 0x3894aeaeu,
-	 0xc1f51ed1u, 0xabf470d7u, 0x78d12c41u, 0x917a72beu, 0xd03e000fu, 0x6e93c02du, 0x8c7c66a9u, 0xb7c14e9eu, 0x116c2445u, 0xc2771d17u,
-	 0xcbecddfdu, 0x1c405dddu, 0x1b082fe5u, 0x172b0ebau, 0xdae50372u, 0x569b49e9u, 0x75f0a77du, 0xfc0a496au, 0x183d8aadu, 0x93a79412u,
-	 0xfc16eeb0u, 0x46467d51u, 0x4e079b71u, 0x52755ff7u, 0x41a69c18u, 0x9de9773au, 0x0e29fc19u, 0x6f2452d4u, 0xe6dbc41cu, 0x33368a6du,
-	 0x39549011u, 0x09f54270u, 0x8d7b5df5u, 0x126d09bcu, 0x90f851c1u, 0x78220700u, 0xe18c3ba1u, 0x72143b01u, 0x110c9453u, 0x3f7ecfb0u,
-	 0x33900acau, 0x90fcb859u, 0xba94117au, 0x4ca0f598u, 0x711abfbeu, 0x79abc8c5u, 0xd6ba6aacu, 0x91d60facu, 0x4a698459u, 0x78762ed0u,
-	 0xd2f2b9e3u, 0x64942699u, 0x04114e4du, 0xb278c966u, 0xbe85604au, 0x8382512bu, 0x2c004b00u, 0x8db73fd4u, 0x61f05c73u, 0x4e70ccc4u,
-	 0x5e7d0d79u, 0x115e7f51u, 0x68cee0a6u, 0x31ff3bfcu, 0xe3666f83u, 0xdce399adu, 0x4a3eeb40u, 0xfd1b8b03u, 0x6374702eu, 0x7a39f0afu,
-	 0xcd42b649u, 0x57d307e5u, 0xd6e781dau, 0xe3027552u, 0x52792b66u, 0x481ca8a4u, 0x17ab17e4u, 0xa4781330u, 0xf7a91882u, 0x0737b104u,
-	 0x1e981746u, 0xa54f23efu, 0x8f9a2239u, 0xb7fb907au, 0x03a4e7c0u, 0x0cf0df0au, 0xfcd49fa2u, 0x44123962u, 0x276699dcu, 0x73864f5du,
-	 0x98cb9b2du, 0xf31e7c22u, 0xfc2284c2u, 0x18c42d59u, 0x12af30e4u, 0xeb6d0753u, 0x725433f1u, 0xca4e9f9bu, 0xa2e6ec09u, 0x028c0048u,
-	 0x12d95487u, 0x1e6d27aau, 0x9c53258au, 0xdce2738cu, 0x636b5d21u, 0xe6861646u, 0x4226a7fau, 0x3725b63au, 0x2b79d9e9u, 0xb6072b7eu,
-	 0x5e614560u, 0x70f91f1du, 0xbcd309e6u, 0xbe3c6f26u, 0x54e2753cu, 0xb62edae4u, 0xdd6e60a2u, 0x79595410u, 0x218a0adcu, 0x3d301403u,
-	 0x248b4cb2u, 0xb5ab3d55u, 0x2c4a51fau, 0x0f84d723u, 0xaea25c41u, 0xde535854u, 0x7c617dadu, 0x867d204au, 0xf07e4a6cu, 0x5552fc9cu,
-	 0xb0918426u, 0x48cac212u, 0xb04a70ffu, 0x2a639a53u, 0x4d28838bu, 0xbaed0ae4u, 0x3abc82f8u, 0x0507287bu, 0x1bf87ff6u, 0x48749df5u,
-	 0x3a534d37u, 0xdcc89438u, 0x75810727u, 0x4fe46f12u, 0x7285d281u, 0x82284b1eu, 0xcd3d0d2fu, 0xf847e254u, 0xf20a1ddau, 0x6eb93486u,
-	 0xd00fa9abu, 0x683b87ddu, 0x4a02b59fu, 0xaa307025u, 0xa10b62e1u, 0x4affecb5u, 0x2e267fc2u, 0x126b8397u, 0x23fe971cu, 0x8de1ed71u,
-	 0x40c68975u, 0xb64c7013u, 0x735853e0u, 0xe073a5c4u, 0x0c99ca79u, 0xbfb6f1a3u, 0x28fc052bu, 0x1d1d3db7u, 0x61561e6bu, 0xe7fe5612u,
-	 0xd970aaf2u, 0x7cbcae7au, 0xd045208au, 0xff67cff0u, 0x1bce3f56u, 0x1692d2fdu, 0x0989678bu, 0x97ec166au, 0xed6446e8u, 0xacc4a3c4u,
-	 0x965f74bdu, 0x0821bfb0u, 0x2732ebb9u, 0x68f8832fu, 0xdd5ed7beu, 0xc672e4b0u, 0x5d458888u, 0x26d75af4u, 0x7c2fb5a1u, 0xb646c892u,
-	 0x71255501u, 0xb168d227u, 0x7e4ddbc8u, 0x657bc4d7u, 0xa41c5754u, 0x5d6ce5f8u, 0x8e0d6039u, 0xc0baab23u, 0xd7b6c157u, 0x5a24b24au,
-	 0x43c283e8u, 0x226fc530u, 0xb317584du, 0x15983f46u, 0xf1fdec92u, 0x19bea8ffu, 0x99335f96u, 0x576b4af2u, 0x95770af9u, 0x0a2240f6u,
-	 0x98f157f4u, 0xe1cf836fu, 0x1ece9ccau, 0x07d120e7u, 0xfbd82277u, 0x0f087fbbu, 0xd0b18e19u, 0x1d444dc1u, 0x9b1bf776u, 0xe314dd11u,
-	 0x026ffbf8u, 0x827f49e3u, 0x55bb6779u, 0xa7bfe908u, 0x724faa4bu, 0xf67a8222u, 0xa06a1a3bu, 0x5f17d144u, 0xbe9c6b66u, 0x0cf6e08eu,
-	 0xe2b08765u, 0x7e4c9ac4u, 0x921ba909u, 0xfea5cbe4u, 0x24a8071bu, 0x3f927d16u, 0x0f2944d7u, 0x21ddeb34u, 0x91e0e73bu, 0xd8626fb3u,
-	 0x7578ec45u, 0x22db4252u, 0x4b73613bu, 0x3ea44e38u, 0x9a15eaa3u, 0x0af32c16u, 0x1b7c4fc2u, 0x47a1d2e0u, 0xa3b34f04u, 0xa8c3b608u,
-	 0xdd555b3au, 0xcf454f0au, 0xb35dfc76u, 0x30d238ffu, 0x63577020u, 0x2674d9cau, 0xbe983cf7u, 0x335eefd7u, 0x2d3485a3u, 0xf1b7c325u,
-	 0x039896ccu, 0x74be5f7au, 0x4dd3d059u, 0xa9e26c9bu, 0xe22c3406u, 0xc54da7e8u, 0x8527b613u, 0x4ea8d3beu, 0xce91df33u, 0x18aa974bu,
-	 0xb52dc5b0u, 0xb9725203u, 0xb4a0e334u, 0x4a1c1f66u, 0x58017cd7u, 0x3344685eu, 0xc2e424a8u, 0x4a6abf7du, 0xfd4a59f8u, 0x92b7fa64u,
-	 0x4434db46u, 0xd815abe9u, 0x7f7501cau, 0x038a1fceu, 0x618dedacu, 0x4647bef2u, 0xd6203009u, 0xd3dbf6bdu, 0x6f3764b9u, 0xf9233f73u,
-	 0x5bb4cb61u, 0xd5d4a9c6u, 0xbba4202fu, 0xf9a1323au, 0xcce484edu, 0x7d10c24eu, 0x4e65741au, 0xb1de8492u, 0x98eb3c76u, 0x8cf34b0bu,
-	 0xdc605db1u, 0x32eb4f10u, 0x9e52e725u, 0xa9aed385u, 0x77b13f92u, 0x5d1413adu, 0xf8316aefu, 0xaedb0193u, 0x43e8afe2u, 0x872c7a6eu,
-	 0x0427bb02u, 0x729c9872u, 0xb122f2ceu, 0x3a243969u, 0x4d8ebfe8u, 0x06ab25fbu, 0xdafea719u, 0x2667820du, 0xbf031e5bu, 0x0aad6219u,
-	 0x629d715eu, 0x8e5234bfu, 0x24c40940u, 0x4f359fc1u, 0x80a0e880u, 0x83f6cb8du, 0xa1c049d0u, 0x87c8b027u, 0xcd179aa0u, 0xb408b467u,
-	 0xa492502fu, 0xba3dd131u, 0x3688a967u, 0x9cdb8976u, 0xdaa53fb8u, 0x9537dc6fu, 0x2bb7a41cu, 0x1205cc29u, 0xb1c85470u, 0x406bb75cu,
-	 0x6590bc63u, 0xf5e12c55u, 0xea86f933u, 0x787066c0u, 0xcaf6bb91u, 0xa3871feau, 0x1066a5d1u, 0xdbf43ab8u, 0x650cf1ccu, 0xb6f86b6cu,
-	 0x08ebb6c5u, 0x4d264e04u, 0x2d12af0fu, 0xede5cb3bu, 0x6e9434d3u, 0x02254453u, 0x2a2d48fdu, 0x32888ce9u, 0x9b7dd5d0u, 0x35a1e2ddu,
-	 0x850a9b58u, 0x55886129u, 0xe1cfe7b9u, 0xa9d7aba9u, 0xb9b4da44u, 0x9c376b8fu, 0x64f034acu, 0xa578d29cu, 0xd6a1727du, 0xae7f44b2u,
-	 0xf45f9e4eu, 0x542ff2c5u, 0x0b8d6f1cu, 0xf3f96bb7u, 0x2764addfu, 0xba58fccfu, 0xd40ee8a0u, 0xe9760967u, 0xd0a835fbu, 0x6fa8e7fau,
-	 0x8bf2095du, 0x4357ae35u, 0xaa4bbda2u, 0x0a324da6u, 0xc4bcd202u, 0xf9ea1ba4u, 0x014ece4fu, 0xc4c73cb3u, 0xf9bfffa2u, 0x81ca9ab3u,
-	 0x2f0592dcu, 0xa52271bfu, 0x19ca92c2u, 0x52bf08d0u, 0xb9ffcff7u, 0x14465ce0u, 0x173f10cfu, 0x655ebbf0u, 0xa99bece7u, 0x57426d19u,
-	 0x81e9703cu, 0xabda5308u, 0xa2f00643u, 0x6be5754au, 0xcff27182u, 0x78b7b898u, 0x6001f80bu, 0xcb3cb695u, 0xa740ca60u, 0xeaf75e78u,
-	 0xdd67eedeu, 0x824ce155u, 0xfb33dc5eu, 0x0ee6c395u, 0x2b2a7aa0u, 0x01fb5876u, 0x1445d15fu, 0x43560e33u, 0xd80cb400u, 0x112612deu,
-	 0xe5a12321u, 0x7d382a93u, 0x9c3fbf71u, 0x5fc35c1cu, 0x277a74d4u, 0xf27e26cfu, 0xe853078fu, 0x5b17f6e5u, 0x36215b28u, 0x42f3559bu,
-	 0xc8088328u, 0x54557124u, 0xa4c549dfu, 0x78608d43u, 0x46490f23u, 0x4088fb71u, 0x405a8ea9u, 0xb43353cfu, 0xad4923b3u, 0x01d0ac6bu,
-	 0xfc3a623au, 0xff384910u, 0xcb341fe8u, 0xd7ebc108u, 0xd0c65c64u, 0x8aab0590u, 0x75383838u, 0xac6938f7u, 0x87cc51b0u, 0x21e55e57u,
-	 0x4db19152u, 0x808c8870u, 0x09124954u, 0x108e5875u, 0x44fb5e46u, 0x12a0b932u, 0xf8374368u, 0x1a04421eu, 0x6f088dc2u, 0x0abf89fdu,
-	 0x717c66eau, 0xfcf944a1u, 0x319a0c57u, 0xfd789e23u, 0xbda6ce49u, 0xc738bd7au, 0x80cf9b4cu, 0x2b358f9eu, 0x3803cec3u, 0xcce4175fu,
-	 0x08c60e93u, 0xa4df592au, 0x43fd995du, 0x85f1ddbbu, 0x561d87b9u, 0x7e019d50u, 0xe3f3a875u, 0x1bb7ec5bu, 0x3b06a3fbu, 0x64a2ab70u,
-	 0xc4786fe0u, 0xd13d3b13u, 0x18beb92eu, 0x1a7f2d98u, 0x0e09cce5u, 0x5be5a411u, 0x552ca3e0u, 0x85c42370u, 0x0b720ef1u, 0xd995a1acu,
-	 0x8c6132e9u, 0xb5cd4214u, 0xc7e5a71cu, 0x3e6acde0u, 0x4df10e77u, 0x60a12de7u, 0xe613cb06u, 0x60910dcdu, 0xbc4e6e7au, 0x932bb780u,
-	 0x6f048fd4u, 0x3bc647efu, 0xc8258e52u, 0xa133bf99u, 0xfbba2576u, 0xbd3b07bfu, 0x6aa0616fu, 0xcc76a23du, 0x894e36d1u, 0x518adf81u,
-	 0x5a40ff9au, 0xe3c9e741u, 0x502e930cu, 0xf4beab5eu, 0xccdfde05u, 0x3d0648c4u, 0xe47b663du, 0x104a1107u, 0xda88106eu, 0x51a5df17u,
-	 0xd6242a60u, 0xe2380236u, 0x0f58db00u, 0xbeade0aeu, 0xb0a16b87u, 0x437fb2f9u, 0x7c5a7fcau, 0xd6e2f1a9u, 0x0b376d4cu, 0xddc9cfdcu,
-	 0x20d0eed7u, 0x3bc0baa5u, 0x8b5fca63u, 0x4d5fa06du, 0x8a574fb7u, 0xc0a1994bu, 0x06ef2fa2u, 0x5d66c4c5u, 0xaa477a9cu, 0x35835789u,
-	 0xaba9c241u, 0x6b3eaf7au, 0x54d6cfd7u, 0xce563d62u, 0x753eef26u, 0x7aa6c2c0u, 0x43d1eb2fu, 0x0960c679u, 0x19048c83u, 0x60bafab2u,
-	 0x6924605au, 0x7d5b0a93u, 0xd01dd40bu, 0x6582ed87u, 0xcd4addbcu, 0xfbc1a6e7u, 0x1a76ccb5u, 0x9f4f407du, 0x1bd52feeu, 0x9d5c6a38u,
-	 0x4cd102f1u, 0x4cca6f21u, 0x129b42e5u, 0x4d310edbu, 0x50db1ee1u, 0xb712e65du, 0x95ac92f1u, 0xe98147aeu, 0x4d30feedu, 0x88368ed8u,
-	 0x875031f7u, 0x51c71fdau, 0xf8600be8u, 0xee971839u, 0x55111759u, 0x521aa272u, 0x78e5761eu, 0xd0fb32a9u, 0x73d1bd17u, 0x9780e9e0u,
-	 0x3fa61facu, 0xa605892eu, 0xbe8a7a1du, 0x84bf3795u, 0xe01a4c09u, 0x067d3155u, 0xf2e5a8c2u, 0x05b8b066u, 0x5e54bdc2u, 0x06716793u,
-	 0x4d90d304u, 0xe4db1270u, 0x83b951d8u, 0x135361a5u, 0x353e9350u, 0xaa9f0223u, 0xc6ff7117u, 0x66a84afbu, 0x8490902eu, 0xfef67386u,
-	 0x42e862afu, 0x36558ec7u, 0x2d4a4617u, 0x106c7a46u, 0x2c68743eu, 0xd4ec4951u, 0xe6742a8bu, 0x789ef616u, 0x078f541eu, 0xcbd17ce2u,
-	 0x26482f70u, 0xaa3758c0u, 0xf2349225u, 0xbcdfecebu, 0xae419b44u, 0x503b88ccu, 0x139e16fau, 0x2d84af98u, 0x72e83540u, 0xb5c4d0b3u,
-	 0xb3c51644u, 0x66e62caeu, 0x544c1c67u, 0x82615e87u, 0xb5f6aa4fu, 0x03ee6200u, 0x05576aecu, 0xa07e6259u, 0x049e0014u, 0xd7a3544cu,
-	 0xedc369bdu, 0xe596bbddu, 0x4ae99703u, 0xab84fce9u, 0x5f2fafb7u, 0x879fbf04u, 0x70737428u, 0x6ceaddd1u, 0xf5ca6353u, 0x606e5280u,
-	 0x2373ebc4u, 0xb366b262u, 0x1aec9a0eu, 0x09d3f3a0u, 0x4e48de5du, 0xe791439fu, 0xd74ede71u, 0xc9c45240u, 0xc14368e4u, 0x4aeae484u,
-	 0x5b561cf7u, 0x10423a06u, 0xc2e294f1u, 0xaeda480fu, 0xdfec569du, 0x2e66eaacu, 0x05097e7fu, 0x0b9e01bbu, 0x3059f1eau, 0x11e4c0bfu,
-	 0x42cc2463u, 0x49e340c1u, 0x93d69651u, 0x9ed3b39cu, 0xe62610f9u, 0xfbf3a97bu, 0x151b2348u, 0xcdbc96eeu, 0x443c8546u, 0xef2caca6u,
-	 0x38a6bb77u, 0x43257674u, 0x4aaee9feu, 0x9c29e45au, 0xe5145876u, 0x7dc6b8d6u, 0x0bdd5a25u, 0x83168887u, 0xe2b5f8dbu, 0x4b0a79d2u,
-	 0xbf6424dau, 0x754251efu, 0x19a6805fu, 0x27ed1524u, 0x7e782702u, 0x45f8ff74u, 0xc137b557u, 0x168cd572u, 0x1d0faed6u, 0x0fc1fbafu,
-	 0xf9d3a122u, 0x5862df81u, 0xe3066b25u, 0x91d2b9c7u, 0x14402d0bu, 0xc2801292u, 0x1e83618fu, 0xff5b05c1u, 0x6404e9c4u, 0xc9e9335fu,
-	 0x4986fa31u, 0x48c14abau, 0x6f125130u, 0xc81047b4u, 0xb030bbadu, 0x852ed95eu, 0xec5be3c5u, 0x411d8024u, 0xd43a59c9u, 0x17063a02u,
-	 0xc12ac3b7u, 0x8a0384a5u, 0x7e1c3cf8u, 0x5d21cfe5u, 0x31fa374du, 0x83b101a4u, 0xa2fdf2c2u, 0x7b787181u, 0x57d6511fu, 0x0cccdb64u,
-	 0xa0e7fcc7u, 0xc9066112u, 0xfd87121bu, 0x2f737d06u, 0xf0bb959fu, 0xb192c9c2u, 0x69ff866fu, 0x1fd2b895u, 0x84f1f358u, 0xb05d627cu,
-	 0xb670ee39u, 0xce6bac59u, 0xfed589fbu, 0xdebcd914u, 0x805a5867u, 0xd5db861du, 0xceacd05cu, 0xc2373dccu, 0x30a004a5u, 0xbcba0adcu,
-	 0x03412202u, 0x357819fau, 0x8dc51893u, 0x2c0547a3u, 0xb5d548f6u, 0xe890dcd5u, 0xa7b86d38u, 0x24cd756eu, 0x86240998u, 0x17cab477u,
-	 0x6a21d56eu, 0xcd527302u, 0x63c36b7bu, 0xd3ef55efu, 0x8ea852e2u, 0xcda16bdfu, 0x39a7fb2bu, 0x1a4cb850u, 0xb6eb3e00u, 0x5e768cc2u,
-	 0x1c85b94fu, 0x6fb10a4au, 0xf51e7e99u, 0xd3a126a9u, 0xf2f52b6du, 0x5bd4fa1bu, 0x03037c9cu, 0x7e46cd63u, 0x470df4bcu, 0x0edd8b2cu,
-	 0xc641354cu, 0x6db7ada8u, 0xdf67e16du, 0x184c5b1cu, 0xfc24b448u, 0xed67529du, 0x4b0f0002u, 0x46cc1378u, 0xd1dede37u, 0xeb510574u,
-	 0x5b0e40e2u, 0x767fe440u, 0x878cabf9u, 0x00b6d7a7u, 0x4ed4ef92u, 0xc52e724bu, 0x7b643c13u, 0xf6f2bd16u, 0xb27dfb62u, 0x72ea1873u,
-	 0x1389b80du, 0x4e2ac28bu, 0xb55e8878u, 0x03d005f0u, 0xca75b7f0u, 0x1fe9b19fu, 0xfb2d424au, 0x20144db4u, 0x59b5d763u, 0x199cd923u,
-	 0xb4d28669u, 0x999556e0u, 0xc87fddd1u, 0xef85669au, 0x6af5aef6u, 0x4e7a2b4eu, 0x6e5d2a16u, 0x7f0eb2fbu, 0x1e1a51f6u, 0x392ec058u,
-	 0xbc54e04fu, 0x43d7992fu, 0xf0be1ea4u, 0x4df2a6eau, 0xe7b41fd2u, 0x2d1e77fdu, 0x045ec99cu, 0x89d8e9ffu, 0x2ba28576u, 0x98444f33u,
-	 0x57b55c5au, 0x6ab60726u, 0xd2cd5e96u, 0x2c259364u, 0xc645ccd5u, 0xa924d44eu, 0x05a78d0bu, 0x5a9040ceu, 0x261cf99du, 0x8535a465u,
-	 0xdd4bae9bu, 0x36ff5900u, 0x482052ddu, 0xdd2cecb9u, 0x33d67c4au, 0xcbc983bau, 0x3265b6c6u, 0x1a862e43u, 0xbdb55f5cu, 0x515b4aa4u,
-	 0x5ecc006eu, 0x39dfef32u, 0x38234069u, 0xcad47090u, 0x8f2c6e8cu, 0xf8675e61u, 0x2bca0e83u, 0x087ed7c6u, 0xcbdbe076u, 0xdee90f9eu,
-	 0x28729703u, 0xa5809c72u, 0x02d68a1eu, 0xf8928f70u, 0x222575a4u, 0xc5cf620eu, 0xc0474f9au, 0x388177b5u, 0x42244281u, 0x06e79787u,
-	 0xdc0a606bu, 0x3fbfa6f2u, 0x5b54ec23u, 0x65ab6d13u, 0x1abb897eu, 0xde155cdeu, 0x98000813u, 0x0295d967u, 0xc672c5bbu, 0x8cca2b00u,
-	 0xdf3b679eu, 0x06aed2d9u, 0xe5568132u, 0x0430b010u, 0xbb10e458u, 0xb16a41b7u, 0xeffc122du, 0xfa4a9d8au, 0x0e156078u, 0xcd253fa1u,
-	 0x66529ee4u, 0x96253a18u, 0xdb90ad3cu, 0x47ad2d43u, 0xd2dbf6c9u, 0x3111796eu, 0xa17a0260u, 0x1e6ee104u, 0x51965408u, 0xfda912e3u,
-	 0xe9b2cb4eu, 0xb4a6229bu, 0xe7814bdeu, 0xf644266bu, 0xeb5541f2u, 0xb6c40ebfu, 0x4c9f0fb3u, 0x2d46cbedu, 0x78619e6bu, 0x7ec0caadu,
-	 0xd8dffa54u, 0xc6594b70u, 0x41989dacu, 0x34ad001cu, 0x920f3b37u, 0xb7c79205u, 0x92dbdc79u, 0xebf39ad8u, 0x1e0c3104u, 0x4296d413u,
-	 0x05e0cc42u, 0x81eb2f15u, 0x2622de96u, 0x4fee9927u, 0xba20bcc0u, 0x98aeb95du, 0x02c8bf0du, 0xbebc9e13u, 0x6a0f2856u, 0x07d37458u,
-	 0x8db6f3ecu, 0x44bea512u, 0x33a9624au, 0x2e895099u, 0x97c6d6b3u, 0xc52678ddu, 0xfaf53aefu, 0x3713692bu, 0x02e4b70eu, 0xdb72ce99u,
-	 0xf87922b5u, 0xefe2b7d5u, 0x5e1c5e49u, 0x21ba2d78u, 0xa156ef1cu, 0x0f6821deu, 0x81bba914u, 0x46b8619fu, 0xb75df8d3u, 0xf0ba3e02u,
-	 0x161aa8a8u, 0x5797f2dbu, 0xb314441du, 0xca1ad50eu, 0x89812e6au, 0x1ca87fb8u, 0x10eace22u, 0xe6b5a107u, 0xa84b50f9u, 0xd34f4179u,
-	 0xfc0d813au, 0x1e2cf6c1u, 0x40adc07fu, 0xc17cf00au, 0xef8316deu, 0x09b4932bu, 0xa992a32fu, 0x79343d20u, 0xc69dcf3cu, 0xc117987au,
-	 0x14b427c2u, 0xd5ec718bu, 0xf990da65u, 0x2a8a0f5fu, 0x0dd6efe2u, 0xdcb8efa3u, 0xae3ad25bu, 0xd1991b22u, 0x70f42695u, 0x656e025du,
-	 0x277ba757u, 0xb697e8e8u, 0xeb88cbfau, 0x9c9f7107u, 0xf9dd1dccu, 0x2bca954fu, 0x98dfaa5au, 0x43bb407au, 0x7cbb1cdcu, 0x6980d550u,
-	 0xfb44fa69u, 0xef77d2d2u, 0x00f13758u, 0x4f5b6a50u, 0x5b5f77b8u, 0x415949c0u, 0x600836b3u, 0x26e830c9u, 0x25409e37u, 0xd6c7d1eeu,
-	 0x0ac8c8dbu, 0x7798fc9cu, 0xdbffd18eu, 0x8d98fad6u, 0x480f97dfu, 0x5f2bccc3u, 0x1a2955f5u, 0xb20dae95u, 0xfbbfd546u, 0x2d252ea5u,
-	 0x6cacc670u, 0xe85ce5feu, 0x7f1ad943u, 0x25544604u, 0x5d6a27a8u, 0xcec88b23u, 0xa60dac7fu, 0x3fe69447u, 0xaf7fb56fu, 0x069ce9b3u,
-	 0xb8b8caacu, 0x589a5ba7u, 0x00490e32u, 0x09d98972u, 0x510b701au, 0xba0c9f26u, 0x126ab3acu, 0xb1f60056u, 0xfeb79e14u, 0x1f41687fu,
-	 0x8629a954u, 0x98204065u, 0x62fa82ffu, 0xcd1f232cu, 0x7f81ce67u, 0xc8aaf99bu, 0x10102059u, 0xa0696ab1u, 0x3c4ba18du, 0x5b88fca0u,
-	 0x86772a4bu, 0xc15199c7u, 0x90276ab2u, 0x3635910fu, 0x0161bc03u, 0x93d07204u, 0x027372d0u, 0xbe19c069u, 0x87b00432u, 0x0a720ef9u,
-	 0x9e3d71a3u, 0x36559f22u, 0xb4685f2bu, 0x7c9c6ac8u, 0x8469a53du, 0x96cdaedbu, 0xb3994c7bu, 0xa8da1d84u, 0x4d0717e2u, 0xce0a83aau,
-	 0x1e1667f8u, 0x23eaa3a7u, 0xea940ff1u, 0x4ecb8fc5u, 0xfdb6f75fu, 0xa2175168u, 0xc0718859u, 0xff412501u, 0x23dd5d21u, 0xacca2978u,
-	 0x3e50ae8eu, 0x6c58f799u, 0x6bc10d3eu, 0x43701c50u, 0x1ce8f47eu, 0x323c036cu, 0xea6aa291u, 0x8ebfe051u, 0x974e1b8bu, 0x24f20866u,
-	 0xcd56748fu, 0x0d8246c6u, 0x52530332u, 0xc877faf3u, 0x0c4eb623u, 0xc25356d5u, 0xf6e6eb7fu, 0x60917e87u, 0xd086bb7eu, 0xca467fc8u,
-	 0x73ed8a20u, 0x5189224fu, 0x52e903a7u, 0x24c646a0u, 0xb88aafb8u, 0x22eaa3a3u, 0x8b6e991bu, 0x3d6160a1u, 0xcb34f08au, 0x905babd6u,
-	 0xa1da3f2fu, 0xce6a4cebu, 0x11b9b1cfu, 0x600ecd88u, 0x1e7f4313u, 0xfd49b26du, 0xdd69d0cbu, 0xb458b9d9u, 0x5925e51au, 0x69b8bf44u,
-	 0xc12c598cu, 0xb1e229b0u, 0x02972064u, 0x2b38e4aau, 0x0544a5aeu, 0x6ef84783u, 0xc4561cf7u, 0x983d3f0cu, 0x3fcff116u, 0x2b46c29cu,
-	 0x505709fdu, 0x7f6627b9u, 0xa3d3c67au, 0x37f92631u, 0x9a5cdb32u, 0x01f2476au, 0x57f79080u, 0xc38ffacdu, 0xf79ff972u, 0x60d76683u,
-	 0x3f24c687u, 0x1dfa24adu, 0xd2b98e85u, 0x40b7b6bau, 0x977a846du, 0xd9055cdfu, 0x96dc6e00u, 0xd7b49042u, 0xf1fd1be8u, 0xa9241ee9u,
-	 0x59a1ce86u, 0x935011a1u, 0x8c47749du, 0x5389d828u, 0xaf4128edu, 0x6f75da50u, 0xcbea547du, 0x0d71747fu, 0x7ad17359u, 0x8d4ae654u,
-	 0xf55ed841u, 0xfec25ad7u, 0xf794cfe5u, 0xea6f07d9u, 0x139e8407u, 0x88739c6bu, 0xeaa6c9c7u, 0xf2970633u, 0x4277a97au, 0x58217dc6u,
-	 0x875c3ca4u, 0x8470f097u, 0xcb1e7bcdu, 0x865a9b3cu, 0xfec63434u, 0x235bb372u, 0xbbae96fau, 0x1780e75au, 0xecc01b6cu, 0x7e6a3051u,
-	 0x7b843739u, 0x76f453b2u, 0x278c4b9au, 0xa2aa880cu, 0x0eaa6401u, 0xbb6b7b66u, 0xdb762e4au, 0x40b2293fu, 0xb7669c93u, 0x22a2c95du,
-	 0x088aaffau, 0xd9594fbdu, 0xdfe7ce6cu, 0x783ecddeu, 0xce2ea5cau, 0x5e749c70u, 0x25571f4cu, 0xf0f419bau, 0xc824ffc1u, 0x4a24afc9u,
-	 0xb232368eu, 0xe7a031d2u, 0xd0c62f49u, 0xdf44b271u, 0xae00c76du, 0xab8792d2u, 0x287fbc62u, 0x3136be09u, 0x1264b4acu, 0xb38522e4u,
-	 0x3829c490u, 0x7ecb18fcu, 0xf4bb73c0u, 0x7dcac676u, 0x1e98e5f7u, 0xeef067ecu, 0x160f3f02u, 0x7479c290u, 0x71986a18u, 0xa32e9149u,
-	 0x8e982644u, 0x9ce259fbu, 0xcfaf1f1fu, 0xf6025dc6u, 0x4ef09abfu, 0x060b656fu, 0x85b49cc9u, 0xa81f2031u, 0x6c315ae6u, 0x23ffc966u,
-	 0x60a7792bu, 0xdc95e3e8u, 0x8f20e899u, 0x18f050bdu, 0x274ef483u, 0x1cc9654eu, 0x3fea255du, 0xd7a8954cu, 0xb86c7a23u, 0xa828452fu,
-	 0xba5f7f86u, 0x212f9592u, 0x5f09135fu, 0x31504361u, 0xacd4e943u, 0xbc064603u, 0x9c83ddebu, 0x5583bea9u, 0x4178e902u, 0xc3f26f3bu,
-	 0xc7b526e4u, 0x7610dac8u, 0x2c7f1105u, 0xf1519259u, 0x46e3d729u, 0xcd77d2b9u, 0x647e65e5u, 0xaf852209u, 0x6d5da837u, 0x7584ea46u,
-	 0x8f1fe6ffu, 0x749ec44bu, 0xec335181u, 0x41af3747u, 0xff506cb4u, 0x6e9ee3a4u, 0x6ca13b01u, 0x57a14766u, 0x75b483f4u, 0xd9e755a4u,
-	 0xd7f31134u, 0x208560b6u, 0xb345ebfbu, 0xc7df78c5u, 0xf8a1c496u, 0x84a4d463u, 0x1c7a8658u, 0xd6d02a15u, 0xe6c392dbu, 0xa581dec1u,
-	 0xa70f1bbdu, 0xc2915ee6u, 0x32117bf9u, 0x86e13331u, 0x206ca469u, 0x0ac96476u, 0x3a1e8f08u, 0x074260dbu, 0x97db36bcu, 0x5d92ad4du,
-	 0x55727cebu, 0x09f0d248u, 0x00d2288au, 0xc8f05f30u, 0x79343374u, 0xb9c648b6u, 0x1c441fecu, 0xaa2ef68cu, 0xdd7c81d8u, 0x941fc28du,
-	 0xe381f039u, 0x6f028545u, 0xb3a406e7u, 0xe22baea7u, 0xf2935620u, 0xa3a70d6du, 0xc8942732u, 0x9352183fu, 0xcdf780b8u, 0xae8daeeau,
-	 0x9aae38a7u, 0x48514e7du, 0x550cfd1fu, 0x56d48291u, 0x63106524u, 0x04be379du, 0x12d2b046u, 0x780fd0c9u, 0x623f9273u, 0x734c46d5u,
-	 0x338955e4u, 0x20614093u, 0x60dfdab7u, 0xe7915f2au, 0x8ec76e8du, 0x1db8c6aau, 0x16dfd341u, 0xf87944c2u, 0xbd076ee9u, 0x10969535u,
-	 0xa4941a9cu, 0x3015c95cu, 0x9ffa9041u, 0x0a682371u, 0xa7ce6686u, 0xe9817d9cu, 0xff74b204u, 0x0b3bf013u, 0x63667a31u, 0xbfa6d5d6u,
-	 0x7aeba6b3u, 0xab6c0775u, 0x69a47e84u, 0x95837790u, 0x38c5c372u, 0xa703c2e9u, 0x190320fbu, 0x293c6018u, 0xa9da76f4u, 0xeb64e2b1u,
-	 0xfe59f44au, 0x563d439au, 0x6906dc14u, 0x815e290bu, 0x6d122d5cu, 0x9c0360d3u, 0x3b5af6c4u, 0x4be3ab00u, 0xdfb6cf29u, 0x4515fafcu,
-	 0x5095a8ccu, 0x6b5ffd87u, 0x776cd66fu, 0xdd4965d0u, 0xa05f6a19u, 0x5205cf60u, 0xa682d8fbu, 0x02688405u, 0x1165e990u, 0xb0e85c19u,
-	 0x44734532u, 0xe3acbc23u, 0xf6f61d9fu, 0x0562b734u, 0x5d4b2ddcu, 0xe26900e3u, 0x77b38798u, 0x2295057au, 0x4a4d8693u, 0xcc4c48a4u,
-	 0xda000caau, 0x99a5f51bu, 0xfd4b45efu, 0x0c3ec061u, 0x55f4410cu, 0xe6de6462u, 0x59225d9fu, 0xa85be848u, 0x0a9e08f8u, 0x96b2150eu,
-	 0x01996303u, 0x9e9a970eu, 0x958857deu, 0x70f57120u, 0x6474c369u, 0xf6f9a815u, 0x62d453b8u, 0x71106993u, 0xdf48928bu, 0xa03dcb24u,
-	 0xcb36c7c6u, 0xc44fdfcbu, 0x4f084540u, 0x4e10b86bu, 0xeabeec0fu, 0x403db175u, 0x27354a2fu, 0x2fc2ddc0u, 0x76cac903u, 0x88051e1fu,
-	 0x824dd5ccu, 0x21de35eau, 0x3d439a61u, 0x7363b321u, 0xe5e0ca49u, 0x8b5855c6u, 0xf55866adu, 0x5aa28e90u, 0x65de7037u, 0xe7c85947u,
-	 0x2ba71dd4u, 0x2073fb7du, 0xf8719768u, 0x65cfd973u, 0x781492adu, 0xf4136408u, 0xd22057c4u, 0xe3aca073u, 0x32af6511u, 0x6d0c21deu,
-	 0xe3edd58eu, 0xb5bca275u, 0xe3cd47adu, 0x4967b6dau, 0x981449c8u, 0xf03ab76cu, 0xfcfba7f0u, 0xe72a48a6u, 0xe30eddffu, 0x7b883b45u,
-	 0x8cfc94a3u, 0xc63b72d8u, 0x649aae9du, 0x8446ee37u, 0xb38a4a6eu, 0x5cf3326cu, 0xabaa4115u, 0xa99ac561u, 0x06f6825fu, 0xaf3e0af2u,
-	 0xdcb498beu, 0xdd698961u, 0x0e7224b8u, 0x74e093b1u, 0x18bd693du, 0x8e8673ceu, 0xeddbc5a4u, 0x65bf93fbu, 0xc7f4f7edu, 0x1ad5a961u,
-	 0x6e0e6886u, 0x4440ce0fu, 0x3ab910c3u, 0xced02541u, 0xef86000bu, 0x679e04c4u, 0x73098691u, 0x7f4ee160u, 0x6bded9edu, 0xe9a7350cu,
-	 0x41486cd2u, 0x61aea690u, 0x5cb4f4bbu, 0x1eac61c4u, 0xe096e13au, 0xaf5de7a1u, 0x81226ef6u, 0xfe34c852u, 0x1c4b9db3u, 0xdaa51115u,
-	 0xaae8a846u, 0xb9a2a9e8u, 0x02a3a7fcu, 0x1faaf0f7u, 0xd0c3bc3au, 0x2ac626a1u, 0x17effa8eu, 0x72ca8ee9u, 0x32a6acb0u, 0x234a5c27u,
-	 0x859bedafu, 0xca3da8afu, 0x5ee17aa9u, 0x72f0c293u, 0xed0d77c4u, 0x731dcfcbu, 0xc10b5e35u, 0x7fe2ece6u, 0x6ee7a7d0u, 0xe89c0208u,
-	 0xcc3756fcu, 0x4fabc050u, 0x6badfc77u, 0xf7603a23u, 0x64b8b741u, 0x27b93737u, 0x7c4fbb87u, 0x13c48567u, 0x5ed5b89au, 0xf14778e5u,
-	 0x69e19490u, 0x4fbcec4eu, 0xdf625985u, 0x4f172e62u, 0x39e15a4au, 0x4f1cb037u, 0xf2af9b0cu, 0x0ef52a44u, 0xa5fe96fdu, 0x69c587efu,
-	 0x36e6a070u, 0x5a03d707u, 0x0066d8aau, 0x2956d859u, 0x2b85c827u, 0x08a28d43u, 0xacfb7ae0u, 0x01011466u, 0xceda5f26u, 0xb9de1ce6u,
-	 0x4b56273eu, 0x7a4eb828u, 0xd9ce103au, 0x00b5252bu, 0xfdf768cfu, 0xe16a3f00u, 0x8046016cu, 0x39d01162u, 0xd5edec5cu, 0xe1f47b6bu,
-	 0x14f2df46u, 0x435491ccu, 0xdafb0fc2u, 0xccc88c78u, 0xb6d7b2c5u, 0xfca983b3u, 0x4b45a38cu, 0x4a31a950u, 0xe78206d8u, 0xb969017du,
-	 0xf65e5702u, 0x5ca04097u, 0xc7a16abeu, 0xb451d1ffu, 0xbec07e52u, 0x9beb495du, 0x0469352du, 0x32a46634u, 0x6e3219a7u, 0x32d1a914u,
-	 0xd7bcf493u, 0x4164d306u, 0x97c1b1dau, 0x7e37fa54u, 0x1f46571bu, 0x3390f15cu, 0x18ac3d49u, 0xac676f78u, 0xab5846b2u, 0xf10d1b4eu,
-	 0xc9f3cb3bu, 0x686d140au, 0xf7864ee3u, 0xe35d98f9u, 0xf6e9edf2u, 0xa9bf238au, 0x13748bbeu, 0x825af8aeu, 0xb11fbf19u, 0x3da28449u,
-	 0xc099f86bu, 0x691a5295u, 0xa1df67b2u, 0xe22b0ac6u, 0x18dd01d0u, 0x011af8eeu, 0x310f2177u, 0x2a80e585u, 0x2a6df502u, 0xffaf9553u,
-	 0x3b41b887u, 0x6280ff1bu, 0x854a28e6u, 0x51b2166bu, 0xf90e92f9u, 0xea062a62u, 0x1d7b2217u, 0xa1ea7202u, 0x081f9fecu, 0x4ec507f6u,
-	 0x2176038eu, 0x8bcc36b9u, 0xcf1df261u, 0xaf88b921u, 0x97473676u, 0x103a1707u, 0xe6ac1da2u, 0x423c592eu, 0x8d754860u, 0xb356aa8bu,
-	 0xf96eeedeu, 0xde2383e4u, 0xa0a239feu, 0x8015bcd6u, 0x352689b8u, 0x846617cau, 0xcf6da069u, 0xad8c4052u, 0xaff899c8u, 0xbac37633u,
-	 0x6d1a2e58u, 0x5e42e5d4u, 0xcd90581eu, 0x4b72178du, 0x55df20aeu, 0x15aeb7c9u, 0xc4e4da18u, 0x02503ce8u, 0xed1bc99cu, 0x5eb58f7eu,
-	 0x52a50a76u, 0xc067d4cau, 0x6dbb7dfbu, 0x54ecdee4u, 0xe372c2d1u, 0xfc99646fu, 0xefc70737u, 0xa440bee8u, 0x3ae1bee1u, 0xb78db9e4u,
-	 0x6f0870b0u, 0x4f3a8822u, 0x55645cf6u, 0x3c604e8eu, 0xd19e9bebu, 0x58c21d72u, 0xa1f3ce68u, 0x81ee13bfu, 0x8811896du, 0xabf5e93eu,
-	 0x67742ccbu, 0x51a2aed1u, 0x51f5e932u, 0xfaa3da6cu, 0x52c43fe0u, 0xa381ce4au, 0x9ac398afu, 0x9efc6ce6u, 0xd3bbaa66u, 0x2c8ab72eu,
-	 0xf0d1732bu, 0x9bc3d5a1u, 0x45e9640fu, 0xa3b041cdu, 0x42a4befau, 0x715e5142u, 0x6d405b4bu, 0xd5652bc6u, 0xfb6f815cu, 0xd11871dau,
-	 0x7f95ac1fu, 0x2168bc59u, 0x1cda928eu, 0xb8f960e3u, 0xa27c5791u, 0xf18cc155u, 0xe27ef763u, 0xb6e5bd8eu, 0xcead9ae8u, 0x764d47d8u,
-	 0x7120e9bfu, 0x5287c995u, 0x2eb3b1f8u, 0x34d451f1u, 0xc34fab95u, 0x95c4f639u, 0x06eacd59u, 0x784b86c4u, 0xf2047e2au, 0x2e40a0f3u,
-	 0xf2495d3eu, 0xdee586c2u, 0x0b3b4ff9u, 0x161847e2u, 0x20930330u, 0xff99b356u, 0x69aa33bdu, 0x55f2d42cu, 0x2f8185e4u, 0x5528cef7u,
-	 0xac22d44fu, 0x0e1505f1u, 0x9c6f2f81u, 0x9ff9a804u, 0xd64bb5cau, 0x86d24172u, 0x85b9f4ddu, 0xfa32419bu, 0x66411468u, 0x9dfb39a6u,
-	 0x0cafbd00u, 0x0ce2801eu, 0x79e4b30du, 0x4fa8bbf2u, 0x2875065cu, 0x3b764c97u, 0xa62575c2u, 0x448f1e3bu, 0x6f9402a5u, 0x7e532866u,
-	 0x8cc0468eu, 0x6eb96546u, 0x032f5462u, 0x4826769au, 0xa2a0bca9u, 0xb08e7e84u, 0x8c4178b7u, 0x9f31b339u, 0x98f71102u, 0xb0173230u,
-	 0x19e6ea3eu, 0xe2dc1372u, 0xba9172d4u, 0x5736ceb5u, 0x6be00ddfu, 0xec0906bdu, 0xe59857d7u, 0x747f10b1u, 0xbdf0aecbu, 0xf75d314bu,
-	 0xa2ed9bf2u, 0x9e802bb2u, 0x96a89c4fu, 0xced52478u, 0x7fb444f0u, 0xb11513e7u, 0x13fd221au, 0x8a96159au, 0x13e71369u, 0xbe284c01u,
-	 0x451a2f0bu, 0x66f13d48u, 0x2a3505c9u, 0x53fd669cu, 0x2a381a98u, 0x796f7145u, 0xc049c6a4u, 0xf8633c61u, 0x26f51c44u, 0x8e80ba17u,
-	 0x0a161e5du, 0x83a59051u, 0xb5716d94u, 0x5830d71fu, 0x6d5e9421u, 0x72cb3040u, 0x5e6a8207u, 0xcb1c21edu, 0xe4b928f8u, 0xa7e2789fu,
-	 0x195ba20bu, 0x59d38a46u, 0xcf9c6867u, 0xafde4f5du, 0xb584f147u, 0x5300e13eu, 0x9ee7de7bu, 0x90e3a273u, 0xa59c0a17u, 0x463aad12u,
-	 0x1ea12812u, 0x319bb232u, 0xc128a9a7u, 0x69accc1eu, 0x2f042a2fu, 0x8ec0589bu, 0xb72c464au, 0x797c721au, 0x683deee2u, 0x5263a085u,
-	 0x9b8b7bf0u, 0x9ab6f354u, 0xbfeb1625u, 0x9dcbbb20u, 0x6790a0c9u, 0x0392ddccu, 0x426d970au, 0x123bb94bu, 0x6cc474bbu, 0xa0ef2371u,
-	 0xdf4e1f69u, 0xad132b6bu, 0x346043d8u, 0x9980c9efu, 0x82fc2b09u, 0xc24a6bf9u, 0x4ab13517u, 0x2e3cb8d7u, 0x05028e4du, 0x488b546cu,
-	 0x6fa451ecu, 0x8f11f94fu, 0xf8d6fb27u, 0x01dc0fafu, 0x30560705u, 0xbd016953u, 0x2c2c9c1bu, 0x6f7903a0u, 0x26b1f2a1u, 0xc7759725u,
-	 0xbe36abc0u, 0x7016a65bu, 0x57a1dee2u, 0xfd3fc2ceu, 0xace3ac94u, 0x9bf2eaabu, 0x027f3e08u, 0x4efaa212u, 0xd0f1d0afu, 0x0f9f243fu,
-	 0xb4baf7cfu, 0x854047adu, 0x89eb9731u, 0xfef6da79u, 0xf80f70ccu, 0x7fc3ea3au, 0xec0090dcu, 0xd8997682u, 0xa04da657u, 0x4d984af9u,
-	 0x74fddae2u, 0x58b7b463u, 0xed2b31d8u, 0x4ac62e3bu, 0xf0077891u, 0x9e903ee8u, 0x511b6d66u, 0x418fd475u, 0x1cf65e4fu, 0xb351707cu,
-	 0xa72d7148u, 0xb2301469u, 0xca52f1f3u, 0x49670979u, 0x6203dfdau, 0x11ade759u, 0x7e6a7900u, 0xa7b41d9au, 0xf381a144u, 0xbbad54edu,
-	 0x99fe413au, 0xc5c73829u, 0x958620fau, 0xd16cc455u, 0x71c6c46cu, 0x84401647u, 0x34b506b9u, 0x4a80d020u, 0x537c2e7bu, 0x67686899u,
-	 0x18bc1754u, 0x531d92e5u, 0x46c064d1u, 0x5aa6ce30u, 0x03d70197u, 0x49e0309cu, 0x75f1fdb0u, 0x28060d56u, 0x4090236fu, 0xc8b318d7u,
-	 0x52530ca4u, 0xadd554ddu, 0x1abd271fu, 0x2ff01b7fu, 0x6597b2c3u, 0x5786ea26u, 0xa0d44eafu, 0xddfedc99u, 0xf4669289u, 0x823638e5u,
-	 0x719e28c8u, 0x17ef35edu, 0xd1874893u, 0x8701c3bfu, 0xf1cf462eu, 0x7a2adf51u, 0x9421888du, 0x8d8a4047u, 0x954abb74u, 0x92997574u,
-	 0xb6b324e1u, 0x1970016eu, 0x0f544d73u, 0x3534460eu, 0x3c68edc5u, 0x9e3f9d7bu, 0x088a0424u, 0xb3709392u, 0x81c27f26u, 0xc5758a0eu,
-	 0x1ebd0b2eu, 0x4bfd85d5u, 0x77b7bbf1u, 0x51aca193u, 0x40193883u, 0x0005ae3cu, 0x2223d46du, 0x67c50281u, 0xed687dcbu, 0xca3e6e86u,
-	 0x53ec195cu, 0xbdfbaba0u, 0x61c9d2ceu, 0x68e3168au, 0xcb6f68c0u, 0xc18f7fa9u, 0xd913dae6u, 0x1cc06c35u, 0xd8e816c5u, 0x23efba63u,
-	 0x16b28ce3u, 0x29a6d7dau, 0x05330627u, 0x77fa1302u, 0xe887060bu, 0x6767a046u, 0xfd27f64au, 0x1c05ffdau, 0xa9de4bc1u, 0xf259f71bu,
-	 0x786d61e6u, 0x82f5d482u, 0x068b6f6bu, 0x70257808u, 0x44cdbaaeu, 0xcc7beb1eu, 0x32656cc5u, 0xaa3ca4afu, 0x34f3b77fu, 0x55859733u,
-	 0x58a22f9cu, 0xa414a099u, 0x1d695975u, 0xe42f3730u, 0x8780f6b0u, 0x0450f57du, 0xaad4a9fcu, 0xde195472u, 0x05ae2119u, 0xea257455u,
-	 0x953e1219u, 0x0cfb1d6du, 0x2c35666du, 0x3ac8490eu, 0x362daa3bu, 0xcb139845u, 0xc9a77ec4u, 0xe87aca7fu, 0xb3abbd2cu, 0x83cd068bu,
-	 0x4e0c04a5u, 0xc42cb19eu, 0x4d9d58f1u, 0xaa4149d2u, 0x88124e38u, 0x065e9524u, 0x870013e5u, 0x7e173ec4u, 0x460cc25eu, 0x3c6678d4u,
-	 0xea0d3d55u, 0xc3606dacu, 0xcc6430d2u, 0x839ec52cu, 0x96ef5523u, 0xd1dbfc1cu, 0xb44c3d65u, 0xa277418bu, 0xfc2aef4bu, 0x694b83beu,
-	 0x22de5b62u, 0xd0fe1dedu, 0x60ff241cu, 0x0715e286u, 0x5a45a296u, 0x3e9dd3a9u, 0xce6df583u, 0x859aecb5u, 0x0666e89eu, 0xc17d6eacu,
-	 0xff6c5d17u, 0x3b1dcda8u, 0x8959a7b3u, 0x85321852u, 0xe3450ba3u, 0xc786a28fu, 0x78dc9a9cu, 0xfb5f0715u, 0x7843dbeeu, 0x7cd123bbu,
-	 0xceebc429u, 0xe39c29e6u, 0x23fe964cu, 0xbd7e5965u, 0x973eec97u, 0x114331aau, 0xff818d7au, 0x278624c9u, 0x381d8ca2u, 0x5115bc15u,
-	 0x853ed236u, 0x79088183u, 0x957bb46au, 0x6389507fu, 0xdb0d9d23u, 0xb5b79c6fu, 0x4f3bc1fau, 0x970e9b60u, 0xab61a6cau, 0x760d5f7bu,
-	 0xb642704eu, 0x939a9c01u, 0x319019c9u, 0xe9fa92aau, 0xd57cdd89u, 0x2d172290u, 0xd1bcf99du, 0x77704201u, 0x1e3677c7u, 0xbe0c9bacu,
-	 0x94bcbfa2u, 0xe42b56bau, 0x6a47b4d1u, 0xe1fd9cf8u, 0xdbe8af74u, 0xafa6595eu, 0x88b5b19cu, 0x5126fe50u, 0xc61bb317u, 0x4ba0b944u,
-	 0x1bf79330u, 0xda5a6967u, 0xccc43221u, 0x6f397beau, 0x0fdd641fu, 0x42481e2eu, 0xdc73170cu, 0x271c60c9u, 0xae28850fu, 0x45da8c93u,
-	 0x7afa9accu, 0xf7354c9cu, 0xfe6e9142u, 0xc46ba408u, 0x4351a45bu, 0xebc4a3a8u, 0xe9484ddeu, 0x9c0e27d1u, 0xbedd9e18u, 0xa49e9ec3u,
-	 0xa5e003b1u, 0x98a45bc8u, 0xd905879au, 0x3b98b186u, 0x4dd2f1f6u, 0xdfd9e15fu, 0x492309e4u, 0xe9b244afu, 0xd32dc890u, 0x11e6d9beu,
-	 0x6b2fe1a1u, 0xfc5a4a0du, 0x404f8482u, 0x4e73f88du, 0x1f6cecaau, 0x24c622e3u, 0xac779268u, 0xdfcf35c3u, 0x50da7b3fu, 0x637ce4adu,
-	 0x32158f12u, 0xda4a1ecbu, 0x1a08cf27u, 0x77a4dd74u, 0xd10e6037u, 0x6cf4e09bu, 0x02e0ae45u, 0x1d181f72u, 0xcecc4e2au, 0xc6be4e11u,
-	 0x85e1d7ceu, 0x8a70e6eeu, 0x221001f7u, 0x6b988654u, 0xbed8de68u, 0x236cbd3au, 0x025ce1ebu, 0xaed8f703u, 0x6238752eu, 0xcb7244dfu,
-	 0x49697f34u, 0x8ce7299au, 0xe40124b4u, 0x52145172u, 0xc45dcaa8u, 0x0e8fabb2u, 0x85b2aa9au, 0xfbfc789au, 0x5e508f04u, 0x26cdffbau,
-	 0xef9a30dfu, 0xed917204u, 0xc13fc443u, 0xd38e77deu, 0x75042e70u, 0x9606b8a0u, 0x7ed2c412u, 0xc49c569du, 0xa21d71d0u, 0xb8ee97d7u,
-	 0x5b8b78eau, 0x16e68c78u, 0x33393960u, 0x4cff3f04u, 0x002b5d9du, 0x56639de9u, 0x248ab02bu, 0x3a8e71f2u, 0x25f866e5u, 0x372131c7u,
-	 0xf3f841bau, 0xc0a3f2a5u, 0xaf2ffbf0u, 0xd8daec77u, 0xea1580f6u, 0x3b8d28ebu, 0x66bbf8e8u, 0xf1f83473u, 0x97589e7du, 0x0c5114c7u,
-	 0x282a852bu, 0xcf33aed6u, 0xa85bad9du, 0xa6c7526fu, 0x51bcf5beu, 0xe6973a3eu, 0x4afc7324u, 0x5ba558ffu, 0x9a487945u, 0x358567f4u,
-	 0x1a554262u, 0x9e8d4b93u, 0x0a5f0a4au, 0x79a8a6d4u, 0x8b93fef3u, 0x3424ad01u, 0x6457ddbdu, 0x9da0cb2du, 0x9838dd74u, 0x571cd6e0u,
-	 0x6522d5a7u, 0x631d358fu, 0x570be6d8u, 0xd5fd6529u, 0xa319c0f9u, 0x94ebb21bu, 0xdfff5318u, 0xffaa562fu, 0x9012538bu, 0x4300f934u,
-	 0x08d5e949u, 0x49de39bbu, 0x77285373u, 0xff3f8138u, 0x14ce72a8u, 0xe5b90ec0u, 0x73aaf49au, 0x807d0facu, 0x3f350342u, 0xb8bed337u,
-	 0x237bd512u, 0xe69ab124u, 0x271b84c8u, 0x3022188fu, 0xb6c5abd1u, 0xb3b0c42bu, 0x109d2e81u, 0x42df2afcu, 0x56cf9dddu, 0xc0ca919cu,
-	 0xafda28a8u, 0xfa78ce8du, 0xbb3597aeu, 0x3d6fe818u, 0x79f3daddu, 0xac500e6bu, 0xc8f2cdd7u, 0x359505c9u, 0x096f0b7bu, 0xc4fb3c26u,
-	 0x29f5f164u, 0xf8c7f525u, 0xb59a1c50u, 0x3d99f1fbu, 0xba637893u, 0x63a7743bu, 0xbfd44393u, 0x058f286bu, 0xbc151666u, 0x19d2d8b3u,
-	 0xdf7ee5a0u, 0xdf1fc0bcu, 0xc2ae5746u, 0x70388b3fu, 0x22a30a97u, 0xba3e9b92u, 0x4af115eeu, 0xabb15d7au, 0x6c0764e3u, 0x4a88704au,
-	 0xba81ae67u, 0xf26f027eu, 0x7a5f0e1fu, 0xef650339u, 0x91e7de8du, 0xaa784742u, 0x1e0234efu, 0xc9fc9bd4u, 0x1adccd56u, 0xa51412afu,
-	 0x91be0b8du, 0x26304106u, 0x5bd88f8du, 0x22c1e525u, 0x34899d61u, 0x941c1bd6u, 0x8a30fc34u, 0x37e2e564u, 0x52902ffdu, 0x23bc5142u,
-	 0xf0a6778au, 0x90db9772u, 0xfc3c83edu, 0x01999db4u, 0x5a769bdeu, 0x15013f58u, 0xa1245a9eu, 0xf7cfe922u, 0x95d44076u, 0xfa1f5180u,
-	 0x10c69b19u, 0x1d3803f4u, 0x4d3f0410u, 0xaff15a7eu, 0xee7e50b4u, 0x83f73da0u, 0x1651f4f0u, 0x47e8bdb1u, 0x358037f1u, 0x4e949ea6u,
-	 0xc4bbfd4bu, 0xf9da0a0cu, 0xf99328bbu, 0xfcd526c6u, 0x1de66935u, 0x331dd478u, 0x8ce79ebeu, 0x7a143fe9u, 0x3e4d5efeu, 0x63c53667u,
-	 0x73def876u, 0xf29ab40au, 0x66399d7du, 0x78cb2924u, 0x4e59f770u, 0xa8d1434bu, 0xaf00eaf5u, 0x5ddef0ecu, 0xd18ad3b0u, 0x8b8a88f6u,
-	 0xefbe2472u, 0x52253e05u, 0x18f20de2u, 0x9e49202au, 0x54c26f23u, 0xd524a23au, 0xa4dd2cfdu, 0x198d52adu, 0x228a9311u, 0x6d226524u,
-	 0x7397465eu, 0xccf675deu, 0xd32aaacfu, 0x57ee296cu, 0x4cd91b26u, 0xbf44cee9u, 0xeb302d20u, 0xf6635ad1u, 0x26179073u, 0x9ee8cd9au,
-	 0x8716e676u, 0xe416fbe1u, 0x7e03cc6au, 0xa87a4abdu, 0x42c9b6ffu, 0x2280acf2u, 0x7461d958u, 0xbf4cb987u, 0xb698efa7u, 0xa1a575aeu,
-	 0x4d763221u, 0xf97a7961u, 0x18e8084bu, 0xe312985au, 0xd31fb2c9u, 0xbf9a27fbu, 0x1d8b16e8u, 0x0dfff4acu, 0x59f0d3edu, 0x84988e4cu,
-	 0x2b46cc28u, 0x1b51d8bfu, 0xd9b0eda8u, 0x0bf11455u, 0x20df09d8u, 0x2eed6da1u, 0x9e17d4c3u, 0x3bd600b2u, 0x271be789u, 0xe859b947u,
-	 0xeb4a69e0u, 0xe7024b96u, 0x975a6abeu, 0xfab7ea04u, 0x8a8ae3b3u, 0x9d7f1ddbu, 0x4922d2c8u, 0x426da4abu, 0xb62f4478u, 0x326c1c84u,
-	 0x02139483u, 0x83aae584u, 0x089a3d5du, 0x4c5d5a1bu, 0x97d906eeu, 0x5adc2891u, 0x565c488eu, 0x9a2a2ad1u, 0xe21ab711u, 0x305cd7e8u,
-	 0x2da41d4cu, 0x040184c5u, 0x1665fbefu, 0xc1cc209eu, 0x881f8a96u, 0xa33897aeu, 0x04fd32dfu, 0xf92d0bc1u, 0x605b2dcau, 0x9d6fa81bu,
-	 0x0ddb7a21u, 0x0252552fu, 0x8fe174f5u, 0xc4adfe0bu, 0x06bda6d8u, 0x90de9c77u, 0xa2e7be9bu, 0x7f739d76u, 0x5a5b7983u, 0x903a755eu,
-	 0x4762d77au, 0xd67dd7bbu, 0x6c0fcccau, 0xd2496f65u, 0x3afc61bcu, 0x99d0e9c7u, 0x91669fccu, 0x921d7a4bu, 0x9e813420u, 0xf878ec04u,
-	 0xfe6ec630u, 0xfd2dcb7eu, 0xcf1cc2bcu, 0xb9470d97u, 0xe2a71675u, 0x5fd4a14fu, 0x9c1bfef4u, 0xd5044b74u, 0x574feaadu, 0xd02d9e39u,
-	 0xc07493aeu, 0x92d38133u, 0xe961d637u, 0xacd1b48eu, 0xde574133u, 0xb0129b74u, 0xd4645fdeu, 0x93b173aeu, 0x1c63acc8u, 0x3c1be176u,
-	 0x7b157219u, 0x66c98d1fu, 0x913decafu, 0x3726daf9u, 0x23b211e3u, 0xc627f429u, 0xa9b50ddcu, 0x3c88e738u, 0xad765002u, 0x99bef9a0u,
-	 0xb22b62e6u, 0x875a25bau, 0x1c0d3ae1u, 0xca5bf5a4u, 0xad106d91u, 0x6b4a5095u, 0x5ece5553u, 0x724ca2dfu, 0x4b0862edu, 0xa7094fbcu,
-	 0x8c55c9fau, 0x9fc9c595u, 0x53c48329u, 0xeb2bc163u, 0x4ad022d4u, 0xe867c079u, 0x93b48f50u, 0x83589a47u, 0xca94ab31u, 0x04a03f96u,
-	 0x16626abau, 0x9310ee09u, 0x400993acu, 0x52e1def1u, 0x82fc9451u, 0xd9207f67u, 0xf548885cu, 0x2a96720cu, 0x639e693eu, 0x897edf39u,
-	 0xf8dc98d0u, 0x2e102a7bu, 0xb3daab4eu, 0x25a1ae43u, 0x06b38d4du, 0x190ad3c5u, 0x40727116u, 0xf3e2dfd1u, 0x7e46ab11u, 0xbe401ff6u,
-	 0xb99f4a9cu, 0x9fea0b2cu, 0xd054e58fu, 0xa6f67935u, 0xe146515du, 0xf9b75445u, 0xb51afd20u, 0x548e69c0u, 0xb9e4ee1cu, 0x7650a536u,
-	 0x97fb2fe0u, 0x902cc471u, 0x6701740cu, 0xe7439ea0u, 0x814e18b4u, 0xd958157cu, 0xf38da0deu, 0x3e5bf318u, 0xa7712781u, 0x1eedac94u,
-	 0x6f817480u, 0xd2ad1e3au, 0xaa137956u, 0x4e5223a1u, 0x6aa21ed5u, 0xa9fb0970u, 0xe447fad8u, 0x971526eau, 0x6f457100u, 0xe552cec1u,
-	 0xb426c882u, 0x776c97ebu, 0x500b413eu, 0x8cc47361u, 0x2f0e6c19u, 0x76e065d9u, 0x98ce1675u, 0x0407c01cu, 0x1b131accu, 0x5262c321u,
-	 0xfd9485b4u, 0xa061fa78u, 0x79359a06u, 0xf248010du, 0x6f433821u, 0x36b07550u, 0x48cae16cu, 0x7fce4721u, 0x411d6381u, 0xec3fa831u,
-	 0x9860c834u, 0xe0633a7fu, 0x1ed7afb7u, 0x0d2ed1e9u, 0x377ba287u, 0xbfa74ac2u, 0x27f8ba5cu, 0x2e494928u, 0x42ec0e1au, 0xd57e7c4au,
-	 0x1a928c87u, 0x89841ee1u, 0x8c93bd77u, 0x5717e5e9u, 0x5fe6d967u, 0x49dc525eu, 0x0bf229f1u, 0x0269ebc7u, 0x137ea246u, 0x15ae99edu,
-	 0xb8351cbdu, 0xe1e74a42u, 0x571f88dfu, 0x4cd35791u, 0x1b6a37cfu, 0x17614a20u, 0xbcb536b8u, 0xc6aeb653u, 0xad2313f2u, 0x9c16d694u,
-	 0x259eb87cu, 0x5ade42bbu, 0xd2159e93u, 0xf9f4b52eu, 0x6c6c7aa0u, 0xeae4e5afu, 0x2eb529fau, 0xd198499eu, 0xf25faccdu, 0x3fa3df48u,
-	 0xbaee0faeu, 0x86917f5cu, 0xe4f1cc6du, 0xbe210b65u, 0xc16d30d8u, 0xca2ed926u, 0x4f45538cu, 0xa850af31u, 0x8525662du, 0x17c15a75u,
-	 0xbe3204c1u, 0x4fd54f41u, 0x65d2dbe8u, 0xd316253du, 0xb4c1f4a8u, 0x58738a3eu, 0xb7d4e9adu, 0x6023dbb4u, 0x408d8e75u, 0x76ea22b5u,
-	 0x151c4bb7u, 0xb996d7dcu, 0xbcd9c01bu, 0x1ec4b6ebu, 0xe370ad22u, 0x004f3a7eu, 0x47adaa29u, 0x3defa4d4u, 0x40a29732u, 0xa5c027efu,
-	 0xfbeb6e45u, 0x12c22b11u, 0xa4e98572u, 0xfb062df3u, 0x79167cbeu, 0xbc8d9b4du, 0xde15a2a4u, 0xb739517au, 0x829da52bu, 0x4b9296cdu,
-	 0x37515d49u, 0x9384e05au, 0x4e4df686u, 0x84ba50ddu, 0x4a3e620fu, 0xa6f2dc2bu, 0x92889f8au, 0x2bda9df6u, 0x3a2ec8e0u, 0x3ae7bcafu,
-	 0x64a9e3a3u, 0x0fae9832u, 0xc6cb361du, 0xd40b8002u, 0xf5dccc67u, 0xee96d0dcu, 0x37257ebcu, 0x56b94f40u, 0x766a030bu, 0x15fb1245u,
-	 0x29ada097u, 0x62defa9du, 0x3d71a050u, 0xc123223eu, 0xa003c3ecu, 0x0eb373b4u, 0xf005ba33u, 0x4c3d1167u, 0xcd87fd9au, 0x5281d79eu,
-	 0x2ccbcf94u, 0xf3e0d22eu, 0xa31c2dc4u, 0xb184f5f5u, 0x4a7c2194u, 0xc17581d8u, 0x04ec274fu, 0xf80d8dc0u, 0x19f9b3ceu, 0xebd04947u,
-	 0x0f13a556u, 0x1bbbef37u, 0x801908f1u, 0xf75a3d51u, 0xfdf8d5b5u, 0x8d52cb1du, 0x94e7299du, 0xb3a3a5d1u, 0x499460b5u, 0xcd3ed32bu,
-	 0x75f84193u, 0xeeb5eab0u, 0x161cd546u, 0xe111cf40u, 0x47993315u, 0x29f121f0u, 0x56dabe3eu, 0x2fbfe873u, 0x766981f7u, 0xeb2de333u,
-	 0xe5897c88u, 0xefcebfafu, 0x24f70b4fu, 0x8797ed23u, 0x56d53b03u, 0x66e12a01u, 0x6cfcc962u, 0xcc3b4d43u, 0x4172e6d8u, 0xd55cb8f6u,
-	 0x6cac9a2cu, 0x17131d01u, 0xc3876c1fu, 0xf2760e6fu, 0x9aeb47f3u, 0x2b155471u, 0xc5880916u, 0xe15aaf7au, 0x4b3eec99u, 0x73571ae3u,
-	 0xa1dcb372u, 0xb57d5cb9u, 0xc6e34441u, 0x28adf1cau, 0xbe052490u, 0xc86fd203u, 0xa2fb6ccau, 0xcb1a5fd5u, 0x339cd20fu, 0xbdf0e985u,
-	 0xb7eb2a9fu, 0x703313a6u, 0xd464f72cu, 0x5d7cfda5u, 0x87e3db70u, 0x80ffd793u, 0x50067f27u, 0xede9514fu, 0xa9a1eb1bu, 0xddd9bc2au,
-	 0xcf9282ccu, 0x6afe37edu, 0xe6fea42cu, 0xa3c8fdb0u, 0x4271df86u, 0xa52a6502u, 0xf62957d1u, 0x2dd250abu, 0x524fc2b4u, 0x332b85d0u,
-	 0x6aff4727u, 0xffbecde5u, 0x2b7816d7u, 0x0b7fee9eu, 0x2bbaa82du, 0x3a451b8du, 0xa8e5c597u, 0x7c86acf0u, 0x9ca7b998u, 0x34002a61u,
-	 0xccae5b4fu, 0xd2dab246u, 0x983367bbu, 0xce087440u, 0x1031f206u, 0xbdcdbd79u, 0x989db4bcu, 0x0134d2fcu, 0x03ca4bd8u, 0xd5742a5fu,
-	 0xf9d8ba75u, 0x375e1081u, 0x3c582528u, 0xc07bd683u, 0xb3dc461au, 0xe3455ca0u, 0x76f0a8dcu, 0x95bd92d1u, 0x6c401e89u, 0xe0b14490u,
-	 0x343b538bu, 0x737561fcu, 0x99c1454du, 0x0c2d1f62u, 0xfb57eb96u, 0x00229014u, 0x2840e615u, 0x03195ef5u, 0xaf9ad9c9u, 0x25d1990du,
-	 0xf9d9f6a6u, 0x67d20bacu, 0xe4e98755u, 0x36a3d7d6u, 0x9d0c4c00u, 0xfacadb15u, 0xf4abeda8u, 0xb59307d6u, 0x263513ddu, 0xfca67060u,
-	 0x61aa6252u, 0x30a71bdcu, 0xcca783bfu, 0x463258ccu, 0x2590f699u, 0x4b0c9244u, 0xd690c6b6u, 0xa14824a0u, 0x2dff5475u, 0xe9e89ba6u,
-	 0xa7122689u, 0xb1e86e62u, 0xc2a2c097u, 0x64526f23u, 0xe76e5e25u, 0x54cf3c1du, 0xc3464969u, 0x96ea7558u, 0x4d10d44cu, 0x53b11fd9u,
-	 0xed8c403fu, 0x898a56ccu, 0xbe37fafbu, 0x1f120a43u, 0xe87018a0u, 0x7b25d8dfu, 0x27b0c46au, 0xf32c3976u, 0x8336bb38u, 0x876475ccu,
-	 0xbf337ce3u, 0x73366665u, 0xa04ca6fdu, 0x618d32ccu, 0x079feb93u, 0x4da5c523u, 0xf342128au, 0xee14db03u, 0x19e70ac9u, 0x01790896u,
-	 0xc8e564a3u, 0x363c2063u, 0xbc036e38u, 0xb50143e6u, 0x8838f25fu, 0x10f42766u, 0x69d64d98u, 0x5aff8190u, 0xc5536b3du, 0x3c409ec7u,
-	 0x38350fbcu, 0x4080ffd9u, 0x04c032a7u, 0xa2f03bc0u, 0x80243a09u, 0x839759aau, 0x3007156cu, 0x35e7f782u, 0xa5f821c1u, 0x301d1d3eu,
-	 0x115ecc7cu, 0x0978326bu, 0x21f353d7u, 0x49bccde1u, 0x97a63d9cu, 0x0d64d49bu, 0xc162bff2u, 0x898c7c87u, 0x35907935u, 0xda786f58u,
-	 0x4a981bf9u, 0xfcba9219u, 0xeb4ef613u, 0x82371ac3u, 0xdc8afcebu, 0x83ce42e9u, 0x03b0319bu, 0xf45ff8c7u, 0x68d3ee92u, 0xd2601402u,
-	 0x59f20e2au, 0x45e92cfau, 0xfc6d16eeu, 0xf46602e9u, 0x486de87fu, 0x04624a92u, 0xbfbf1793u, 0xf75c1ceeu, 0x95eb45b9u, 0xe4c0b98fu,
-	 0x96f93605u, 0x9e5b280bu, 0x998928d9u, 0x5757c718u, 0x29c95a2eu, 0x8c618755u, 0x34363ca2u, 0x42d0ad84u, 0x3edd0be6u, 0x46bf16ccu,
-	 0xb6aeff3du, 0x5895e25fu, 0xdf8e5a5bu, 0x01edf7acu, 0xc7910415u, 0x206e15efu, 0xe2c73a3bu, 0xebf0895du, 0x403f6f71u, 0xd05ea9deu,
-	 0xbae6322bu, 0x488cc558u, 0xeaa2b794u, 0xecca58e7u, 0x20d985cau, 0x22919f40u, 0x63494b3cu, 0xdd534611u, 0xcc0a3c7eu, 0x150296ddu,
-	 0x9af055bfu, 0x8ecf68acu, 0xa583b233u, 0x32e41f69u, 0xe9ec840cu, 0x9e2ddd17u, 0x54bf76beu, 0x8adf8475u, 0x13d7ccecu, 0xf110129du,
-	 0x9973c1fbu, 0xf57741aau, 0x252decb1u, 0x1535d084u, 0xaf4cae0au, 0x33afd149u, 0x78cc4bd3u, 0xc8ce3b28u, 0xd1e80218u, 0x16092d87u,
-	 0x39678f07u, 0x239aa5eeu, 0x2c2d73feu, 0x3a76e99bu, 0x32e44861u, 0xea1a5a7fu, 0x235bded9u, 0x2eb4b68eu, 0x133b41feu, 0x6e53f16eu,
-	 0x37a6bfbeu, 0x8b2af82du, 0xcd65b4c3u, 0xfe1bdcbbu, 0x62cc18f6u, 0x1ec407e0u, 0xc1c7fdcau, 0x448eddb5u, 0x7a8b0d3eu, 0x495608f3u,
-	 0xf5d835c8u, 0x357525f5u, 0xf60a4f6du, 0xeae9ce5bu, 0xddc0e903u, 0x31b8683bu, 0xf5c959f2u, 0xd6a24800u, 0x1587ca03u, 0x5ae8794cu,
-	 0x1df09c90u, 0xdc6d2c51u, 0xf9b7815au, 0x7683032fu, 0xeec68e96u, 0x3a69b6ffu, 0x5233861du, 0x5d95caf5u, 0xf6bf2670u, 0x5d46ace7u,
-	 0xd1c61bd4u, 0xc26e2323u, 0xfc03570cu, 0x0ebac319u, 0xbf9b110cu, 0x34f9d7b3u, 0x065acb2fu, 0x3afb84bcu, 0x85fee126u, 0x90ac42f5u,
-	 0xf014f0a4u, 0x67ca7bf1u, 0x39fbb61eu, 0x70341661u, 0xda4caa7du, 0x2e3fae94u, 0xc5bf8eebu, 0x92b66229u, 0xa8041619u, 0x39f2194eu,
-	 0x0fc79f0cu, 0xd7afacc7u, 0xfffc81f2u, 0x05581e43u, 0x6ae0afbau, 0xaf93329fu, 0x5af63c5cu, 0xf6226f73u, 0x96c03a55u, 0x613bd350u,
-	 0xb38ad321u, 0xbe393c2au, 0x0c3a26fau, 0x83ae7cbeu, 0xa44d5b8bu, 0x4cad9eb0u, 0xd8124469u, 0x76a704f8u, 0xdf414c83u, 0xbe6f04fdu,
-	 0xb026f526u, 0x5e7241afu, 0xb1a9e402u, 0x09c4ec79u, 0xcdbf22eau, 0x06a67884u, 0x399ba4a9u, 0x6ddd618au, 0x83822186u, 0x3a182195u,
-	 0xc3f14b51u, 0xdbcd1e4cu, 0xee758b25u, 0x3fcc0bfau, 0x9f41b880u, 0xe4ba849fu, 0xf9b85bcdu, 0xc5043b4du, 0x39c99e93u, 0xe3ec2934u,
-	 0x5a234fb3u, 0x74fe952fu, 0x60daa6b8u, 0x1cfb62a4u, 0xdaa8d51cu, 0xe9e137b6u, 0x3b427f3cu, 0xb7382da0u, 0x55472ddfu, 0x8433e2a2u,
-	 0x677bfd8cu, 0x524531aeu, 0xc9ac88d5u, 0x96c9a3e5u, 0x2fb4230bu, 0xd9a9163bu, 0x973f81e1u, 0x7298cd81u, 0x8a887313u, 0xc070a678u,
-	 0xe5a88da3u, 0x0070d6e1u, 0xc8725c92u, 0xf3af26a4u, 0x7338fe5bu, 0x7492c0a0u, 0x7c23f7a3u, 0xae01df74u, 0x53824ed1u, 0x5bc0c7b1u,
-	 0xc5844d9du, 0xc26842f4u, 0xc81b1d8du, 0xde3fa832u, 0xc5c8e017u, 0x491f5290u, 0x36e1ea7bu, 0x0af791dfu, 0x3e25e7c8u, 0xfe892896u,
-	 0x9570cd01u, 0x97144b64u, 0x74b35a12u, 0x8ea2b9abu, 0x7b1df263u, 0xe56ced94u, 0xdc3a01afu, 0xe2549df9u, 0x737c7373u, 0x8c0da730u,
-	 0xb111560eu, 0x5a4d93c0u, 0x16ff3913u, 0x3a73ea49u, 0x2d3f9bd4u, 0xc9e4a059u, 0xa33e0b59u, 0x56252afcu, 0xbc4b438fu, 0xd989e3d2u,
-	 0x2a3a7ee6u, 0x18d00963u, 0x431fdc62u, 0x96c9f872u, 0xbbda23d5u, 0x2d2dc001u, 0x73f05cbbu, 0x520dd9acu, 0xb560f5e8u, 0x362fe9a9u,
-	 0x7acc784bu, 0x1938d5e0u, 0x184d7f46u, 0x1b5441b8u, 0x08508242u, 0xba213355u, 0xbf0daf51u, 0x11de743bu, 0x008042eau, 0x24d3c9c1u,
-	 0xf1310fdcu, 0x7eb2235cu, 0x2e2588f7u, 0xf78e93b6u, 0x20b5f822u, 0xc4ac1aa6u, 0x4188791du, 0xd0eaedd5u, 0xf0c9e34bu, 0xe8f8f2cau,
-	 0x53bcfaecu, 0x77225279u, 0x9198ed68u, 0xb8f4820au, 0x1b6d43d8u, 0x5c596425u, 0x958db0eeu, 0xa3de41e3u, 0x5152ab72u, 0xaad6d63au,
-	 0x3ae89e97u, 0xf30ae84cu, 0x2e7c3de3u, 0xb873fd7du, 0xc7312c34u, 0x5fa1df72u, 0x6c98d24au, 0xd8b4409du, 0x65b4de2eu, 0x1d7a7f53u,
-	 0x8f9d3ab9u, 0x9ed4fee5u, 0x52b7872fu, 0xaaf273d4u, 0xc530d3cfu, 0xd4a5f510u, 0x48a409aau, 0x5f201a58u, 0x64d4608cu, 0x11098555u,
-	 0x8271c84bu, 0x0ad02645u, 0x070c37a2u, 0x0e0f6466u, 0x655e5954u, 0x0870d3e0u, 0xa7e8e89eu, 0x309b1f5cu, 0x277f75eeu, 0xcb1c96d8u,
-	 0xf4478a90u, 0x43780f4bu, 0xce20a1a4u, 0xf70077aeu, 0xcc23aa52u, 0x5d4e75cfu, 0xfd188eb3u, 0x9a3c8c29u, 0x9255ff0cu, 0x746a63e6u,
-	 0x618536fcu, 0x5dbc0a00u, 0x48369643u, 0x83cc935eu, 0x6a6e6efeu, 0x6902dd5du, 0x329e8299u, 0xa444570au, 0x2af92d0au, 0x4bae5155u,
-	 0x2aa97396u, 0xfe9ce6c4u, 0x811fd091u, 0xff72368du, 0x485a51feu, 0x5a382205u, 0xaddab596u, 0xdf533bbeu, 0xf88b2d3cu, 0xfe4a212au,
-	 0xed077069u, 0xd162033au, 0xe06defbdu, 0xaf82d960u, 0xe3aa70a7u, 0x8001641au, 0x1309c12fu, 0x26ee5bd4u, 0x0b6f1fd6u, 0xace95ff5u,
-	 0x2dee2179u, 0x33fc82c8u, 0x936ec2deu, 0x40fe3382u, 0xe9924e29u, 0x180cc398u, 0x6cbf99d1u, 0x42c17545u, 0xf6c775b9u, 0xd36bfd18u,
-	 0xb8de66a7u, 0x431885ccu, 0xcbf982fcu, 0x2155c21bu, 0x9fd8f20eu, 0x3e58bd66u, 0xf5c3a174u, 0xd286fd94u, 0xe5bc499cu, 0x96530ef7u,
-	 0x63492c15u, 0x136b4b6au, 0x1348f32bu, 0xe574775au, 0xfd703bb4u, 0xf3a46742u, 0x8c9b498du, 0x6373ba9au, 0xc7e2e4cdu, 0xe373be4du,
-	 0x28ad0fe9u, 0x34f37046u, 0xf1941af0u, 0x18b26f39u, 0x3f6df35fu, 0x1799352au, 0xfff6cdffu, 0x2ac3e4e0u, 0xb3510bd8u, 0x662d7c82u,
-	 0x3af87ca1u, 0x8a023408u, 0x16217e2au, 0x2b04d0d8u, 0x8f1e06aau, 0x43dcd7b5u, 0x205f621du, 0x7f8e49f3u, 0xc3e2dbf0u, 0x1ed0c095u,
-	 0xe97fad0cu, 0x9681cc7fu, 0xfc5c3dbbu, 0x49ba0f8au, 0x8c9a47b7u, 0xf7c23adbu, 0x454d64a5u, 0x8c0bb730u, 0xe1cd5a21u, 0x7d2b6119u,
-	 0x4329ab99u, 0xe1c0557au, 0xd3e830f6u, 0xbf9b7647u, 0x71f6d0f6u, 0xad540c85u, 0x869e7889u, 0xcc363e9eu, 0x54a839e9u, 0x1facace6u,
-	 0xf7fe2f5fu, 0xd32f1725u, 0xa680eeacu, 0x54f6596du, 0xb198519du, 0xec1bfc31u, 0xae242956u, 0x972a1df5u, 0x1abd6c5eu, 0x311cad50u,
-	 0xddb9b415u, 0xe2b2f4cdu, 0x68a76bb2u, 0xfe871cd9u, 0xbe214cdeu, 0x9fcbcacbu, 0xe70de148u, 0x18e20381u, 0xb3441274u, 0x23f7fc05u,
-	 0x97793342u, 0x61207ff5u, 0x3814ee82u, 0x512bd109u, 0x9d2bc1cdu, 0x57d1a147u, 0xfd5afca8u, 0xbddea28fu, 0xaf80d46cu, 0x02ec3d9eu,
-	 0xf3c50e2eu, 0xa06c1c9eu, 0xd64a886fu, 0xf8f53faau, 0x5fb4ea06u, 0xb56a3ad6u, 0xc2b40e1cu, 0x04b1f6dfu, 0x1c11a3d8u, 0xe99fe646u,
-	 0x3fbeaabdu, 0x72a7ae0du, 0x157c0783u, 0xc20d1c29u, 0xc3f88decu, 0x896b0637u, 0xd28136f3u, 0x73b80714u, 0x7e131006u, 0xff44af1au,
-	 0x64574ab3u, 0x45e24619u, 0xa381ed3au, 0x1c48b35fu, 0x38b88b6au, 0xdf4c7c9cu, 0x48e8d3e1u, 0x5431b310u, 0x8e9d7253u, 0x4519bc60u,
-	 0x22cf9801u, 0x85af1edfu, 0x2cd04d3bu, 0xa54f504au, 0xfc098e3du, 0x2ed27a8bu, 0xec008b0cu, 0x082dd053u, 0x2cae169eu, 0xcb52dbd9u,
-	 0x6fc5e7edu, 0x7271bbe7u, 0xbddfae8fu, 0x62e48b34u, 0x9a091038u, 0x1fde94d4u, 0x6b974ea5u, 0xf058da18u, 0xc9d4ef12u, 0x39d76e21u,
-	 0xff98dec2u, 0xcd4e3f60u, 0xca92d139u, 0xdfecb2e2u, 0x666f32a6u, 0x84e39417u, 0x6dd50892u, 0x79a62d49u, 0x01923787u, 0x852696d8u,
-	 0xd2659fd7u, 0xa9f7f556u, 0xdc4daacdu, 0x10ded2deu, 0xff9330d1u, 0x9a851aefu, 0x64f8721au, 0xc8886addu, 0xc96cf1ccu, 0xc719e95au,
-	 0x253d5d8fu, 0x6372ec0eu, 0x92225a08u, 0xc4ffd2c7u, 0xb8d95cdeu, 0x483086aeu, 0xe2fa3f81u, 0x51110716u, 0xbac1168du, 0x5d0eecafu,
-	 0x4d89119fu, 0x44613c0eu, 0xd088aadfu, 0x4d7cb0fau, 0x15fb4d2fu, 0xe3145c6bu, 0xc823b550u, 0xbc9ab491u, 0x33de9d1au, 0x7bef5b2eu,
-	 0x7b1c37bfu, 0xe3b83271u, 0x2731f80eu, 0x9c29edb4u, 0x311ba579u, 0x77b01aabu, 0xfd6ef7d3u, 0xf3c6880du, 0x5c084763u, 0xafa22dadu,
-	 0x970615b5u, 0x5cdde6ccu, 0x60d62b54u, 0xadeba065u, 0x30beba51u, 0xf4692910u, 0x709f7a6fu, 0x126d38c6u, 0x41b72754u, 0xc51ddc19u,
-	 0x7845ae99u, 0x29d905ffu, 0x59e17517u, 0xbf065574u, 0x7cadc5fbu, 0x799225f8u, 0x1e5eb8c6u, 0x6747a50eu, 0xa3ad5e0au, 0x7359f679u,
-	 0xcec72e81u, 0x94878269u, 0x11e0658cu, 0x6813a90fu, 0x8199824cu, 0x0b449f4au, 0x500d7617u, 0x68b47e50u, 0x24505a34u, 0x33f46f6du,
-	 0x11633714u, 0x7e2a4843u, 0x54c33871u, 0x17f13ae5u, 0x377aaeb5u, 0x9629dab9u, 0x179e5e6fu, 0x41db64b8u, 0xe9f749fcu, 0x7962a919u,
-	 0xaaeeaf6bu, 0x9e53379fu, 0xfcef8281u, 0xa504a05bu, 0xe2bfe4ceu, 0x465ecadau, 0xc16152e5u, 0x4ca61a9du, 0xafc99fe7u, 0xfc2fcb5fu,
-	 0x25a0c3e5u, 0x4faa6813u, 0x03b53a6bu, 0x7c85fa47u, 0x8d56eee5u, 0x6c7722b4u, 0xf69825e4u, 0x8802aee3u, 0x4ed50ba2u, 0xc351b1beu,
-	 0x433cdb8du, 0x2bd9b64fu, 0x1f6bff74u, 0xd6c80b28u, 0x100a14a7u, 0xa3c386beu, 0xb2cfc84du, 0x82778acbu, 0x7c0ac4edu, 0x23b186b8u,
-	 0xa221132cu, 0x1f8d2b11u, 0x8151d683u, 0x178df675u, 0xe72f5a81u, 0x27e907e7u, 0x1f45ceb7u, 0x2833ac25u, 0x2b73f862u, 0x04a8f99au,
-	 0x435f1b41u, 0xfcc18080u, 0x59029941u, 0x4c5e178eu, 0x5da9b803u, 0xf07fdd64u, 0x016c27e6u, 0x796945e4u, 0x52649957u, 0x0afab680u,
-	 0xf838f147u, 0xd956290du, 0x4f1800dbu, 0xf3a07c6du, 0xbd670943u, 0x88b9c757u, 0xbdb632d1u, 0x55f3e3eeu, 0xdb63853au, 0x864fb2e8u,
-	 0x954c15dfu, 0x97022dd3u, 0xa5a9768bu, 0xbaa33c23u, 0xb8a0d499u, 0x7a802a85u, 0x3ab982d6u, 0xbcdfc42bu, 0xf5bb1269u, 0x0a5d221bu,
-	 0xe0c109d0u, 0xfc53ea2au, 0xefd3f8f5u, 0xc5007049u, 0xe6dcdab3u, 0x732d78b2u, 0xeac3b52au, 0xc695e181u, 0x673fd8c1u, 0x49875323u,
-	 0x32440d0bu, 0xf274ed6cu, 0x567cbf88u, 0x9e481becu, 0xdf637814u, 0x00e12163u, 0xbeaba36cu, 0x732940a2u, 0xb7aa7ed4u, 0xdc875aabu,
-	 0xb0dde442u, 0x6da96976u, 0x8e6e3899u, 0x65847e91u, 0x188ee4d6u, 0xa726347cu, 0x19d9a7bfu, 0xa5a83b8au, 0x36be6745u, 0xd297c3f1u,
-	 0x40b2df67u, 0x732ab4ddu, 0x9d5ad55eu, 0x9a7e4b96u, 0x9bf49ebcu, 0x305658a3u, 0x1fce2d9cu, 0xa562b91bu, 0xbefffe8fu, 0x64cf8e19u,
-	 0x776e1c92u, 0x7c9b4c9au, 0xdb5bc8dbu, 0xd029b5b7u, 0x11c161a1u, 0xa2230d0fu, 0x8b4468bdu, 0x65919fbau, 0xb71e3e4fu, 0x789492edu,
-	 0xda6779d1u, 0x07085e65u, 0xf3a25163u, 0xccb13a82u, 0x78f46d9fu, 0xac4091e8u, 0xf16d9cc1u, 0x05b2cc12u, 0xa20fbb90u, 0xe8ea11dfu,
-	 0xc064e05fu, 0xaa6e25a6u, 0xc11152fdu, 0x2d93a3b2u, 0x1f4788c2u, 0x7528e09au, 0xa42c7e26u, 0xa4814eb4u, 0x7f00c1d0u, 0x2e567a48u,
-	 0x1c1fd4cau, 0xecc97a77u, 0xe06f1206u, 0x35a1ff30u, 0x6ed2f5b1u, 0x97bea057u, 0x1213e8dbu, 0xdcf7af20u, 0x5967f949u, 0xa1d878a0u,
-	 0x9a1a7aa7u, 0xc5b4333eu, 0x2066d145u, 0xe6b80c18u, 0x8d0b1e61u, 0x1569a682u, 0x4691a4a3u, 0xe802c935u, 0xe91d2293u, 0xc3912778u,
-	 0x8e6805e3u, 0x72823a24u, 0xfe9c78a3u, 0xe27584fbu, 0x283c089cu, 0x3196f068u, 0x508826b1u, 0x116ba419u, 0x45155f57u, 0x0acc228cu,
-	 0xbb115a6au, 0x72689b8eu, 0x77beeb11u, 0xc44f6575u, 0x8a71e9f4u, 0x2f843103u, 0xb0cbd664u, 0xce9bd596u, 0x9aa7dc4bu, 0x0ce0ffcau,
-	 0xacc4d432u, 0xd758ca5bu, 0x894d5052u, 0xffee0d1bu, 0x647c9878u, 0x123fee5du, 0xb4f23013u, 0xdb049bf9u, 0x355aabe9u, 0xe3c9deacu,
-	 0xfe2e4c7cu, 0x00c7aa6fu, 0x1b9ddedeu, 0x1d6f6444u, 0xff980462u, 0xffce21b7u, 0x0ccd9969u, 0x2b3373c6u, 0xd3096e9du, 0xed7849dfu,
-	 0x18dfdcbcu, 0xd3adb708u, 0x49c85aa7u, 0x039d4b20u, 0x41c63531u, 0x5a8b941fu, 0x7aa7d642u, 0xfc49b98au, 0x65c379e9u, 0x81443bb4u,
-	 0x35056f05u, 0x2deaac29u, 0xe84c2be6u, 0x4fd2b1bdu, 0xc66515ecu, 0x2271f032u, 0x006db5c6u, 0xe8e5c067u, 0x983653eau, 0xf8c35287u,
-	 0x412c36e5u, 0xecbdf0cau, 0x096ea076u, 0x5a487efau, 0xd0acbfbau, 0x507e1741u, 0xaa736b36u, 0xab4f82f0u, 0x0804632bu, 0xfb9958cbu,
-	 0x14be582fu, 0x03cfb80au, 0xc4d06d02u, 0x26b52134u, 0xad1c8184u, 0xed8c4cf8u, 0x0c2b4bb9u, 0x1029ba8du, 0x926850a1u, 0x0de91020u,
-	 0x5717e290u, 0xf311f02cu, 0xabb70ba4u, 0x93753fe1u, 0x10f87d23u, 0xaaad30f0u, 0x6356ce68u, 0x8ff9f94eu, 0x02ab09b8u, 0x8ad4ac73u,
-	 0x54cc6fd1u, 0x9f32f309u, 0x3c8a67f6u, 0xc0c740e8u, 0x39504e5bu, 0xf78e0813u, 0x231aeb53u, 0x13a4e01fu, 0x8bfda0e3u, 0xf1e4d9beu,
-	 0x2a1127edu, 0x9925ce9cu, 0x5c04228cu, 0xab009b4au, 0x78690e5au, 0xd120a4e9u, 0xf59bf7b5u, 0xc704f6dau, 0x73843708u, 0x4ff73dfeu,
-	 0xc153d637u, 0xdf3b2ba9u, 0xc2208262u, 0xc3e93573u, 0xf4c9c1aeu, 0xc9ef85eeu, 0x860bde15u, 0xaa985ef7u, 0x0a257dbdu, 0x3aa90c54u,
-	 0x2fc5c423u, 0x4e46a09au, 0x4e560c7du, 0x92f4367du, 0x40b933a2u, 0x8fd58cb4u, 0x21ecc1f6u, 0xb5969d0bu, 0xcca235dcu, 0xd5ec5b1au,
-	 0x0c42edf4u, 0x0f173dd8u, 0x8aeb3eecu, 0xc08294d9u, 0x1030cd68u, 0xcecc808bu, 0x71255eafu, 0x906d1975u, 0x9fb1731du, 0x3d50852au,
-	 0xd7ae41d5u, 0x8c0986b3u, 0x62c9f0f8u, 0xd977ee06u, 0xa22d467eu, 0x63172985u, 0xf31dd317u, 0x5cb2d4f7u, 0xb01428adu, 0x2cbb2abfu,
-	 0x2738443au, 0x4a214b57u, 0x0a595c4au, 0xf4eed0abu, 0xf1f2fe9au, 0xca0eb2cau, 0x2c1ef77du, 0xe97b00d7u, 0xc43783dcu, 0xfe8ecc5eu,
-	 0x7c6dbafau, 0x6da33fb5u, 0x5b8fc359u, 0xcfcf9e5cu, 0x06fc2bf7u, 0xd2a2224au, 0xaf74a83du, 0x6e7aa554u, 0xb7c39cf2u, 0x71f5763du,
-	 0xc6d83e77u, 0xd2a8fc77u, 0x22382c3au, 0x0da9c8aeu, 0x1eb94c9cu, 0x44f63634u, 0x06717c04u, 0xc6013008u, 0xc3ae76a9u, 0x5a090474u,
-	 0x65a04de8u, 0x70673ed9u, 0xb147ab50u, 0x60701cb9u, 0xe302f494u, 0xd52f66d5u, 0xe7d85cc0u, 0xee0f39afu, 0x750a56abu, 0x7d2b777bu,
-	 0x9df45200u, 0xc0c8ea1cu, 0xbc4d42dcu, 0x201fefdau, 0x043fbb06u, 0x0ef5c309u, 0x3992e05eu, 0xf2daef82u, 0xd3dde84du, 0x2526f426u,
-	 0x0c60654au, 0xe00e49cau, 0x4c8577e7u, 0x33f07f06u, 0x21a57b8cu, 0x82d5e607u, 0x94eef147u, 0xc19aba5fu, 0xd8bd6defu, 0x078789c5u,
-	 0xc4ca5ddfu, 0x355a2f5cu, 0x92ba5703u, 0x6d95cfe7u, 0x7a1110e1u, 0x1e106ac7u, 0x4206cc5eu, 0x314c4514u, 0x16e0a166u, 0xc0fb52d4u,
-	 0x3b0e2b82u, 0x43b01740u, 0xa8fbf708u, 0x8aac822du, 0xd91c7ae0u, 0xab036056u, 0x73d482beu, 0x93b7dcbbu, 0xded0373du, 0x68817492u,
-	 0xc9bfb4fau, 0x56c5b326u, 0xd97e8b7au, 0x22d6ef27u, 0x158faf25u, 0x0616425fu, 0x971df15fu, 0x89f9402cu, 0xed50d938u, 0xdefc0e43u,
-	 0x19ab5bd6u, 0xf9dbd1a7u, 0xade029a2u, 0xbb998a5au, 0x8a17da24u, 0x58881e35u, 0xc08e1f5bu, 0x1d4cc224u, 0xb1676388u, 0xf9652484u,
-	 0xe4211e02u, 0x25208ff5u, 0x1b9dfe74u, 0xe5430357u, 0xe3ab77efu, 0x16bdb51au, 0xd41f8293u, 0xc30c493fu, 0xe4a5ef58u, 0x950151b1u,
-	 0xcfb8b3d9u, 0xa1ae1420u, 0x08471bd8u, 0x5ef49128u, 0x471d96c0u, 0x717b9350u, 0x69dc21bau, 0xc55e5563u, 0x27a46c62u, 0x9635d8ddu,
-	 0xefce5f3cu, 0x0c8513e5u, 0x77cb949fu, 0x75ec6af9u, 0x2bc1f80eu, 0x9fdc6f38u, 0x5a2a7a9du, 0x7ffc4bb3u, 0xa1dbe470u, 0xbb8ff86du,
-	 0x4d33779cu, 0x0d4057c5u, 0x4f2a608du, 0xc68f2d17u, 0x3457814eu, 0xd85c95bfu, 0x3a2353e6u, 0x68055a2au, 0x5d23bb45u, 0x036512aau,
-	 0xf42ac222u, 0x97057db8u, 0x709b2bbeu, 0xd2345477u, 0x88b6b730u, 0xae7d6833u, 0x9b7472d8u, 0x1293eed0u, 0x39b8ed85u, 0x89a76af0u,
-	 0xe5f7203bu, 0x98ebf088u, 0xa2e8bf23u, 0xb3140c42u, 0xbed2cf43u, 0x4ec79b87u, 0x5626cb6fu, 0x3a5a1de8u, 0xeccdb84eu, 0xa3fc307au,
-	 0x043781e4u, 0xc1795f51u, 0x69d2c653u, 0xebdf4204u, 0xd25490bbu, 0xd7f84d6fu, 0x6636d063u, 0xd488bd43u, 0x0401d615u, 0x39ea7ad1u,
-	 0x4f298ca6u, 0xc0936eedu, 0xb27cbbf4u, 0xe4028373u, 0xb02406b4u, 0x805fa1b5u, 0x906cd19eu, 0x9e06f994u, 0x62219a9bu, 0xd9efc5a7u,
-	 0x4f040572u, 0xdbeb149du, 0xb34d7a22u, 0x4ba8de10u, 0xdd59d556u, 0xf50722c6u, 0x77838d36u, 0xdbc1ca9au, 0x0a1fb596u, 0x9fa3f5a2u,
-	 0x024b7466u, 0x3e3a1453u, 0xc6920bddu, 0xc1c10fb4u, 0xa0e10f99u, 0xce360f9du, 0x65b470f5u, 0x59b8ca1eu, 0xf03c0e2au, 0xade1d5f4u,
-	 0xf7c9f93cu, 0x9445062eu, 0x7ea5fab2u, 0x31572101u, 0x4bfe504bu, 0xdb8b32d1u, 0xd2525770u, 0x25a4879bu, 0xf3bb57acu, 0x37c248a0u,
-	 0x9ea07e7du, 0x4c574ca2u, 0xbd595ce1u, 0x8bf09b14u, 0x9821b41bu, 0x6fcaf3ffu, 0xd0b4639cu, 0x7d4909f8u, 0xf416b9e5u, 0xcc92614eu,
-	 0x54b56ab8u, 0x1433a9c3u, 0x86fe609cu, 0xf4e0eb7au, 0xd25408deu, 0x7ac82e94u, 0x33790b83u, 0x15076522u, 0xb5a9c7e2u, 0x2f455077u,
-	 0x61bda46fu, 0x85d3a0a3u, 0xb519b287u, 0x7447654cu, 0x62fd702au, 0x3fd1d303u, 0x52ee413bu, 0x263346b7u, 0x5935687eu, 0x80e08910u,
-	 0x996b6f03u, 0x6d88c068u, 0xb329f366u, 0x8a5dee5eu, 0xcf0fc3e0u, 0x3170a21eu, 0xe10edfffu, 0x8994acd0u, 0xd87f495au, 0x249043cfu,
-	 0x496d04b6u, 0xe35117f1u, 0x09f22183u, 0xff90de42u, 0x9f7ef55cu, 0x0d72c269u, 0x6f29c4e7u, 0x184c17b2u, 0x7113f01au, 0xbafa3e13u,
-	 0xb56dfcacu, 0xaef32317u, 0x2bf27b81u, 0x87c7d932u, 0x752bcaa0u, 0x7a4d0852u, 0xb5788db0u, 0xeb86f6c3u, 0xa9de5773u, 0xafefd739u,
-	 0x5b699679u, 0xcaac4d9bu, 0xeb2a1d55u, 0xf194d765u, 0x5277b6ddu, 0x1226b9c3u, 0xbdb3a705u, 0x94da05dbu, 0xb1e5027cu, 0x225acf74u,
-	 0x5346190cu, 0x9175752du, 0x2fb3bb38u, 0xe6dc158fu, 0x77545068u, 0x570c8674u, 0x6c24767eu, 0xf49288a1u, 0x312c568fu, 0xd1bcb963u };
+static const unsigned long long zobrist_init_key = 0x5714e7ffbb48e6e1ull;
+static const unsigned long long zobrist_player_key = 0x9a38d246c5e4f8e6ull;
+static const unsigned long long zobrist_phase_key = 0xbc49fe4285d7f80cull;
+static const unsigned long long zobrist_field_key[4*(N+1)*N] = {
+	 0x5c8b626408acd7adull, 0x81bf5712d7becaa6ull, 0xdd1b9f45cc95d15bull, 0x92e5a7c8a419e4d1ull, 0xccd7d9990f080e8dull,
+	 0x6ecd0d1295a0433dull, 0x845eb320b23cbb1cull, 0x1ab353691e348de1ull, 0xef695f282784179bull, 0xfe9c8f20420e0a01ull,
+	 0x3353d99c0a10eca2ull, 0xae7abc14224cc4fdull, 0x04153ed7e5a5a925ull, 0x2cf4a2753ab106e5ull, 0xb13ebc08a359a49cull,
+	 0xfcfdac73a6c2ae67ull, 0x3713549d808d72c2ull, 0xfd751da375c8dde7ull, 0x9bde053962ad70eaull, 0x9cbf622983ceb350ull,
+	 0x0cff4b9cf2518d71ull, 0xb1ebce08f956546cull, 0x8210a77ed075677cull, 0x4592b9985e56004cull, 0x22677c8a9711927full,
+	 0x5abe6e1c1183dab6ull, 0xc795023f6e08e6b6ull, 0x1719229ddd90797dull, 0x0e3a9f685fda79f8ull, 0x1fcee28d0bc79788ull,
+	 0x8f334fd51d419aa2ull, 0x188fb78addb4627eull, 0x05da0f751aafd836ull, 0x6628b51a04ea5474ull, 0x7040e9d9ea54f4c5ull,
+	 0x49a72414500d9224ull, 0xe7cccd495205e578ull, 0x03a0d9c4400b9e9cull, 0x97d14c5a122cb1aaull, 0x9c45b5a89d037c61ull,
+	 0x38f792447744dfd9ull, 0x13e172b5d0b1ec72ull, 0xdb617e74fb3b98d6ull, 0xe14bfc71114fd1ffull, 0xb15361dad95598b9ull,
+	 0x067b49601627896bull, 0xd654a4f6f6a00fa3ull, 0xf8e5272666066b31ull, 0x76b999e1e8f5990aull, 0xca1d65406da8729eull,
+	 0xd1b9c948cda21ff1ull, 0x7e3507dd89110491ull, 0x4d0b0cb5176efceeull, 0xffc6c3f2dfdab593ull, 0x67f72b172dda948bull,
+	 0xe579de6c505d37e0ull, 0xa5aeda040583b0abull, 0x4770d700e333f805ull, 0x39cfd1c4dc84f290ull, 0xdc7c2bf4f098c761ull,
+	 0x9afb415a588d93e9ull, 0x5c0df17caffec92dull, 0x70bae08eeb867a18ull, 0x2af1c86cb18cc90full, 0x7f689b49b62ab62cull,
+	 0xd0dabdfb39994c33ull, 0xd07acfa613251067ull, 0x3a0998ca74d974c0ull, 0x35cbf8c85a3cd3d5ull, 0x4b00c488cbf5e69full,
+	 0x8df3bc530b7ae8a5ull, 0x13c1f37c96b13829ull, 0x35739e654b387408ull, 0xe8d34ad469a78e57ull, 0x9ac328a13375b5a1ull,
+	 0x95d5a2b79a11a530ull, 0xe99bc35a907f8d24ull, 0xf30db16309e13e91ull, 0xd54256ce628d0047ull, 0xd0702c37afc503e3ull,
+	 0xbd358d9f20525dfcull, 0xd8a37ea4e22a8e85ull, 0x45701fdc9c41d914ull, 0xa28536cb065833dfull, 0xa0c51de02011ec57ull,
+	 0x74e5e06bd01188d6ull, 0xff6b95d4ec61ce0cull, 0x1e67641bbc8d1366ull, 0x2339a5659e84682cull, 0x41341b990662fea6ull,
+	 0x453d6c2718e7ece3ull, 0x7496a5e9699e6a20ull, 0x309d5edb5d346bdeull, 0x0c0a040d2134111eull, 0x7a4e55c0198b7b41ull,
+	 0x68c62c249931a736ull, 0xeac49cee211850cbull, 0x1bbc5bf213bde9a6ull, 0x97e48413efcc09b7ull, 0xcb396aea893cc122ull,
+	 0x9e8ca8b96c534c1cull, 0x206831052497705cull, 0xa2af506a04723422ull, 0xb04c424c8db3fb44ull, 0x557b23d03a84d7a9ull,
+	 0xa22ed928ec443b22ull, 0x21b443b143c59da7ull, 0x31c2266a84ab747full, 0x84ca05018f979f26ull, 0x03dd7e579eb8513eull,
+	 0xc520d35209e015b5ull, 0x2d9d2cf26689a852ull, 0xf77f529bb086abf5ull, 0xb5c91c9dbd02c66full, 0x6f4005ed2d12cafeull,
+	 0x410e85c0cd865e54ull, 0x8a4bd02442c4f849ull, 0xc6889d8c3c9961a9ull, 0xfb0967f835f96dd1ull, 0x591355aa30fe7d7cull,
+	 0x3b0ad2eac4803586ull, 0x816c0a245a8436cfull, 0xebec51003ba5fabbull, 0x856ffec10611e5f0ull, 0x385f763eb25800b0ull,
+	 0xe90a168ba0e7daa6ull, 0x501e24b8df20f7c0ull, 0x97a2678d099fcc1aull, 0xc1f3ff34c78d59a1ull, 0xdec5a275c8037ebdull,
+	 0x1afa99979d76305bull, 0x1d3c9fe692a96678ull, 0x8a1cfc8a458e875aull, 0x9619037a245ba148ull, 0x6358212eb9ed3ca6ull,
+	 0xa4b02349449582e4ull, 0x9f38022c8fb5d89bull, 0x9268e644cb88a410ull, 0x0c28c64624bdea97ull, 0x732210928f178779ull,
+	 0x2d7eaa2b019387d2ull, 0x29469d939e43e119ull, 0x32edab99f8fd269dull, 0x772df91ec768fe0full, 0xc1b3275fd2973ad8ull,
+	 0xda5866a76ca33369ull, 0x84e17021970b924cull, 0x1c0aa5605a9d24e6ull, 0x13d62b214f64e72aull, 0x2658baf18b2392dbull,
+	 0xa4b406ca2bfc3b5cull, 0xb5487746a26678a1ull, 0xfedf7ae978868215ull, 0x593e2b8b8638e7abull, 0x1314f84c367c3d76ull,
+	 0x4748685919df23a6ull, 0xf76e8c77b45facb1ull, 0xac586649ef410123ull, 0x50821a9259d2d75eull, 0x18f6a0c0ecd33bc5ull,
+	 0xccd1cd3eb8e97e76ull, 0x57668452e4579662ull, 0x0bb80265b21b4f9eull, 0x141206467f0fc588ull, 0x7c026c48afce1692ull,
+	 0x55072d31e91bb770ull, 0x22ad78dee2cefa97ull, 0xa97a3c1f7a6afb7full, 0x523a705a1287aa9cull, 0x73f11a7f98406aefull,
+	 0xfd01db568b66f963ull, 0xa64cc6d123e48b14ull, 0xe070fab859248b87ull, 0x2dc5abd522e8789aull, 0x69a374748606ff78ull,
+	 0xde1bc36abd9133b8ull, 0x2ddb31a041ea74c7ull, 0xb62b52ffe1a4aceeull, 0x52a6d4dead203644ull, 0x0102682c148182e6ull,
+	 0x79e9181fb709ba70ull, 0xc3136b14b89d2dddull, 0x0021072ef7f82f40ull, 0x20ae9b40283fc86cull, 0x3162885a8fefa440ull,
+	 0x2cec4eb4c2b3ebafull, 0x3a82265a0e5d4636ull, 0x33de35272c65f3d0ull, 0x135b3ad3e2f1c718ull, 0x595361e074c98a3dull,
+	 0x996ef577850a1536ull, 0xd7e04d2db9eb55f9ull, 0x6062ca629f84bf5full, 0x34fe71428d72e49eull, 0x873c14531a5c2444ull,
+	 0x4e59f4a258c8f78full, 0xf9cc02dbe6eb1d69ull, 0x2a928b032201c5f3ull, 0x495a6f1bfd416c8cull, 0xadf8d6a48ef4d4c0ull,
+	 0xd5ad422c68882502ull, 0x90c7d3f3d72346faull, 0x712db8aad43dddd3ull, 0xc9c991516da67cccull, 0x092267d64cde0bffull,
+	 0xd52985f996395079ull, 0xb269a6bacd4689acull, 0x3008f7c2a3170ebeull, 0x56bf17cb80dea9ebull, 0x40f46ca107a1f3c6ull,
+	 0xdd27ca46263b8850ull, 0x0a4bc29d5dca396bull, 0x1b6b9f52963a8101ull, 0x710d78786ba5522cull, 0xdcdad5e2f284c395ull,
+	 0xf6c5a0332500775aull, 0x8b699ed7f4599f24ull, 0xbf9531e068bbaa48ull, 0xc017fa5a5597620bull, 0xe80843685cf55d28ull,
+	 0x9ae838bcf9f69631ull, 0x0035986480c3da5cull, 0xe5cb55337978be73ull, 0x1b39103d7ef2a9caull, 0x95cf959f03274f7full,
+	 0x5c4fbefebb9fe4daull, 0x519fce671b2c8b2aull, 0x2146286325e55edaull, 0x0e8bf7cbcec7fdeeull, 0x8db6f43262bc17f2ull,
+	 0x518383357b91695aull, 0x555818c839a9a35bull, 0xfcb6adf6bf3df685ull, 0xccd4b68f89a2d37aull, 0x463c59488541ef8eull,
+	 0xaeef6845c4e0bf31ull, 0x6b7efe5280df8c9bull, 0xc66a17acbd62964bull, 0x5c38331d27b87135ull, 0x5159ae97e08f87e9ull,
+	 0x57642ce224194207ull, 0xec7f8a91c9b8cecdull, 0x5a79381422b5ece6ull, 0xa0959a49874b5855ull, 0x49aebaddb0d3404eull,
+	 0x7c718ef87566506cull, 0xa26e30a663a22ec4ull, 0xb21824427ce2cd65ull, 0x66261c4b1c78f44bull, 0xcbf5fa9dfa754c90ull,
+	 0xb2b5a299b52c58f2ull, 0xcc2b6337862ce344ull, 0x3fe109d3c65bc265ull, 0x1d051bb06b9b50b1ull, 0x2b46951ec1a190b1ull,
+	 0xbcdc89babba2f712ull, 0xfe2f1f69c2ab3f2cull, 0xfb57ce1ca1d39b27ull, 0xf3026e0604a5b27cull, 0x78fcff4f6bb0032eull,
+	 0x9fb87e70831a2d77ull, 0x3bfcd048ef4de200ull, 0xa6734733e7343b74ull, 0x85f76d08adb517b3ull, 0xb48065f880c2544eull,
+	 0x64a450a61f685705ull, 0x94d85a9f1ff2a4eeull, 0xe8799f094e33858full, 0x9160ac8643b70d66ull, 0x9473ab9c50bba8afull,
+	 0xfed153fc42bf5413ull, 0xe3abb69387db3177ull, 0x9b80a0fec46405c4ull, 0x58ff66f2cfa1719eull, 0xe6272cb4a9208801ull,
+	 0xd1b4b3c29ad9db99ull, 0x25291fc76c1f2292ull, 0x17c440c758974f2eull, 0xd2b890e4086b3707ull, 0xac52705a058dcbf1ull,
+	 0xac4075e55e2f0a3bull, 0x02bb40e7268a706aull, 0xf09cbc2650591553ull, 0x950e2533274da6b0ull, 0x676db0f1756d9f06ull,
+	 0x41618a61180fb7d5ull, 0x9b5c33f6da4a6ffdull, 0x8592d07ba11eb9b5ull, 0x6055d6ddf3090803ull, 0xc9b4479a82283bc1ull,
+	 0x9157e887f203c996ull, 0x099815e4af85467dull, 0x753766a578c670d9ull, 0xfedd9e874bc1acb4ull, 0x2dc880fc33f6347full,
+	 0xa3ee36bad8d96ee5ull, 0x675d6e804530e027ull, 0x18d4152a1065152eull, 0x3c2097703f0603c3ull, 0xd7a2b49cbb91574cull,
+	 0xa581a52841722d4dull, 0xeacb79cc068c8bf4ull, 0x64fd490ea9e55b81ull, 0x12beb3741e310682ull, 0xec7440c3b995ddd0ull,
+	 0x77ddf22c0499e825ull, 0x657d6242eb142fcaull, 0xeba94877e8f51e5cull, 0x789562082d74b0fcull, 0x7346190dfbafac42ull,
+	 0x75d395b24b4fb156ull, 0x22c98564a015c043ull, 0x5089ecbbd7c6a39full, 0x9abff530a73dc7a2ull, 0x56e700e930da8fb0ull,
+	 0x3de290c32481431aull, 0xcfe4877ff252916aull, 0x66840e604718e4bcull, 0x6897e6ad1ef806fbull, 0x6b5d66deb6c966a3ull,
+	 0xd6ea3e00d7b93137ull, 0xe43a1b08160fa7c0ull, 0xdbf4bb645e397a07ull, 0x9ac07e48b6197a5full, 0x8c88b95f2f531db2ull,
+	 0xd9fc44556913deefull, 0xac96a082b09a1904ull, 0xb9fa607a49c53ba5ull, 0x356ec302ffd505cdull, 0x57053393080a337full,
+	 0xf403593e647fc575ull, 0xf2291f1f421bed80ull, 0x134782d15692736aull, 0xfccc468fcc9e72bdull, 0xf9db4eff1c2bf338ull,
+	 0x49b4255d326bfd8dull, 0xbbfc42623d34fdc5ull, 0x378ba487840fd220ull, 0x0359c9a7fce6b7f1ull, 0x7a12a5e28808b9cbull,
+	 0xdabad7f14951bfa7ull, 0x95ae8c04b6cbf7f6ull, 0x03b594b0d39c52c2ull, 0xcbc67a087f795815ull, 0x2892097bba234b55ull,
+	 0x80218a6a7f526002ull, 0x1e4ac91a89194f70ull, 0x0a5f68f5900dd28eull, 0x343261ca2d9e157dull, 0x58665d2c659baa47ull,
+	 0x42696c59e06ad489ull, 0x26b5c53b30db3a55ull, 0xea3fa9a3e1623b7eull, 0xd420a905dfa8074dull, 0x379e7292966844beull,
+	 0xb39bf392983a5d51ull, 0x168282d60ca43fadull, 0xba44ae6787d0df2eull, 0xf356b1f1dbfcae38ull, 0xeeadb1dc4bcbbf10ull,
+	 0xed19a0e1acd415a6ull, 0xda9802b67e67ed7eull, 0xa8d8de118b1e455full, 0xaca39a02827ea59eull, 0x7570a7e1d740bc96ull,
+	 0x3839ef43c7b5ea58ull, 0x5e4744b448e2b5e6ull, 0x34a025d47b5a6877ull, 0x87a30836b1ef668aull, 0x09fd23610069f0f9ull,
+	 0x68f4a50d561f977eull, 0x6c24cf701a0be0feull, 0x298b5649cad6aa81ull, 0xfa6d0f16fa08c444ull, 0x83b2d289e86f35d5ull,
+	 0x4bf23416b08827fdull, 0xd3e34905631ce5a8ull, 0xe3b63a0d83117917ull, 0x68f456d09ea4abe4ull, 0x0a98979930809e8bull,
+	 0x982e97f0f7f9d40aull, 0xba7bafa192c1fa83ull, 0x525fb2ddd9f5cdbdull, 0x1fd594e322921ce2ull, 0x75edca6557d4dc61ull,
+	 0xeaf18fdf07620fd1ull, 0x482b29efffe8cfe5ull, 0xa47ee642bb45ed7dull, 0x1e0b7c9910c275daull, 0x47629d3f98280f75ull,
+	 0xd53bfccc306d4ed9ull, 0x65e27e91953991e4ull, 0xc3f655e125e19d92ull, 0x1b34e57fc0a0ee20ull, 0xb0b67c81f15d90abull,
+	 0x2caa19cfe02c3abeull, 0xde1b720cbb4db533ull, 0x95f7cde34b0ab89bull, 0x425a0e22c63b4c23ull, 0xcaacd80b77ba5696ull,
+	 0x88d881db4c154d78ull, 0x922304ed5f3f963aull, 0x5db1d08d0f4efee6ull, 0xae783148a46c318aull, 0xd7492027fbabb30full,
+	 0x4bc9aa4b12dba43aull, 0x2e3529f4da49c95aull, 0x19d6c6b813239bb2ull, 0xe625e7be8edfced6ull, 0x9d480b521d3752c2ull,
+	 0x5e45db19caf76d9full, 0x902016c794cc4677ull, 0x5e54aec1a89f641bull, 0x4619aec187560ca7ull, 0x6e78a0940ef3f69dull,
+	 0xbd0aa777093d9697ull, 0x7d47328683b1ca1aull, 0x6618791868799dd4ull, 0x46d6f21517892ed2ull, 0x848a2fc5f1fac228ull,
+	 0x1312eaa479c45bb5ull, 0xbc321b424ef22338ull, 0x8260c380017909feull, 0x160e45a558adc57dull, 0x807fd50e2cf76559ull,
+	 0x9a1c69fd21d391dcull, 0x7979abe90ba10d66ull, 0x7a21003b8bf8fb60ull, 0xce211a7c8b07e34aull, 0xcf48f2f228521f71ull,
+	 0xbeaf92b0b8a1affaull, 0x9056dbca9b7b3c21ull, 0x99ca64d41d374898ull, 0x9b17ccb5462b9035ull, 0x85326c35506a769dull,
+	 0x9e56558f6fd467f7ull, 0x04287f15f6c6f135ull, 0xd5fb431c02788b0bull, 0xb6733349b86aa1f8ull, 0xff917b2ef23b839full,
+	 0x13ec5378a4dd1534ull, 0xfc389a7c7981eb86ull, 0x33a57d34343e31cbull, 0xfc9b5159f00e8b0cull, 0x40d92c9f202e2273ull,
+	 0x7ade311e94877d83ull, 0xd1dcec4d38423da5ull, 0xd319b586658f5cadull, 0xf1646ffe78a0d199ull, 0xfbf984e319c565aeull,
+	 0x618ec15782d17f8full, 0xf265cf433e436111ull, 0xec26968d9cdc36b5ull, 0x89c2fe1b4169905dull, 0x2c68e3f44033bf0bull,
+	 0xf740e18b6b2d548eull, 0xccbad085fb2f9886ull, 0x72e0166b66e65518ull, 0x6d93189b4be6dd6aull, 0x4368ce1c0acce160ull,
+	 0x23f7d7f08f815acbull, 0x6d9780272f0a41d3ull, 0xc8a3705cae94dc19ull, 0xa41953c6c1d5534aull, 0x5d79be26eb446474ull,
+	 0xc6ebe7e1fa919dd0ull, 0x0c7c205912303cedull, 0xad9ee3100ffee3f7ull, 0x68f4e0dba2b0660full, 0x792adf927367458bull,
+	 0x8782964b2b35a662ull, 0xb00ed8ab8c253888ull, 0x3388de325f446570ull, 0xcc45f80e5d41406bull, 0x5c0a38007fad84c9ull,
+	 0xd0fce01e78517b25ull, 0xab8bf1b1614985d1ull, 0xd909025ffe39dbd5ull, 0x308e296dcfbcd961ull, 0x0c1e5e873414d728ull,
+	 0x6b0d57dd8960a35eull, 0x390590a4b7a753ddull, 0xc5050c5de35ee682ull, 0x41deade97ca91915ull, 0x3ff80cdbcac5c5d3ull,
+	 0xf8d40074b1d7015eull, 0xf8ff7f9779522538ull, 0xadb8cef76c7e3cadull, 0xd31b749a683795caull, 0xe9185de66568fd4aull,
+	 0x0b9f3c1eddcac23dull, 0x4bebeca74b3be851ull, 0xa82590960811f49bull, 0x8d78ee7502b74c7aull, 0xe5a9ebe1fa774575ull,
+	 0xc2599102be434a93ull, 0x7029850de09109a6ull, 0x9b5dd09ac14d150bull, 0x024ae2bf3c52f0f7ull, 0xcd0c80c76b3f120dull,
+	 0xb05045ffe282684eull, 0xd2c24260367a1419ull, 0x3d27db37ce92bd60ull, 0x68f839233dadaaa6ull, 0xab408d1bd0615d6eull,
+	 0x533c50c50485b0ffull, 0xed4e0d8cc4c2feabull, 0xbc53d0086cb2934dull, 0x8842badcb9f59dccull, 0x78c0593ecb2a293cull,
+	 0xaa5d8630e4aae60full, 0xa7ead68e8bda154cull, 0x62f7a6dca752284aull, 0xa30cb7d0f50f5c82ull, 0xc655caf2214e618eull,
+	 0x5a0c029bcabfab9bull, 0x0b0dfd694c5a56f1ull, 0x9a87eb7a98a0e867ull, 0x791bc47e5b5fce32ull, 0x4d26082632c7b9e8ull,
+	 0x4d8a7c8f8ce39973ull, 0xda80bbe7da1c384dull, 0x95db96fc735d5da7ull, 0x9a232a2d1b8ceb24ull, 0x57ba16c18df59678ull,
+	 0xd57d9cb0cc754a46ull, 0xf31fff7124bcf411ull, 0x902cd9fae1befc20ull, 0x7f814a8b0968935full, 0x1da30fa920d32e43ull,
+	 0x3a93dc6d46abec92ull, 0x7ed171a2dad1e756ull, 0xf5202728dee9da99ull, 0x9c491b8089a2d8fbull, 0x9df984089cea9a73ull,
+	 0x240dcaf8adca8885ull, 0xd6cd2ebb8e1e21e9ull, 0xa3f48d6059aadbfaull, 0x3ccea0c3c29dfdffull, 0x9dba2f46adecadd1ull,
+	 0x13b1af9c130ba648ull, 0xe33dfa523e80da35ull, 0x9fb08851f4ca7f65ull, 0xa4d2c18a3b0479e7ull, 0x67563f235830f6baull,
+	 0xfb4776a25268c518ull, 0x4ef6200f0e30a1c0ull, 0x27014158768d2bacull, 0x760c8c81508bff14ull, 0x9dfb161e1931bf84ull,
+	 0x43e5340918f79ba2ull, 0x9d6c6d79b8559557ull, 0xe3222401d8008dc1ull, 0x1f702c73a177d5d0ull, 0x87d72910ce350682ull,
+	 0x6c818d596c537e50ull, 0xd0ad1db749ad1a6dull, 0x1c763f736abac523ull, 0xe3533c183ee6c707ull, 0x94531a4b3ce915f1ull,
+	 0x56b4c825a1a0577aull, 0x8a029bad3cd97246ull, 0x148a165ad28e7857ull, 0x2bb725a632f6e6b7ull, 0x9249daf82d2679a8ull,
+	 0xeb08ef6c985e92bcull, 0x76768de7964e9630ull, 0x52955de1233253e8ull, 0xcb38d1e2f810ab52ull, 0xe2dfe75922ece98dull,
+	 0xa84c1ad3c14d1e52ull, 0x07525196d33dc7edull, 0x873c7a3500284abaull, 0x683f6e388ac19eedull, 0x2ca7ead72e356a17ull,
+	 0x97bf20a55974c32cull, 0x6f8b903b98c57429ull, 0x60c686d4cda7f9e7ull, 0xe5e7a485ad27f5a5ull, 0x7e9e3c8acaaa53baull,
+	 0xc4b6da6c300c8be3ull, 0x3fd51b4118a2fc56ull, 0xcebd37b4538e4821ull, 0xb3b55a2582411a34ull, 0xf3a89bd00927f36dull,
+	 0xf47bfb92725f9450ull, 0x44d90413dc91d763ull, 0xc992a58596d6e4bdull, 0xa7d880825bb7b3e9ull, 0x9ae944f780dc4e44ull,
+	 0xfcb91abcc1bfa999ull, 0x141d0d51a1fb6044ull, 0x47fb87373d911810ull, 0x5b5d6633ec5c23baull, 0x6eec1fb7aaecd2acull,
+	 0x45d53b4efc06bddcull, 0xf9ec40660bd9a3ffull, 0xf7b44ab189cfabf8ull, 0xe613f59f414e71a6ull, 0x14f6b471796fe81cull,
+	 0xc5386b99ab486957ull, 0x6dc32bbcaa17a827ull, 0x998511bf7fe15804ull, 0x08942d57a333f164ull, 0xbdf01bc1d4aece26ull,
+	 0xe5872676753eaac3ull, 0x31a5f817e60d7212ull, 0x1718ab12fa8a19a0ull, 0x41249011714200b0ull, 0x8147c21b7e66d242ull,
+	 0x34a7fca59e883bd0ull, 0xdbe2669a5821fdffull, 0x240671282237e9cdull, 0xc05ca405ed23a1baull, 0x1c2bdf8a872acc79ull,
+	 0x394d340d695163a9ull, 0x048b30ae04e54861ull, 0xf92de933624898a2ull, 0xe7e72257c86e9857ull, 0xba7af49529ddf273ull,
+	 0x03ed498e8c0f828aull, 0xc94cc429ef45b323ull, 0xf1c4176d41e7a81full, 0x293752963a6c2fb7ull, 0x0d6ffa9776909c46ull,
+	 0xddee16a608605163ull, 0x4d8e0e760a9fb727ull, 0x822fb7609f33bbc2ull, 0x9c4f981a2afe8a1bull, 0x39373a48126e4b23ull,
+	 0x985dfcd930c42ddfull, 0x2daf45a25cbc91f9ull, 0xc4afb0daca0f54afull, 0x335a955031fa0792ull, 0xae2cdaed077e6cbeull,
+	 0x86a22722f75175a6ull, 0x28d50d675fa8d41eull, 0xff78d8ca0612e9fdull, 0xf03771f589a5f81cull, 0x80504c360a138d69ull,
+	 0x7ab96a561a914337ull, 0x30ad6b9bfcea4562ull, 0x82ba6c93985dcce3ull, 0x96940f331892da6full, 0xa2ed685d580fd283ull,
+	 0x8c0038ba030fea42ull, 0x7e727844eee24c95ull, 0x76ef2cff53977fefull, 0xeabadd411d309734ull, 0xc7689299da735895ull,
+	 0x9b3b23b3c6d0670dull, 0x477356bdc1894485ull, 0x3f3a75465ae1696eull, 0x595b7bc7f69e18f8ull, 0xc4dbc2cf20c18967ull,
+	 0xce6e96629b68dc7bull, 0x8fddcbf35ab31837ull, 0x997ce8bb1937f60bull, 0x12772f190466b5e2ull, 0xa5ae55e3bebaca6cull,
+	 0x546f478d910c1012ull, 0x3d6896e5d52ae041ull, 0x17841fd8024a3f31ull, 0xe41839c308eef090ull, 0xc9e898abd05b9070ull,
+	 0x01ba1774f1471935ull, 0x9fa5920bcc626d2bull, 0xd6543fd8859d6d3bull, 0xc162cbb8e0732ec2ull, 0x68184fa338fee5bdull,
+	 0x501ab0b39bad00e5ull, 0xa0e2fb0f215fc8c2ull, 0x6c9c3416d8036396ull, 0xb61cd010b71b0c91ull, 0x8e567c254cb19d77ull,
+	 0x804d79c475b33454ull, 0xc9acadb2e03d7b69ull, 0xae827f2e7e1d6463ull, 0xc1d462871ce33980ull, 0x100f0e982567f589ull,
+	 0xcbc95c2ec75840c3ull, 0xcd9b7b0c10b14d2eull, 0x3c5c001f016cf0efull, 0x768972b9b47e71c4ull, 0xaf72941daa4b9c87ull,
+	 0x617b71c0ecda67bbull, 0x94751c26acdbe5f7ull, 0xecd85ddb8a3e7d4dull, 0x0f1dfbd677e11fb8ull, 0x1ea422d7034be9a1ull,
+	 0x80a7ab3240caa4ddull, 0x5b4b948d7e687369ull, 0x7e33680c5d3c8e8eull, 0x906bfb53d05eba65ull, 0x4722f015c5eeccd6ull,
+	 0xb4f4a57cbfcd6205ull, 0xebfdf25668a96577ull, 0x39b6a286b6bdf916ull, 0x1df4076c1a89b063ull, 0x6510b976f57c3c74ull,
+	 0x7895b6527112d02cull, 0x5ce923dfe1e8f028ull, 0xaf87620e6e873694ull, 0x5a177d862137d4fdull, 0xed0ec93409488507ull,
+	 0xbcb7066e4a5cd2d1ull, 0x0b6f166ca19e6ab1ull, 0xe3c7a05f13a9643cull, 0x993dc5fe589e0527ull, 0xfce0bceeaa760420ull,
+	 0x321329fa27e980f4ull, 0x3c4bfc991ae02cb4ull, 0xed7d50a2f9e12f9cull, 0x7adf9ba125e9c40dull, 0xfa07b42b45f0f01bull,
+	 0x81202d4fcf1feea9ull, 0x65cf319de49b0c0bull, 0x731fbd67a576d633ull, 0x6cdeeacfd4697992ull, 0xbb5f3eff0b62b9a0ull,
+	 0x16e0c9bd90d81293ull, 0xb0ebd7cb82b69879ull, 0x698e6253c59ba233ull, 0xe3c75bd45a3efc62ull, 0xaf448a1f6ba2e2ceull,
+	 0x8dee50eb5995e864ull, 0x8936939aaf584efaull, 0xc7b514a5d96ecb13ull, 0xb63de717846f3ab0ull, 0x5eb85227f9b3c4b4ull,
+	 0xdd42ddcb5c603f44ull, 0xcdadcac5dc142b87ull, 0xc015f143834b8105ull, 0x531e8cd723a2d944ull, 0x3c6e3bc25776bc6dull,
+	 0x910732151392db0dull, 0x70804c919e5f9243ull, 0x83334769a1f0ded3ull, 0x814caf2ea701925eull, 0x6fcc0e760d07744cull,
+	 0x7383f31c1ba9f205ull, 0xb26dcd1fff2c55f9ull, 0x973cfac86cee1e7full, 0x2e770d9080c33e1aull, 0xc86c39d2c059e20bull,
+	 0x46549273ca0d403bull, 0x4c4a267fbab0f5a1ull, 0x9209dbe88a3a53ccull, 0xd76a7d22f27fd736ull, 0xd0d81dfa10187474ull,
+	 0x90b9779f3a4b93eaull, 0xf90e8fbe734fbc6bull, 0xa805f3d63626fe39ull, 0xd43d5ffe58207413ull, 0xd68ba0f4075e9881ull,
+	 0xb55b1bd7dc27da46ull, 0x96337d1668f4c014ull, 0x901c615442596594ull, 0x25bee5c0cb7d12a4ull, 0xc933bbb04ba499f3ull,
+	 0x539f4e8b492ec0c9ull, 0xc489b74eebb326afull, 0x5ce8ce33505d072bull, 0xa9ce148b4e163dabull, 0x734c89f755b327d3ull,
+	 0xd70bfc57f1e7f8a4ull, 0x5d03a47d47daf3c0ull, 0xa1789e26940ac737ull, 0x7ea9cb1b4b56d839ull, 0x8d960ef73c78bb4eull,
+	 0x139a04c084f11507ull, 0xbfec4f559f1c6289ull, 0xf8b9daa4deb847a5ull, 0xd2d4c373c3180426ull, 0x598d1f376cabf586ull,
+	 0xe7d320452e4e1f4cull, 0x518b6a734f168140ull, 0x5c5997000c89dc0aull, 0x0297808c82081f39ull, 0x24dfaddc09924c85ull,
+	 0xd0f08049c1031418ull, 0xd03d280ff9daf59eull, 0xb651dedf3b63e62dull, 0xd7a0f7bfc408e3baull, 0xecb33ce43d4d23c7ull,
+	 0xfb283b04df38b1ffull, 0x6337e742d3cc998aull, 0xd95f360d5942a997ull, 0xa15c12cbe47dffc6ull, 0xcca8248b19433580ull,
+	 0xf13403ff7322c036ull, 0x16a5ef5b8c273947ull, 0xdab4ad2ebb924a50ull, 0x06cfff85ae192266ull, 0x932f165f3adb6eadull,
+	 0xffe1b934f83c9863ull, 0x69d06db357b17236ull, 0xa269da39266e9ca9ull, 0xb1110f9063a56ffcull, 0x9e94aa0edebb68bcull,
+	 0x8e21df0b6065940cull, 0xbce5261ecaebdaceull, 0x1696c11021eba61eull, 0x4d9f5907c7690b83ull, 0xcf5b39c7f765bb04ull,
+	 0xeb3ab3b2430a4981ull, 0x23bf54dc0db79d68ull, 0x3541ddf5995a4cd5ull, 0x95f87b6d9e456b0full, 0x075259b839734c7bull,
+	 0x99d0462c63798821ull, 0x5cb665521cb6464dull, 0x0baa4ec273a670cdull, 0x0bc0b8fad8d5996full, 0x893f69bbb8f371f4ull,
+	 0xa7e0edf69580654bull, 0x69b7befb25f896fdull, 0x59ffb22765d150f2ull, 0xb3b790dbe7d31065ull, 0x68f7183a0a219145ull,
+	 0xcbcb225fff428348ull, 0xdd68228844693efaull, 0x466f487b44502d36ull, 0xd3bdd8aecea292c4ull, 0x87d7eb592d4d1c14ull,
+	 0x98f956740bb3da2eull, 0x1a869f0510a33eefull, 0x21bb477355dd9e6dull, 0x9b2cad4294c338cfull, 0x53afd4f4d9225c2bull,
+	 0x4ca942a873630063ull, 0xfe754bb9785fcbc0ull, 0x3d1e83da10374e0aull, 0xb8f531693f6c2890ull, 0x97b46f53f1dd4937ull,
+	 0xb858068114cea499ull, 0xe3ddcf3e1915c36bull, 0xbe1c31f72c32e51eull, 0x0d3c7be0cb91ca38ull, 0x5fd55b1bdb79b2bfull,
+	 0x1dda54c53521bba3ull, 0xe11b4438ea595eb7ull, 0x6c93718de4ec0a87ull, 0xa4e14a7cae87dca3ull, 0xeb848aa3104f2ef1ull,
+	 0x43134abef660abb6ull, 0xad1d2399c21ba8b2ull, 0xdcb886296b443ffcull, 0x5ac9cb93e202c1ddull, 0x7cb8cd1fd06fe088ull,
+	 0x375e90adb6ee83bbull, 0x4fc38ce2b7fb9306ull, 0xf25264139725f645ull, 0x6d01fb445e47e61aull, 0x5bff0ede3ec32f9bull,
+	 0x722c915d025c6d85ull, 0x19b71006e562c8a4ull, 0xc668a3a1a18563dcull, 0xc38d2dd5c0eb4eaaull, 0x139db2b8d3fa3754ull,
+	 0xf4b8e088d62c08e7ull, 0x1bcb665494ebcfa9ull, 0x7a50e3c7f7acdb6bull, 0x9fde62669a3c22d2ull, 0xd86f2925c115a899ull,
+	 0x45f2ccc298ddcbddull, 0x300758f1254d4db6ull, 0x1b54cf4997d66d31ull, 0x777e0b5f47e27560ull, 0x1cd7418aeaa3099eull,
+	 0x5047fcb6ea23d174ull, 0xdc64b92290755e68ull, 0xb4de449569eef810ull, 0x2ecec24b2089b408ull, 0xfb32570ab05623c5ull,
+	 0xc77e03d330886d2bull, 0xf66e946953b62a51ull, 0xcfcbc515c194d883ull, 0xef724edae8042ed1ull, 0x53b7e9f078c5f74full,
+	 0x509e1e4045a69ac2ull, 0x0b75aa385143e116ull, 0xae962ee46fbfe73eull, 0x87cb1c917a78dee4ull, 0xf4d4465cfd626e03ull,
+	 0x9d595659e8a91816ull, 0x0086223934b0b190ull, 0xda42a07977c33813ull, 0x495ec24fac5166a5ull, 0xd00e70f05f3b584dull,
+	 0x5548bef27670053aull, 0x9989f760351020cdull, 0xadabd07dd066b1d0ull, 0x242e33b2bc002cb1ull, 0x4b56b826496dd5aaull,
+	 0x424949f575585f7bull, 0x77e41ae2a4e1c56eull, 0x7dfb27407e1c1f96ull, 0x0a747161fcc6db2bull, 0x97be1b14e3612ea6ull,
+	 0x65fd780843fce6caull, 0xbc7d58bd9722a5f4ull, 0xcf68a897dde32ee4ull, 0x03ef0abff0766f5eull, 0x3d2a1012e5de08a8ull,
+	 0x1e14efb3682a718aull, 0xce976e6b855c6c9bull, 0x8007f0de83e4b25bull, 0x1f1925af5a41eb03ull, 0xba34f1a47426f56bull,
+	 0x9b30791dc83f8705ull, 0xbaa7ec7720242645ull, 0x62f77b37e66df7adull, 0xa2b07a47ebcc1e3eull, 0xfbf8525e0801c5a5ull,
+	 0x761faf25e67eaec8ull, 0xfff0ea2afddc3995ull, 0xdeca85ae9f8b87c9ull, 0x94872f63c1f4ddd3ull, 0x823b5db231a9e77cull,
+	 0x5dbf4fc10d010b5full, 0x22d083da4b8df6aaull, 0x4eab2cff5bb50471ull, 0x47d221ab98e49badull, 0xb5f19de512517098ull,
+	 0x617a9b2a516bfde5ull, 0x1e4a49768035a065ull, 0xd59f9a03802112adull, 0x881ffb7d4c54746eull, 0x1264df3c67426a62ull,
+	 0xbd0c9bc7412085c0ull, 0x5b5cafc2fab70279ull, 0x4f42adad62d1a831ull, 0xcf524aff76baad5dull, 0x9fc984cd4826522aull,
+	 0x7bd7cfefbe925792ull, 0xe1decc66cfc432beull, 0x2f0d730d67786578ull, 0xf85efc1b078fa085ull, 0x804d73862326ebb6ull,
+	 0x15db10f9938cd7caull, 0x2ed07f3c082e231dull, 0x10becdeef4debf10ull, 0x0ef5a510f05d9e65ull, 0xf68e41cbd17af964ull,
+	 0x0d9dd2d9bc94a30bull, 0xcd9aac941d71aaf2ull, 0x4e9baf5594c3cce8ull, 0x0761e80ec205785full, 0xc7e824ae9546ee05ull,
+	 0xed279ea4f66010adull, 0xe4ad27fe35662db8ull, 0x2792a4a9cbdb196cull, 0x1197afbd123042f3ull, 0xbcf215f80e085b6full,
+	 0x31f428c8b02e60beull, 0x5f05c08a248cfa79ull, 0x0ab77a999497273cull, 0x58e6a05b6711ee6aull, 0x83a7ece173725a4dull,
+	 0x70607b38f9911c8dull, 0x6cc11038497c8239ull, 0xf2da4b96c25ec701ull, 0x906e9539b18125a1ull, 0x12fe086160699824ull,
+	 0x393868a95ad07b2eull, 0xc8e1b6a3db341ebfull, 0x3be3781756252e78ull, 0x5d3e93fe5222f9abull, 0x1b0264c89c0621ecull,
+	 0xe287a43442a8274aull, 0xf1eeb9cad91dba38ull, 0x3210d022ba5fbf6aull, 0x78e37445ed668c19ull, 0xf0d3727b786ce2e1ull,
+	 0xf5ffc505b3e65d7dull, 0xeb8120465ba2aa93ull, 0x5e7559d1fcc735adull, 0x799b95eb1c726f1aull, 0x9c81dd2a8d541fc4ull,
+	 0xcff4bb311fa383a1ull, 0xc07dc6000d61a956ull, 0x550e163685f668e7ull, 0xd850c7ea2a434874ull, 0xd5b27f3bcc1fa078ull,
+	 0x85c030f6d7aa5593ull, 0x4849a3edffccc0c0ull, 0x3911f9a7949f15f4ull, 0x29adaf909e7d80bcull, 0xadee73d26d49f7d0ull,
+	 0x3d3ef88889e09e73ull, 0xa1a56173a8bd880cull, 0xbf58f7e0a42e0b2aull, 0xd81de8f61337902cull, 0x1482cacbf9ba738dull,
+	 0x242f0b90487f69b7ull, 0xd8aed9575ead1d4aull, 0xb09d8a5c75062424ull, 0x415c6d0a7f2741b4ull, 0x69d7e2a0009b8e56ull,
+	 0xeb174216992edc1bull, 0xb162f717315dd581ull, 0x777178e6aafb5bebull, 0xde7be6d12056b809ull, 0x43d966c63e6eaab2ull,
+	 0x4d0aa11d43818b4full, 0xe71e344429afd4d2ull, 0x4f361ed2dcf9acaeull, 0x6e1abfb7ebba7c09ull, 0xf9ad191db7cfef68ull,
+	 0x34fa657a6e0238d3ull, 0x6062577f47177562ull, 0xdae3506ff241a697ull, 0x1c280ae5017468ddull, 0x813f622b235a41dfull,
+	 0xa172072aa9bc888cull, 0x60beef8652951e5aull, 0x4263e0e5bd6ec17eull, 0xdb0c0de1c7e77c73ull, 0x4c9b176a54b3cd84ull,
+	 0x9b70ae60ad15cb13ull, 0x7bd66661102ae0beull, 0x2555f53123dde5a1ull, 0x5cf653c5a7569ab0ull, 0xe32058b65eb9a0c1ull,
+	 0x26f4cef848ba82b2ull, 0x492f54f808268c56ull, 0x6f4afae8c3730574ull, 0x5536a42d72730882ull, 0xbf557a3a8c9ffc1cull,
+	 0xec949ab2791bcf6cull, 0x3d2e25be2f7aec9full, 0xe06dba67a043b059ull, 0xbbee4f472bd8d672ull, 0x19965b530b71bf23ull,
+	 0x0900b006b8b27d90ull, 0x2e04695539501066ull, 0x527bce4dbe814237ull, 0x586ed100c4af8c99ull, 0x21e84d0762a8597aull,
+	 0x3c76f4d4c05abfbeull, 0xf4635b4d9dfbea9eull, 0xdf326abf7868b6edull, 0x5ad7d35f9ff1690eull, 0xf070d45724770cbaull,
+	 0x9b637bcccaea16eeull, 0x6d764953a9464f49ull, 0x2494e6ec4a5cf596ull, 0x4da4cc81a1bdaf48ull, 0xa013910414f72eb5ull,
+	 0x61ed6b5264d00292ull, 0xc90a70930355e6d0ull, 0x3c7900b1e51071b6ull, 0xa4e55cfba272eacbull, 0x5c8db1a0ae263045ull,
+	 0x17d74b9c697acc90ull, 0xe3e8da9d1faa9b8full, 0xfa09ff7e46868f7full, 0x8951c65b233a1750ull, 0x1ddc174d887c81ddull,
+	 0xcc9bfe4702165242ull, 0x2386d2833a5b02caull, 0xa27d1f976f01178eull, 0x3c68e2be8bea3210ull, 0xbcadcf4eebedf374ull,
+	 0x32933e15361a6f22ull, 0xcdc8f26a223a3ae8ull, 0x81c7e881b90dcbd2ull, 0x47cd720eb70d9fcaull, 0x976e7a7c3e29a81full,
+	 0xa8bcfc727e966230ull, 0x7cd1741256b1d466ull, 0xc971ca2c102dd316ull, 0xdf2504f7ecc22d0eull, 0x9b237d70c4a98f87ull,
+	 0xb3624fd1c707ccfcull, 0xa97801f8c6c2904bull, 0x77e63415e4ebfcdbull, 0xf4e7d9b0a95d471eull, 0xdb8397ad4637e51full,
+	 0x60aab8bab7a94f69ull, 0xcb0e693d03de0451ull, 0x69d96fbcd43ab82cull, 0x4a2be8e6589d6df8ull, 0x103e7f49af0cb0daull,
+	 0x04894e896fc59423ull, 0x4a3b6f280c4edb56ull, 0xcc6687e12caca1ceull, 0xbd072c188398f5e1ull, 0x985f1c38f521d5f0ull,
+	 0x0d23e3ad52ed3300ull, 0x7f7ff1f5b24d7d23ull, 0xf3acc8c747defd00ull, 0xd78d58908a0a83c1ull, 0x90fe1e2433bc0d46ull,
+	 0x29f025e50f5f746aull, 0xf974c6a8a0780dc6ull, 0x685876dce0226fd8ull, 0x1cc86968756d3c42ull, 0xef79e6888f3c73adull,
+	 0x7882c31b694746a9ull, 0xad23df94a9659e2aull, 0x9e0e82efef49ed70ull, 0x66136f9c26fa98eeull, 0x42834e735cb138a3ull,
+	 0xf08f8acfee3d800eull, 0x2f08d51593e595ccull, 0x0f995c216efc3728ull, 0x503bbcf6ac845ba0ull, 0x2ced0a5955d43336ull,
+	 0x131203e1c884ecfeull, 0xa7bd4191720a61a5ull, 0xe2515fdef3816a75ull, 0x1c70337e7b69de15ull, 0x3e60aa6ba1c13fb9ull,
+	 0xa1d35a46b5a89e5cull, 0x7c19f37bbfdd3eccull, 0xfe0e74e8bbd6334dull, 0x90de8a19c6c0c559ull, 0x4b7d9ae07924984dull,
+	 0xc68122e3d033e70full, 0x29d44c64800c182aull, 0x020cbaa8db716388ull, 0xf7ddf4ff7face92bull, 0x9c1bc08c1f2294d1ull,
+	 0x6a0d8a29bbe03c1aull, 0xe2638d84b0db921bull, 0xd4ec73337436a62cull, 0x90a896c390ae44cdull, 0x4edac9c163b624feull,
+	 0x837f565ccd15c23eull, 0x8a47c01e63c1484eull, 0x2922e85987df4e8aull, 0x1277f25ac85b4833ull, 0x94dac83438728719ull,
+	 0x0822153d4022aefcull, 0xed4554d50faae691ull, 0xfb94d060ab4d13c7ull, 0x173a145f5af05310ull, 0xa8a8774a86ae2420ull,
+	 0x3c2037510d249537ull, 0x892cb4c868efeb87ull, 0xf5f28825ad95870dull, 0x65cb4c9bf3e10f4cull, 0x469c958399031190ull,
+	 0x832a876a5953e60bull, 0x896fc68aaad8a015ull, 0x75820b886aa56a9eull, 0x4bc2e78ce2ff1b64ull, 0x5c97c079e49f4d10ull,
+	 0xcb05a52659769457ull, 0x4b776cda1c659774ull, 0x5f84cc615ce06073ull, 0x1e11fcf23f253c42ull, 0x35487bb37a128d10ull,
+	 0x4e2ac3c5f89d6d99ull, 0xcb3febe32d901eb6ull, 0x3e4a1e669f1786dbull, 0x41514fd63f895646ull, 0x2ce067cee3d189eaull,
+	 0x8f28ff0b99a727feull, 0x6060c83fb07b53c6ull, 0x310b11ffafe5e62cull, 0xf7dc7bde321c3e8eull, 0xec31b0458b377c67ull,
+	 0xe1a1c84f23bbbb3dull, 0xcf0a839cbd8b51d4ull, 0xef1225f621ac4ec2ull, 0x6610f29de211f8bbull, 0x9ae6f4dde59f12d3ull,
+	 0x4a8be529d8fec20aull, 0x51b0990dcf2dc991ull, 0x5bd744be944ec64full, 0xc857e6dbccd0baddull, 0x41c7fe0a6a4208d1ull,
+	 0xd294c18567427073ull, 0xc85179c27f85eaf6ull, 0x1aeda14f52c92f00ull, 0x5bc5b47e5195b731ull, 0x9a6702b3f2a9da9cull,
+	 0x2291392e73cff6abull, 0x629b2251e1c68b57ull, 0x4a83e00671358223ull, 0xca8106c0d2bdd59cull, 0x7200de96b4a6726cull,
+	 0x9c2756b5eaa79c3aull, 0x31199ff5110bb951ull, 0xb6c5a1429e8cd9d2ull, 0x658ea9ad785db89full, 0x916b6e8078c14ac3ull,
+	 0x3df663a30e87864dull, 0xc6d384a12792bbc6ull, 0x36f08744907bfc64ull, 0xfc7f62fd9c3a4b71ull, 0x4f01be9264ee1e02ull,
+	 0x4747c09ec1a658afull, 0xa3c4cf30cc26d67eull, 0xaf43c397adce0858ull, 0x485382bedef959f4ull, 0xab58180b1abfcf79ull,
+	 0x1e549f3812b7c04eull, 0x474c344eeb95b0a4ull, 0xad1c40320026ebc9ull, 0xe8c1da66a4ebbb14ull, 0x98693a32601960a8ull,
+	 0x66e39fbe0e5129ebull, 0x75a7b47c92c99927ull, 0x66bbfbac23756594ull, 0x4fd29548dd506a02ull, 0x6a709c804bc2acf6ull,
+	 0xf4482934ca638e93ull, 0xddb6402e4cf6a903ull, 0x45000c3c897b817full, 0x9996461a0a270c8eull, 0x3e96e2b7dd9a03f2ull,
+	 0x45d45fb136576d6bull, 0xfd4dfbc350823fa9ull, 0xdbab9bca8ff9f934ull, 0x6e97c1f54a23933cull, 0xc3933bd8fc517457ull,
+	 0x7c828a4f5b0bb428ull, 0xe47bd39a63a940f9ull, 0xfe52cab8ca023499ull, 0x79cd2a3701e400bdull, 0x7b52b59c5e89c1c2ull,
+	 0x9598d9617f9d462cull, 0x73a3e24c7818b255ull, 0x525f38af82383074ull, 0x4d0a8de8f9dd84efull, 0x5af3cd99eb8cc196ull,
+	 0xa4ea51c00407ad94ull, 0x061f54a17d1b72faull, 0xf05dad3ebdea0483ull, 0x534bbed664768d15ull, 0x5af6c017824bd93bull,
+	 0xa3df13ec9fe84c04ull, 0x6dce54acab6799b7ull, 0x51185f6b0752012full, 0x23d18a04740231b1ull, 0x36b5fcfd5afeddeeull,
+	 0x397be026a50df92bull, 0xf9b1a107adc549ebull, 0x4a5a85ef29a0168aull, 0x48e3ef08a7dc1f03ull, 0x485806114cf6d289ull,
+	 0x8a9b90433fb36c7full, 0xf65aa36119bb5820ull, 0x67c1e192f1ffb3fcull, 0x566a69f4ef9988acull, 0xad8c472b5ac78c63ull,
+	 0xf0a4dc0b2d4cd198ull, 0x178184d1f610eac2ull, 0xab747a5d46a91e75ull, 0x22baf603a4e86e1eull, 0xb93ac7026472c0acull,
+	 0xe3debe82fec8a66eull, 0x145fac7de3b07ec8ull, 0x47774c137ddf1a88ull, 0x5b23b332198fb13eull, 0xc4b52a61cb36829dull,
+	 0x0ab142314707a132ull, 0xde4fbadb52e488b2ull, 0xc31b99888fd05d3eull, 0xeefa9db0ca71aaa3ull, 0x32a75772b8779e1cull,
+	 0xaf48bce6b022f3e3ull, 0x5b1adb1ef8d91c9dull, 0x5e20a931b1591d73ull, 0x8add010cde3d0f42ull, 0x49ce40bf6f71afc0ull,
+	 0xce8560fe0c334cd8ull, 0x5469c58a54b43794ull, 0xe2910d402de6fa22ull, 0x83453f0d6a82b3d2ull, 0x6f0e65f2e2424288ull,
+	 0xb623f88b6d200e37ull, 0xdb8d83eecf14c8deull, 0x987ca545eb315656ull, 0x0010a726f592a5e9ull, 0x6b707a3b53369314ull,
+	 0xb10e70dcb219d2c0ull, 0x4bea647cff0310f6ull, 0x8666f1d2bd4bda08ull, 0x93cb90307f0a1677ull, 0x70a93899d2c884eaull,
+	 0xc3a14400d7d9e5a0ull, 0x2a82da8b51e2059dull, 0xc16d40e7375639a6ull, 0xa40135a4257c43f7ull, 0x3c6fcf8f74bd5e29ull,
+	 0x984507ab7c800539ull, 0x29638e21b448a22aull, 0x687a28afcbbb304eull, 0x384d714ff034c6e8ull, 0x2a4621c59d1cbf7eull,
+	 0xc150cf0cf9fe01f7ull, 0x50732c1a3b9decaaull, 0x19b99f3b2a1057a7ull, 0x370c27f909f6901dull, 0x234d0e9124f7dbb0ull,
+	 0x8df5de84978b386cull, 0x5c481a163388a405ull, 0xdb784eb5dac8ac5full, 0x2f9f62124c786c80ull, 0xb3894cf0672d148eull,
+	 0x3fc37cf2985cb573ull, 0xbd3043aea8fc4abbull, 0x2d0544017e8cc7ccull, 0xdbb63bd92a7e583aull, 0xec324c0527e2e203ull,
+	 0x18ba2b741afa7fd8ull, 0xbe47fdba8f3f22a2ull, 0x02c98546c3b1dda6ull, 0xa14f215a279df214ull, 0x1d840567b6279e70ull,
+	 0xa7a1f8fc81909c9eull, 0x4bf7d18d7e7b16baull, 0xcfcf7d08332e553bull, 0xfdac6995e39bb786ull, 0xebe5bddf22afede2ull,
+	 0xd6d1683972811ea4ull, 0x7212f1f27d203371ull, 0x27b00c795634b613ull, 0x1aaf832a0f1d0ee1ull, 0xeaf1418b715b7b92ull,
+	 0x00cb329e5156e968ull, 0x0fb94458180ea34dull, 0x17207caa7ce0357cull, 0x5ed4fc506459c790ull, 0x380c3686e348b368ull,
+	 0x252a17d4841e65cfull, 0xcbdc56e8326f329dull, 0xc056f1459da7412eull, 0xea9a3b679c48e02dull, 0x85bb598f6a1368d9ull,
+	 0xbcb05e0b96a4d151ull, 0x8cb39bef9a9ffe34ull, 0xd56591d6c3961643ull, 0xb39c87f85c3913dfull, 0xea7bcc0b73560986ull,
+	 0xf191afc3b898d032ull, 0x36a817274f131982ull, 0x5a91ee318405aaa0ull, 0x340b88bae8543c43ull, 0x0763f66ff0664d94ull,
+	 0x5a15be43a54521a9ull, 0xe5153cdaf4d61a4eull, 0x4dade95bd1aad6cdull, 0x914869eeb04e2b9aull, 0xb5ee2c4c9134e6ffull,
+	 0x60b59977251541d7ull, 0x8a22f4a46ee90f69ull, 0xd716b52dca789dcaull, 0x5e768e4eca0145baull, 0x45c43d5be9248648ull,
+	 0x26e50b012a1a0f98ull, 0x2cb3efbbcc9f35f2ull, 0xcc5e516664c50f8bull, 0x35bd7d3cc6add862ull, 0xd28315f4875c61dfull,
+	 0xe8a1952639828763ull, 0xc21d32d722f5b916ull, 0xd64c7d030c9cae9dull, 0x12a2c69a01bd590full, 0x29c489dc8ef30d89ull,
+	 0xea0949bbf69b76f6ull, 0x09941fa65e7a949full, 0x601cb6c51844b281ull, 0xc054d326c8af9394ull, 0x84d20d5f0f48cd10ull,
+	 0x5ab93230599e6ccaull, 0xd375bb23a742a5caull, 0xce9c10d940cc2b39ull, 0x0653f3897713a670ull, 0x18e1aac6dd107914ull,
+	 0x8d7df89243e7572aull, 0xe3426df4f2fb89cbull, 0x6fa3ab5ae91f0951ull, 0x41b0790f8fe889e4ull, 0xd5f03bdac9b2a869ull,
+	 0x5248b33df056c83aull, 0x73568adb2364d073ull, 0x13fef5cf7e39b712ull, 0xc8972676d8fd98e0ull, 0x4f8fe28ced038827ull,
+	 0xeb26c8cd11be00e0ull, 0x76ae27078daed753ull, 0x1a78a5f2f77473c5ull, 0xd95a4cd0285edd3cull, 0x8627c93f94fc4883ull,
+	 0xbb7949c407f193bcull, 0x60363101ae9bdc53ull, 0x1728a9c0524612b2ull, 0x077924c0a310185cull, 0xcaad20fb748a8bd8ull,
+	 0x0df3dfea02db474full, 0x9c29489f0035692cull, 0x22db30c5cf62bd46ull, 0xef1b72eb3e57fc75ull, 0x1ad0c95be30e2a57ull,
+	 0x01c8ec5d6002e88eull, 0xd8f976c22c0e1a21ull, 0x98bfa1f1e409cc94ull, 0x4db862ccce2a0c8bull, 0x292a705a7faa4d46ull,
+	 0x264543a570e35238ull, 0x35b1d45e454ccf66ull, 0x2814f4d0c2931c74ull, 0x5fdca2dec0e37a56ull, 0x793708ccdd891b96ull,
+	 0xf6d65027da412d3bull, 0x986cf34ec5721322ull, 0xa7391dba7dab370dull, 0xb267f2c64ac60ed4ull, 0xa4c64837a253dedbull,
+	 0x326c9538f6dd8fbfull, 0x3dfb38298d5835ddull, 0x55eaade57fd6413full, 0x674d993cd5c5fa81ull, 0xb18e74e76be34290ull,
+	 0xc53ecac107bb8570ull, 0xb9fcd33cbcac6d13ull, 0x212cb4e34e31a123ull, 0xe707eead56241e76ull, 0x574d3050f65d26a1ull,
+	 0xc6e6d21e9ea82279ull, 0x9124cba1c7226f4cull, 0x1d9d50c385e548a0ull, 0xc1523b3b31afc513ull, 0xf69483fce564b538ull,
+	 0x0a9519579a7bbb79ull, 0x83fdf39703917289ull, 0x6db3ca71ce23495eull, 0x49bb3a8938038e6eull, 0xf9618c485ca53f71ull,
+	 0xc6866abaaec66243ull, 0x9a951a72f8ea7da3ull, 0x091a469d476ea1c6ull, 0xc7f7f91018f237ccull, 0xef2f423f563ad16full,
+	 0xc5e521f454ed13b9ull, 0x8a28ad384735ed1dull, 0xc5cd3f1638048b2cull, 0x5ae14dc75b610b93ull, 0xe75e46ca51888afdull,
+	 0x4eba85622ba1511dull, 0x2fceaeb6e1c1cf21ull, 0x60b5b144f6898ff0ull, 0xbd05023331ad7701ull, 0x04ce9276f7f6ef91ull,
+	 0x7221782bf182c82bull, 0x14ce575d84bc2659ull, 0x3fa48f64e99ab915ull, 0xd7efd0923fadb2ffull, 0x58dee8abbad493feull,
+	 0x46afa0abc56a0c2aull, 0xc118fbffbcfe9cb8ull, 0x6048240e779176c5ull, 0x31cd4419acdfefe1ull, 0x1fda30e987fb6f05ull,
+	 0x84b781181dd6f01dull, 0xf68aaee79b53624aull, 0x073f320b098bddedull, 0xe82d39fc200142bdull, 0x8f1bee10a97da6c5ull,
+	 0xf973688b4cc2b06eull, 0xecbd5d03e1154ed4ull, 0xbd0738601e1512f8ull, 0x8f7cb3ce297f56aaull, 0xb070ef1bd17d431dull,
+	 0x96df7b4b41eeeee4ull, 0xf99b12a435deb1b4ull, 0x13585a7b81a4fb53ull, 0x906f1eb262da7831ull, 0x497c4ff9fa14875cull,
+	 0x8ce50956bdf32678ull, 0x26a4dde0c866cf6dull, 0x5dd9ab98008cc68bull, 0x627d78db8daced69ull, 0xc088abb5a4d18cddull,
+	 0x103c4845c0b23c23ull, 0x6d75edb81e490c2bull, 0x413fe2694cc94b04ull, 0xc99bb92c07301357ull, 0xab20ba663d92b21full,
+	 0x6f7d19b569974e7cull, 0x7b48d9775506288bull, 0xa5282d181629c507ull, 0x796a7d997d31b690ull, 0x7d142e9a631e6df0ull,
+	 0x0e36ce00787e4ef5ull, 0xb3b967dc46c7eedfull, 0x7a2f41d4511f5028ull, 0x7b38e91f8bcd79a7ull, 0x0bc1934a4557b360ull,
+	 0xdee9c1c4121e10b9ull, 0x366274ce388b9b99ull, 0x8a702bb256be016bull, 0x4ede544063476ca7ull, 0x7b98199abc0207bdull,
+	 0xabf70715ae2fad89ull, 0xef1b825274bcfae7ull, 0xcbdd0edaead99696ull, 0xc732533199fb7102ull, 0x7649e1989280ef8full,
+	 0x12ad6d549e7c0dabull, 0x832815b1ad51d03eull, 0x1deb4bb2ce3b8ff7ull, 0xecec059754c0f189ull, 0x2d13c5c02126c475ull,
+	 0x2ef2144939d88136ull, 0xf8dc37668ec5c2a5ull, 0x5afef14be13a3475ull, 0xc09bc5486fcc56dbull, 0x9305203da1498c87ull,
+	 0x5e6677d890735402ull, 0x67c25b4742891168ull, 0x99c9ef5494b74345ull, 0xfec4621c3d4ec489ull, 0x02b3a5b24be8a94full,
+	 0xfc994d7553c5a39dull, 0xc5b7508f709e71b5ull, 0xe015446ec92651baull, 0x264cabe8debbbf07ull, 0x80b2a49140cefb56ull,
+	 0x374ccfb77efd125cull, 0xc500a0daf813ed30ull, 0x8827548b363910faull, 0x93fc9e5b4f6cb495ull, 0xa64347880c84d15bull,
+	 0x962b7b68ec912012ull, 0x530fe78f2a3bafc6ull, 0x8971f2fd0a6a644bull, 0x1fb9717522a75126ull, 0x71676f036939071full,
+	 0x7b4d5f4c2e8ca88bull, 0x3a072c122827b305ull, 0x0f277a16f0a8b485ull, 0xbc57cb72271ffa16ull, 0x4e456110744f64a8ull,
+	 0xc0045922a57ba163ull, 0x13bccbd42bd00ccbull, 0x35465aeefd56e18eull, 0x6628cdd186427cdaull, 0xd995db45448baa04ull,
+	 0xf19cf22531f30b16ull, 0xff0f229b9000b6c8ull, 0x07607cfed91532a6ull, 0x5e1c97817671dda3ull, 0x61d294bc5e01004dull,
+	 0xf8284ab60769c075ull, 0x1444c4d5e774d1aeull, 0x1ab45781d9fc15aeull, 0xd94706223f85c160ull, 0xd1e6eed31974212cull,
+	 0x2bfa8209c1e70d53ull, 0x6a4cf2d1f5b818c8ull, 0x3b11fbb58d2db806ull, 0x7594c19195bc08c9ull, 0x376573adfc284d77ull,
+	 0x69a3849a0220827aull, 0x3e5909595ff64df9ull, 0x368fe5ec9e27726aull, 0xd02ec72651a5febdull, 0x4846aabcb0b340cfull,
+	 0xd2b2624eb59fdc56ull, 0xd44964a1ab1d5aa5ull, 0x5915811cfdbda47cull, 0xebf70dfba71b5b6full, 0xa81be226e0608336ull,
+	 0x13a623e0a7c2997dull, 0xdc983749138e3110ull, 0x436ce5ac33a8e18eull, 0xb6c30074cf57926eull, 0x568b65aaf946ce0aull,
+	 0xca00154f60810cabull, 0xaa558254c90d2de3ull, 0x22e6c8fff133ec68ull, 0xaa7778114e18ccbcull, 0x21b7269332f2dc3eull,
+	 0x4e170cbfb9284032ull, 0xc4c1bf2fc5493e15ull, 0xe303529e2eec928cull, 0xb3f9de0c88402d5full, 0x9be6474aa931420bull,
+	 0xf81bdc30af992883ull, 0xc180f2d1f85173e1ull, 0x24f0a9a883014561ull, 0xc60daa4a361c3eaeull, 0x1ebb62950220ea83ull,
+	 0xd393e5e08cccec6bull, 0xbb4cdb3bc4877135ull, 0x0808a8b9079a9f64ull, 0x437c67b4fd94be31ull, 0x6cf48c5719ef12d4ull,
+	 0x0c1ec254e0402414ull, 0xdc360d74e707557eull, 0x8755185557fcc988ull, 0xa1e85a9a15160077ull, 0xac0dced493e6b3cdull,
+	 0x9f26074738736eebull, 0x03678049aa9aebbeull, 0xcf1c4d6c5d3c88d1ull, 0xb78401123019c3a5ull, 0x00594e030c380ed2ull,
+	 0x1eaf23988c8082bcull, 0x2417f8dcd98b2997ull, 0xb02f9b11ffa6e394ull, 0x765c4ff87c3b1337ull, 0x1f4716133d0a40d6ull,
+	 0xe8c313bb1835b38full, 0x58718d2d3a094144ull, 0x0a12b2c3ff3ada85ull, 0xcd48e16662b75853ull, 0x96784d50ba9ed2f3ull,
+	 0x37545617e0fcbd58ull, 0x9463b79f4a459a35ull, 0x1dd7dd1808944c90ull, 0xba515157efbbc915ull, 0x91482a6342aa5bbcull,
+	 0xed1cae0330eba792ull, 0xba6eaf11aeede9feull, 0x74bffdac3ae0a770ull, 0x92e5d89532d803e7ull, 0x83cab596858b816dull,
+	 0x8ca5aaaea1761081ull, 0xbd520081d175d32aull, 0x6fff72b8a37e703bull, 0xa54209b661d57478ull, 0x2071432fa27ff363ull,
+	 0x89df13b2efeebafaull, 0x040f4adba1c5be0dull, 0xb966afb0679fabccull, 0xbc15796fb4da765aull, 0x69cc6dbb5d642280ull,
+	 0x072aa0db7f68fcb8ull, 0xa32066f600bd7956ull, 0xee20d3ca2d98194bull, 0xd1863da09f9cb848ull, 0x25ebc1c473196fdaull,
+	 0x5b54f7b598799b36ull, 0xfd5c5f34b29d926eull, 0x4d785fa7139e948cull, 0x89146ed90fe87a2dull, 0x0772aacbe32387cbull,
+	 0x10793be818eaa5d6ull, 0xd566ffe3b2818d78ull, 0xdc3f179e0737f34cull, 0xae2967381a636c2aull, 0xda1719a1a3296f9bull,
+	 0x70d7eaf34ebe0173ull, 0x9efb7b2c9a18741aull, 0x2492317530de6843ull, 0x2be4da1dffad9425ull, 0xfe20fa551ecc42d3ull,
+	 0x05437344c4b28582ull, 0x674129aff6bd0942ull, 0x4e34c7d65f712664ull, 0x11f77b84dd721d73ull, 0x1410010135e3e76bull,
+	 0x6a5c86e47f1b9c09ull, 0x269d49516e4a0befull, 0x9d867b4c002a1421ull, 0x9772e6d9357ae380ull, 0xfd28202473a4c568ull,
+	 0x235c554653b9cd03ull, 0x4f459a5fa314677cull, 0xe29689fe0e019eafull, 0x71f986894d623e79ull, 0x8f6b77918e51a61bull,
+	 0xf2045281dd4986b0ull, 0x288f03c4f0dd0cecull, 0xfb8509c0d738aa74ull, 0xff3887619f6fcc87ull, 0x9ba55d14283c41fcull,
+	 0x3e5e356723fc63a9ull, 0xa9e1e44d3afb3b2eull, 0xe936776ee2b9cb16ull, 0x74a992530c7130d9ull, 0xb58fc01e74ee2c38ull,
+	 0x1fcc1e48d90f7aa9ull, 0x7af88d48b3314029ull, 0x652fe0e8e1416dd0ull, 0xfeeed233d261938eull, 0x9798a0cf52a57f9full,
+	 0x7ca9142f5214c8a4ull, 0xebc7b92ab1dce7b6ull, 0xf08e6b824d66823bull, 0x3fc3c770bd2ce998ull, 0x929e6b885992103bull,
+	 0x965999f0b9cfcac3ull, 0xfed2b359b5f216a0ull, 0x4c9d52399485b8f3ull, 0xde2ba8bcb0629d28ull, 0xa878e7f694c3dbdbull,
+	 0xc60bdd8f53c1f14full, 0x16760955ccba0d4eull, 0xf35a228d5dd39d84ull, 0xd73515a47f0a4a27ull, 0xca9e7c077a91216dull,
+	 0x0ccfe8050e5908adull, 0x155b3a16eb2c4384ull, 0x75f851cf0872bb91ull, 0x323fe806bdb4ca99ull, 0xf6ac94ba28f258f4ull,
+	 0x9a941a93bb22d966ull, 0xbdda84d7e2520f07ull, 0x63f7d0822edd625eull, 0x3fb9a46cb1409cf9ull, 0x89accf24f232886full,
+	 0x4b5937a25f38e061ull, 0xd049bdae70661baeull, 0x2629deaf53f0ec82ull, 0xdead1d5e1f547f7cull, 0x6415a7ddd53b76e6ull,
+	 0x5fd75d74b54428d9ull, 0x09fa6addba88bc48ull, 0x942ebfc4a0b1acc5ull, 0x7a7f1d6bd7680e9full, 0xb3218f8ab025b759ull,
+	 0xc255479275c1de7dull, 0xb171e570df140bdfull, 0xf0e1aa5a4d46c63eull, 0x633b00bf7c5c113full, 0xfd6e92a63f52a165ull,
+	 0xedfa14d2f23aa819ull, 0x3f66436a8f3f37c2ull, 0xc7cd136b3634dba8ull, 0xfa6271533a588833ull, 0x263ecf9a576e1796ull,
+	 0x31f7f6fc111b9a3full, 0x4324d0b441bbc741ull, 0x0ee065b2b50d4ec7ull, 0x4eb26893d34be1cbull, 0x02074fb22290ebb4ull,
+	 0x758974b1f55c0e6bull, 0x01e05900cae6d572ull, 0xa1b18621b4d03c42ull, 0x90bafc5e6c528184ull, 0xcc8bb9a05fd589e9ull,
+	 0xb561de851dbf8184ull, 0x032bfbf4558b1749ull, 0x08298cc95e7ec600ull, 0x0d180aac31282384ull, 0xf62d7240743c744dull,
+	 0xf05cdb59cfa620cbull, 0x61c8ce2e67659071ull, 0x6e329e90aa983581ull, 0x8662bfb40a7e2bb5ull, 0xae70361d4e5b842aull,
+	 0xca155a981f48b4daull, 0x329230ca7d1836feull, 0x108dbd57cfc2667eull, 0x58d5558217a9e60dull, 0x5fe0821d9b36ac96ull,
+	 0x978a2a4f44f47468ull, 0xcf906fc0ebcff98dull, 0x77e72d124d47f0e2ull, 0xa1c246352724813cull, 0x639a8942071992c4ull,
+	 0x0eea5444913df185ull, 0x8fddd6e9a7e93189ull, 0xce322ae69941d073ull, 0x6e18e16a6036d2d7ull, 0x957e39007f04a801ull,
+	 0xe451a64c15acd30dull, 0xa896c3532de5bc2full, 0xd7edbdd125134120ull, 0x4070796202253981ull, 0x7d1ffc416f6872c0ull,
+	 0x8672ab9932f58077ull, 0x0dbedfbd3e0ca597ull, 0x6fa77635e48e6ec9ull, 0x6192e0e53d7be6f0ull, 0x04ea6c1026eda863ull,
+	 0x2f5d2878a9e6b6b4ull, 0x9e611820b3cce3b5ull, 0x8a12440dc9a19a8full, 0x4c31e856976f80a3ull, 0x2f14f746a2d043bcull,
+	 0x3970ad1bdbcfd335ull, 0xb2427b3e5ec7a6a9ull, 0xd07cff31ddaeeaabull, 0x107241aae05ccabdull, 0xe1d6ec642d9b4370ull,
+	 0xa1a36a37ef12a737ull, 0xf41d13d953c7b1caull, 0xaeb843e7948ee432ull, 0x5d25e2022848fec2ull, 0x10c8836ae87e3251ull,
+	 0xe94e96166159a208ull, 0xecfb2f3c80aab04bull, 0x9decdfe45d7a7bcbull, 0x3a3ce3fe28bbd028ull, 0x65c5781964a2f000ull,
+	 0x9d7e50a24e48c008ull, 0x08b9fe3d9f716ae1ull, 0x0fd406a6ab878b95ull, 0x5e192aa1e4b243deull, 0x7953747be6792432ull,
+	 0xffb32c9cdb1d0174ull, 0x1bfbd0d83a611416ull, 0x1f0aa7aaa3d412baull, 0xb31686cb828353dfull, 0xde0bf4f4d089522bull,
+	 0xef9b5a6ea55a8a13ull, 0xbda899c5ea21dfcbull, 0xfd4247a6cab59e6dull, 0x9fb82c7a1296a066ull, 0x44535d86f5709c46ull,
+	 0xe1ea7eddf4739aa6ull, 0xeff5ad9921934881ull, 0x1858ef72dbe32d2cull, 0x2217ddae468ce6c9ull, 0xf4d3678c08ad8b02ull,
+	 0x7751a80eb7773ea3ull, 0xec85c6cf46a6a39dull, 0x5a20e175e689e15dull, 0x5c8902f02cf31119ull, 0xefb1a72a7054630eull,
+	 0x156ed2e57e08573cull, 0x5286b3a8f4fd3302ull, 0x20fadc1e036ff9e3ull, 0x2973d72e3343443eull, 0x2292618711ab2fe4ull,
+	 0xfdced56e43f53a76ull, 0xa02738660d09be50ull, 0xb1984ae2f41e1792ull, 0xe98794dd799e596dull, 0xe7766f13b640ca02ull,
+	 0xac42bf63c7a33eddull, 0xb03c40b5be9a2266ull, 0xe084f138ece0606cull, 0xf4ae931fcc8d8d59ull, 0x5e5432d22715f837ull,
+	 0xf71d3113742bb9dbull, 0x6f40cbc9253dd033ull, 0x35ee0750cb3b87c4ull, 0xfab6acc9542541f0ull, 0xe07ffb7c5c967601ull,
+	 0x2a0aa91a821ccd2full, 0x15c096875a7a870aull, 0xa1dba89f3e95d79full, 0x3e0d639bfb085071ull, 0x0d8cec029bc0e928ull,
+	 0x2e8f92cf47846e11ull, 0x6c2dd78628185468ull, 0xe3bf9330bdf66404ull, 0xe3d4931704e8db80ull, 0xbaf564de6d724ee9ull,
+	 0x7309fda9d822a483ull, 0xd2c79236a33ceacbull, 0x9f689719cef2b79dull, 0x3ac2f3f6b63bac51ull, 0xfc784310e7a07963ull,
+	 0xed47ab94d5cc45e9ull, 0xec8e1a912046ed0bull, 0xddb3f203553bbe4cull, 0x38448782dcbb7700ull, 0x193842391abf96f2ull,
+	 0x3eb9ca2f49af85b4ull, 0x860474f5ecd61d04ull, 0x07180bca0dc45f4aull, 0xac0d08ea195b0a35ull, 0x9c5f3ce6b35e255cull,
+	 0x766427ef8de5bbeeull, 0x4a902756532b3d22ull, 0x23042c80c6e72bb5ull, 0xaf59f265acb4da69ull, 0xd9628a7546b14db0ull,
+	 0x1cc135b4bf55208bull, 0x40ff307aee42a941ull, 0xaa71959c8ecdbe0full, 0x33de2b0c4d48c518ull, 0x093cda568646b388ull,
+	 0x3c7d82c467f4297cull, 0x79c2953ba3926498ull, 0xfdd22805313e301bull, 0x49046d6e71b13163ull, 0x31d00a36da70c361ull,
+	 0xad4077235c3bf132ull, 0x20d2bd73a8c59b42ull, 0x974b0af11ba4c91aull, 0x608d6e122095079dull, 0x8bfcc1bf02a98dd4ull,
+	 0x5cc90c3589f3cc05ull, 0xda5355bf5972c384ull, 0xb0516a1cb5fb97d8ull, 0xc1c64daed1ca9d78ull, 0x5a292f980d408415ull,
+	 0x8218c0a019fbb180ull, 0xa37273d10f36cfbbull, 0x45b0594e326be194ull, 0x02511140e59cf262ull, 0x982b343c60b1ce8dull,
+	 0x187d5e3c3bfa9ca9ull, 0x2516d6541aec64c5ull, 0x2c84b88d3282b58dull, 0xc0aa564985029849ull, 0x584617b779c62964ull,
+	 0x4df487a9908e4210ull, 0x8718e6bae4b65a70ull, 0xdda09a2c82557c5cull, 0xf74ee84c3b668b75ull, 0x5545909a4d9333f5ull,
+	 0x69fb2035af057cb6ull, 0x4f90c6e0ed6905b9ull, 0xa449aeec7f483383ull, 0x534e41fb8c406304ull, 0xf4363e298e717de8ull,
+	 0x2b4678760a6dfff8ull, 0x12e106b8388fac5bull, 0xc280098073ecc552ull, 0x86d43c493f7c81b8ull, 0x7da07fbe69d0ebd8ull,
+	 0x99f76fdceac03366ull, 0x8541b2a8e0b6cf46ull, 0xff7c5e258d0ae2dcull, 0x852ed1702c9c64fdull, 0x92aa6bb59d60d9ddull,
+	 0x7597f36f88c78469ull, 0x5b43dd1b9d19a7d1ull, 0x431767bc0333df5dull, 0x82995030a5c21173ull, 0x26b201ffdc85cd2cull,
+	 0x2e8cae14f7fb1ac9ull, 0x4b83def9bb90172eull, 0x950b94707d484251ull, 0x0d95ef4846bc56ddull, 0x74a74aa0ce868744ull,
+	 0xc89c5f9ac2d7227aull, 0x668b6b1a7b05172dull, 0x680bb57b03260eb9ull, 0x3df5b66ed0568896ull, 0x2e18a31ae4e91e05ull,
+	 0xf4c4e087d6cf65acull, 0xdcd083fda5213b93ull, 0x1c7ca2ea25fd8447ull, 0x7676f72ddf941c6cull, 0x8e77dc80d66dcfacull,
+	 0xe23957acf0770581ull, 0x79d179be7e79650aull, 0x4610f5613256bec2ull, 0x000b2bab4cd79417ull, 0xce6c4aede4ee60b5ull,
+	 0xdce9f78b766ec294ull, 0xa9d6687720428aedull, 0x564d249d211047f1ull, 0x1f695614610cc2d2ull, 0x272f03e9efe086c4ull,
+	 0xcda27aec05be509full, 0xa633ebe18f4b356full, 0xaa4551d88abb4d33ull, 0x7bb456f99f91ec76ull, 0x2af9f2019688bc06ull,
+	 0xa4fe4e4416659520ull, 0xd6ec73fea3024d2bull, 0xcb038cbdedd9605cull, 0x0f8785114c6e60eeull, 0xc650236add343a29ull,
+	 0x2af1436478575841ull, 0x079532785aa0b6acull, 0x99c4aac34c7e721eull, 0xfd4f57abd8f923ddull, 0xafb14d8fe4d6f036ull,
+	 0x12132f5c9e3cd07aull, 0xf3241b880b6d85b6ull, 0x4ad7d108ce69a79full, 0x51409016d885efd0ull, 0xeabb362a2cae104aull,
+	 0x7ab3b12ed7c3f7feull, 0x58f7c6342d353829ull, 0xb00f8920ab8304c3ull, 0xb4f54d7ebb842224ull, 0x9833979be1f1faabull,
+	 0x2893afd629145ff3ull, 0xa40b459ead50a226ull, 0x3975b903cf957a84ull, 0x2a9e3567643972f1ull, 0xb497af549944e503ull,
+	 0xda117ac6bf2bca83ull, 0xe0406925a97994faull, 0xc224357134de36cdull, 0xe09f14244b59a681ull, 0x004a326df68429bcull,
+	 0x0a3233409bb78676ull, 0x3ce9b95b7e0b9575ull, 0x718770b092d0f77eull, 0x05337158a274ef97ull, 0xf9146fd27e24dc03ull,
+	 0xb69969b3e9a80addull, 0x54dca6cd50ba88a1ull, 0xbe4ca015e78c06d1ull, 0x9ab30a5020f93a07ull, 0xc107c270cf9a0ecdull,
+	 0xb436cfac5ab86064ull, 0x1dbd4e870328d074ull, 0x6055a0cbb9c2bc83ull, 0xa83f010e6a4cb9b7ull, 0x8eb081dd4736695aull,
+	 0xa878731e2aa7788bull, 0x92a153fa8cdd2b68ull, 0x899118861989bc0eull, 0xafe7266e2bc36cd4ull, 0x573c186854031029ull,
+	 0x28d8008d131f0898ull, 0x8fb682be1711865bull, 0xbbf92a263ff7c96full, 0x621aa6e0a435d816ull, 0x0fd012384591a7e3ull,
+	 0xc77f921f7603bfacull, 0xcee7b6a489619ea4ull, 0x79136436a832f474ull, 0xbe3c543a6769d7dcull, 0x61f6a193e43687c1ull,
+	 0x0d8c46ce1097315dull, 0xb5a96fd84ac08f3cull, 0x2ec9a163ced420f8ull, 0x4959a995a22ab0d1ull, 0x0656ba2b2f783d23ull,
+	 0x96914b44af1e4b82ull, 0x4c85612297fca566ull, 0xad30ee6a3e784045ull, 0x61e284a484925e97ull, 0xea1faceb34ec2807ull,
+	 0x464ed4a7d1076b32ull, 0x85eecdd8659ccb2bull, 0x15535044f98d869full, 0x2598da84e4a7656eull, 0x048e4fe374b4dd62ull,
+	 0x07a18c9757cb7af0ull, 0xf75dd2cb428cf078ull, 0x4533200d4f4d39abull, 0x068db48c6c21f981ull, 0x7635920e2f10e336ull,
+	 0xd114b0cc67486261ull, 0x8a12550c9e275b4eull, 0x251c8d45a648f29bull, 0x875791f9e9ff18b5ull, 0xdc2a919bc55621aeull,
+	 0x88664f7cca4889aeull, 0x468fa5ad6d2e397aull, 0xe325db32cff422d0ull, 0xc9e7253df38fe35dull, 0xf50cba6378239579ull,
+	 0xe85201ecfb151c22ull, 0xec6a064eddce5353ull, 0x8bddf3a498d8aa45ull, 0xc87de27240fec81full, 0xa80184daa02f13dbull,
+	 0xdb3071fab7ac3c53ull, 0x8d8bd35ee9eb7a4eull, 0x83e7a65267448a86ull, 0xd702f41a8982b82bull, 0x509e08d4c3f85d34ull,
+	 0x808d231c032f1b74ull, 0x0accc480ecebfdb3ull, 0x8ad102a7e0c3e4f7ull, 0x847198400f22d1d9ull, 0x1cbfd9c78c5de428ull,
+	 0x63a8f181fa4c3a87ull, 0x6d1f0d1b665f6619ull, 0xaf52ee346564d9d9ull, 0x11be1ed88032f8d0ull, 0xe0c686bfdf5c2aa0ull,
+	 0xc8de2c4785b3da53ull, 0x9aeeaac3d723887aull, 0xf705cd13fa45ed5aull, 0x7785e50862bd124bull, 0x1608ec1a217a3ad9ull,
+	 0x4e35c1a6bd19ba28ull, 0x12273850f2c87654ull, 0xad0143947517cdcaull, 0xb89fbba2915c5cefull, 0xe17dc9b6dfbdff4bull,
+	 0xbe73b03436927a4full, 0xc9565505f63b5f9aull, 0x39d69c147741ee84ull, 0x69b985e0759a8777ull, 0x5fe29958e88fdd6eull,
+	 0x1183e068374343aeull, 0x363af7d34fa16056ull, 0xc510af6679552b18ull, 0x31fb484ce6a26fc5ull, 0xb1d4570f6ac776ddull,
+	 0x5ce19df71d337e0cull, 0x60fc4bdcdea0ec9eull, 0x5264e06d31a56174ull, 0x6010554803a297eaull, 0xead4e832a02abefcull,
+	 0x76e7215c0cfa13c6ull, 0x7a17f619de3a2b18ull, 0x74149792c65f2e34ull, 0xbd76d4f49857e633ull, 0xc317dfb4175c6582ull,
+	 0x8d536c6c5c9c0949ull, 0x5d8124c7f7637668ull, 0x2793a3a4111469e0ull, 0xdec346aa2f339b5cull, 0xbc2beb958b6c1773ull,
+	 0xb924e8241e84eeecull, 0x04bf0e8a7e50b1a0ull, 0x0e5665265db8d551ull, 0x1eaa041765361712ull, 0xaf8b8ea763302556ull,
+	 0x91f8f2917feca6f9ull, 0xb09113505029a671ull, 0x9eba04129e26b882ull, 0xead6c1c51a3d2e77ull, 0xf69fece0c888a6eaull,
+	 0x965285f899e298c3ull, 0x7ea66b94aca0da68ull, 0xa6e228a1fd6ac1e3ull, 0x9289af2e7b2b8b61ull, 0x80ce395aa25539a1ull,
+	 0x5452e975bc56d989ull, 0x4bd75433186180c1ull, 0xefec69fa491d1a5dull, 0x665ff3a856a14a98ull, 0x8b9ae3d8ff01e1c9ull,
+	 0xc0b437fbf555fcccull, 0xf3d072b234a15e70ull, 0x5fe1184d3c814e9cull, 0x08da8db91f941152ull, 0xdc5fa8de6a6094eaull,
+	 0xcd5e41fb9193f665ull, 0x7c80d0502f4325b7ull, 0x4cc0f9e6e4c8eceaull, 0xd11325ca72ff2226ull, 0xf7bdd178c38953f1ull,
+	 0xe127a5009b064f53ull, 0x9f41b654864a74a0ull, 0xbc8666cbb3239154ull, 0xc71fe11e793a437dull, 0xea21f2af3ecbd60bull,
+	 0x0c56b88933c2cccaull, 0x2c02e136c3b3a99bull, 0x6399729ae83d23d4ull, 0x0d30997c484ae0c0ull, 0x6f8baaabaa3c28b0ull,
+	 0xd8e1998d28ba1cd3ull, 0xe6e98f27380141f7ull, 0xd04b82bd2d4dae48ull, 0x88ac358397f671e0ull, 0x1f33f1e344c59c82ull,
+	 0x451c6a0ff93a5e01ull, 0x42b0340ddf4865f0ull, 0x3a26828ce5343f08ull, 0xef35da7b80b1e3e3ull, 0x3a01c47ba4ae553eull,
+	 0xb79a8f7d7ee03802ull, 0xc1f30c62f8c32343ull, 0x4afe2f8e115154fdull, 0xbce3a1d082104767ull, 0xa54be5b3ef945bfdull,
+	 0x4685c629be00fccbull, 0xf663a1de15c1e97bull, 0xc8e35ab7cb9c655cull, 0xb6ff83ed7e9eaac8ull, 0x3163fcecd6d55b2bull,
+	 0xa6431730c54df43full, 0xbf2fbe6ee672a077ull, 0xa2807372be0ea2d2ull, 0x426d6b733234a59dull, 0x0b33d7d7aa5bf048ull,
+	 0xd5e486abb311f3dbull, 0xb908a8c4b580944cull, 0x47b09f6250bfd99eull, 0x3ccf54c463baad0dull, 0xd36f5bc5ab2a67cbull,
+	 0xddb6c38d34a8cb10ull, 0xd53879702297e204ull, 0xe7aac18db93d3593ull, 0x8177f3dde4a0907aull, 0x89b7365bdcb00f08ull,
+	 0x1f29834f4f31cc24ull, 0x468700f609d3162cull, 0x867bd01d3cc3153cull, 0x714b6b6b496d1fe5ull, 0x3648998266d3f0edull,
+	 0xb39581697c1c3366ull, 0x8258f85db9987cabull, 0xa04892f4f3dc7c5cull, 0xe1ffdb8625ee4181ull, 0xe783ddea602755a2ull,
+	 0x2680b46357bbb343ull, 0x97199037fab91e36ull, 0x687c3ccc0fe70451ull, 0x1215ad0d9ff13639ull, 0xa2b0bdfffa06d6d1ull,
+	 0x57fb145d909f1520ull, 0x843a450147e94573ull, 0x8b9161d00ec85b8cull, 0xe8509a1afd729a9full, 0xeed5a3d71d63c948ull,
+	 0x68f1610725e7b135ull, 0x18624e4099494c99ull, 0x3bf27c7c505b692eull, 0xb682757af3359ee2ull, 0x0cafcc187f46e353ull,
+	 0x0b3c5d30b5e815b6ull, 0xaa821bdd2aa9f31eull, 0x41d92872396d3a84ull, 0x3f34a832e77972d6ull, 0x1adf1ee3fdfafa43ull,
+	 0x3217f036130a11b4ull, 0x5b57aa1838cc003full, 0xa6e8b0190d95a954ull, 0xad6e00e3e532ddf5ull, 0x5b5061a0d99f9cc0ull,
+	 0xd0622777d78bd8fdull, 0xc2276a892c41c803ull, 0x752db944b5242339ull, 0x449c464e0092fa05ull, 0x057284be4c400796ull,
+	 0xa5d57f42b752d837ull, 0x776e10b6762b3c55ull, 0x92ee9e9040126b15ull, 0xabc964d13a72805bull, 0x2a8b489aa88142b0ull,
+	 0x560938b3c131b8e5ull, 0x83fe5b3f83204be6ull, 0x166b5c6ed81328aeull, 0x130e9eec9570a052ull, 0x91fa7e84a48f0896ull,
+	 0x748bf24d6864c893ull, 0x9bab1763e4c8e889ull, 0x5c79d01668c07d2cull, 0x65813ffaa97286c9ull, 0xab49ef66dd80877cull,
+	 0x18be70376b3bdd9cull, 0xfef972ebd67e25d1ull, 0x21c813f0fbf9f60dull, 0xebcd85abdee943a1ull, 0x4705ab11e9242f2aull,
+	 0x8de0be820666075dull, 0x1ebcef4343662f85ull, 0x81dac261a4d9b9a2ull, 0xb0e265312f305649ull, 0x37415c8e6f3ffd7aull,
+	 0x9602b36a6561097eull, 0x27e27a8f5423145aull, 0x8530bfa960fda766ull, 0xa8848dc237c3a172ull, 0xe0a3339bf39c0a52ull,
+	 0xfe0a7c410752fd50ull, 0xd490e5d8b79d1543ull, 0x753f595b35ad0ba0ull, 0x92126e22bdde783dull, 0xebc4234bdffa5691ull,
+	 0x71f30035b1284a6dull, 0xa351f681f792181full, 0x70b85312bbe99e92ull, 0xe06c420de20b4aaeull, 0xd71d24683df0cbfbull,
+	 0x904e1906a4d19774ull, 0x77bd92fc972af25eull, 0xa3fe2c3b4a533c6dull, 0x361ad21a30970ec2ull, 0x134feab0acec5c3dull,
+	 0x2ceb1ee1306df1ddull, 0xd15d7629d7ece126ull, 0x1839294ce8479e65ull, 0xad952b180c26c4cdull, 0x5045882bff2585ffull,
+	 0x2d067e3a10a9cc77ull, 0xb5b95bd803ddcc59ull, 0x19ed0c56c850f381ull, 0xaab61cf3453ccfccull, 0xfcd462cd25bb3c98ull,
+	 0x319ad12696ab93ddull, 0x33bfdae3a4be755full, 0xb3ac1377a33e8338ull, 0x4cf286900e8c2f99ull, 0xdaf9a82d9468a42aull,
+	 0xd21068dda8b1e6bcull, 0x9c3fa8a51d87020bull, 0x17d465dd79da8472ull, 0x04143558e92659fbull, 0x0943de8dbe85e5a4ull,
+	 0xe87a825f775e1dbbull, 0x773d9de2215e219bull, 0x1cb18a9ffc44d3a7ull, 0xeabb43453db4a837ull, 0x19e12eb216de9e4full,
+	 0xa90f107dca02fe5full, 0x29d83136d77650b1ull, 0xf77e1dc21f75af6dull, 0x92f127a4531d93bfull, 0x272f20e5c961edbbull,
+	 0xe18ac20ea77a5769ull, 0x5bc74ce2eb1be374ull, 0xc7ebfbb8fb862a30ull, 0x3d1a9713e465e8d3ull, 0x0e49beb4542c1332ull,
+	 0xf2148629b8cd4039ull, 0x36f191cbb1b8b277ull, 0x7e725fc5a9c87524ull, 0xe59386ac2fcf0c89ull, 0x716cca8fa662e33aull,
+	 0x6a2ac92ecd1d3bbcull, 0x7748198cb58366b8ull, 0xf8074c9f67cbe279ull, 0x3180bb37a88a9a0cull, 0x4e81f2755419e7afull,
+	 0x83d70e9edddcf806ull, 0x6fd1609bca2971afull, 0xa32d764d3dd3d66aull, 0x49552ae98d2967dcull, 0x6fd1bce467135e59ull,
+	 0x01a09192e6e78421ull, 0xbfb63c530209ca33ull, 0x1ee89f9ec3ac04b1ull, 0xc59818d535a32d72ull, 0x8b4eb43c5a8eecadull,
+	 0xce6338da9f96d593ull, 0xa721d12f20b3aa72ull, 0xc13f717d2936a42full, 0x9b3df470c467d86dull, 0xe8257d0162d7526aull,
+	 0x311c7cf5972e0afcull, 0x119a38c98a31c2c9ull, 0x21af94fbe941b008ull, 0x27bb42840e96d31full, 0xdc8612b181aa47f5ull,
+	 0x50ac743d0b99fd35ull, 0x2a5d360a9a927295ull, 0x31ace262666b2565ull, 0xae21a68de35de5a5ull, 0x6dc8424037b79af2ull,
+	 0x6c14b36336808decull, 0x04eb5bd6808d7f1eull, 0x99e4dface3a3f9bbull, 0xe273c318a91624f5ull, 0x1000c97e36e00b9aull,
+	 0x42ff84c2850ff4a4ull, 0x833576ba2dc580b3ull, 0x0a785b0dad034bbcull, 0xc5b50299cfd7179eull, 0x48505c4ce429eda4ull,
+	 0x3064efab59b0e3ddull, 0x694d41c71094d44dull, 0x3892da958e2ebe6eull, 0xdb93788a7dd0684eull, 0xed7eda156628523bull,
+	 0x6d379b47ed51101full, 0x5033110ed00f7dc9ull, 0x5a5b791f5347e98dull, 0x0fffddb6133b3093ull, 0xf561a3e11806d97aull,
+	 0xb6017ce07f29f379ull, 0x763b5095f74388cfull, 0x68a3148caccdf881ull, 0x368a7c521cef8de2ull, 0x0823810507c43a26ull,
+	 0xb5522bf506077d1dull, 0x1d2023795a9683d0ull, 0x6e74c27184843277ull, 0x2adf59832519495full, 0x515048e05080cb8aull,
+	 0x930ccbe07e8f1e29ull, 0xa8a3ccf7b7698a23ull, 0x57050cfd0bdf264aull, 0xfbff64b3f0bcd08bull, 0x3da9577408570080ull,
+	 0x12e027fc598b0913ull, 0xa8ec4d41be8ea76full, 0xa682db6abce06c38ull, 0x0b6b4339d1176a33ull, 0x7a8051354f7a9a02ull,
+	 0x6e10bb22c5aa37d7ull, 0x262bd92ee62bea3aull, 0x5cb76b25b7acfe02ull, 0x53dfa971eb4d4a9eull, 0x9f72aa6fc5c23e5bull,
+	 0x8121220e77fa8a52ull, 0x70104b9f191e828bull, 0x6f6213b791743718ull, 0x2d44af60c294f6a3ull, 0x2eb07b70695f768cull,
+	 0x2e9307fbf1fe7bb4ull, 0x34d14080bae73458ull, 0xfb23c284a75b0b14ull, 0xeef1644c9ef62520ull, 0x4fa98a8fe4356527ull,
+	 0xc8e3549dde716a12ull, 0xf43572020f954984ull, 0x73e029c249cef542ull, 0x0dbbb61d675135a6ull, 0xe4fc551d574338f9ull,
+	 0x45abdcc19cb806c3ull, 0xfe50e6990120da79ull, 0x4ca7d83a156dc302ull, 0x79edf5f184f9b58dull, 0xb511c3b7f10716d8ull,
+	 0xcebc702fd38bcf1full, 0x7e20813b6305f44full, 0xb06e42b14c88be6eull, 0xe9df2566a878a6acull, 0x3447637c57306888ull,
+	 0x292a01489f54be7aull, 0x98d495312bda9721ull, 0xb58bd94aad29af60ull, 0x26bfb00991abdc0aull, 0x5e56f2fdb750427aull,
+	 0xf1252df2f8e651beull, 0x7ff70dc916c6440bull, 0xa4ac33835b2d6502ull, 0x60ebdceb98e84b0full, 0x0c2aa4125ee0bd7dull,
+	 0xc64e1c11cedb8685ull, 0x15ae07f7a1b28fbaull, 0x046591a15dbf2798ull, 0x8e3bb2e37907d34eull, 0x0ccf7a044a622becull,
+	 0x2e2d8a4dcbb07a2cull, 0x6f16b7ea33ec08ceull, 0xc7e6f3e49cb23785ull, 0x7535fd79cf51c5f2ull, 0x1401ee5989a8a596ull,
+	 0x3e1079b73c0455d6ull, 0x8f1634cedb1c246bull, 0x037b6fe32f4aaf11ull, 0xc4ccffb7f4905823ull, 0xcc547bb12145fd67ull,
+	 0x5f1c334e80e99742ull, 0xb30552951b823f79ull, 0x2725f1a21084beabull, 0x40c1b782f34c38dfull, 0xc66aa5157c9d1d25ull,
+	 0x44947003a576dc2cull, 0x76468520730770ecull, 0x459ba6153e857e3cull, 0x92dc1317589e678cull, 0x1696e37bfbcb84daull,
+	 0x8117f1a4f7340765ull, 0x2e60c72b220a0bb6ull, 0x7f4703f45fbd4cd3ull, 0xc2f9d181e167f338ull, 0x6c4bd42f5f1ce273ull,
+	 0x057c3da0cfb2337full, 0xc038bd353cbac7e5ull, 0x6ed13ffbb1081fa3ull, 0x53862f630079f0eeull, 0x89d63f1199bdd27cull,
+	 0x885043db6df0bdbcull, 0x0f9cb483ff9f0be1ull, 0xb8ce996a37581bd5ull, 0x70e8c4b9a56949f6ull, 0x9b2ce0e0dbbbdfe4ull,
+	 0x44d7885f7c1cdd21ull, 0x062f33dee2921c9aull, 0x6fc1e02cc0c2995eull, 0xb76a6e260ab647b2ull, 0x5fe2c8de2d17ef29ull,
+	 0x4c0204fc25bce466ull, 0xe81b9992d475e632ull, 0x3543b2393690fb27ull, 0x284dc6739606dedbull, 0x3906f7ac7097fb6dull,
+	 0xdf97d1f3f473700cull, 0x053f4a4f31924f19ull, 0xa12ed00049f699b9ull, 0x982ebfe54d571663ull, 0x943bfb20d57fc3aeull,
+	 0x011be7f8d84f5135ull, 0x461857732794f971ull, 0x3bd936ad895f0d2aull, 0x03b51b6c68f14692ull, 0xbdb74c268dd09052ull,
+	 0x8a167655d6b1d234ull, 0x95190ba0284806a4ull, 0x4f7bd8410ad33399ull, 0x8d36102fbd4ef275ull, 0xfaca5c8a2b2abc80ull,
+	 0x3eaa26b18028d668ull, 0x595370bf1def4543ull, 0x002bc240b0515b31ull, 0xe9d55ad589e3cdecull, 0x7d939599a5636cdbull,
+	 0x1eff027fca7ca5deull, 0x583f27e4a2e2287dull, 0xae3c8a0a9eaff171ull, 0x6203e6d3f8dc8f74ull, 0x0d8a05b28e26c6dcull,
+	 0xae60382a95107c20ull, 0xe0d7df8c9ba1dd7bull, 0x26384dc0ce4a4d16ull, 0x7f10046eeb739f4dull, 0xe44883c8005b6f18ull,
+	 0x3e2449696131980bull, 0x7880f65698f5b513ull, 0xfca26bd5cd952092ull, 0xe6ff83a8b3c62088ull, 0x8d69f40f4373ad39ull,
+	 0x4a250b17082d374aull, 0xecaae3a1111a0a8full, 0xfec2029f74649981ull, 0x7b3aa894342112d5ull, 0xd0d372be872e958eull,
+	 0xdcec656b002dfbc0ull, 0xbc582f6eb053f20eull, 0x9f1875a2b8398625ull, 0xdf8b379087b78b41ull, 0xa1c6252874763c2cull,
+	 0x586a334be98e67a0ull, 0xc5a168fda7af3649ull, 0xafd9a4cadd4cd8cdull, 0xd3303dad37bed330ull, 0xaa71eb8ccde569b9ull,
+	 0x17762319298f8c3dull, 0x8c205795c4d7d4c6ull, 0x6b63f646ffa1878full, 0x7f18dc8f7c04c1dbull, 0xbe7c57cc90cdb233ull,
+	 0x707997ea370bb0f9ull, 0xf4eb9261666b7498ull, 0xb83547a54bf58c8bull, 0xb61abb5930762653ull, 0x69c325d6051314eeull,
+	 0xd5be4f7c7c61a1b9ull, 0x8bc2dc8ad5869c3aull, 0x2aa425253103b8e6ull, 0xa2d053f6813cff1eull, 0x7859ec9008360901ull,
+	 0x39ee154f737f98feull, 0x2ce9314d6c04b1c8ull, 0xc09acc7d9b943153ull, 0x163f1487b47cfe97ull, 0x67164b53c23f11d5ull,
+	 0xc3dcb016852fd7fcull, 0x075ceeac813f4f4eull, 0x0cfc2d9d712f06a7ull, 0x44ffec3ddbc34500ull, 0x5e52d376321d7e07ull,
+	 0x42a069f1456a6286ull, 0xd6ea197869f7b1f4ull, 0xdcea33584e6a5369ull, 0x61030cfffc21af28ull, 0x84b44bbe6c874965ull,
+	 0xf769da5ea02634d9ull, 0x3e25bcac808c5792ull, 0x35fcc39356028d3eull, 0x07dc0c3fae86b98dull, 0x173ff72fcf9deac9ull,
+	 0x59d0c0d1308e1f3eull, 0x121c474eb20f7298ull, 0xebf7ca7b80e5f0adull, 0x674dce3118cbad9aull, 0x2c3eb2f0c917b76full,
+	 0x23b7adcb6804473full, 0xb901b1fbb325188aull, 0xdbc1176deabf7d2cull, 0xf26542afd977bd1bull, 0x141eee44e4708698ull,
+	 0x15eb2081273a8fc4ull, 0xe2c4424a55f12d63ull, 0x9840675106734b3full, 0xa94e1f36d20ca9d0ull, 0x373797a72752cf11ull,
+	 0xbd6c702f81769beaull, 0x5f23b8fed4cd377eull, 0x159ea250e81c89a9ull, 0x0857d54efd34f645ull, 0x08069629f0031abdull,
+	 0x74f40299fc4635cfull, 0xcffcb9c0322e3640ull, 0xba90114bbb45c3aeull, 0x843b473b444a6d7dull, 0x93df6f6b1244200full,
+	 0xb7287403d5999c3cull, 0x00eca14b4291b575ull, 0x3beb43d5ab4bedd6ull, 0xaf627cbb616a8841ull, 0x649f9df1ce56c7ebull,
+	 0xc294beb3657f3a68ull, 0xd92ce2131e6a3d4cull, 0xfb4dd2bc46f61b67ull, 0xf4edaade7c1d82bbull, 0x7bcf54af2669973bull,
+	 0x91e83935538e5cb9ull, 0x99ce496f400aafecull, 0x7d8e4b349855d67dull, 0xcf760937f0d1b579ull, 0xded7f4d76cf73523ull,
+	 0xcc5cdbeb16f1088cull, 0x2e1814e861411846ull, 0x0b296eb5b8300702ull, 0xad669139c50ffc2eull, 0x3e0fc5ab41c7d437ull,
+	 0xbb389da9a1dbb4baull, 0xd45216ffdc1d0e63ull, 0x6ce8ee16f6cde43aull, 0x528e0d70bcab99c8ull, 0x5a5c117f1f7e5d4full,
+	 0x02c932ddf1073cd6ull, 0x2d951cc01c21d721ull, 0x7d9344ce81d49bf0ull, 0xa8235e7d286c416bull, 0xd803522f0d4225acull,
+	 0x53a0dd5da43cde73ull, 0xe139af4426f345acull, 0x1418ea51e7f9932bull, 0xc15eae3877fafba4ull, 0x948f2e681623b6c9ull,
+	 0xdf00de2269b28b70ull, 0x60f2a3c040e5d3d7ull, 0x9999f0cf82eeeefaull, 0x379e428df3f9cd19ull, 0x42a614147a901356ull,
+	 0xce002f80a8f15d53ull, 0xf35e6efe9d714419ull, 0x3749687b5639764full, 0x4b12540ac8adb647ull, 0xebffb572529d0f71ull,
+	 0x99257f763a72f5c6ull, 0xfde05b65da45c15full, 0x9ffc1b55b72d5705ull, 0x9790d1280cf21f5bull, 0x5bc15bd08d9788f7ull,
+	 0xcd703a4cd4ab08a8ull, 0x53c4a5ab5c8adadfull, 0xb1684acb5223fcddull, 0x4e1d9b74f9c04e76ull, 0x55ca640c0b29611cull,
+	 0xb1823dc92b1df30aull, 0xa432936dde925cc4ull, 0xc379627165e30f10ull, 0xdfe5103a16204d21ull, 0x20e7cc81e33a5f23ull,
+	 0xe5611781b928658eull, 0x553e455a783f9423ull, 0xeeb53a2c1d6f5014ull, 0x56ef7a364172ed24ull, 0x6a9e226893f7b4a6ull,
+	 0x9c23e5a15e52c192ull, 0x1d31a67d85c4ad7cull, 0x2964d24453db5a3full, 0x00ad07b5a658401eull, 0x35d41585fe1a73f6ull,
+	 0x5e2d7b3b9acabb07ull, 0xe61dbb299328b888ull, 0xf376df5918c98fc0ull, 0x308dbbb4c55722fcull, 0xc50a751b7b39b785ull,
+	 0xc288f4963771ab2cull, 0x7695dd66861ce153ull, 0xf23a2e2679351431ull, 0xa8d101df3e1a88d6ull, 0x98c4274db0e23d68ull,
+	 0x85a87707f9922315ull, 0x3ee5a90132d43bfbull, 0x3cf52d4d047d08f9ull, 0x632dc6e0bca25838ull, 0xaba7ff0cadb4aaf1ull,
+	 0x38bf2a40b3a8f431ull, 0x52ebb6ba1f2c3c4bull, 0x4c781e55f5aff026ull, 0x7892a6971bee361aull, 0x429034988a4f03b2ull,
+	 0xb300ef2922d64151ull, 0x9696a1dd1741364aull, 0x8f4319b5805d0745ull, 0x0f2edbaca3ed5349ull, 0x70dcf958845d2a63ull,
+	 0x89322de4387f0015ull, 0x97d335fc04fe552dull, 0x18195b3154f3b553ull, 0xcc3de92e6c0d1b51ull, 0xace64223a145cd15ull,
+	 0x8e796e68eca97002ull, 0x612cb0141d509006ull, 0xe175a46d98aa0c1eull, 0x70abedcae4b345e9ull, 0xa490743b0b76497eull,
+	 0x5105f6acab4f39c3ull, 0xf86f04eb2382d311ull, 0x70df4feccfb9715eull, 0x3cb1b13b00b32e70ull, 0x7eed42829ee2a4b0ull,
+	 0x8af82b664c26b44eull, 0xf5324f3d9e78afb2ull, 0xff4a4bdd13fdce50ull, 0x205f90f9bcd470b2ull, 0x373e217878762c99ull,
+	 0x41ef6d63bf4fe4a9ull, 0x390ebc8e959c6251ull, 0xe6df6be663bbdf2eull, 0x92dc7f62bde3c4a3ull, 0xee5163c1916942f2ull,
+	 0x63a7b09e12b2aeacull, 0xc48d0af353af20a3ull, 0x33b0077dad7b0f54ull, 0x06d3e80fea176e4aull, 0x774b737b40553735ull,
+	 0xc582b2d42b0f636eull, 0x931db7843161edfdull, 0xf53f8e218b29777bull, 0x19b21484d1863144ull, 0x43af9a44747776b5ull,
+	 0xd39c3674b6a641f7ull, 0x3a728a47f50d6fadull, 0x1279818011fec543ull, 0x67415270dd9325c3ull, 0xa0ba029a2f8d39cdull,
+	 0xab77b711697179bbull, 0x8f66e0cc09a1c9b4ull, 0xe3bfb5b828678743ull, 0x4bffc087cc9da21full, 0x31dc63ceb983d693ull,
+	 0xa3c8299cd57b1c7aull, 0x068d4fc45eac173eull, 0x7368210da1e3cc45ull, 0x37c8301bd1d79d91ull, 0x070b7cab52d52f14ull,
+	 0xf8a51fe208b52074ull, 0xb77abd876714096full, 0x69a4e5758ba0789aull, 0xe41c41bfc2666a81ull, 0x9d096a3f9e6ceb2dull,
+	 0xac95a146f684a53cull, 0x2c604ca6b620ecadull, 0x220bf65204dced55ull, 0xd3c3c624e25bcd2cull, 0x1419e1048e2edbd7ull,
+	 0xc487135ae5650fcfull, 0x205f981ba77e4864ull, 0xdc7e0393d9c21494ull, 0xe583c22ed787c5bbull, 0x8f03f3d43c7b126full,
+	 0x36739ce55a478f96ull, 0x6410e881e7d284b2ull, 0x0cb75da06c4b2d4eull, 0xbf5185be000df32full, 0xe41472f258dd10b0ull,
+	 0x936baedd993e041eull, 0xf6071f72bbfe9075ull, 0x84d9cf253bbb9419ull, 0x78059a0966c817afull, 0x8faa9ec53372d980ull,
+	 0x18ed91d22c060e39ull, 0x6337569c1b12caa5ull, 0xc13ac8f502f65e6dull, 0x8a5f94dd194a82f2ull, 0xfe80c5995dc74b98ull,
+	 0x7a289cd137602e1dull, 0xa7d2e1d859a4844eull, 0x207fd4defffce0c2ull, 0xfa0cdd522cf0596aull, 0xa14aece60984b2d3ull,
+	 0x6bc796ab132038a6ull, 0x976d48da07718656ull, 0x900ac99e437414fcull, 0xf466e11cf3be0e42ull, 0xc31068fefc14f052ull,
+	 0x71ec9e09b524d2a6ull, 0x73b76c240f16b7f3ull, 0x093730857b4b1d2bull, 0x7885931025ed4f90ull, 0x0d895ae0e85bd1ceull,
+	 0xd0855f115fb3bbaeull, 0xd16ddb9811538860ull, 0x886e2cd47758a208ull, 0xeb102a82e2d140ebull, 0xfbdd9bbf78d815fcull,
+	 0x8047c2c19efdddf9ull, 0x115e658336f709deull, 0x27e70832440e6c9full, 0xe2b89bf41da8b30cull, 0xdf4ef037ec3b6ddcull,
+	 0xfd5c51becaff6e8full, 0x0241d2f9cbf7cf49ull, 0x5194bcf348ac5c13ull, 0xd0299c454c0a07f7ull, 0x7eb0366436758291ull,
+	 0x41e90559a15a9959ull, 0xdc8463c9ed3a32f5ull, 0x24058a765ef984cfull, 0x35d83ccbdde5ec2cull, 0x9a722010b8175c09ull,
+	 0x54ed700e9eb42f6cull, 0x92ce66640c954a3eull, 0x488909f4fa0d2f83ull, 0x5459afe8b311eb2dull, 0xe10c88021913ebbdull,
+	 0x08df63a6c27fd9f1ull, 0x36d712c16d1b6f23ull, 0x798a2d9443289167ull, 0xdf6ef61921562bb6ull, 0x666385ea8ee830f2ull,
+	 0x1767702197a58749ull, 0x58b50391e80e64afull, 0xfdad7808d87e7ae8ull, 0x7722b02be012a508ull, 0x97668594a6ef31e1ull,
+	 0x99d43e7955ddacefull, 0xb5d8d20a5fac81c5ull, 0x626f465fd513c8f3ull, 0x7f561fa4855e6735ull, 0xf03638facdaa7dd5ull,
+	 0x894d1394b2f4fb25ull, 0xbf95e0942832e4f9ull, 0xd3ed070d3c799af2ull, 0x8b1d5cfcbdf1cbdbull, 0x694dc12e9243bbd9ull,
+	 0xad4188e8939a32b4ull, 0xb18e47055b2983b1ull, 0xa8e5cf7416be055bull, 0x93292b2b7b53c9b1ull, 0xedc1d5323ca72e83ull,
+	 0x3398e77c6d6cc7b5ull, 0x4e5d6ede8cb61386ull, 0x2ca88b0fc247ca18ull, 0xa2c8b839b8186ddcull, 0x294da4ebc2010221ull,
+	 0x925199705b730ebeull, 0x7f31a603879b035dull, 0x8aa8f7d53be823b2ull, 0x800f84e2d9c22007ull, 0xa3364cf74eb404ffull,
+	 0xaa20effb09ecbd9eull, 0x14b742baea24c61full, 0x14ab86a905f5f167ull, 0xafd0e7237af94e09ull, 0xede0600032210b60ull,
+	 0x823adafa38be84e5ull, 0x66ac0212508ff454ull, 0xce32fe2c5e7447c7ull, 0xf328cc28b3172788ull, 0x6aec0eb68b95dffaull,
+	 0x06466cfff3baf218ull, 0x7554905d0e29df8cull, 0x1359e80d540d7472ull, 0xcc4b8d155a1e3847ull, 0x0890d8e900fcfc9aull,
+	 0xdbdb4b5bda5a1c09ull, 0x4e540c7f866e0788ull, 0x53b97cdfbfbb9da0ull, 0xe545bcd569a58bd9ull, 0x8d404b2ff624551full,
+	 0x9c19c1cf4bc04a78ull, 0x18cd00f2d48fd82dull, 0x4266da28b7fa5bc9ull, 0x396b232b115c0a77ull, 0xfc9f479902e07b59ull,
+	 0x42fa6aeb6a9d5523ull, 0x551daa85b9562a29ull, 0x85acb2682e0fe905ull, 0x5a60dd39b20c94dcull, 0xc1ce4ee91b41432full,
+	 0x5669374f1163a134ull, 0x6e6d2fee726a1649ull, 0xda009444bdb039a6ull, 0xd5d85191071ed973ull, 0xccf8bf49e58f25b5ull,
+	 0xe8d414bbb174c1a1ull, 0xd9070b6673baf06cull, 0xd30ee3e70c31021dull, 0xa617c70a59b69df0ull, 0x07ccfb49d41a6e9eull,
+	 0xf99f6b4fab347190ull, 0xd53ad14efd3837f9ull, 0xa9d1e56ec03648cfull, 0xc58fee0cf113aea4ull, 0x53290763d39db87aull,
+	 0xa0c8c7986000c79aull, 0x67cb68da6ce7f3c4ull, 0xb0248fd827e8ce8bull, 0xe5e76b07210471c6ull, 0x4c669d4615ccd7e1ull,
+	 0x8ee4872b9481361bull, 0x0f915514a1d91a42ull, 0x182c5db50e2cfc00ull, 0x6b735380b5683b8aull, 0xe06c45e2cf28b3e8ull,
+	 0xd2f4157db9aa5ec4ull, 0x6d9a869fc8cd7ee8ull, 0x8eb2f08a0bcea12eull, 0x98a7825935c315aeull, 0x2886dcfcd3fb4550ull,
+	 0x87516b8737512713ull, 0xad95ca6765300d00ull, 0xbb77fea7eb813057ull, 0x437c3b24528b0ab7ull, 0x68b68b547afd6a48ull,
+	 0x93e5d837b930af54ull, 0x4168f8f404998b12ull, 0x042873a4cd930ce9ull, 0x7740487b8c1a74e2ull, 0xa62383ed47b31e71ull,
+	 0x0acf56d277640ecaull, 0x576b2b6bd47d0646ull, 0x6ec94fc9ffe0a46bull, 0x6c3926b27f0a6bc0ull, 0x725935220b70ad4bull,
+	 0x17b986610a10b0efull, 0xc9673f28f6854a0full, 0x0169bd615fe73130ull, 0x88bb4b0ee2dc0b88ull, 0xf23fd71cdf0cddadull,
+	 0x54adb26cf0c66675ull, 0x47bf1823c9a039c3ull, 0xbc722caf5e14237dull, 0x19d9085255351543ull, 0x1a1c6e93f4b5ae0aull,
+	 0x7bf08e0ab18bb4beull, 0xcb742a5abcb313bbull, 0x43481d95611f1553ull, 0xff3c9ad5b0854efeull, 0x6184f7f743ffcda6ull,
+	 0x560fc64acddb9e39ull, 0xa77549016f300b96ull, 0x1d45ebe6c90ecee1ull, 0xc40f26b121ca8780ull, 0x68ac463af6260e25ull,
+	 0xeb47d394be5e4358ull, 0xac85c2087670db0full, 0x4878152047df63bdull, 0xa6d8bdcdc13c1e85ull, 0xea1bdb8722954809ull,
+	 0x52886e2fed0cfa59ull, 0x0a62178a9d13cd17ull, 0x9216c5cd4db4c7c5ull, 0xa448145c96e6caafull, 0xe0c9d3afab93eea3ull,
+	 0x957627bfd8aa8ccdull, 0x85df4b803edc0914ull, 0x1d6abf9c591d4793ull, 0x418e84e618b8bfd8ull, 0xe2a6f8a8284a546aull,
+	 0x87fdbdfe0d6f24bbull, 0x8e65cbaf84521afbull, 0x30f1f599d1b9d007ull, 0xb352525bc0278d57ull, 0xe20a28de943f023dull,
+	 0xda93d79c53685ebdull, 0xb0fb0466e10c0bb6ull, 0x94659a0842b19cefull, 0xed50f7e33a433098ull, 0x673200e60e688c30ull,
+	 0x4e58297ad6a13879ull, 0x04a05e87cecd304full, 0x0cbee76f03b67323ull, 0x55cc01e2a969e654ull, 0x082efcb184348ce3ull,
+	 0x05029cdc259872e8ull, 0x8d59b25c496a266full, 0xe9b274c641c24763ull, 0x290597fad0ab8776ull, 0xd5f792e3b0d9cd9cull,
+	 0xa5bf745080e00cd4ull, 0x0147927bbdfaa27eull, 0x4c4df06dc47d2ec3ull, 0xd26d0123148850c3ull, 0xac13d2d75c2be101ull,
+	 0x2c14d9573bc6963bull, 0x0ef8e2e683f8296aull, 0xf67cc65dca1270efull, 0x219f0a940a8d8abcull, 0x4af7016996c8abfaull,
+	 0x3465667e23177a32ull, 0xa55be3f1cb5c2923ull, 0x4ef5c92cfd2a33d4ull, 0x01b98d3892a0a56eull, 0x50af6170e3884246ull,
+	 0xa7e8cfb74899e186ull, 0x2e037ed0e24229e6ull, 0x162b649cf7c127a9ull, 0x3000761a45ba9950ull, 0x87721827ce25be2bull,
+	 0x348ef4e2801f98f0ull, 0x4ce1101e3f4bc7e8ull, 0x76c6bb64148fd218ull, 0xa0c9610fc42b958cull, 0xee37372a913a005dull,
+	 0x7817be7d4846a3e2ull, 0xfeee2adeb1dee81aull, 0x28a97d77b3ac9c50ull, 0x1988300fb1df6293ull, 0x17ad79bf9d8b0b93ull,
+	 0xecec8aa157f7a185ull, 0x99dd672d0d89d0beull, 0x199f1e95a32b7486ull, 0x69ccc41bfd8fd0d3ull, 0xeaa472f66c707d96ull,
+	 0x396d9cc12fdb08bfull, 0x29d404647e2b0f7bull, 0x0be0662bc1e09112ull, 0xa6c5010ea27a2156ull, 0xb084379deaf03318ull,
+	 0x8b8855f23eb5689full, 0x0cbeecdb6a55de26ull, 0x8cec1f838b7a230bull, 0x6bfcdcaf7a04186dull, 0x4d216907b13d7ddbull,
+	 0x9c0315f54cfed283ull, 0x62dabf9e00901e8cull, 0x036e1a374815c372ull, 0x9cfae08f64b8c071ull, 0xecbe1036eb0e5b65ull,
+	 0x5c07b3d832319c88ull, 0x3676da3080981eabull, 0xaae4af00826c9ccbull, 0x808e74fcb65b6e1bull, 0xab87a21f5ea6d709ull,
+	 0xde55a2df28dc8c9bull, 0x79a142b589d6c91aull, 0x534ed79f80f2e413ull, 0x6fb84f1d28384f92ull, 0x8740e8e50fc70049ull,
+	 0x24e1276ca291c1e8ull, 0x54c7d0e84beab61full, 0x957c8a8f701170adull, 0x601bba95da555ee2ull, 0xb388a7da166bf09bull,
+	 0x4393b48b79a20f3dull, 0x6963272cb390170dull, 0x5e6a14539d6e43d0ull, 0x9a562c64ba02425eull, 0xbad196bf26d02a29ull,
+	 0x449729c15ca82fd8ull, 0xe3bb87a3e4984ffdull, 0x3d8cd7306d0e3227ull, 0x50876630fe814ec5ull, 0xdbdf5e1688dcbad5ull,
+	 0x48463b23dabb10c6ull, 0xdd13c893ec421153ull, 0xab43ece08835f59aull, 0x9a4faeac28a52a54ull, 0x16d5ea2a583d108dull,
+	 0x6431f5d4d3a5cd9cull, 0x15eeb7f638fbd2feull, 0xb53bb179fae85730ull, 0x6b18b56dc94e9d0dull, 0x11f27872840b90e7ull,
+	 0x2383602fb706f4b9ull, 0xad297a9702621351ull, 0x7c4f7200f8487be8ull, 0xb2f2be291ed0f066ull, 0x01ebea7473f02558ull,
+	 0xc421476d3b721d45ull, 0x79ffdf83ce566659ull, 0x28485b49610b383bull, 0x525868117ebfe62cull, 0x7e6594e0bc82c86eull,
+	 0x4429a2a903af2568ull, 0xf7bb7091101b50d1ull, 0xfe8db21d97836ae5ull, 0x69ed55ee8ce5bedcull, 0xf8e0facaaf06cc79ull,
+	 0xcc2a55ae48d1f868ull, 0x0ccc73a7f943b616ull, 0x9c43f6cab5b9a724ull, 0xb1ebef8a8c2fa949ull, 0x82f0491018849919ull,
+	 0x74efd8c12ff04abfull, 0x686f43fee9d88f6aull, 0x93003cb45f3ba3fbull, 0x41d6bc6cd97ca5f3ull, 0x29d0d7a34daf70d7ull,
+	 0xa0c3deb31143b0f2ull, 0xa3e7495b2b9a0b16ull, 0x92316663c3087fd4ull, 0xf64a3b2e0adca6a0ull, 0x5a8c8bb545355fbcull,
+	 0x80102db3074009f1ull, 0xd5d693ea410c06e9ull, 0x5045b5810b68bf92ull, 0xd358a4e99770742bull, 0xb7e14a9004a0af57ull,
+	 0xb42e3bc5968c6e23ull, 0x1e219c7f91da13f5ull, 0x0fce46a1cb541cf7ull, 0x407b9dcf901b90f3ull, 0x40e4576bffb9422eull,
+	 0x55a3b9dada92e5a0ull, 0x99ad4b0ebfa4a295ull, 0x2723c99dd2167cbbull, 0x853989206da52bd8ull, 0xaef779782664eab8ull,
+	 0x75af4d92be335ff1ull, 0xe453133200057be5ull, 0x2bc6c1c0db9463cbull, 0xc9c074d20f7aeb51ull, 0x85ebfe7ac213b88eull,
+	 0xbe967e18a286ce60ull, 0xed7fa69ebdaced5aull, 0xebde83b0766db6f7ull, 0xdf0633caf2c2f72aull, 0xc99cbba97dffd635ull,
+	 0xf13634f0f3b0a95eull, 0xdc38b88360294d11ull, 0xec8fd79f18fbef89ull, 0x8bf15e043da092deull, 0x3f1967ae37d74404ull,
+	 0x75ab3ed38d3157a0ull, 0x394b4cd592be8174ull, 0x72e32c096a88e50bull, 0x3b4e040c8f48b937ull, 0x33f78074cfc21058ull,
+	 0xc50b1cc57da30118ull, 0x882707d8e7378fa7ull, 0x1d5c08a55fd2f9b7ull, 0x88757e94147c2c34ull, 0x02601ee4f2814588ull,
+	 0xc7c3a8883a7a3a12ull, 0xc5635a3153ee4925ull, 0x588a0521f01df751ull, 0x7337bb2337fa550full, 0xf178cc0e4f086a1cull,
+	 0x12a82a0b40e58b69ull, 0x09ced4e0e6903cf3ull, 0x8017fed087a2fa33ull, 0x431c3335cb5a8237ull, 0x7aa60efe14844583ull,
+	 0x8f68f5276eb65fddull, 0x355251708df2e372ull, 0xe0d19ba0fb32d7cfull, 0x06a96f357d042ec5ull, 0x98de5faaae063d2dull,
+	 0x9ecece80b7887bc6ull, 0xff5af8f4a4d40dd8ull, 0x95743670de3a7230ull, 0x9c2033403bfbdc66ull, 0xc41d15c64c1b8149ull,
+	 0xcd39cef73e7c578aull, 0xea2ec64df053bdd1ull, 0x0a4a6a0e32bfdc87ull, 0x165c526640ccc365ull, 0x05ac0c79413d7616ull,
+	 0xd3700f7e7cece87full, 0xd8ff5c53932d199full, 0xdf854fb70db5c2acull, 0xe8b92b18537f4adfull, 0x370e0bcab80a97e7ull,
+	 0xb1b12bb56b0cd625ull, 0x3d040bc12162a1b7ull, 0x0de9832a3ab2c9ceull, 0xc74afe5ee338c4faull, 0x1c5ad9b3c8dd15d5ull,
+	 0x749051fc9c584d79ull, 0x5ebf6d290a2ceffdull, 0x70cd207bfabfd9a7ull, 0x3038ecca9955cf4eull, 0x874eda7379cb1007ull,
+	 0xa48d37bb10af9d2cull, 0x6c8ca4f281ff1527ull, 0x5ee091943c46572cull, 0x2d3a1a91a53df77dull, 0xbf334d94d551c5c3ull,
+	 0xc935667cfe9acdb9ull, 0x17852b3e043fb0aaull, 0x18d35dde3fe67e48ull, 0x284a0f50383aa269ull, 0x52fa4e62b58c321eull,
+	 0x95416099e84bc45full, 0xadda14371fe0c77cull, 0x86330cb54e3db22bull, 0x65fe3976a0b90c36ull, 0x4e6a2ea29d1068efull,
+	 0xd9c1530369917a8bull, 0x8d6ae0407f1b5cfcull, 0xdbddc0e6f86b20ecull, 0x37e609091acb653aull, 0x3e4bc68e4fa4c066ull,
+	 0x1d8936c38ccead5dull, 0x5b0542341fd7789dull, 0xee9bf25f326d2ce5ull, 0xf56b4d9846a08f57ull, 0x4c1b73dd2ad9eddeull,
+	 0x9790d81dc8204823ull, 0xf5e1f63ab737b12dull, 0x1ecbb8dc0b894c6full, 0xf7ba85ad59f5b9aaull, 0x351c288e565d4019ull,
+	 0xc55668043acbf967ull, 0xda9a99fc488d9158ull, 0x22d1af7be0fbf49eull, 0x7e98087fb86696d2ull, 0x0562bfb8ab0e22dcull,
+	 0x12caf4335767d2b0ull, 0x44f370df171e03f1ull, 0x76d6f2999f76c12bull, 0x0657a059409a357full, 0x055209bf595740c4ull,
+	 0x68a07c9b85074b18ull, 0x39b87e058ece045dull, 0x46a1dec5cc31de3dull, 0x816f22b8b438ada9ull, 0x1325e513e60bb523ull,
+	 0x44028869d45a964bull, 0x736ea8c9fbf58086ull, 0x1ffdfff8b340c01eull, 0x600335afc54dd397ull, 0x6ad7cb1b9c7f5612ull,
+	 0xcd00149c62837bbbull, 0x74cef1304bb63869ull, 0xfde7aa20edee6777ull, 0x8073cd12838b777cull, 0xeb977f6fcd7ca77cull,
+	 0x99849aca19302cd1ull, 0x3c2ca9d87f744ae8ull, 0x21d52cd315e19303ull, 0x690e86f86b8f0035ull, 0x837c4f45cb16ac85ull,
+	 0xb204d73d961b59d5ull, 0x474f38d90003c02full, 0x1e6b4975b764d126ull, 0x9cfd05be99ab61b3ull, 0x9b85f76577f65950ull,
+	 0xeaea7ced7e1b74d8ull, 0xbdb889a9ddb5639cull, 0x63e7a30d88fe5fcaull, 0xba02c3c5af93528bull, 0x4dec249685499485ull,
+	 0x7e6e84c295c08eb3ull, 0x162ed5cef2d2d705ull, 0xcba00502ffd01686ull, 0x50ed367421b11b93ull, 0x89d1db05a3a313baull,
+	 0xc0dbb4c5d29149c0ull, 0x5d7b3d81020701c9ull, 0xb1d4490670a00262ull, 0x6ea0d629f4e74807ull, 0x6734f2aa0055d52full,
+	 0xfe9f41e3e4a2ddabull, 0xc386a7a72647dd0cull, 0x837fd2bd28837979ull, 0xf316045957c69972ull, 0x3a1ee96c6286550aull,
+	 0x16c6b0ad7b4a340bull, 0x3ffe1a7655ebf367ull, 0x7769ca9fd941b180ull, 0xabc5ebc893bcc632ull, 0x855837b0e375f14aull,
+	 0x698d5977dd35bf48ull, 0xfef27cde1907a5e2ull, 0xac8a67b5196b2be3ull, 0x03485064d405b97bull, 0x0950a2ea7cc05a23ull,
+	 0x6e04f8951b68b11eull, 0x23c33056d42ec89eull, 0x23f72a93bf0f433bull, 0x3f8fe79a4ae9e633ull, 0xac464823721b92b6ull,
+	 0x2c6e15c3dfa56302ull, 0xc91fa5fd610d7d3bull, 0x79a9e335f84c93b9ull, 0x43262acefbf5b8d8ull, 0xa6c91f59fd2a5612ull,
+	 0xa74314ae5efb78a5ull, 0x4dd9e8a3a02d3907ull, 0x818efb7f18ca3881ull, 0xc1fdc73ec4ee5cc0ull, 0x18e30cc9657f37a7ull,
+	 0x8bf6ea820de2a2bfull, 0x27fabca2791471d0ull, 0x81e31957c22efb81ull, 0x508ac26c4e15b569ull, 0xce0f8a75d2be25e2ull,
+	 0x5962d63035d7e5f0ull, 0x5de133759ec617d2ull, 0xb80ed814ce2ae10aull, 0x4904cff9d1ef42ffull, 0xe443fa05f3f111bbull,
+	 0xb284539c528fcca0ull, 0x949420ee519332eeull, 0x2bd0a10a233c7024ull, 0x281d38f64e25b8b0ull, 0x5bd137bfa4aab4cbull,
+	 0x5f7be15e62f1ba44ull, 0x72c79c124afdc36cull, 0x2e16e19d271030f7ull, 0xc7f372dc0914d3eeull, 0xb08d8b332ead87d0ull,
+	 0x828c2a071e4e82ebull, 0xae180c977fd1f2c1ull, 0x3adf5d4aa73b6f58ull, 0x91afc6209dde00c3ull, 0x857ac2e0ea49fe38ull,
+	 0x272587e6e5cc8142ull, 0xa8ffa032cfc4ba35ull, 0x338a0317b529a461ull, 0x08142a3a22bd752eull, 0xf564873311e96ae0ull,
+	 0xb55f805af91de992ull, 0x20857686c5acd4dfull, 0xc2133e7c4b1566baull, 0xfb599d9e31f25a47ull, 0x365ec5d7589054d2ull,
+	 0x030f93122bd85293ull, 0xfba695570187d9cdull, 0xfc507eac22b22338ull, 0xa0f6853b9b47b955ull, 0x07579c3b82f360c4ull,
+	 0x342ef838bb2f381cull, 0x2ce7df841ccbf9f1ull, 0x7eeedd125cbd5b2eull, 0x6c08ac277d39e1a4ull, 0x0fde85b485b3b43full,
+	 0x64e54c9363bdf11bull, 0x92365b33eddc94c4ull, 0x38e2b949babf53c4ull, 0xc3dd1349f3f5d7ddull, 0xe25969d235d57309ull,
+	 0xb66cd9d6b1333a3full, 0xd5b7da77eb264e29ull, 0x480544583ca7a6bcull, 0x477b32f75c8d0850ull, 0xc785020abd93e987ull,
+	 0xcf1fe3d1f2b02a7eull, 0x9cbab9b2662efd1eull, 0x2f84548dfcfc141dull, 0x4a28723f7aaaacffull, 0x297f6aa5166562e7ull,
+	 0x83a52b8bf69ea4dbull, 0x3ff87f7ea9c1f729ull, 0x128943dcc2d3e363ull, 0x518323e4490c13beull, 0xcfa561418b8d3cb0ull,
+	 0x903b352d3ce7108aull, 0x464f26a5c273a2e0ull, 0xe81de0d19d8287cbull, 0x72b61cae71edae1aull, 0x0a470ad2fedd8f41ull,
+	 0x2f6becef15797610ull, 0x0540d09c269a6e87ull, 0xd23411a766adca50ull, 0x7b1052cbcadac6e1ull, 0xe934d213c0642fadull,
+	 0x7d0ab7f757a3dc95ull, 0x1a9b35a0f22522efull, 0x569b015922158fb8ull, 0x3a02eb1fd8b761baull, 0xf7d92805847bfd04ull,
+	 0xc40b8ef012236656ull, 0x1c32f9068c89ea61ull, 0x193923dcf245a909ull, 0x81ed6af312fd90baull, 0x4c97bf8fd5157150ull,
+	 0x297a0f8fe7c19220ull, 0x4c331e7577425dbdull, 0x9de661fb0708fb32ull, 0x06cbaa67c6f75b19ull, 0x80a3c41a89ac74acull,
+	 0xadcd2d118ca7fcfcull, 0x091e056ff143d492ull, 0x377348a6c06081cfull, 0x5a7dc0e778f9f576ull, 0x222ba44085fb656aull,
+	 0xf33fb1eddd91ed45ull, 0x568f011ce28c80b3ull, 0x654207a5cfce347eull, 0x16eecb4a0f223e88ull, 0x7d3c8b92156cba22ull,
+	 0x54bf5bf0979c22c2ull, 0xb4de0bbf1f644902ull, 0xb4eb1ca127db709eull, 0xe1efaa52a95c921aull, 0x4b7ce015e0778d9aull,
+	 0xbdd4484ac9d64745ull, 0x5da27163dd9594c3ull, 0x9c609be35305e1ddull, 0xb4da42c17b823541ull, 0xd647247554aeb438ull,
+	 0x0d39eb28afa04dc5ull, 0x7f5e224d04425293ull, 0x9021c037c146596dull, 0xd45db6c31267fbdaull, 0xb7b362af77ee11f7ull,
+	 0x70cbdeafe2382ad7ull, 0x0e6457a4e8543811ull, 0x0750b928a0acd0adull, 0x5b934923a01449a2ull, 0x06dd461f1f0b7f1dull,
+	 0xda198a772579030dull, 0xfbcab16f89b80a3bull, 0xbb90f53fc6f47257ull, 0x2711df63befa6f6dull, 0xdac9b04ab1bae79bull,
+	 0x611b0a52e84d5a07ull, 0xe741d729a9afbf68ull, 0x7a380d27546cc844ull, 0x1911bb2dd119507full, 0x967d33764bd74715ull,
+	 0x7deee8a83b7c1cd4ull, 0xd2e4cd901ba74e91ull, 0x22cf4a3fb4f494c4ull, 0x580d6fad8c584bf4ull, 0x162f7ca6f12736ceull,
+	 0x1f29588c96781a71ull, 0xefd54c7648822cb6ull, 0x4e6013c063c44e86ull, 0x3c57d433a898550bull, 0x12a2f8eba8f77883ull,
+	 0x6a5582725a7f9743ull, 0xf266223810cda446ull, 0xa68cdf28f1ea71dbull, 0xb30877a1ef511f1eull, 0x34943c958ad47792ull,
+	 0xde18f7dc3141857bull, 0x84e184131d8e3cfcull, 0x615f41a528f27523ull, 0x187ae76094d63ebaull, 0x2800f0f7becf673cull,
+	 0x05efd25752efe830ull, 0x2661c0238d591b93ull, 0x3b60488d658f69f9ull, 0x1ee6f3b3b39cc4c3ull, 0x146cafeaf96c8a39ull,
+	 0x54e420ecb8a7ea3bull, 0xb6f19527a29f2c0aull, 0x32c05a564ff9a691ull, 0x7329679638614ef3ull, 0x242f0fa47ea2e432ull,
+	 0x81727cea453ec0f5ull, 0xe771e9baa7d58cbaull, 0xdd5ac70c9e9a94a4ull, 0xcbd541e498f56fc4ull, 0xed6d7f83c46e795eull,
+	 0x7d44ffab606a883eull, 0x04d987ed8c12cc3cull, 0x9e114345a99ac316ull, 0x6328e27c2a2983a1ull, 0xfb9c4f0bfd1cc032ull,
+	 0x0f49f568b0d70a99ull, 0xd46db9766595aeabull, 0xeffae84e6a16d947ull, 0xb2eda186b24d6b7bull, 0xd2ed45691dd8b8deull,
+	 0x7bfe3a370e4c14d5ull, 0x80d103db215136a4ull, 0x6159d87a8e9dd933ull, 0xce80b605aa6f866bull, 0x8c0a7c326a986b53ull,
+	 0x48e19f3dc7571cc7ull, 0x964b4bf0193b5eb8ull, 0x14eaf12706a3667eull, 0x1e9e94fd3b934944ull, 0x531e9a844c76302full,
+	 0x28a88bf4c9c5414cull, 0x6f0a107ece3381e6ull, 0x9162250f054ded44ull, 0x7c6166c584d8655eull, 0x1b08b7a4fc00eb57ull,
+	 0xb70c7a05ce8ac5bfull, 0x257a013a711bfeb4ull, 0xb609fcafd9fe044cull, 0xf582648fc6fcd345ull, 0xdab559bd644ca780ull,
+	 0x7353623db3830165ull, 0x260d4438c08773a1ull, 0x9ce39d5f758b4586ull, 0x2026105def2b0ba3ull, 0xae112eedc41ebaf2ull,
+	 0x5aed837868b1837eull, 0xaa5bed711a54808eull, 0x41405d7287bb2177ull, 0x2f9c0025fe74054eull, 0xc93cec5deb0ba3ffull,
+	 0x880abb17206e521cull, 0x66c67b7f7f7eff89ull, 0xb86dfb9d537c91b6ull, 0x03497b224019eb2aull, 0x3f62d83bf92bb354ull,
+	 0xbc175a7682f5b36aull, 0x453b37212c07d8d3ull, 0x4e95ed9e5be9ffe6ull, 0x330c677da4dc0743ull, 0x823cf858bf309bcfull,
+	 0x75bede5b1cb911e2ull, 0x1aed17416f5078d3ull, 0xec26639369434600ull, 0xc28b222012aa0624ull, 0xaf5059b69f1e9fb0ull,
+	 0x528ec9b88fed7b88ull, 0xa40e5c1523f21589ull, 0xbedf6910c4368e6aull, 0x5a44284a30f8aae0ull, 0x03cad487ae7dae0cull,
+	 0x4f8504209503903bull, 0x2a3de01977d05d66ull, 0xb0e7d645071c75e6ull, 0xdb5857c0e431c36eull, 0xa6e1a997094546fbull,
+	 0x3feb3c3b304b34ceull, 0x75730718abfed0a7ull, 0xefa62b022b21d8aeull, 0xfe112ece71e18db4ull, 0x5249706294afceb4ull,
+	 0x16ac678efbaaeedbull, 0x3fe1d4df4624786bull, 0xf9f8fb10cc7348f2ull, 0xf6331363f0df87b7ull, 0x16e9231c35cb21f0ull,
+	 0x93ec83e544f35e23ull, 0x041ce452f6733280ull, 0x2c413487e13dbabfull, 0xa442a1c36776da88ull, 0xd1f23597a4954000ull,
+	 0xece49999e52c8c9aull, 0x97c869fe738e0f4bull, 0x213c347cd2b679f7ull, 0xe50c94024ae3e055ull, 0xf92dc0bfe62b6e46ull,
+	 0x417a9fef9fa85a37ull, 0x5c8268098bc2a3ffull, 0x1597639993754c5cull, 0xa913849ed8b049e7ull, 0x8c7a986d2c122d0full,
+	 0x40243f791aa4af0full, 0x8379c1538d30c2cbull, 0x126b1667981ffeb8ull, 0xa4c557e7bfc659e8ull, 0xb2beafdbc18b4bebull,
+	 0x794ceb251f3f3530ull, 0x0c159263a310f732ull, 0x57b841ff6e77ea3dull, 0x9e02b8b4306d22e9ull, 0xec30f46512216913ull,
+	 0xf652b351dda0ba9aull, 0x82d9fdf4ef3c2111ull, 0x1c8a05782356ea34ull, 0x0c6fa4b35cf1ff6eull, 0x019dc1bd3d1f4f21ull,
+	 0x958fca6eda5b89efull, 0x53cb5138c880f339ull, 0x7e5ddd95cd37a4b4ull, 0xcf98aa650c068985ull, 0x0c6072686b45f05bull,
+	 0x5012bb66195676d4ull, 0xfa31458e000ba5e9ull, 0xe9e5a2981beb7e1bull, 0x6cef41f38737e5baull, 0xa62be4e484ea8fb9ull,
+	 0xb55bb772ec0c4e11ull, 0x54a8ee80dbe05e4aull, 0x003dc53df663bc45ull, 0xeb8d04eab1be47a0ull, 0x8abcd3e0f799ffa4ull,
+	 0x063879107459a835ull, 0x8b4e64171225fc0cull, 0xfa8857443bbc4915ull, 0xc8f89290d72ddbd4ull, 0x289250faa86b9430ull,
+	 0x897879c1751fb274ull, 0x44c658836d84e9beull, 0x99d3ce900b5363fbull, 0xe54ccedd673cea87ull, 0x44c0463261c463b6ull,
+	 0x9a87073e838a4b5bull, 0x923649cf9d1fae85ull, 0x3661c06956a9b27aull, 0x11ecfd3a359be3bfull, 0x0cc89e151505d961ull,
+	 0x4571e31a6763da18ull, 0xa77adf03940a8c05ull, 0x3a9a344ddb7fa127ull, 0xe1612559b1ccef01ull, 0xdbd03e54b9b7f2c4ull,
+	 0xad6aac8cca3a0629ull, 0xbfd8cb085c9290f5ull, 0xd45b4203d0ecaeebull, 0xb208129e4b4ed569ull, 0x91060dfcbabcad81ull,
+	 0xfe1d1956e7dbffadull, 0x7784f9e2593c3510ull, 0x2834263b12a5904bull, 0xc4c3582e30d6d3bbull, 0x55d0ac50985093c9ull,
+	 0xb8e2820e5befabbbull, 0xbc04e0d0d690d9fdull, 0xf1b085a0720aba3dull, 0xb96ce855badd43e3ull, 0x8e20599cb57f3fc8ull,
+	 0x2140bf13e14a5840ull, 0x7db42880ece16a74ull, 0x3285e733a10c016dull, 0xaa86488a8940a796ull, 0xa223428633378488ull,
+	 0x88a908cf0419a251ull, 0x50b8d72692253ad7ull, 0x9b85fb82c43981f0ull, 0xa4674f8c4600d48full, 0x4b8251f2c3945794ull,
+	 0x7163baf5e1131567ull, 0x1dbece145d4cd841ull, 0xf34eca3797fe1b2full, 0x220203712adfda54ull, 0x86a842054dc3ef9cull,
+	 0xe05a4da4c0a65193ull, 0xa4bf2ae087a77b11ull, 0x5b1373fc8ea5f3a5ull, 0xabe533d7fa91dbdeull, 0xf42b5651d378acecull,
+	 0x691128e1e368eb93ull, 0xf3aa7822df3f8806ull, 0xba09a0bb84db22afull, 0x7d1b752c444ff2e6ull, 0xb0cbd1b7865ca92aull,
+	 0x759b06b201684ef3ull, 0xd1916593fa335a47ull, 0xf1ef52328412ade6ull, 0x114ca4a8d64d693cull, 0x938b368b5da03991ull,
+	 0x3e091d199379e8faull, 0xb6ad08802d1fac17ull, 0x2a74c9be2b57e72aull, 0xf8aff77468980ed7ull, 0x0aadca4202941be6ull,
+	 0x7587f4b1a6be2b61ull, 0x70a75686b4566163ull, 0x7c356d3122504212ull, 0x0bb17148b30e7f77ull, 0xa44e872b8221a5d0ull,
+	 0xcb4bddb6dc538747ull, 0xa239b8d3829e307full, 0xac8fabd63a1be8a1ull, 0x45e32866169f9d17ull, 0x49d2600207e3c46cull,
+	 0xc764a2e902a78654ull, 0x070b94a986358644ull, 0x529045a559615509ull, 0x1890f29310b0d511ull, 0x8c4f7bb7106a8895ull,
+	 0xc9e7d1b0e850e683ull, 0x97b997009038ba0eull, 0xc7d205d8f1ca4adcull, 0x78144598756a866eull, 0x7dbb9d26cf5d389eull,
+	 0x65ef533224f2b7d1ull, 0x4cf0fed74add12bbull, 0x522a7866ce5899baull, 0x48a1c74f0845ce2aull, 0x84fada904c13452aull,
+	 0x1965014304c529fbull, 0x4983c75cfbe45d0bull, 0x2845c4ee717f252dull, 0x05590b12b83cf633ull, 0xaf00a53296d590adull,
+	 0x31ad2c01ba086c8full, 0x9f7834a4672f6f2full, 0x248ba052140d10d3ull, 0x16f60eabe9e4930aull, 0x8da5688966ba2173ull,
+	 0x5f2885a688e56e34ull, 0xf754a80400fa9bafull, 0xf9cc04913b34f77cull, 0xb53af6904c5f74b5ull, 0x03af831bbf2c96efull,
+	 0x717bcf80f9eb95ddull, 0x9fd7389b79ac258cull, 0x47b1cad82903b7a8ull, 0xf2d3c8ef843b2abdull, 0x156ab4c4192b7d15ull,
+	 0x361b70df2daccd05ull, 0x877ea023a22dbff4ull, 0xbf978067b9c1c026ull, 0x4ffd64ae0c95126full, 0x77ca4a89858a5189ull,
+	 0x33a41f85db5b5d11ull, 0x1cd6312d1e140984ull, 0x2033fe8ac6a69d7full, 0x385bf2607b62ce45ull, 0xc79323cf63892b47ull,
+	 0x17b6548807d7178full, 0x65d3483612fa9661ull, 0x01c1effd0cd39d93ull, 0x521433f11817a866ull, 0xaf083aea0a7ff99dull,
+	 0xba12f736013d17c6ull, 0x402470aa8f6c50d5ull, 0x92bb951d97ce66adull, 0x5b859dc8525edabbull, 0xe06e37136514dc2eull,
+	 0xa9d851a656429b55ull, 0x3d0007e556c19357ull, 0xb0f2135a9b70203aull, 0xeae7857cfbc0b849ull, 0x0c727a6b51ff3838ull,
+	 0x3ed99c52f0b76cc4ull, 0x30413bbb8a2fd9dcull, 0xc7e4516f53a44cb0ull, 0x87fac17d94e79b43ull, 0x69e38f3243c208f1ull,
+	 0x05efdb2200a1e493ull, 0x0ba80b1e86fe53a7ull, 0x34b43ed07bf1cf83ull, 0x38583771d3424c4aull, 0x51f7a4d16e4140b7ull,
+	 0x6cd9dfebaa6dffe5ull, 0xcaecd73e10f510d3ull, 0xfc8fc86e988ec802ull, 0xffd75284c59db055ull, 0xdb32638742957bd4ull,
+	 0x187a6410fc025afcull, 0x8fe6cf33600c831dull, 0x2d46015553d38801ull, 0x9c670a86714d9edcull, 0xb4953b8ff6ad1b40ull,
+	 0x01196f5c9adb3a9aull, 0xc788a73603da23c4ull, 0xf475fb3a6e5a3b0dull, 0x7a0969c370a551ceull, 0xa9e82654e6f18d6bull,
+	 0xc83366df9a6f8147ull, 0x7f3b4f5a81a80bb3ull, 0x0c2376409684e93cull, 0xae2f96524db27f27ull, 0xade73655360744a1ull,
+	 0x60f858f4156c14e2ull, 0xd40aafeb61e837d2ull, 0x09eb0781cf6b2d1dull, 0x4741d07f4dc354a0ull, 0x97b30d2007451f35ull,
+	 0x48863b4404c6a8b0ull, 0x26e0ab929c27fcb2ull, 0xde2f94508f95f6c1ull, 0xd5c5b0d170e5a64dull, 0x967d2a94e9bc3e9eull,
+	 0x3a1674828db1a98bull, 0x673febb72244828aull, 0x037290894d6740e5ull, 0x7233bd35d99b2602ull, 0x0d8922e8b48ed600ull,
+	 0x35cf5eb881b35724ull, 0xcbc2b050bac3d61bull, 0x61b23e536278bda8ull, 0xfffe96ad25108386ull, 0xb7dac592d88d60a3ull,
+	 0xe8301c006edf5622ull, 0x8a942e4e021d161eull, 0x83c30bb16b056f22ull, 0x5b4b6dde38657e8bull, 0x735b174acc5c0207ull,
+	 0x17c844597bd0db44ull, 0x86624af3b3e8e944ull, 0xea66c938027823f4ull, 0x4e040b3e01d572eeull, 0xf13679b9ca9ed4b6ull,
+	 0xeba3aedbc76ffda2ull, 0x359a19381dc8ff37ull, 0xe25445edc753482dull, 0x69b37ccb2025973full, 0x27e336c56aed6cadull,
+	 0xdb21f95e99b9c017ull, 0x95283b78df2eedf6ull, 0x0d69c48fe3759f31ull, 0x9bee1d134a05469eull, 0xfe1a42ed98bd7e7bull,
+	 0x141fb4256c28d31bull, 0x32d300568f309ad2ull, 0xb02c58a616cfefd1ull, 0x0a5e46182e32eda0ull, 0x12cc9d2a47c144f1ull,
+	 0xccffac4d157fff8bull, 0x2b9b28920f66ab9aull, 0x666c39f65a86929dull, 0x7dce66a786937776ull, 0xf1c0ea1cc992f497ull,
+	 0x875483ed1ff13253ull, 0x92a241c1101f1824ull, 0x80588dbb1c217be2ull, 0xc8850cf48d409ff4ull, 0xb33e6215d06ed67full,
+	 0xcb1c42dc79d4cd78ull, 0x239a4e35c13ec4c6ull, 0x46750d0f0872b92full, 0x3bdd4c95c201ee64ull, 0x5971888ab5e13e30ull,
+	 0x6cfb54b62ac2fe2dull, 0xa2f6e07db7e83cb8ull, 0x855fe15e284f5488ull, 0x8ed572869440728cull, 0x7eb470731ed39f9bull,
+	 0xa443d38056cb371bull, 0xa9c2b38f3dc51f8full, 0x22d97333ab03c586ull, 0x021ca7739e404a05ull, 0x12939c412b9a885eull,
+	 0xa3ac19c4133a0dd3ull, 0xb5e5ec35f41f7e68ull, 0x1196af241b760d33ull, 0x3c0aa2a30e0ae6d7ull, 0xef57bd5549efc304ull,
+	 0x1cbe258a8b0e3ee8ull, 0x27798242fbd47bbeull, 0xf5ed5ea38124a12dull, 0x94aa8d9c09b4726eull, 0x0be8e2f219d9027cull,
+	 0x5795404315440659ull, 0x2c22fe85b9ba4672ull, 0xb8730692b20d48e6ull, 0x52a683591123adf4ull, 0x53dadf5921157b9full,
+	 0xc56ee3d78b27b520ull, 0x70eade6787eda8baull, 0x5583644d4238ece4ull, 0x0d48175a0cd10a5cull, 0x151fceb92ad4c059ull,
+	 0xe2e68c809be8f72bull, 0x44a4f8a20bbcbf6aull, 0xeb392d989498d15aull, 0x0220c4c8d5f3d4caull, 0x7a9f62c0c3c31a53ull,
+	 0x770690685d81a91bull, 0xbfbcb9db7b82537eull, 0x0f23aa37b0db8201ull, 0x2917478856869249ull, 0xbc1aa0f2633da0caull,
+	 0xbb9a6fc11601b9e3ull, 0xb4dfa11014c8824aull, 0x034592a7a50d7d8cull, 0xb2c997fa7d622ef4ull, 0x49ad042699d17bb7ull,
+	 0xce711ca85734a5f9ull, 0x63d9ebf6ccec3766ull, 0x16e9902a3d327395ull, 0x4fe70025bb237532ull, 0xb515bcf0b8c221d4ull,
+	 0x33ca26e33d64bc20ull, 0x3ebb5eb6457f9027ull, 0xd8c64e1294a40601ull, 0xa2230de76ddd6294ull, 0xf6870d455aff1702ull,
+	 0xfd8b09686890df6full, 0x92b9e7c1fb192787ull, 0xb98a22fde4050adcull, 0x4e752acc7cd8a6c9ull, 0xf8f09b378bc1d094ull,
+	 0x1664f7f9f0d149cdull, 0xe363b8d5121db8a8ull, 0xc5550d4be76fea59ull, 0x711d2ad9fe638eb2ull, 0x4b4a7860f99f51cdull,
+	 0x4a31f8834d905ac8ull, 0xfe9f5976956ff42aull, 0x59753cfb835f17a8ull, 0x99acc69f9f8cd40cull, 0xa85bb6ff730e7bc0ull,
+	 0x740fb8b9e7d3621cull, 0x4c9474aefb01a90eull, 0xad40f7e50e8a7088ull, 0x7490f4818b07e2edull, 0xe2f42496d0c0c60cull,
+	 0x22ba2accdbd67233ull, 0xb13722d656ba5491ull, 0x8255dc15524dab8dull, 0x11fb8129734d021aull, 0x365b7946e4aad698ull,
+	 0xe3c4ea3abeb6fb82ull, 0xc189f0a821c627feull, 0x3308c298077700adull, 0x4e4a55dfeb386d58ull, 0xeb391044f38ce5a3ull,
+	 0x8d8c8d0fd8b75ba4ull, 0x305c2878faf25b2bull, 0xd87a2ca7df783976ull, 0x37d132da0ff1a1d1ull, 0x1880f5b97adcc91aull,
+	 0x65e4d2b69fc72384ull, 0xdfe1cf3233ce756eull, 0x6ce0f70d6c40f5f7ull, 0xc9f788cdb94ce050ull, 0x6ffc948476311616ull,
+	 0x72e0c583e090ed6full, 0x210b7f8e7ba4985eull, 0x623778cf14087c67ull, 0x9454683dac7b09e0ull, 0xc26b70a97dc750ffull,
+	 0xb950993556ae0c56ull, 0xb96f6b1a3221d5fcull, 0x9957f70e83ae6f54ull, 0x870eb84d7d6986c9ull, 0xc37c23a143fc6c0dull,
+	 0x651e6dbabf3e85e1ull, 0x734177990feb2280ull, 0xe23a6bcce6a78054ull, 0x9341d0652f03c292ull, 0xd4011a876ddea5beull,
+	 0xdbc057242f2cbc17ull, 0x1b545691d1b63d6dull, 0xcc876205fa432769ull, 0x0802a80257fa6dc9ull, 0x0a99f04ea6384be0ull,
+	 0x8f8224b906ae7ea5ull, 0x92ae92f761cf3539ull, 0x392dba8b68056053ull, 0x5591bf9334472079ull, 0x153c26d213476f08ull,
+	 0x3e2315ac1cde5254ull, 0xc2a62c1e118c1e28ull, 0x1558c80869fce4f0ull, 0x5aec2f100df7ba1cull, 0xd8e9a35b920c83ddull,
+	 0xb127bd16c2fc92b0ull, 0x15511e504683dfe8ull, 0x8337d2bb31adae95ull, 0xfcd8dd3c5e6e8966ull, 0x0bf4624e36986d71ull,
+	 0x8dd9b02df5493a3full, 0x3f94f6f2dfc82c3dull, 0x51a4811f986bd8f5ull, 0x0027ea07235638faull, 0xb586eb40c7809adaull,
+	 0x0ed727494c9323beull, 0x8dbf933772a8f549ull, 0x059f2850fe0f3861ull, 0xd271b3b05f381b4cull, 0x68c8ea809a541f45ull,
+	 0x4611a4f0642aa3abull, 0x98570069b47de3b0ull, 0x96354dc4483afeecull, 0x86338eac97aa1b2full, 0xb7e937e86304fed5ull,
+	 0x94f90f37f4d94d49ull, 0x5d7419f957f36697ull, 0xb4e08033ce407a5dull, 0x3df51a39f3066fbaull, 0x97e27e5ec154b4adull,
+	 0x1fcbd4a4fa0c39d8ull, 0x65b77b2b79f09efeull, 0xb5c1aecef552f071ull, 0xe8dd57de7925e863ull, 0x167d13745f95e2dcull,
+	 0xcf39f1ad67b19050ull, 0xc3b7eda80ac4cbdbull, 0x7cbdabc9b6df384dull, 0xac4f94bde91b042cull, 0x9335c0c887b3d3e2ull,
+	 0x4c46e80239e72476ull, 0xe6f5bc79ca4a56f0ull, 0x8bd0aeb421eecb76ull, 0x3bd06865e7f7cf74ull, 0x009d51c8121db31full,
+	 0x5a5a72397cae39a8ull, 0x48a2004076d5358dull, 0x695e81a38cd772b7ull, 0x8f9cf47b509d117dull, 0xf40b24d97974ee08ull,
+	 0xc62e22fbf11342ecull, 0xee22c4414cf7ce86ull, 0x0239a6a50d9f7a1bull, 0xcfde1a1868d2910aull, 0x29c6a9ca7fd2e2e2ull,
+	 0x14b7743801cdc644ull, 0x47e4d17f0774fcddull, 0x31012e93317c2885ull, 0x85e9a8efdc36fa21ull, 0xa6d94c9043440061ull,
+	 0x0e8e7f192730fb3full, 0x2f1e2d2757ab44b5ull, 0xfdaf0f53813a480full, 0xa8765a54a4343590ull, 0x051a6bb83b7bf695ull,
+	 0x15e7aa34f1201bc8ull, 0x34e99f19c5b03029ull, 0x3733f6781425bc9aull, 0x92cd85a40ecdd479ull, 0x4d7d8931a6b1fb76ull,
+	 0xdd67489cc16d26afull, 0x22738a4646898593ull, 0xd0804ae8568b0c9aull, 0xdaa54472007ba2f9ull, 0x2aaa39750db4a475ull,
+	 0x392dc7543d040166ull, 0xa19f05465260e78dull, 0xf0788668e3c1b451ull, 0x8320afea461306f0ull, 0xd6f8880c2a9d138aull,
+	 0x1a45288c34aee6acull, 0x95af63650e5b4e52ull, 0x35c4fd9c060a6e1aull, 0xaa434d0eb4f814e2ull, 0x6575d88705abc52full,
+	 0x67a5279c46330afdull, 0xdefcbb48f066a4b0ull, 0x4a1e90fb85321f47ull, 0x67320a140952a047ull, 0x355d64110a1b6d3bull,
+	 0x7dc5db15e9040337ull, 0x58cdff4996bb0578ull, 0xacbfc9efea9377d5ull, 0x0f03bb5bed0143e2ull, 0x5ebda0cd8cc10048ull,
+	 0xb1d3acf7339fe472ull, 0x1fcbc843dae2a067ull, 0x184a751a1e5b02b9ull, 0x3cf79fe0f040f735ull, 0xcd90884bc8ac00e5ull,
+	 0xa61ce2d064b9fcc5ull, 0xdfe04e9e3d5bc826ull, 0xda26002ba23c6cc8ull, 0x9bf0894c9bd60f2eull, 0xc823f8b5a35f5cc8ull,
+	 0x72affc5bf8eecbb7ull, 0xdaf6b0177909000aull, 0x55449f7a7bccb8d4ull, 0x503bfe7f7472960eull, 0xaa1fca4967fd5a18ull,
+	 0x84f14a74874e27b5ull, 0x379b42f8194743c7ull, 0x574ccdfd8077a88dull, 0x083b083d75c4d827ull, 0x1426935b4e5a561dull,
+	 0xbcb81859a35c2bd1ull, 0x28cc29e5799e5c15ull, 0xbbf254e4e39fe482ull, 0xe09a4913b44f2bdeull, 0x42f3cb3ab707b89cull,
+	 0x5a9b3fedf08df428ull, 0x41880989f39ab80cull, 0xb72ec54cfe95fbebull, 0x3117caec08bac9beull, 0x777e2c6ab48a74aaull,
+	 0x91c1c07d8c0fc4bdull, 0x0efc957e11139ea5ull, 0x49ed2da42cca5f95ull, 0x3a518849f221a2aaull, 0x44bbfe287b5ed08full,
+	 0x2901347b93b9cb53ull, 0xcf3dae98e2e7d618ull, 0xf80dad4ebd65b890ull, 0x4e74379f26d0797bull, 0xac30324bd79f8be7ull,
+	 0x3d348094363957acull, 0x7d433515495fdf78ull, 0x74568f55c0e3f2eaull, 0x422ac367c16ea695ull, 0xbda69c38cb229decull,
+	 0x21b25f99d0869055ull, 0x940a7f8336139283ull, 0xfd970f19fa35370aull, 0xae12e801b4c993a8ull, 0x5bbc075fc6c79f8dull,
+	 0x55f7cd09652ae790ull, 0x0e6c1e1572e2ba0aull, 0x1a260725b0556d90ull, 0x127f4771710463faull, 0x011ebcccc8a21bddull,
+	 0xe52e72b8c8aeef47ull, 0xaacbf752a6e3f06cull, 0x90915926d15e99ffull, 0x2d15c37b73823319ull, 0xcf14cb6ec6a2fa12ull,
+	 0x825b6a5a63cb61b0ull, 0xae1bd3d7ec5d82d0ull, 0xfcac87ec3bd3d539ull, 0x764da76c9bf1ef2full, 0x90d464c9ec66bb6full,
+	 0x8ea3f02bc650f72aull, 0x421b1ae946ff00f8ull, 0x082c6a75822ec487ull, 0xe00ca617610b1e36ull, 0x8415abecd41244c8ull,
+	 0x4d2301f65402505aull, 0x09bd9364d1c0b5ccull, 0x85e29c300501aae4ull, 0x966e495a1883734bull, 0x0ca4a4afd08926d4ull,
+	 0x1daa4fd3933e54f4ull, 0xfb04b3a5fcce5b95ull, 0x962cf97d600e0187ull, 0x6ca5046bcadd3c29ull, 0x5b033d895ca95886ull,
+	 0xc0da92b7825ff0b9ull, 0x069b001857cf2d47ull, 0xd2a57d4ab6e7cec9ull, 0x9cce4fadd252d250ull, 0xb48266c536c08b8bull,
+	 0x7830d826c23e3e0full, 0x16c3d424fc7563d6ull, 0xac645f12b3dc05b5ull, 0x0f1f93c60d33069full, 0xb7ad1bc1b5484d01ull,
+	 0x85928527ec81e699ull, 0x9ab88c8f40f97d1bull, 0x21bbd572dff88ca1ull, 0x3c5ce520f3933892ull, 0xfa6b1bfda0fe9ea0ull,
+	 0x38ae8e678bbe6336ull, 0xb478902d6b008f14ull, 0x33b698a83d6092f7ull, 0x77775dd7219634feull, 0x31560f5f9e42c9c9ull,
+	 0x270f56c531898e35ull, 0x28aa7fabedf989fcull, 0xd13445f7db735d43ull, 0xdcde5f2c1b5bd633ull, 0x0071eb3f0bfac009ull,
+	 0x7df49963967852daull, 0xe058fbcb20438a17ull, 0xf2425e13e62a8e4cull, 0xb5dbbd3e7d0112e9ull, 0x1b8cf496d1bcd5ebull,
+	 0xe689e1ac81dd02d4ull, 0x2f5455a25e8c1623ull, 0xdd6346455cf5b7b4ull, 0x9824d72ed381f605ull, 0x3fef54acbf016aafull,
+	 0x7b684c394a41a4faull, 0x707d43f76c19cd43ull, 0x7671cb1508c384f7ull, 0x5229af5a70189cafull, 0x49556cfb4841b9c9ull,
+	 0x28455672b7b0b63bull, 0x66cda3dc03101a71ull, 0xe40c2cb5e9c6dd87ull, 0x75175b35b9f3b0afull, 0x056bc3a6db70d2b3ull,
+	 0xcb3a1dd6f3c56516ull, 0x790d7cb034041f55ull, 0x24bf8003fff4a3d0ull, 0x983f47575f801662ull, 0x0f73db115f20a2abull,
+	 0xea742f9c6ab32792ull, 0xdd7a11f57cc840efull, 0x557413993ea5de47ull, 0x9e510b00cad5e2fdull, 0x12daa879f579565full,
+	 0x9e3206ab2b630be1ull, 0xfe3ddfb35e60577aull, 0xf8d8619ef309d1edull, 0xaa7a593236f0eca0ull, 0xe49acc1afacb160bull,
+	 0x490f282ce8c6ae7eull, 0x2c0d958961769ff5ull, 0x8ae94c5ceb2026fbull, 0x28b712f654354871ull, 0x22644305fca975efull,
+	 0x2587f67d81ba4a41ull, 0xdaaf8d75a462935dull, 0x19d281d9c0b552f1ull, 0xb7e39bd16c7a1894ull, 0xa273220c773fe26cull,
+	 0x8c20ac164762b2b1ull, 0x556fa2b8ac68cc6cull, 0x430152203d71b0dbull, 0xf416ab8962924cddull, 0xd774f9cd4f814affull,
+	 0x3fadf84214f012d8ull, 0xb4a58812b1568c50ull, 0x495f4aa436bf6a3bull, 0xd2f1198959ae447cull, 0x8e55f9ce1e5fcbedull,
+	 0xaf18fd144c66221eull, 0x702aef46794be2beull, 0x65dc23b3d7692298ull, 0x10581cb3a54f9fcbull, 0x5b7d905a49a1a386ull,
+	 0x8c8de4ae7f289a77ull, 0x80d85f300089d7baull, 0xf4ec7be0ec3b13f4ull, 0xb43b8177cf2cfc45ull, 0x35d13db6e09110cdull,
+	 0xc8943eda810f1578ull, 0x03803cfa0a2e8c15ull, 0xa4ad7a873880cfafull, 0xf182df2d7ef6b1d2ull, 0x98d100d763e4593cull,
+	 0x2240c8041a1b49bcull, 0x6ad445f871252ae6ull, 0x1166d22863680ec9ull, 0x06f8cef101cf4523ull, 0x2f9181a135ce7814ull,
+	 0xb94523b46ab702a4ull, 0xde751224e7cae449ull, 0x2909d9cc597e1334ull, 0xc11b8f01c8629306ull, 0xcd094aa8a5b83accull,
+	 0x70e94041ee1e7c9bull, 0x0af5c8aca4b6a9e9ull, 0x32d167cc5dcf4f95ull, 0xf64d231b4f89adc8ull, 0xdc9dc109dc6af1b0ull,
+	 0xed68c393aff68288ull, 0xbb6aef6860332aceull, 0xf0363d3a492cd81dull, 0x7f508a0814b831c8ull, 0x020794cae4113b24ull,
+	 0xc770c1a2eba355c2ull, 0xfe3d5dbcf554f86full, 0xea78d8563056477bull, 0x1e81b676c3b5a9e8ull, 0xa187fca3d8776c5aull,
+	 0x7cd3e1c6a497d5f6ull, 0x65d8957b0b00f7bdull, 0x7be667def92d8974ull, 0x92c2adfed09012a3ull, 0x92192cc38857ff77ull,
+	 0xec95cf5ef79ab594ull, 0xac87d4f0c84fec45ull, 0x963002da6391b739ull, 0xdc31a669464fd89full, 0x37ad5cad2f746a03ull,
+	 0x3f2dbad3830c1d38ull, 0xe185afb44b6d92a3ull, 0xd9671e2561bdfac0ull, 0xab42d4677ea4528dull, 0x80505c221416652aull,
+	 0xa16ea26829ba621dull, 0x7af49c29678f3cd7ull, 0x0a6efd89bcd31674ull, 0xfbdd3734cd5a0ea7ull, 0x289df9991b27b3f8ull,
+	 0x4b49a33b264c9e5bull, 0x420e6ded640ec970ull, 0x94d8e6df7b2ae6a4ull, 0xb1c13765a62f177cull, 0x78344db330ef308eull,
+	 0x43cc95d1a0dfd28cull, 0xd4340d1efb72a611ull, 0xb8863769a1b46427ull, 0x94a775f4184a440eull, 0xe563deca38d74bedull,
+	 0x7df255ef930a5ae4ull, 0x713af563c18d78f3ull, 0x6ed0491515f711d3ull, 0x8bd0971b8d2691cbull, 0x3bf632894455b42dull,
+	 0xbe4d75c4024be522ull, 0xeafb2434882c6364ull, 0x941d2fffb032edc6ull, 0x921233922752905full, 0xd4e5fc065522be34ull,
+	 0x5143fe772f2123e2ull, 0xa4a9ad57a8052aa4ull, 0x5519615076ce1ce6ull, 0x31a844f2dd65148full, 0xc110efadb2e1dab5ull,
+	 0xd6139a16421e38c7ull, 0x65186b2a11f993a0ull, 0x89d129b481de6581ull, 0x0cf6d89f31d8001aull, 0xfe8a8cd5658f941bull,
+	 0x5c78b9a47b611050ull, 0x7537558f43110990ull, 0x50db00baeb1945d2ull, 0x5f5d75e5bbea4424ull, 0xe9aeef3f9a972a70ull,
+	 0x7708f9766b66e74dull, 0xeb820612a4cd41deull, 0xa3c39dcd1ce5d3e2ull, 0xf7e45710fc07c77full, 0xb79eb9ef394da76full,
+	 0x4d301b1567e44066ull, 0x49c5027af7ed4b61ull, 0x955342eb79a0469full, 0xb6e146904faa084eull, 0x686a2b412e87610cull,
+	 0x80e6d2d44a3b7eeaull, 0x56b1d681797d51dbull, 0x5a24ed8bba85ed95ull, 0xdd3f145cb86018e5ull, 0xb5d0856e8d5efa62ull,
+	 0x24a155b772a9f4a6ull, 0x5a258a454fe7835eull, 0x77dfef0d5bb83358ull, 0xd0ac23c1f8eea5a3ull, 0x5e7411aea5f47a06ull,
+	 0x75f72e67d7d14732ull, 0x7483ce01247e1d81ull, 0x232eb1039ef92dc6ull, 0xac3faad223d57049ull, 0xfd2336973ade5d26ull,
+	 0x4bf323aa166b72f8ull, 0xb51b4441b4866305ull, 0xd4cfb971f1e4e3afull, 0x09cc7a083dddde64ull, 0x310019bb7c828305ull,
+	 0x5c0bde29779394b5ull, 0x177d1dca19788145ull, 0xfe0b4d566982178full, 0xef47613e823cf381ull, 0xcb461984882aedfaull,
+	 0x8b96237a83f2d21cull, 0x591e7dc4b3d6b6abull, 0x70db759bab0964c2ull, 0x185dd00e53c46064ull, 0xee4e30925416585bull,
+	 0x6f2bfb770218ff67ull, 0x467951cad5b401f3ull, 0x67a108e1a9b1f22cull, 0x45b505bd5107cf2cull, 0xe26204fb0085e825ull,
+	 0x3f24510460310452ull, 0x070e4e117a2fe19eull, 0x61db9ac84788ad10ull, 0xa7b5bf5d7da4b2fcull, 0xbe66689242cab445ull,
+	 0x9801c3810fd06ae3ull, 0x38e2aeac0ccbe726ull, 0x852e53c9b01497a2ull, 0x636cad094d172f33ull, 0x8ab67346a838ce59ull,
+	 0xfdad6cf01fe5680eull, 0xec72865ae6465868ull, 0x0254d134383faa11ull, 0xda63211c59f46927ull, 0x6e9c374163f14ac3ull,
+	 0xf39576748db1a706ull, 0x039c8c55b55d6027ull, 0x42d1a727f9aba74full, 0xc75a7f0e9cba4a58ull, 0xa64ab7e9a6e13b5bull,
+	 0x78f32e2e32f61dfdull, 0x82b1f26648210809ull, 0x216d23e818758e49ull, 0x63935fccdc060d92ull, 0xc2b2b1ddb862239cull,
+	 0x95adeabe1a3e5822ull, 0x9a5da449f03600dfull, 0xaf588cb28920395bull, 0x5580481211d54f05ull, 0x888fe575c9b3ddc8ull,
+	 0x9699abaabd370400ull, 0x1122acf34d91b3dfull, 0xf83cb6873b43b421ull, 0x4d2853f0d98ea1b6ull, 0x4e1784991a268e6cull,
+	 0xb68bbf6bf059c1ebull, 0xcd0bc970fcfda5dcull, 0x6e6d8892fe56c0e5ull, 0x07e408e5d805e4c3ull, 0x5ea98eaf681f3fefull,
+	 0x1b53065a8a2ff18cull, 0x4e171a8fd40bac99ull, 0x134b41739166a7c2ull, 0xa901a2bc11826d9bull, 0x47604b903a6b8e26ull,
+	 0xe1ee5ff91980ec2aull, 0x907af94b0de93291ull, 0xefb461c5110e0271ull, 0x086ea946f61fba98ull, 0x72a2a12994ed12c3ull,
+	 0xa9c8e1f16e16c2c7ull, 0x158bec316d5e6cccull, 0x6af9ebdcc919e3b5ull, 0x919cd9a44140a844ull, 0x046b7b580e5f65d9ull,
+	 0xc263fa166a2dae40ull, 0x748371cc50e9988dull, 0xca1b6ac8cbcc0cd1ull, 0xb1f01476b0380baeull, 0x7f54a68fee551139ull,
+	 0xfb1aa12e9688774cull, 0x418357e1afac91baull, 0xd022c6a92cb221b4ull, 0x2ced3178a25021edull, 0x2a7ab59e5d450574ull,
+	 0x0078e3f980e9b08full, 0xda91be85f301a380ull, 0x8ef663cb79a3d02aull, 0xd0c42238f9d6a898ull, 0xd33dc2d73e85c05dull,
+	 0x5b72cb5a96e8259eull, 0xa8303e53b38c3802ull, 0xaf280fd592fd0f79ull, 0xc09ed51eb33d70afull, 0x054bc7e159b286dfull,
+	 0xece1eb3d77accd5full, 0xfdcf6a0845146b84ull, 0xf021afc69768e7f3ull, 0x559d0a05c1bcbdc3ull, 0xc77de061ad382555ull,
+	 0x0db25cf7da076aefull, 0xe9b57abdb9bbdd11ull, 0x40abe4c112cc5636ull, 0x8f3277126be1cfeeull, 0x8cf1a4a710f25607ull,
+	 0x511e5043c3a88a06ull, 0x17225fc4b6433860ull, 0x02724834e250d22bull, 0x936d3bdf7342d018ull, 0x3ef06ca4f2a65c48ull,
+	 0xd086f08f5604ccc8ull, 0x1a9c4ac52a3d56a3ull, 0x67192e44fc453a85ull, 0xd23b3b1df3040d08ull, 0x8d262f0f724404bfull,
+	 0xbff09ff7580cbb82ull, 0x8a78d4cd5ba23351ull, 0xddc215f0e2a42b47ull, 0x983feb7fceecab8aull, 0x25055873c479e2f0ull,
+	 0x376204deefd51ee9ull, 0xacfd8fe4ab95cba4ull, 0x7fc2da9b17e9e8bdull, 0x60e617ff4b2044cdull, 0xc2d23551976b5a82ull,
+	 0xcf2cf60d73c0fae1ull, 0x7aa71e9039378c93ull, 0x2714ae384aa39597ull, 0x7ce3e7ceb393c0f5ull, 0x660ee2d987de6f61ull,
+	 0x9aa968cfc78d047bull, 0x3b29f405715d9912ull, 0x3a291f4fdc7e1885ull, 0xf37fd08eda877042ull, 0x5784ce8fc745ee08ull,
+	 0x22371d8d5e389dd8ull, 0x2c1e1979f01ef6a1ull, 0x461255b035bd0819ull, 0xb683bb9dcdc0959cull, 0x7ef6e07443471198ull,
+	 0xc95c4d7b0538acb7ull, 0xba0e5e2d2352eb65ull, 0x8ed1726afac4b3adull, 0xc7005b7ae9c4ac28ull, 0xc197a9aefa91b0f1ull,
+	 0x2669a3bae79640b9ull, 0x93234d6e0dfbdffdull, 0xf74360c48730d2b0ull, 0xbf86ac61131f2a9cull, 0x98512370652a6d96ull,
+	 0xbf853768d996133full, 0x40b2b038c587c56cull, 0x0ed9c406e5a53409ull, 0xf3d823cd7cc0b0f5ull, 0x1916c7edc51fb347ull,
+	 0xb6acee08a1a6459bull, 0xdd9ff8c73c5df8daull, 0x2b651b771017c5e8ull, 0x0e60ef2abd400398ull, 0xd111bd9e5cc6803bull,
+	 0x3c5fe33c26de6fc5ull, 0xb0dc6111367a57dcull, 0x89e8b77013aa3358ull, 0x30b3635f554d1cd9ull, 0x18548bc3b11a9028ull,
+	 0xd06a8e622faac552ull, 0xbda35461f39af3c9ull, 0xef7eabcb527ff83full, 0x71be7ec52b3c60cdull, 0x362777adc25230c0ull,
+	 0x899545092397a201ull, 0x3697a480a19d8cf0ull, 0x3e3401b124b8a4c5ull, 0xb8e9dfe4ddf541bdull, 0x7f91a08835db5642ull,
+	 0x9a96c4557d3d5ba1ull, 0x099c774bcfc9e3d4ull, 0x817e19c8fcead801ull, 0x4168ab379de0d55full, 0x982476a7b4119559ull,
+	 0x7ed47bdf523b3a8full, 0xe61e976c43ac3ec2ull, 0x1a33ca06928e58b8ull, 0x1be541b88542caa9ull, 0x7d04abefbcf7a887ull,
+	 0x9a963e19078e57bfull, 0x6709d324077d92b5ull, 0x4b4505dde45a7741ull, 0xe6488eda0cd21262ull, 0xd564606c3e3275bbull,
+	 0x4f1dd7585a7b54e1ull, 0xe9da6495fec86b58ull, 0xbee4172a56a7a703ull, 0x7fe3437e72f08d40ull, 0xb79768f8b3504a17ull,
+	 0x43ac4e4d8e8c6130ull, 0x2ac10c578402c4eaull, 0x4092588448ba8aebull, 0x200a304a0745c0d2ull, 0x77d484f218e5073aull,
+	 0xa55ebe68823a42d3ull, 0x6b1aaf3fd666dd0eull, 0x2e4da6a0177edd20ull, 0x6bf93bdd642420d5ull, 0x6193b73b159acd7full,
+	 0x20a187051fcfc603ull, 0xf6715fa89fb75d0aull, 0x79411c7483bb809dull, 0x544cea6e65b55471ull, 0x92f07d9ceffebc82ull,
+	 0x2e4e8ac9ee4fadc6ull, 0xb7750c35ead25d18ull, 0x2e032786271cc917ull, 0xca6814813ef4d5d6ull, 0x5cf8240706e0032dull,
+	 0xccffd5a26ccbf581ull, 0x2873b9844045208full, 0xa5afdf7b819f330dull, 0x4d3be918f132afd6ull, 0x25721e70ac6886a2ull,
+	 0x99a58703d3a114e9ull, 0x2e913bdf364db7acull, 0xead826ffb5c35e50ull, 0x547269b755817a21ull, 0x888f88b573df604bull,
+	 0x8c45af95c8294186ull, 0xc2902b3116751db3ull, 0x5605f6fb4869ad7full, 0x2ff4da4b97eb612cull, 0x184b8e695dcce61cull,
+	 0x7ec345f40bf28c8dull, 0x66e6be683c5e223full, 0xcc4b324b4f0fc803ull, 0x45a15762fb4dddeeull, 0xdbb4c52f18cd8f2full,
+	 0x3f3054ba5d7fa6a3ull, 0xc19ceb927ddd6f7eull, 0x7db39a9f3a5f12e5ull, 0x4e90a2520e9078a0ull, 0xb9a3093062719b71ull,
+	 0x2b7cc88f06196504ull, 0x3de4741c419b4eb8ull, 0x82db67550959642cull, 0x7f02d2cf2bc16f00ull, 0x468b2e3ce79dfebcull,
+	 0x7223ff8c71579401ull, 0x5994587f355e2f09ull, 0x9b0f26808ba9722bull, 0xb7d36b0269eba55eull, 0xf715b5dbc9f61c74ull,
+	 0x69057ca6bb92e8bbull, 0xb6f6b0b500860503ull, 0x163b8577ceb0f06cull, 0x54c90835d2b5791aull, 0x9e3593ce44bf82feull,
+	 0x6e1c0581ed6e7676ull, 0x24756ed9ae31eb44ull, 0x09a3d11b2919bfa4ull, 0xd481af90e7db98f4ull, 0xfad413716f3f3802ull,
+	 0xe1ff1def95cdf1fbull, 0xbbd6e374bb36e490ull, 0x45cae5e65289b6abull, 0x53949268dc672fabull, 0xe2536011e642d540ull,
+	 0x853467f81a8c70c9ull, 0xc76100c545add5e1ull, 0x83df2ec9582e4492ull, 0xeee89364120ebfa7ull, 0x493ee987e79c4338ull,
+	 0xe0be2435f453bcbfull, 0xde0552951eef4a03ull, 0xdfe529e193b5c1c5ull, 0xe0242b9132e7af54ull, 0xbbb590c448864181ull,
+	 0x85fbcc8ae82e7761ull, 0xc85feaf4ffed480cull, 0xd2b336ada46cf521ull, 0xd4a8a4e9b9c98392ull, 0xf775edc443278a18ull,
+	 0xf5819e35f18d9772ull, 0xac213307ce5952b0ull, 0x344a01a56f4bd7ecull, 0x539391c3845ecfd2ull, 0x921055b52049c438ull,
+	 0xc9cbd9fa68f2dbc9ull, 0x2a56b2d6b1561dc3ull, 0xf68ecba1b7ff5632ull, 0x158c6a699daebafeull, 0x1caae3fab4ca781cull,
+	 0x5f63697da15c704full, 0xdb6dadf35a116517ull, 0x918303f069ee917aull, 0x1f0bcd31ee96c3ceull, 0xd3ca7e09771752f9ull,
+	 0xf0e9297e177c56a0ull, 0x4b53835699d28693ull, 0x0cfd970eb590df5aull, 0x2bf1f03adbe2dfc9ull, 0xa2f768a0f761cd2cull,
+	 0x7ccd85f71edded51ull, 0x912a15534bc35571ull, 0x229766484af8db30ull, 0x374de5be2365a28aull, 0x9bb68e82203e096dull,
+	 0x6e11fc53c563c987ull, 0x4b710bc3c48a2668ull, 0x239a41ea074b5510ull, 0x1ff6dc5283e9317eull, 0x3058adeb27a97ba8ull,
+	 0x98f606390053935dull, 0x543fe274fe7b7358ull, 0x6aa2e0f04fa133c2ull, 0x3810a37b129a48e2ull, 0xefe45f27d1d375eaull,
+	 0xe884858c902d4446ull, 0x745b94228da1d866ull, 0xa852c540f5169033ull, 0x2b7a4150c2a5e3f5ull, 0xeed86956639ecee9ull,
+	 0xac2090835829c089ull, 0x34cc015f50eaa3bdull, 0x6bfac52ce36282aaull, 0x1246e08daa12d3ecull, 0xe092b5cb6e906768ull,
+	 0x485774a3797ff0fbull, 0xa675010fd129a8c5ull, 0xced8dba57668c69full, 0xd9bef1b58d4e7009ull, 0x116da033a6a0f2b8ull,
+	 0xa7711afd6902c2f9ull, 0x77fac082ffd33a5cull, 0xafd81c84230519f8ull, 0xa53b6bb68a1b66c3ull, 0x880f5effae9d6612ull,
+	 0x6cfcf2ed94c82758ull, 0xc3b9dbad51234b44ull, 0x47984f19b06ae231ull, 0x96f7976bda6be946ull, 0x08a64cf5bda56f65ull,
+	 0xf6871066d47200e0ull, 0x6c66b5f47fae8ca4ull, 0xa4c461ab7356206eull, 0x9f007e3e9991a13cull, 0xb1fa6a7b7066b384ull,
+	 0x7dba40712d6e4648ull, 0x72f525356b763477ull, 0xe87d49bb04c2337bull, 0x461905a88c2cba10ull, 0x3ec0c1cbcc8b2214ull,
+	 0x1fd05f7ec0082dd2ull, 0x92fcd2524cf7307aull, 0x05732ff110bafc18ull, 0x940c90ab892409bdull, 0x49e1806651ac0f22ull,
+	 0x4e44c760bfb5bf1cull, 0xdbf2a05335a9a338ull, 0x8b70cf6ea3548239ull, 0x5099f53b03f0cb8dull, 0x55aace8c6b392631ull,
+	 0x04f3cf2f7295f5cfull, 0x52e34f7a62b5aec5ull, 0xb272de08802b75b3ull, 0xe1bd3f089ddd22bdull, 0xd7c42e7942011223ull,
+	 0xe7bf725429914ef8ull, 0x9a8ec8aa51951a12ull, 0x308b4a425204d0a2ull, 0x34fb63abdbd9a665ull, 0x33ecc09bed128c86ull,
+	 0x9739af9150883268ull, 0xe9b2c66447c46f40ull, 0x4d636dd15cd12c43ull, 0xc12d348706823d28ull, 0xad965c4ce67523d4ull,
+	 0x8c216c5f7341282full, 0x3e4aa7cca860e3a8ull, 0x7949e7fe588bc3eeull, 0x55cf6c80bb56b8f3ull, 0xa0c09fbc996b90b2ull,
+	 0xf66488fc4c7ed7a5ull, 0xa1607a14bf93ea13ull, 0x5558c5cd895eaf88ull, 0xfc8b0ab0f2154724ull, 0xe3682c688d2d4a29ull,
+	 0x28d498f38806bc7dull, 0x17b96ca61802b5b9ull, 0x63bd80d4af4129c6ull, 0x93827e1b4357218aull, 0xa55ef039c2bab5b4ull,
+	 0x22eabd9fcaedf6ddull, 0x037b6880587f1c33ull, 0xd2c7c70813bfa2d8ull, 0x7d6a8507f30c0f5aull, 0xddf0fbef5500c705ull,
+	 0x94f8495250927483ull, 0xbab0d03a98dd3500ull, 0x8c7ca5dc5d696f07ull, 0xf346dfcc786a837bull, 0xbfab9903b9fa2d04ull,
+	 0x41b2f15fd42ca60cull, 0x7c4c5eddc1243947ull, 0xf6247a97f169895aull, 0x34ce6401ff7031aaull, 0xa30a38283b3592eeull,
+	 0xd3f3fb647f114f79ull, 0x2ed263cc3b651399ull, 0xed388c1bef523865ull, 0x9de03d5381e9bcfcull, 0x8817ad3489375a27ull,
+	 0x635ac92531489fa8ull, 0x55a59ea61f0e16adull, 0x24cea8f1f7417952ull, 0xbc1538a8279608d9ull, 0x64d924f51b407ea1ull,
+	 0xc545fd0225c9f2cdull, 0x50a2da0d3d3433e4ull, 0x95abd2f0885be979ull, 0xec1cbb47b82b7f2aull, 0xdf36a3aac71d0f0dull,
+	 0x7da86398b6ccfa2eull, 0x57c118906d61f291ull, 0x5f3b17d34beb57cbull, 0x594c62d0dfd37df1ull, 0x31d908146d951569ull,
+	 0x67c83c4f7253fdafull, 0x7a01910d5e6d2f29ull, 0x41ae0f69bc90fa9eull, 0x6791dc97e8b4111aull, 0xc47e7f000ad58c58ull,
+	 0x6c632619b865c8dcull, 0xf1d5edeecd84382cull, 0x39eb8ddd85002fcdull, 0x4a29962382756199ull, 0x1de46ff57829bff4ull,
+	 0x4a49434c12dbabf0ull, 0xddd69955daa56780ull, 0x964978f8640e3b35ull, 0xc74ca46123cafc08ull, 0x57465b16ebd852feull,
+	 0xdbf73a7a35543175ull, 0x2e2b735574be0958ull, 0xe13750bf4de14ad0ull, 0x945c5baaf63da009ull, 0x1d60b941864ccb10ull,
+	 0x79b1b4f9707cd642ull, 0x16ffc41843f6c6f1ull, 0x925125f257a09d90ull, 0xa153f50596cd4df0ull, 0x70da294c1f68c112ull,
+	 0xa959149965d2c120ull, 0x946625308f715287ull, 0x6a0fb25ed94af212ull, 0x1e3f31fd25df8335ull, 0x9378c8fd8c82d388ull,
+	 0xc121fe99838897d2ull, 0xe55202eb815a21a0ull, 0x234149cc511e90a9ull, 0x5dc37edd17809eb6ull, 0xe72fb48c2384bc74ull,
+	 0x4f65fbb5a231e58dull, 0xc22befbc24c3746full, 0x8a763da4346e4078ull, 0xe6472fb8503c8f7eull, 0x539c31022ab0ddfeull,
+	 0xb195155365d9598full, 0xb9114fc915e7f649ull, 0xc50455e76e028739ull, 0x992f0f0c43ac0d25ull, 0x11ac59147f872a47ull,
+	 0x414064f03f1b16f9ull, 0x2ddc3af6dda66ab6ull, 0x79d61f2bfdcbd5f3ull, 0x3d2344326997ae90ull, 0xd5f6b2190bf813a1ull,
+	 0xa4d2ee733b7c9e64ull, 0x4c8e5db56e900f12ull, 0x0f2f0f3f1d264112ull, 0x66bb562b739fdaabull, 0x20c6e68ebd32fcb4ull,
+	 0x573f118fd426179cull, 0x18817ac14d9c345cull, 0xe099586f062885a9ull, 0x4c01ee36c2144137ull, 0xba16db54f3b369e4ull,
+	 0x63abc307028371c7ull, 0x8ee2518e2c1f2671ull, 0x3d7f21cc777d8122ull, 0x66d032169741216full, 0x2af993dde2792ec2ull,
+	 0xc2bc0c0d525a4d77ull, 0x5dd936104ba53fdbull, 0xb5a7a4d5d662b397ull, 0x9afff8c8fc9a1256ull, 0x09acee203bbf7d4full,
+	 0xb7f90f7cc19ab1caull, 0xeb477f5e89145440ull, 0xce641e87627f0c53ull, 0xcd7b6a80d9a7fe28ull, 0xd8390dd501e08d71ull,
+	 0x2b9f182aeb228d6dull, 0xe5a794c92e0ad463ull, 0xa2bebf407051a160ull, 0x47f9f104ca49dc4dull, 0x0e123c56f5f690d1ull,
+	 0xe0f068e3d5f607a9ull, 0x31361a5d051ee079ull, 0xca563fecded7ab3bull, 0xd7d3dd38fc6ebc72ull, 0x3e179cf3371b6dfaull,
+	 0x604b800ed0a013d3ull, 0x166d49dd3f7a7117ull, 0x481660f45114d107ull, 0x464cf32b7ba2aebdull, 0x02096062967dabbcull,
+	 0x6b02ef8cf1e085e7ull, 0xcf13a14a201aed77ull, 0x4a8aff7b02adc74full, 0xc6a758a42ab87317ull, 0x80370b8ac7c5a332ull,
+	 0xe21005cb9b44991eull, 0xad7b49b20152d391ull, 0xc7ff13430cb4d862ull, 0x1555178e719d7ba2ull, 0x33819d328307b3f8ull,
+	 0x088397e12dc5b773ull, 0x0e2df92e33a6d8f7ull, 0xb717e87bfc600bf2ull, 0x8bc6087b9d74a752ull, 0x0ee6c714cc2e0050ull,
+	 0x8ee60743df5fc410ull, 0xa37c1cf6880c4246ull, 0x3fd314a8c6a639dcull, 0xfe22ccccb1b5c9beull, 0xf6ab1383ee41ac4full,
+	 0x9534266b210233b5ull, 0xa8716d9607abf13cull, 0x77e49662e5e27ff0ull, 0x9fcbb572db29af6bull, 0x0975ad04fcbeb7afull,
+	 0x341fd9ca1eb68d7bull, 0x8a64a79f6dea29ccull, 0x2d78db27d76b4c8bull, 0xf76046fdee1ea779ull, 0xde0fa010b7dae41bull,
+	 0x3c4980114255628bull, 0x8c5fc7ed4de64cf6ull, 0x4ac72b0b907905c5ull, 0xd33209336faa9695ull, 0x5c69eff80c5cccf0ull,
+	 0x84a04ee1365c5385ull, 0xd439867ca914b083ull, 0x05faf399e1590d85ull, 0x483354d85328cbb6ull, 0x1572dfd39cf505c2ull,
+	 0xbcd434b9254176c8ull, 0x943169a0b88dbc9eull, 0x72b927cb55f4db42ull, 0xb9905c195c6b5fc7ull, 0x8ca063b68579ee63ull,
+	 0x94564f6015fb5a22ull, 0x6a7ef17a142b10aaull, 0x3ce383e196a0524aull, 0x141d19fa9c0b1cfcull, 0xb8c36139fdc0dd83ull,
+	 0x049958ce75ce2750ull, 0x487c02c29cf2b049ull, 0xac0dde8657e5f841ull, 0xdbc3f6f8f46313d9ull, 0x36c8490cc583bf81ull,
+	 0xd42871429c0cfde4ull, 0xc96e6349048ff294ull, 0xa1b0cc9740888f47ull, 0xfad2d7b80a56a952ull, 0x7291146bf3058be7ull,
+	 0x2e5ed1d53be093c8ull, 0x4f2aab0e68eca800ull, 0x34b1cdf2a5e0114bull, 0xcb7a5f2b0931da67ull, 0x48d420dee7bd8a46ull,
+	 0xa024495634a5d802ull, 0x20d248a644197844ull, 0x79c134431029f289ull, 0x08f9a195c1bb9a9bull, 0xdccb37127bbce143ull,
+	 0x82bf5eb7d36dbddfull, 0x9ec538382936fc47ull, 0x7fe43dd432ce197aull, 0xec3cc9296f0b6817ull, 0x6df174737784aeafull,
+	 0xdeac7d911e9a5111ull, 0x676f6e5ff0b9fc96ull, 0x48d0ed9644d92f10ull, 0xe17cf155b4856e59ull, 0xdd287653cafd3d64ull,
+	 0xd6765f2ba92e28b0ull, 0x70678558e90adb9aull, 0x86ed09f868f1a787ull, 0xaccfb6f247585dafull, 0x2ad0f901c51c912bull,
+	 0x305626b6c1e9e000ull, 0xc0f11c8f8d319efeull, 0x6305f39410d29984ull, 0x2e80a2c8f06d20ecull, 0x2d0c62840e561db6ull,
+	 0x62e1a160e31d3551ull, 0xdf694ed5c6bc81aeull, 0x8b00cd9a641dc99bull, 0x0027f53a4add56bdull, 0x37dcb66360bbdcf4ull,
+	 0x0fc2d246176b59ffull, 0x781dcffc1d9aaf36ull, 0x6e2ea04b85995193ull, 0x428a770981afb235ull, 0x1759ee97c7f0584eull,
+	 0x8d8ec62605bdb4f0ull, 0xbc2f287b6c96e13dull, 0xbe73d915d2ac727aull, 0x4eb3bb99e56a3a8eull, 0x20d300c8fd39df5eull,
+	 0x1953337b8b1e10c0ull, 0x47f72b70cbe0e776ull, 0xe95a18c07cb633aaull, 0x7c30a0629a7be7dcull, 0xd333a86ebb330ab5ull,
+	 0x4a18128b2a126dbdull, 0x1f2ae3b0ad895e7cull, 0xd441d27df1921d03ull, 0xd51b52ab0f83ea9aull, 0x797d4780dc94e0c3ull,
+	 0x2393a58796da2636ull, 0xc6fca387e3c6c458ull, 0xbde672f0146aa45bull, 0xf913c032c7520565ull, 0x9a7e04a796b4d6c2ull,
+	 0xbddffb5e5072d4b7ull, 0x2f3e6711f7e2d53aull, 0x054788a6a89ba626ull, 0xc94557d81452f146ull, 0x254a75285c1e0746ull,
+	 0xa091e00ff4a105a9ull, 0xd1f40127951eff84ull, 0x1477dc926466c243ull, 0x9256e6c71da4f07aull, 0x6d1f3d2957d9a37cull,
+	 0x894814f484da5d2aull, 0x58063f2eba73b6beull, 0xcedc9fa7068527c5ull, 0xc74a90bb6015b34dull, 0xee8e84d28418c5d6ull,
+	 0x6f29fc4422d7a3d4ull, 0x16adfbf4fc18a6f3ull, 0x950f40ed6efc9b55ull, 0xecfba375bcc5ce5eull, 0xce0e9699cf8432a8ull,
+	 0x04d76aeaaf8bff9bull, 0x62f01342f704effaull, 0xf7041eb07b7a2fb4ull, 0x97e47e02b2d892a8ull, 0x6c8e6ce1f75e6206ull,
+	 0xd2f9d07e2c1a6c6bull, 0xb498dab1a35e9fd9ull, 0x1ff62879f02fd878ull, 0x9961dc98399141f9ull, 0x5db1e5504cbae2f1ull,
+	 0xa49561129ab87241ull, 0x97fe2ebb0ef8e89full, 0xbdd01b6bca9ad703ull, 0x896fe4fc83dd6da6ull, 0xeac464bd7ab5ca31ull,
+	 0x4e988b6fbbc722daull, 0x68c42b9033a723ffull, 0xb40321094698755bull, 0x305ab5d624ac419dull, 0xf4bddaea51ea2245ull,
+	 0x25c8f7018966e686ull, 0x757174a54eac27ffull, 0xdd556f5dfea31f01ull, 0xf13399f72a2612c4ull, 0xcdcdbdc64444f3c9ull,
+	 0xad2338d8cfb6913aull, 0x1f6f2abfbdc1a4c5ull, 0xbc5792ecd82806edull, 0xfbacd13ee234d77eull, 0x997cebacec2bc046ull,
+	 0x523fe3c709563568ull, 0x0e04fab0316c6e3dull, 0x28ac609cc38d0b84ull, 0x04bbd2b1b9536734ull, 0xde31126d52668e44ull,
+	 0xaecdf0f4d1336cb1ull, 0x79ca88844fc8e9eaull, 0x90a928b801794e59ull, 0x99cde07769eac5feull, 0x2fbe42746343c04bull,
+	 0xdc72f8e7dafc5d2dull, 0xb48800a008090ee8ull, 0xc831d83c97c2feb8ull, 0x6c17c3c3db9a072bull, 0xf8402575321f9242ull,
+	 0xb2773f596765e2a4ull, 0x7d93424b42b807b4ull, 0x0e383cd687f8e00aull, 0xa22755acac93e584ull, 0x771b80f233cc261cull,
+	 0x0ee7b0b4f9f2e4dfull, 0x92355e66b176b176ull, 0x33c6e771ef1bddfaull, 0xfb02601c4d37089full, 0x10120665e197d43bull,
+	 0x7157299aa369a555ull, 0x72a8add94ab8f9d9ull, 0xbe521fb68a657648ull, 0xbfe2b04bee979977ull, 0x6bc6bdf8f91172e8ull,
+	 0x0d32782d704048baull, 0xc8d08bdd97ef2b12ull, 0x2deecbf84b68ed37ull, 0x4a8f87e43af34f47ull, 0x798c94e888d7604eull,
+	 0x0fc3a2903f548646ull, 0x7f2d6ebcebbd7e6dull, 0xc5f5a490f3c928b1ull, 0x78a3c0cc5ed2ed4eull, 0xead4df7bfe7dce48ull,
+	 0xf5a898ae563e06e2ull, 0x2b1c2886fd284aabull, 0xfad7945a50d1743full, 0xd3e4c858e8ab9f39ull, 0xc6132b0c5200bbc1ull,
+	 0xe450d020c1016710ull, 0xb686d5b2628e4890ull, 0xff9b7b52b509878eull, 0x4c67efc67431cb40ull, 0xdb1db2424dc45659ull,
+	 0xb1e053b008b6d768ull, 0xcebe6eb0d36159b6ull, 0xa2e469501e6e3222ull, 0x2d89bf4fa0a7e744ull, 0x758c1026f49aa763ull,
+	 0x3ff3f0adea1995ccull, 0xbc3ff11ecd2603a2ull, 0x5345b7d1662755edull, 0x3ee6df76cb5c124cull, 0x3d7ac73ca138d877ull,
+	 0x65bcc018f6e86596ull, 0xbdd49de7d4a8a8acull, 0xb171caaea7520acdull, 0x69b0c65caa3f57a7ull, 0x73cbb2cd9ca10534ull,
+	 0x176dbddf29cc40f4ull, 0x96fac7fc3617b2d1ull, 0x510be6b1e45ddb1dull, 0x1cec2e270a3f0213ull, 0x5a5b631654e455ebull,
+	 0xb912809f86e526fdull, 0x522a66be7c6e6891ull, 0x8a042b448b16e5d4ull, 0x9dbbd607692e407full, 0xc9c0fbfa40b62af1ull,
+	 0x1231718cdf9e5169ull, 0x1b4bd4b039e2311cull, 0x22ec2006d38d1b2dull, 0xfe5d339f36259aacull, 0x701d50533536fea4ull,
+	 0x5faa121dd8764ffbull, 0x9525d3be6f4ef5e5ull, 0xe1dc4445bde29152ull, 0xa5425397d640c095ull, 0x6b340594c8f56925ull,
+	 0xf3b5528d76a2ebc0ull, 0x96ea1d64aa68be88ull, 0xbb676f2ef3658a14ull, 0xa478c54b86fb212eull, 0xe776bf2bdec365e5ull,
+	 0xd90bed181723510bull, 0xaade0c5fc71955f0ull, 0x576284d69173daceull, 0xc1a0f3d2a80029baull, 0xd255a0d337e98b57ull,
+	 0x323fcf30fdbad149ull, 0x7887b22f88414570ull, 0x470e6b3931efd88cull, 0x1eb8fe852f9dd822ull, 0x94e9cd16f6212527ull,
+	 0x7831079e741400d0ull, 0x03c1d992dbc6f503ull, 0x0a48c63fceda9815ull, 0x23a60e92121de189ull, 0x29dacc0438e04b31ull,
+	 0xb129cc569f007df2ull, 0x5f901ba354e137afull, 0x7649555e152432d2ull, 0x724d01dcfe28c246ull, 0xc93838eb30f04a81ull,
+	 0x1261defbfc8f7415ull, 0xed23c08100c09361ull, 0xa27ccda19a7da8b5ull, 0xfbe7dafaaa4f06b2ull, 0x013e38ff406674d8ull,
+	 0x932b54ca68894b0bull, 0xefcc0623383d0580ull, 0xa165bdd47b9ffba9ull, 0xaffb11c4fe0b0619ull, 0xec945eccc58143f9ull,
+	 0xc99178fac2cda1f7ull, 0xc6291291031d4ab0ull, 0x82573705484965d7ull, 0xe372e82890735bc9ull, 0xfc78e79404079df5ull,
+	 0x99970ea0124d2537ull, 0x928207ff28d4fc61ull, 0x30177039e17978beull, 0x286272dfb40988b7ull, 0xb7c3d8459de92689ull,
+	 0xec0f10688923b39aull, 0x83ddc23db8cf7a02ull, 0x0bb6151db1b5b9aeull, 0x2fd5ebd82e0499bdull, 0x37f9a92168cd068bull,
+	 0x6f0340e2d7c05f34ull, 0xd00b60edc3284f71ull, 0x2e90c8de9d88b0b0ull, 0x369bb208957f909dull, 0x0d4b500696e8354dull,
+	 0x6bbe74a68f82cfcfull, 0x3e28b457c5e95c61ull, 0x61278f54f9da8a63ull, 0x668802b3250193c7ull, 0x94128e38367e811bull,
+	 0x5d5de452120868adull, 0xd0127bd8af81ea29ull, 0x4c78bc8ed9dccc57ull, 0x826db56f3a980c5bull, 0xb04a8a32e281259eull,
+	 0x2a696e4cc77c084cull, 0x925a00ed9efedb72ull, 0xf353a28c066245dcull, 0xad761ac51d4ec3c6ull, 0x23e31cde3471f2ceull,
+	 0x2e85d38e9d9ae5abull, 0xc84aea6b51aa00daull, 0x3b98758c506bc646ull, 0x6acd7499c9b51ab1ull, 0xd908c058433e2155ull,
+	 0x95fbc4d47f26cf78ull, 0xad8868dd0854f9f5ull, 0x724b4118e1bc8ca3ull, 0x6fefcdfa3a4d4953ull, 0xf368006d29547490ull,
+	 0xf6ab6c53c1cb842dull, 0x752ba2ccafff1cb3ull, 0x8a9a8c38bf1760ceull, 0x5cb5a5c63f48d4ddull, 0xa7fe6aeb2063a335ull,
+	 0xc1594184101b5b8cull, 0x58b45f708f860fe8ull, 0x34389330692fb88cull, 0x2527400169911cfbull, 0xc9829499d1b6c80eull,
+	 0x9d2f3a61183d22ebull, 0xf3476a703290fbeeull, 0x12785a617145728cull, 0x459b408139b3256aull, 0x592b4ee9b9d6238bull,
+	 0xd0dd8fcbc2d991d7ull, 0x1a2e089249618c2cull, 0xd8afb2e71f22975bull, 0x17ef9d291268fe4cull, 0x4aecd41fa75563fcull,
+	 0x15129dc26370bbdfull, 0x8d4c83c9b5aef428ull, 0xc2843de42980263aull, 0x4a39e2384c6cf623ull, 0x4710cedf46c6b69dull,
+	 0x03ae97d5f6fda9aaull, 0x68876d9ce4900314ull, 0xc1f2f56fd233ec70ull, 0x34153b7624998d15ull, 0x50dd7d2124bdb75aull,
+	 0x3a3ebadc07e3c242ull, 0xe8826edf2ddd789aull, 0xe367d7da54465df2ull, 0x3dddcfed16c8a3abull, 0x0b8092d166311951ull,
+	 0x678e3d3d43381d96ull, 0xa825280160d3192dull, 0xf2c11b38ffadae1full, 0xa01299571178efcaull, 0x97e3851bf681e65cull,
+	 0x5ca5782fb8dc6365ull, 0xf8a56a8f8dff668dull, 0x9c2090cdd96065c4ull, 0x79fe0bd910d894b9ull, 0x458c6b70a91e8568ull,
+	 0xa732ebedef24db9bull, 0x30005a47037c277cull, 0xfc4a5c383aee99d5ull, 0x7b448ce9b8a90982ull, 0x4efe3ce719da27b2ull,
+	 0x97718658eaa69358ull, 0x1dadc4feee64fc3aull, 0xb92f72572139f2e1ull, 0xa227e42867cc0543ull, 0x72b7c386969c07a3ull,
+	 0x5d34f3fb08542a57ull, 0x745bfd67d346ed98ull, 0x5f6680c13b0ede1eull, 0x22b1d187b1264f45ull, 0xd7f5699979d2b5bfull,
+	 0x7cdad82ad3c65198ull, 0x3d50028133960808ull, 0xbda8f9f2292ef3d9ull, 0xbde989c2a8208821ull, 0x48648a2d948ed5c9ull,
+	 0x16f1126ae439dd23ull, 0x3ff2d52ceb0f1f24ull, 0xd170ebcc840a669dull, 0xcc51ba5711f4699aull, 0xdab40b1604f0bdc6ull,
+	 0xcf4747b0034960d9ull, 0x66da34784939e85dull, 0x31fb05eb565ec038ull, 0x90b4a0b3a82a46bdull, 0x62e632429e1a22a3ull,
+	 0x8178edae1e3f5fc5ull, 0x8c9a199c220e2416ull, 0xcc8b9e942793a788ull, 0xa9418caac6501b99ull, 0xa6c7096ad63930a8ull,
+	 0x9715440e293b11deull, 0x1cc57887e9ff41b8ull, 0xfa7429629aad35d1ull, 0xcbef9af59fa91f33ull, 0x1a721c4f575b7a3full,
+	 0xbb1ac22170e79ba8ull, 0xc36d0f8cd2db111dull, 0xbf79c026ea197127ull, 0x6f054bd4952218a1ull, 0x4c49037d26b7ed12ull,
+	 0x004e733cb5147c2eull, 0x4cdce870e6ee5789ull, 0xda07cc11d0bb814eull, 0xae8d676c99d71d1cull, 0xbc132d9c301c9186ull,
+	 0x1c70280281fb5850ull, 0x3be6b1d8e15c5f92ull, 0x3225801f9e2a702aull, 0x2e04215be63a9c41ull, 0x6eb45c800005fdecull,
+	 0x1f6aaeb7f0573fa3ull, 0x82a3ad74a12094adull, 0x48bb4514eb5cc79aull, 0x065ffa7745c29e32ull, 0x5c8bc992536561f1ull,
+	 0x72df352e300a749bull, 0x0147138389ded3aaull, 0x0fedf6f0241855ffull, 0xbf65755a9ed8acfbull, 0xe3eb93f7eabb890cull,
+	 0xdd2b10a7bf9d44acull, 0xe30b07bba1b2561eull, 0x54c8af0409ad9364ull, 0x3eedc3112f59fd8eull, 0x17f4bbc6ea5a6571ull,
+	 0x8a5ac83025339f66ull, 0x0bbedad50571b9cfull, 0x771a267f2d21598cull, 0xe4f9f3c8006eee39ull, 0x4c8565a7a558e035ull,
+	 0xac3ef260ac30136cull, 0x308a9502dd003756ull, 0x026f33b61a5b8dbeull, 0xc9510d00b993b696ull, 0xb2f8ec3300f0be9dull,
+	 0x74c55ec3526a5a12ull, 0xbb9e3656e39d9206ull, 0xad17ee22879ef9dbull, 0x8b0db830a8572614ull, 0x9e1ebe529768a1e9ull,
+	 0x1cea8dae71d72db6ull, 0x62c699fb6ad6b07full, 0x2ed646de56360432ull, 0xc309bcffe9397933ull, 0x619fc8ff0f813d22ull,
+	 0xd8a02cad8a6c7ba8ull, 0x2c9d4cf99bc38917ull, 0xe69591a323246ecfull, 0x920c28824d9e24c0ull, 0x3e1808d02e1630bfull,
+	 0xe615a4152dd2e2d4ull, 0xd08ff4bbe113374dull, 0x9f5a11396ca715dbull, 0xbd9eed6e6fe9bd5eull, 0x8206ad1c4793270bull,
+	 0xe8770b118bdc81ebull, 0xacfefbf81587d05bull, 0x4549ec75e0725322ull, 0x00ade900f6a4bd40ull, 0x93e8d9534738d8c2ull,
+	 0x5b11df1ec9ad9c6cull, 0x8dc9ac91eff9d6c6ull, 0x5b5bb4266588e11bull, 0x05b41fb527d3dfecull, 0xf61ea3fe8587ecaeull,
+	 0xf81785144ded7096ull, 0x7b5f0a58109606a4ull, 0x31681d806f19355dull, 0x8a7fff69a4b2257eull, 0xdb1058c1248be752ull,
+	 0xc1fdac7a48c09994ull, 0x56ab67b587e6e368ull, 0x5bc278398dc649abull, 0xd35780dec0fcd830ull, 0xfba7361a0cf43e5cull,
+	 0x39bcf8777035084aull, 0xcee74a985d9a1da9ull, 0x414ac14a5fed639cull, 0x246cdf470040afc7ull, 0x4923326886c2058full,
+	 0x66adff904575eb42ull, 0x42d1f4bf636063f9ull, 0x6be1b9480664c6dcull, 0x7157125db44a8046ull, 0xa9961e2881ac22afull,
+	 0x5385622585672f95ull, 0x4168b0a634fbe862ull, 0x12db6b680af2e1f4ull, 0x3796cf7e08069e81ull, 0x751511d62949a84cull,
+	 0x08add84989db968cull, 0xa81047ea00634f44ull, 0xccd9d844038fd459ull, 0x22fdd2552ef82637ull, 0x8e094d253b233c56ull,
+	 0xe0a295e59708de7eull, 0xd73bfcc6f0d036c6ull, 0x42be773a26ee7b8eull, 0x7b17d64a0ae7dc6bull, 0xc0307f993bd80fb1ull,
+	 0x2ba18364fd7a73f4ull, 0x1ec4d214f9383ebcull, 0x0825d6bf365692f5ull, 0xe5acc69de162404aull, 0xc8d6b3d450ea2fe2ull,
+	 0xa4c88595ab29bed3ull, 0xdec4c1c340f3c4c1ull, 0xdcb8b7f09baa1449ull, 0x6deb1f3e0ae25324ull, 0x7d2ba417aacf6ba9ull,
+	 0x9def10b824071049ull, 0x38db61b3afacb3f1ull, 0x90c4c03b2bcd0447ull, 0x220b339244f8ca19ull, 0xf1b3939a6e532c72ull,
+	 0x239c3c9237e95a53ull, 0xa4b0375349489473ull, 0x2b1bb804203455b9ull, 0xedc63693afad54baull, 0xf1467849d084d4c6ull,
+	 0x1f7fc471269f01d7ull, 0x20af8967afa088e8ull, 0xc13e92413d99f8beull, 0x36962adf9daed4aeull, 0x8e15ef67b73b611aull,
+	 0x9e42ce3475dac124ull, 0x412698e09d3eaab5ull, 0x55ba3b03f68f50a7ull, 0x3cbaa536ed0bd1e8ull, 0x5749115cb1698528ull,
+	 0x11f470ea06a547c6ull, 0x41615c9ba1d00c73ull, 0x07c9f4e28c65831aull, 0x612895665e29987full, 0xe10631a883721e2full,
+	 0xb3a69c52cb2f8bb6ull, 0xcd1655278e4effc6ull, 0x970a00be6fdd8866ull, 0x6320d9775e334f0cull, 0x8478824f36ead585ull,
+	 0x284db15b0eecf722ull, 0xae87a6b72f9e4bb2ull, 0x5897448675aeade4ull, 0xe91c1d487b9894c6ull, 0xdec993ecf2efcda6ull,
+	 0xf9b7292f99062942ull, 0x38f22c6f7c0152d6ull, 0xb9292f70a1b57b5dull, 0xbd8a6f6a2727e230ull, 0x78760ce852028b3cull,
+	 0xe3f4ff9e4495d180ull, 0x4b61400aa5c3e2fdull, 0x8fcf993930cf3adfull, 0x0e6a10abd521ae53ull, 0x500106683e8b84cbull,
+	 0xc3da7197d3f0a1e3ull, 0x5583d8fea8999a5bull, 0x5bae3550ce6757edull, 0x84c365128d0d47eaull, 0x2cbc17cff602995aull,
+	 0xda5c12554b05bfabull, 0x6bdfd98006130372ull, 0x349477dd17adfce4ull, 0x9f2c9166dc8b0797ull, 0x7e0c1f6c7985c3deull,
+	 0x9f7dd27aee6dd12dull, 0xdde6ac8fd072dba8ull, 0x7bcf15f4c353f265ull, 0x93804869e89acf56ull, 0x26a5b78aedabe030ull,
+	 0x2b66968e1ced053dull, 0x4f7f86ab9d60ea27ull, 0x52daccf415a85441ull, 0x869b2c863caf4d23ull, 0x508df45fd735a2d8ull,
+	 0x4a7c57ea86fa3fc0ull, 0xc103aab3cf21fb8cull, 0x9e4672a5a31bb6d1ull, 0xa76775dfc6c98fcfull, 0xed18d36d5c8043f9ull,
+	 0xb785f000906b65efull, 0x84a5d4a9a181a036ull, 0x8b4377c32c8086bdull, 0x20541bc18f1bfce5ull, 0xa3ef75f0b8fed46dull,
+	 0x17c9665815695ae6ull, 0x8626a0a680292c10ull, 0x511faf7e008a595cull, 0x97a7ab8f6c09d214ull, 0x08b54cfc3d445bf8ull,
+	 0x102a0778932c84bcull, 0x80145ef9256ccaa5ull, 0x71b79e0698a8c02eull, 0x0b7a12e1eadfa920ull, 0x4c0fc2438c91f822ull,
+	 0xffe2384f27475b8dull, 0xe968c8d9fd4eb500ull, 0xf58138a0d30a3daeull, 0x2337794b3e12e62eull, 0x4fa7ef7f793c130cull,
+	 0xa9c17b33d532fc78ull, 0x9941a507caea90b3ull, 0xd391265eb419775full, 0xaf07ea2bb3b37291ull, 0x460242e2391832a5ull,
+	 0x6a1fd86b403bca1aull, 0xe3204d4876c3789bull, 0x21cf55cbe7a464e8ull, 0x623f055854f05566ull, 0xd1758cec05a57788ull,
+	 0x770731d4293cbf8bull, 0x0bb3ac18f9190f09ull, 0xf92ecc1d7d3e1217ull, 0x606d7dd69624ef29ull, 0x0edda22b7ea02658ull,
+	 0xd3a2028c66f8738eull, 0x9d6d3b51bbd585ceull, 0x9a55cdf412996305ull, 0x7171366a3d6fe2a5ull, 0x26f50ea0d790824full,
+	 0x99333acd28933716ull, 0xb9fa900d2863995dull, 0x7726433c7b0aee3aull, 0x8a4efc9eba6d2b85ull, 0x6af45ba9c4757411ull,
+	 0xbbd049df06c1af80ull, 0x6c170f67d83163c5ull, 0xa00a29a030cbfb4bull, 0x10b7932726eef7a3ull, 0x2ee50b178778827dull,
+	 0x5c050c44b52e12d9ull, 0x081d036d5e5eea69ull, 0xfebcf46d7a04003full, 0x090aa81ca3c21ab1ull, 0x202daa418a34d39cull,
+	 0x7212456a289b7a59ull, 0x0cf25809d0c6e7e7ull, 0xccacadc505705391ull, 0x6a8f8a780294ef0bull, 0x79d20e2c9613ea0full,
+	 0x98b81337fa989bafull, 0x64cbc2d9e5cd5d4cull, 0x535ca1c421e8cfa1ull, 0x6ab48b261dbb772dull, 0xd74dfa01dcad345eull,
+	 0x6b307510d6a779f8ull, 0xb26a4c25502fea56ull, 0x40a3ea8a00128b37ull, 0x2cb1632f3bf8f189ull, 0xe4e1defdb5b39b9eull,
+	 0x3db47e86aadf3e65ull, 0x2806dfdc1333d0bbull, 0x6ca2f6e8075c7bc8ull, 0xfa3df6a73bc49a1full, 0x7dc628684f83eaa0ull,
+	 0x1d9322c5a42560d2ull, 0xcc953ee021fcebcdull, 0x751a089774b1c885ull, 0x615a77e68ed306eeull, 0x7325949cade7cfffull,
+	 0xf4f2fef23298d7d5ull, 0x9717bc150a871e63ull, 0x6f115a0155147607ull, 0x9d08ab29fbda7a99ull, 0x927973dddbe5fb38ull,
+	 0xc9bb3ad5906f159aull, 0x71cfe3c1f34f9fd0ull, 0xecca3e03f5c4b259ull, 0x0af950dfacd7f6f7ull, 0xf762a338eeb0d691ull,
+	 0xe43b3c98449a4cedull, 0x7247a5c989574242ull, 0x4cff49bde36acc3aull, 0x6b559661c37f88b5ull, 0x8f54d632efc36175ull,
+	 0x57eafcf702c9f89cull, 0x8ce3172cb82dd3a6ull, 0x811b3454426c2ca4ull, 0x7d7788c5c685fd36ull, 0xb078b32cbefd00dfull,
+	 0x1f70c04878dc0194ull, 0x63f9a77ad82e8a3eull, 0xaac1eadcb2cfb3fdull, 0xa2b432e25722f841ull, 0x3cd76e574c291558ull,
+	 0x67b0dd7b9e974d8dull, 0xed0d7754e4c7a069ull, 0xd75b69f02596fa2eull, 0x61026031e8655644ull, 0xb5a88a1d295d91a3ull,
+	 0xd9aa1fc960cee3e8ull, 0x482d3cb376edcfdbull, 0x277a84ce454ccf25ull, 0x7302ab6b46114b81ull, 0xc0f456b9cedf2fdcull,
+	 0xfd830c6624354e0bull, 0x2741bf1ffbd6625bull, 0x4fc12fe16179c43bull, 0xfe9c7b643d546383ull, 0x4185fd748a5bfa67ull,
+	 0xcbdfa09a13d26a26ull, 0xcf2a1314be07c55cull, 0x3d48b7d8785d7054ull, 0x323e79c58227694aull, 0x46018f1b3de28f7cull,
+	 0x03b7095d3e08a4f9ull, 0x4bb7d3bb75688698ull, 0xb28bf8f8a9b380a9ull, 0x49ee78fe2171e63eull, 0x39ea17d42ccf5231ull,
+	 0xcc8cc5d03178a6deull, 0xe64f550548fca608ull, 0x849517ff09d123a5ull, 0x9fcf6c77733d3973ull, 0xc904a0f58844aa1aull,
+	 0xa68aa832fbe3df41ull, 0xf99dd58de0bb5a91ull, 0xc418ba0edf78a43bull, 0x5719594b1dd4b68eull, 0x721f7a8be5521873ull,
+	 0x382221f6275c5dbaull, 0x0d26af485e03d5a7ull, 0xbea9cb3067a6fc81ull, 0x47267ea2eebb30f1ull, 0xa21a0ee8668ed2abull,
+	 0x820b0a07c081ce6dull, 0xba08096796e514b7ull, 0xb645ec8674a4a868ull, 0x06558cd0e78a6517ull, 0x74155791bc3c832eull,
+	 0xa78b2a5914a5b4a2ull, 0xd1eb1ce1af8ca10dull, 0x2e004adbaa4dca13ull, 0x72a35d94f7e6d918ull, 0x866c88bb6a305696ull,
+	 0x35dc8bbc4d59b6b9ull, 0xed14fdce9d35df2cull, 0x8f83be65ec3f6c98ull, 0x24e7ea22844ad5d2ull, 0x90f40e65466cf265ull,
+	 0xf19202257fbb063eull, 0x8b6b0dbb37be43c7ull, 0x6bbdbcc7794b9c2full, 0x8ca1912e2f95da92ull, 0x9d412a57e7a3d27bull,
+	 0xb776647359b2ddacull, 0xe6c2d9fc4e4e6c1eull, 0x9167cd314e0c64a4ull, 0x047cc537d3db43edull, 0x2ae8aa6561e70fadull,
+	 0x18b03a386fad442eull, 0x6700eb0683bb72e3ull, 0x183d7928dbfa1326ull, 0x236ee8cd8acef787ull, 0x90c349b8da8e8886ull,
+	 0x715a746cc7700169ull, 0x025ce5c41f80abf6ull, 0xf28fb1e56b505214ull, 0x1e6c794953f9d80aull, 0x8d018f0eae8644b7ull,
+	 0x82482ff5bd7669a2ull, 0x6c0c2dedf7ea9173ull, 0xe1a0695e6fadd920ull, 0x807a8f35b2b5da6dull, 0xacd605108b6784ccull,
+	 0x7574e5f55afe576full, 0xbc987a0fe0b1032bull, 0x37bc52b24a18d661ull, 0xfccb0ef6ccffa8ccull, 0xc4ae8aadaac34d0bull,
+	 0xdf811286f1a9adfaull, 0xe476ea8442f433f8ull, 0xf02d6211e29cc77aull, 0x107a9f11dc8b2046ull, 0x264d2f14dbcb1844ull,
+	 0x449b100a0cfba182ull, 0x938a5d7299a814d3ull, 0x420edc4249bd27ccull, 0x0512760111a00de5ull, 0x504f70f0ba7b5a48ull,
+	 0x4aa0a3f1f6a08428ull, 0xd13310151c411463ull, 0x00405d6c84a34942ull, 0x2f0082aff96de93dull, 0x98ddc6ae5d6835e8ull,
+	 0xaf9d6cbe811463d8ull, 0x4ea3c568d35d23a5ull, 0x257a9235edb7c8d5ull, 0xaa7651403e32fbf2ull, 0x9b42d9566e640b51ull,
+	 0x58d815d66a7785eeull, 0x97cfe4e22b0286c2ull, 0xdcd098cdeedaa6baull, 0x96c728f0dc707aebull, 0x33a4b376c2944ae9ull,
+	 0xd7bf4f8a4ed82b36ull, 0x62b5960bc2040ec2ull, 0x4d7667e8b6c868d6ull, 0x44c18ff5df763bc1ull, 0xf65eca8fe0a5eb98ull,
+	 0x52c0e63db412049eull, 0xa954a0f5c1203baeull, 0xc3fb59a4c5b169e5ull, 0x5f52ff9b87cbc9f2ull, 0x0fb38708d8b8b6b4ull,
+	 0x7bbfa91f78863025ull, 0x619a52bd579af32cull, 0x415ee08c09476715ull, 0xbec77ced674c0e9aull, 0x98f47433b56168d4ull,
+	 0x46c4bcb761869e60ull, 0xa99c9d2db671a64eull, 0x122c35cadb5fd7d2ull, 0xf053457601691b94ull, 0x0360d28c761f9d78ull,
+	 0x0c01d1e69dbb05cbull, 0x2e1879404834677eull, 0x3891ac576919309full, 0x2d35b1a7d480194bull, 0xc1bce6634a29bb9cull,
+	 0x269f922659549168ull, 0x626fff14aea1571cull, 0x02e0c47edc6e43f6ull, 0x1c3ed29cde3cd8a3ull, 0x777c78f2b6097cbdull,
+	 0x1e09c420665b79c1ull, 0xe5662a3849938ec5ull, 0x38d0ed6fb18395d7ull, 0x8dde8114d103940bull, 0x8563880f5940ab68ull,
+	 0x346bf74c1b134616ull, 0xfa82c22a04b07961ull, 0x1aaa360da86feec1ull, 0x640b17ca48e9e590ull, 0x314de6d652546becull,
+	 0x31947a67f6a9de96ull, 0xdfa0461eb3e91691ull, 0x17c7f4840d13a4b4ull, 0x7fcac374af9494d6ull, 0x68a2f6f32c4d0fe0ull,
+	 0x1f763aa596648639ull, 0x840e32481e906574ull, 0xb085b3c3ad4d4cd4ull, 0x4bef53b1c9dfce42ull, 0x8500e45d30c4644bull,
+	 0x2c1ae83f7fc3edb4ull, 0x77ce58ec5bbede49ull, 0xd927f47035bc18ceull, 0x632ce5e5f337be5cull, 0xf18e48425ddcde02ull,
+	 0x8d3ae04ff9d1d5e0ull, 0x67b74668bd83970dull, 0x32b92f7341eb7ec5ull, 0x59ad563c5fcf6be9ull, 0x35cfdb02582989daull,
+	 0xaa9135176b2b92a5ull, 0x47cca7c56f2baf04ull, 0xf6cc054bdfb25ecbull, 0x3e7c21c713e42c17ull, 0x82dc23cfc8aeb798ull,
+	 0x119a519f6f9fdbafull, 0x728882ab1c6e2f00ull, 0x479da2b51eeed8e2ull, 0xf57bc0edd33409fbull, 0x8d55d815a4122dbcull,
+	 0xac05b32d54a18236ull, 0x164bffe93935e05eull, 0xb568a3486e03a366ull, 0x5b495c141ccde9f4ull, 0x953e334d66692cbdull,
+	 0x7912e520f87aa495ull, 0xef86ac697ae3a58eull, 0xcbe5345d3432513full, 0x8fcbf84a530324f5ull, 0xc10a09d1df2c39d0ull,
+	 0xcea78734fd935b9cull, 0x6153e30682c76830ull, 0xe04651978e4aea62ull, 0x91545dd4566dde8cull, 0xa44834ad04d7c897ull,
+	 0x7ca4b7aa43f5a699ull, 0xeb57f4ec2c9ca3abull, 0x3683a42d4f188ca0ull, 0x36a20924242bf07full, 0xce33b1cdbf1e7600ull,
+	 0x96a4a1f7bc2ee74bull, 0xc33135174a5ea1b3ull, 0x1ff709209e49e367ull, 0x1a894ed523952a92ull, 0xd46c309596b29653ull,
+	 0xaac1213fc6e2e7abull, 0x99b7071368e88a2eull, 0xdb4346e4885d36abull, 0x2878655947823a8aull, 0xe826ae2bebcd45e3ull,
+	 0x1e2a06492c2453baull, 0x7969deab4aea54caull, 0x27a57c9fdd84675bull, 0x0719e62dc7a02d6full, 0xeab9599e6aacec2eull,
+	 0x9dba238bf504e07bull, 0xca467e5d5189e968ull, 0xc69f3d1048af34cfull, 0x3c1ae277dc67cae1ull, 0x0737d48d146c2a47ull,
+	 0xa17ecc1947a7f527ull, 0xfdd91be603671780ull, 0xde5ae97a33449ac2ull, 0x7141ac2fe5d72a22ull, 0xb3c70ee7efd06638ull,
+	 0x240c3a0622588a3aull, 0x3ecfff7c6662b6e6ull, 0x9e68856f3e69493eull, 0xb4189df0408b5351ull, 0x867eb80716e387a1ull,
+	 0xb4c8a6432e80cc3cull, 0x0af6d7fe98223e63ull, 0x0c1159cb584bf362ull, 0x79567e91ea9c31caull, 0xcc293424e461997dull,
+	 0x8eade5dfd0fd7086ull, 0xf854d7f767ea3939ull, 0x96235c2acfdbd3e0ull, 0xcc0032e4ccba8b5aull, 0x7f69d9586da6dac4ull,
+	 0x53319531150484e4ull, 0xb9030c967d5f9bd8ull, 0x2c14e7ee9d0b5c12ull, 0xbc87f695d89c6af6ull, 0x1bd32db11d9e8d38ull,
+	 0x7b912728cbefd8a6ull, 0x15982e5d99fe62c2ull, 0x24a918de8c99c285ull, 0x9fca31fa36286d36ull, 0xb94d40a1ed2c47b9ull,
+	 0x64da5b14dc744b9dull, 0xc47a052aaa185e83ull, 0x3529a6d12a968463ull, 0x1f9ae04d0cb7f4b1ull, 0xd15ad3fb00637ea2ull,
+	 0xa0e05dd78bd5ba91ull, 0xf16ae7582ddb41faull, 0xf93f55414dc74df0ull, 0xf56e5f56e9254b2bull, 0x07c950dfa177c76aull,
+	 0xeec636ea007f6973ull, 0xf3f69be10cdcf235ull, 0x43f273eeb5e976c5ull, 0xd1b73a3eea2c459dull, 0x59e03244489112d1ull,
+	 0x185fd3abb0238153ull, 0x437f48614c3d2b1full, 0x14ee9e17661d6e84ull, 0x855b6092a01d71e9ull, 0x7e1220fc09ac015aull,
+	 0x92996a92471c0a89ull, 0x3c02615d1df2debeull, 0x8f7481c99c5824b2ull, 0x9e34fc90f957139eull, 0x5dba08fac589078aull,
+	 0xc72e16da78dccfe9ull, 0x29a4361121d1bda6ull, 0xb03fe7c8198e9b78ull, 0x0baf24f94d1858c9ull, 0x6838d194dae1f359ull,
+	 0xef0f2c95710c7a9bull, 0x9c347e7374c64120ull, 0x33938e6d2dc491b6ull, 0xf46317e39139f0d4ull, 0x6111bfeeeeb07ab7ull,
+	 0x5088aec6f6580531ull, 0xf7ce0464c569f8c8ull, 0x171f3e9579cc204cull, 0x744dbc7af1c187e0ull, 0x684a29fe4a2bb6d1ull,
+	 0x4f067a38f07edce3ull, 0x8c3c13f066e1718bull, 0xe2458d68bddf8f10ull, 0xdd69afd073e3a1a8ull, 0xaf038efbe8fccccbull,
+	 0xe5749a65993f4d44ull, 0xeced7e90fddc135cull, 0x2d07abad233e700bull, 0x5b4fce2899bbb8c0ull, 0x48be6dac3118afaaull,
+	 0x9468d52be4a490b2ull, 0x5814d3a78389d03cull, 0x12b66869f40a2635ull, 0xbb65acb7a5695a8aull, 0x994d5810c8e6082dull,
+	 0xe1363e0d7b744a43ull, 0xc869be1c091468daull, 0xe47f83e76ce96471ull, 0x2779219dc63047b8ull, 0x15084e039862a2e4ull,
+	 0xe540319ff556cf8bull, 0x8a6db3b331a7989cull, 0x70d3dd5f872f42ccull, 0xe6922dc8ecfa3ab4ull, 0x83f4c5febada0d7bull,
+	 0x9867875f20360daeull, 0xa02c2351ddc9c29dull, 0xd86ba19c7129dd65ull, 0xec3b9fa62f44b503ull, 0x1ceb1b6c4cd21a33ull,
+	 0xce77449d5dfe2514ull, 0x64c9d05ba2104af2ull, 0x3d52a2da3878b95aull, 0xa92470c1c658ba5aull, 0xb8b8befcda4b5850ull,
+	 0xc53f914d495fe007ull, 0xe330f2eb3d48e9eeull, 0x4cafd0c9b84f398eull, 0xf5f7b2efe64eaa05ull, 0x86fffddd71dbb11full,
+	 0xf8688cb523812e09ull, 0x6115ccc00f4611a2ull, 0xbd15e831097707f4ull, 0xfc62cabdd919562dull, 0x94a5ddc167c7031aull,
+	 0xc5f14b6e879d3175ull, 0x4ceea0651ec36942ull, 0xd2db1ea1d25be350ull, 0xba0bbdcf62907c30ull, 0x1f56823c0ca54a88ull,
+	 0xd1a6c3417914ff01ull, 0xfe71153a9760363eull, 0x6d4b25d4695e5b20ull, 0xd1aa360d9bf23211ull, 0x4a1bdb994a714920ull,
+	 0x1033982f5ddeb07bull, 0x773305d76f87f328ull, 0xa71e9438d5b03fd7ull, 0x55967b68c20041eeull, 0xbc68ffb62622cc78ull,
+	 0x75b10db72c0dad94ull, 0xbed159a682e753acull, 0xa20ae561ec317ba3ull, 0x36f173b09644a9a1ull, 0xf9b25c902f7e0f69ull,
+	 0x0b2707c9bc8d6f5eull, 0xe886fef5943949afull, 0x5303e26898a63280ull, 0x05c13b6dfbc8853aull, 0xcf0ac8062942b2b8ull,
+	 0x11481235995ce0f2ull, 0xcb5a0c149fbd2a8bull, 0xb3949467b5fbbd9aull, 0x499e80ec4f971e92ull, 0xfcbd014aae0f336aull,
+	 0x7be59c4038edaf42ull, 0x4cd41c412e5da120ull, 0x74b199cb60c1d0fbull, 0xa8c54e2b9fe2faecull, 0xfbe33446991688beull,
+	 0xef570114795b1dd7ull, 0x68767e9f3c535610ull, 0xbbe3bf49e3a9c2f9ull, 0x22afe6dd0b86e7a3ull, 0xcaf51cf201cfa19cull,
+	 0x68a7bf7ccf672b98ull, 0x8f567728e95cc9a3ull, 0x2252556e2e7fcb8full, 0x7c62d4af92b69d3bull, 0xd278fe5d2a0a096dull,
+	 0x01e9012b65a2e114ull, 0x331f957a9ebabf0full, 0x7394991677206491ull, 0x1109de255e502e85ull, 0x1196d3947ba212b6ull,
+	 0x0b5ba6309fcd970eull, 0x8186e65c3708bd38ull, 0x34f66dd19cd45712ull, 0x8152002fc75ad9fcull, 0xc5149abe01ab4260ull,
+	 0x03886bb3abf4fc99ull, 0x5dcb0815c658114aull, 0x45ea28d8928883adull, 0x98513b7f3beb52fdull, 0xfa77f3b50fd64e4dull,
+	 0x3bcebe60c2e88026ull, 0x2166a542291fb48dull, 0xfed31e4d79e2ffb0ull, 0xda9ef1e719215927ull, 0x45ad0a4b055fc577ull,
+	 0xa14979ff7197dcfcull, 0xfc2978c435cf71ebull, 0x1bd3b7b33789651dull, 0x6fc0291d0a2169acull, 0x648de1df1e0ccd13ull,
+	 0xf20f130fc2ab9ffeull, 0xf7a1bc78610dd242ull, 0x988825afe39a59c9ull, 0xb72b3f3d3a91d8baull, 0x108c4f728b43f256ull,
+	 0x03f645e091165c99ull, 0x3b04f4e187e2a051ull, 0x9b658745ca12e8daull, 0x8264c9975ff06656ull, 0xcf65a4b886b031a1ull,
+	 0x49083111fc909228ull, 0xd03321ecde43905eull, 0xe61a905afb39c550ull, 0x78b24534f30ec648ull, 0x1a5b17322f58062aull,
+	 0xe02fbe2fc1079feeull, 0xd2f9ab83fa754b23ull, 0xbb3a85d3da2d9abaull, 0xf8bc620af6099810ull, 0x4993859fa6d9c32aull,
+	 0x9069e285e70676cbull, 0x080573c65fd73c5bull, 0x253956f02a7cb3bcull, 0xfe4b437c6bd347eeull, 0x9596248a9d4c6638ull,
+	 0xf2b64c06f5f1a688ull, 0x611365dd3bbcb752ull, 0x1e4898399ee7f1a0ull, 0x025b04161a47fe23ull, 0xa9a633fb8293ee40ull,
+	 0x17e1717a69a0fae6ull, 0x49bc2faa49e64239ull, 0x94b22fce722d5100ull, 0xcf5950444c1e88f0ull, 0x2b18c554d7ae2840ull,
+	 0x1d85cd433acb20a4ull, 0xf0323788fbbd546eull, 0x5812285dc529bb62ull, 0xbdbc5de36f0d1a0bull, 0xa75415531ac38cafull,
+	 0xff937e0f62d529c5ull, 0xc58e7fd68dfa8e0cull, 0xffb8b65f2138a522ull, 0xc58cd78e65d486d3ull, 0x327189b11cc02ec1ull,
+	 0x028dc7732125951eull, 0x9578c42101647198ull, 0x87717b24ebd0f5a1ull, 0xe4859c37d47dc106ull, 0xc486176baea2d9edull,
+	 0xffd86c1d6d66580eull, 0x62084dcfa2926200ull, 0xde2a6150cc68d9d6ull, 0x152574a8b998b9bcull, 0xb4bb56b2c787bc51ull,
+	 0x6503854e1b8ca99cull, 0x8669ec6a21ab4197ull, 0x171bb08ad604600dull, 0xe487e5074f4a534cull, 0xbf5b6f9a99ffb35eull,
+	 0x8be429a62e60e700ull, 0x7666a8792a127083ull, 0x5885c2b68ec41f01ull, 0x6fc57cc6edf2f5acull, 0xc2ee5a09af3799bcull,
+	 0xc1920c701936e7f5ull, 0xb807a8a298390221ull, 0x8456d42e16fff737ull, 0x74a2991d94289981ull, 0xb5a2e50457e81b88ull,
+	 0xcba56ebeff28e356ull, 0x36e7454d6e44640aull, 0xf07dc180473c57cdull, 0x86e73a5f1342017eull, 0x8a6432a3539452f2ull,
+	 0xf3cb4fd107d04e22ull, 0x6684394223f25b63ull, 0x45c5812430747e57ull, 0xad417582bff7a691ull, 0x884583abab90e510ull,
+	 0xb432d906624e7f3dull, 0x62f10ddafa1e27c3ull, 0x6cb95f4543de883dull, 0xd129e2aeb3836debull, 0xd01e41a1ac0d037full,
+	 0xd7550ed08c3dc5ebull, 0xdd8b00fb46c2e1eaull, 0xacfefb1911d4df9dull, 0xc7782c512324d6beull, 0x82875ea3ca3b7056ull,
+	 0xba4da499ff47e7c6ull, 0xe6a74d3d78cb9040ull, 0xb93cb20aa2a40335ull, 0x961a97a26a5233e8ull, 0x6a8bca4ba99824d2ull,
+	 0xf2146f6f087a90b6ull, 0x06a0b2b7110ae9eeull, 0x5472f316fe8cc0d6ull, 0x6dc000a5504b16c0ull, 0x339e7939f1dfd72cull,
+	 0x98b6d83a2b536933ull, 0x31af471773a96657ull, 0x868b195c40de8c94ull, 0xf4904ec2b4edfe06ull, 0x0ea53c996693e9f8ull,
+	 0x300945a091197f52ull, 0x6313e6c26fed1e2bull, 0x654618aa5ba98605ull, 0x1e31ed665f51dad9ull, 0xdbc733dba515eac6ull,
+	 0x8b1d4e07ae2af5bfull, 0xadbc0f821394d6e5ull, 0x42c242635ecbe158ull, 0xc2b038a64c9b26e5ull, 0xda9164d9afa46436ull,
+	 0xbc62b5bf7a490c28ull, 0xd46216d6a97b6b42ull, 0x9a3d1c7886d66363ull, 0xa98076218cbb410eull, 0x89c67912e3719afaull,
+	 0x3255acc91dd05661ull, 0x689b9cd8542d490full, 0xa89951671018f63aull, 0xb7e1ffcf097a5710ull, 0x7d61ef23c2374d0cull,
+	 0x84089832b990317cull, 0x2a8be6871a3915f2ull, 0xd67fc78f1563e8aaull, 0x8dd9e310e8839dccull, 0xb14ba5872f160edeull,
+	 0xe9711cc2392c7489ull, 0xe234f549c38bda3dull, 0xa50fc9e0bd34dee3ull, 0x6c13de5c38baa53bull, 0x3fc12c6e27c7561dull,
+	 0x76b141c33ccbce47ull, 0x210186ddbf0f8df8ull, 0x1d8f72fd258e993cull, 0x05f7e1783f05144full, 0x63e1ddb3c4522851ull,
+	 0x3aee31d00c117fffull, 0x1a9a8541191553f9ull, 0x4d19084ada38cc34ull, 0x3827ce455959d6fcull, 0xd483f113311aac95ull,
+	 0x66677d846b128bbaull, 0xb595bf00b946e772ull, 0x915f2f329fccd9dfull, 0x3d4f1da49bf398ccull, 0xa75aac36364a7c4cull,
+	 0xc211ca43ccfeb961ull, 0x31ca189d5eff184dull, 0x3a167ecdf647a2fbull, 0x08c18b5183c6652aull, 0x635c7db2ef655a81ull,
+	 0x93c08b65e174a8a5ull, 0x2b5b5e79cbe7e5f8ull, 0x6f52fc2ec9ae285eull, 0x6cbdf09b765e5ae9ull, 0x552d2f0ddec0b424ull,
+	 0x0b988b273365d6b3ull, 0xc9bc1344acd29e13ull, 0x1073a7563f1b1caeull, 0x1937ea1a19c90d39ull, 0xe7509341460b6327ull,
+	 0x8aa3877612364186ull, 0x9c3c5d63bec7b8bdull, 0x16066579230fde06ull, 0xb50f62234d72ab07ull, 0x1075e2a2d0b10862ull,
+	 0x6a61d22ea4645700ull, 0x31adee98d8714907ull, 0x4b78cabe5c2d4cf3ull, 0x9ab1c43cf19c28bdull, 0x957f8a2fb2382347ull,
+	 0x179981c74e6a7798ull, 0x1da040d63f954d87ull, 0xe49b427f0b011aa4ull, 0xf32bb5a04a687a46ull, 0xc578d354679aa4b1ull,
+	 0x599c92d28232aee1ull, 0x160ba466193c99beull, 0xa75c89cc443637b9ull, 0x9411d3d5dce12821ull, 0x542cdbde43f62dc0ull,
+	 0xeacb1349bef4f0c0ull, 0x1177d3d6e02fc4d9ull, 0x93eebdeddaa5f364ull, 0x9f7934ab81b69421ull, 0x12b54cb6ff8a8dc5ull,
+	 0x4ef7f0f3dc539e4aull, 0xcfb8af113482f369ull, 0x02fd9a4b121e3e27ull, 0xb968ae625d45efe0ull, 0x5577609867ecf191ull,
+	 0x1da8ac0428e7b7abull, 0xdd313b397b2d3a56ull, 0xa8ac4fc7698b7173ull, 0xc3233fdf06657180ull, 0x8a9558573ae46649ull,
+	 0x70a781bb0dfa0d6bull, 0xd0793f2cec1c8035ull, 0xd3109d807779c884ull, 0x6a7bcfebbe166edbull, 0xa2c5401440c8a607ull,
+	 0xb1a6fa4a92dea09eull, 0x99d1ca4c0f0635ccull, 0x518e0271d002d27cull, 0x17a8f7191f560824ull, 0x71923c20fbe46a71ull,
+	 0x8678c6e1bfec911aull, 0xfd9432786609a520ull, 0x84b52fb054db1dc3ull, 0x47f2683704c9b36full, 0xcaa47e0e9180ee42ull,
+	 0xc572d2814bd62821ull, 0x9a83b972f30551dfull, 0xe5cd1e150e5365d5ull, 0x97d07bea03246a24ull, 0xfa605b0de780e837ull,
+	 0x5ff212fc59d3fb44ull, 0x7ca298344dd400cfull, 0x023fb572d97488ddull, 0x9940a47b1c00864eull, 0xbef7431d07f9c77dull,
+	 0xf3ee7a1b3ca604d9ull, 0xb4bc39199378eda6ull, 0xaef948dab48c0be0ull, 0xecc3f6613a401550ull, 0x1ed3a707f08f448aull,
+	 0xc28620df83d20e7eull, 0xd1376e0c66aa8afdull, 0xe6d0c5cc40f79cfdull, 0x19cd4ca1eb352d7dull, 0x80d7507a4755fdb1ull,
+	 0xe2d8b137ca29c274ull, 0x0f92dd9e251484b5ull, 0x9a406ee8ba0b796bull, 0x651c19824efa08c7ull, 0xdd6a799aa7b72e67ull,
+	 0x2f6a739d16b40f53ull, 0xc2a6eec59927102dull, 0x0f06586aa2775172ull, 0x28c0ea911b465662ull, 0xc6791942a7546ac9ull,
+	 0x63c3d087a8178a6eull, 0xb509a7f5bebb00f0ull, 0x00062f9e7878e8d2ull, 0x23a994e4b1156641ull, 0x05c8653637783a3bull,
+	 0xc806b7c9ff9a5cc1ull, 0x11dcd8368865d6c8ull, 0x48943a0d481c14d3ull, 0x8c38832158ae7badull, 0x0d4c37d8a631c091ull,
+	 0x9f3216c7a9dabfd7ull, 0x121a12a780247a53ull, 0xddec4b621f935b05ull, 0xda7b0e773d20a1bbull, 0xa24aaba9602f976eull,
+	 0xcf86e21624f6255eull, 0xe527cf4e16bcd7fdull, 0x4bf3087b995cf620ull, 0x9005ac4be2033f43ull, 0x399ef938d88fcaf9ull,
+	 0x98eb086d51aa6d82ull, 0x20e6f2b9b81052aeull, 0xb627462a1a3cbd1dull, 0xb1104dce399c91aaull, 0x80fb0c445458c642ull,
+	 0x3f9c54af9b5c3bfdull, 0x181ced85531f554full, 0xc7a16ae72bdcf916ull, 0x5f5f39180b48622eull, 0x8294be082b895890ull,
+	 0xd8c9bbaee91578aaull, 0x395311d617e2db24ull, 0x7bb181cb683e7b78ull, 0xbc84b3e38a839af4ull, 0x0afcb7920f41f7dfull,
+	 0xb9b6a4d625034cdeull, 0xcec4e2c31cb0147aull, 0x151a3df2987e1bdcull, 0x0c784c46f7fc3937ull, 0x29f54c2d3f31404eull,
+	 0xb4c92efd7a4bd47aull, 0x2f6dab76bd1e8286ull, 0x54708b8ca6593feeull, 0xc1fc1c9187e0da5full, 0x133ceb2c53178eddull,
+	 0xc688ef20ca47a1dcull, 0xbb1c566c83c46c10ull, 0x13dd0814b25f4e0eull, 0x45198ef8ef8942ffull, 0x3263effc554e9890ull,
+	 0xd33bb3ffc37ebdc6ull, 0xfeb587cf4a076eeeull, 0x61e7002a24dbbe0full, 0xa25e10e47f85f20eull, 0x428eb6fbdd5bbfb5ull,
+	 0x967f7fc71f9af351ull, 0xefd7f2f74d6f24d9ull, 0xbadf737577c58744ull, 0x512abdf0c76f9ec4ull, 0x00592828eeadc110ull,
+	 0xeb963f1c5d4fb80cull, 0xe71a257bf8beb402ull, 0xdc3a9061e4628dffull, 0x8fc3e294ba9d5c4cull, 0xfbb933a8a6b02ba1ull,
+	 0xa68b03fb516fcd51ull, 0xbc0008fa1beda269ull, 0x1840aba0c19fc9b6ull, 0x3b618cd3fdc63402ull, 0x60214db5cbcaefe6ull,
+	 0xa411359d53018b49ull, 0xf33a74fea350d078ull, 0xda2e5d634d0d81f8ull, 0xd1b71da299e2ee84ull, 0x999e403fd609566full,
+	 0x2edc11c4f590e45bull, 0xf7a2f0d60b0ca721ull, 0xb114daaaede779aaull, 0xa83f0ca19bac2116ull, 0xeccb2f5c45ead7ebull,
+	 0x13d7a2b78fcc922bull, 0x611ee1446b21f587ull, 0x12d719c8b64c9e4aull, 0x28fecab3ad70106cull, 0x0ac20cae7458ce05ull,
+	 0xbba74dafb0deb4b7ull, 0x7fe2c759bec09febull, 0xdd0fcf8a302661d1ull, 0x0c000f2859139af2ull, 0x9ce3de8f2909cd1dull,
+	 0xfb92d811aff3fe5eull, 0x3370e8213615e14full, 0xd9bf343be8eb8884ull, 0xb779e9621c5f4472ull, 0x7a0ad26ade807655ull,
+	 0xfe4ec7227721abbeull, 0x3d46901f4adc199aull, 0xa17bbd9ebd5b78c6ull, 0x2329150cf4b10774ull, 0xc2f56698172d2844ull,
+	 0x265d160b4aff9db7ull, 0xaf9faedc9612dab5ull, 0x0a2e8ea6bbe25cf2ull, 0x5208fc21897d36d2ull, 0x1635add0ce4f917eull,
+	 0x9b0a44ad67f20a89ull, 0x360b070af90e9cb1ull, 0x92ac2918712de4bbull, 0x989cf626c78d8070ull, 0x7501d83e5927b3dfull,
+	 0x89391319a0719c46ull, 0x67abf232e10fc83eull, 0x6e41e565fa1d9c87ull, 0x8c4744d92ba82f49ull, 0x5ea9e6b840ca9c70ull,
+	 0x471f7a20e82e27b7ull, 0xe86b24752685259bull, 0xe59a02d159aa2e18ull, 0xf532cf447752f73full, 0x916a3aafd2607bf4ull,
+	 0x9f498bde3a7e326eull, 0xb2176b7c3c6efffdull, 0x26c4cc5bc6c58b50ull, 0xde6e3cb58fe958c0ull, 0x326c530ef51687e8ull,
+	 0x64dce7064e353776ull, 0x8a810b56f34f24a5ull, 0xeae5a91f1a499b5dull, 0x933defbd7ce1bef3ull, 0xc5546526e69907daull,
+	 0x33e4ecbf3f8827beull, 0xf88bf074cafde4a8ull, 0x63558a91c7d477fcull, 0x0655a1393655315bull, 0xd0d1c352f0240403ull,
+	 0x2e8eab88249d49b4ull, 0x8007f4824cd2d0e8ull, 0x5e0cbfda088df842ull, 0xef9a054df9b85e27ull, 0x3d4f258c78f5fe7aull,
+	 0x2fc42b92490bd8faull, 0x0d50e48aea40b04bull, 0x311ae7724872ed82ull, 0x09e8bc7926be9fb3ull, 0xb7ba6e84631e6831ull,
+	 0xd0f14fb14c0a4220ull, 0x8345c2d213cf2789ull, 0x605264f0f96dd81cull, 0xf3a9d0d87d5aac01ull, 0xce2e35d1a835ef0aull,
+	 0xf7e05c4c52cec2faull, 0x0e74186e2c6bb5b4ull, 0xa33bdea8a7564f06ull, 0xf53c371a3c9c96fbull, 0x72ebe3805fd8a0e3ull,
+	 0x707f4a42ecb2d486ull, 0x823bc7ab717ee807ull, 0x70945d844fb8fa85ull, 0xe422da8bd35d9137ull, 0x466a14c592258569ull,
+	 0xb1a464aa3eb82717ull, 0x6c2403406908e695ull, 0xf548af472ee4103bull, 0x4c1f9ce4a2d122d6ull, 0xaedee2314a653364ull,
+	 0x434df3ce2172e894ull, 0x2242d805e452bb61ull, 0x5627f83d72e27e00ull, 0x7937ac6bdf51bc7bull, 0xb33c9f9305cdfad4ull,
+	 0xd53142d78b697ee2ull, 0xc66ba346691c4154ull, 0xf467314a6c4c7ef8ull, 0x6fda651e90b427d9ull, 0xcdaaebc8cf4ebf5eull,
+	 0x97b830086a40cbd8ull, 0xb82f1ebaf98e8650ull, 0x7842751dcc6f741full, 0xe9c2208ffd463921ull, 0x4d487de12581cbd9ull,
+	 0xc7a56f5ee785cfd7ull, 0x0596afcb949ac9a1ull, 0x447dfccc2093cebcull, 0xcb8fb9812fe13e22ull, 0x79955fd903f74996ull,
+	 0xd843a9717cf8496eull, 0x370f88f5c890d9f4ull, 0x529b0d00642720a1ull, 0x60a1b5098c916ecaull, 0x18f70db14f92c477ull,
+	 0x98d14f2eea373368ull, 0xddfdae478cc01122ull, 0x65f30b533982ed1full, 0x4e24fd61e425f235ull, 0x52668469c9cbbc71ull,
+	 0xfd843fbc111cd1beull, 0xf5840bb067fd9528ull, 0x2fdded025333628full, 0xf89262ba93db3d0aull, 0x8f2aa35b20f093ebull,
+	 0xa4f9475976577398ull, 0x2ddb1a3aed9a37e0ull, 0x82edcf70af13b01bull, 0x4d5e6e5364fbf7ceull, 0x5ae41634a527c5baull,
+	 0x0bce18e678222bb7ull, 0x26b63d3cc527a178ull, 0x4eb040cea74b5f52ull, 0x927bc3358b86f63aull, 0x3330cf34c656d0ebull,
+	 0x71120f7d7dec7113ull, 0x2edd24d025418700ull, 0x13fbf0691a978c2dull, 0x8e2ada94ab9959f8ull, 0x404d3c3aacf61d1aull,
+	 0x57222aad424ad45bull, 0xf2ed7899b11b9a9bull, 0xf559b18bcecce2faull, 0xe53bbd0e3fa6614aull, 0xfc8e3eb590916e6full,
+	 0x1a14cf90f3ce5fc2ull, 0xf923fba7420356c1ull, 0x9b7c08893a73cc17ull, 0x8439b50e8dc290d0ull, 0x4a6249934b5c2cfdull,
+	 0xb768ab10fffa4cfcull, 0xfb60eece3e03a89full, 0xaa5a95878c1e8526ull, 0x9823ea00ecb06722ull, 0xeea437bf44512e9full,
+	 0xb416a5657217c101ull, 0x341670e2dd3d5cf2ull, 0x453d01ec39218e66ull, 0x2268ce49b6f8c234ull, 0x30b6416f2e717ea5ull,
+	 0x1241e49f2e9d66a7ull, 0xae4a9eadcc34dd31ull, 0xcbff8656408e079full, 0x490de7442de6b955ull, 0xeb6ac908ca5ab897ull,
+	 0x83e83fd8b74a0425ull, 0x6f9b5de592fc3ca1ull, 0x220b8f4f665eedfcull, 0xc99c5a405076db78ull, 0x0579036eb72f0461ull,
+	 0xd3ee5999176382f2ull, 0x7df75dc5f4060b89ull, 0xbe2bd1713d9ee0d1ull, 0x25aca2ebd5d2bea9ull, 0x682be753e154ecb3ull,
+	 0xa87e76e90a13392full, 0xb37a8b20c6923e9eull, 0x4a2c3825fc11c992ull, 0x88405b0efdbb6bfdull, 0x6832dbf1d0dc1d5full,
+	 0x47d94bf27af10d98ull, 0x3e7018afab064138ull, 0x6bf5256f30fdc752ull, 0x1fb7639ff6bef833ull, 0x277bdabc6707477full,
+	 0x4be99808764266c6ull, 0xff60e38f03cf42fcull, 0x0d8e516aa3891daeull, 0x9f852060e9a9874aull, 0xe35d1a353908f149ull,
+	 0xd09d8fc5083afbb6ull, 0x11696a8564176e9aull, 0xbb2f5d8ebdb98f72ull, 0x06e5857729993c45ull, 0x94a0a45f8243a626ull,
+	 0x37e992cb9ba35637ull, 0x0a8acd163bc5f242ull, 0x61a85685178670faull, 0xc70c774482b4dfeeull, 0x8a0585ee9eaf60e1ull,
+	 0x0136118ba7a45419ull, 0xfb2d7399c900a177ull, 0x663bcea2a84eab8full, 0x04b878dcf3039688ull, 0x3103625ba8af9e71ull,
+	 0x97cfff937749a162ull, 0x849257a84f990488ull, 0x7d8fc282928c6762ull, 0x48c0cd6847ab19dfull, 0xd12296242c0963e3ull,
+	 0x73d1443409dcba24ull, 0xd5eb8c16c9f59cedull, 0xcfd0da244a3cfbaeull, 0x727767dc5456cb39ull, 0x1eefaeafa22abad2ull,
+	 0x23547919e3ff619bull, 0x1bab7962070421d5ull, 0x820bda874d9512eaull, 0x6eabee3d52537dbcull, 0xd817722b4a5771d9ull,
+	 0x69f9bdbbe6c6d0beull, 0x5865c14fbd47cb52ull, 0x24c0a979600186ddull, 0xae8e5edacb8cee3full, 0x30a1d569e91dc71aull,
+	 0xc1b6e6f79910e7d2ull, 0x165758cd5431854dull, 0xa10ec528b2cf8512ull, 0x5c8aed733f5fa2afull, 0x2db49dca1def565dull,
+	 0x2036dd7e7452950eull, 0xf208cf41ea7bea98ull, 0x44d91d0722c53ef3ull, 0xf5dc0db99011178bull, 0xc7354cca256ab9dbull,
+	 0x9c1be082016b9bd2ull, 0xffbf1bafb641bf42ull, 0xa5fda5cebe0b7faeull, 0x1f6a23b1fc7ea25cull, 0x9b945b28e58ad043ull,
+	 0xac11272042fb1b3cull, 0x1d6064b2388f1783ull, 0x8e9ef435eb52a07dull, 0xff86e97d20b78389ull, 0x439bd794de19e4ceull,
+	 0xca74d5d353448cdeull, 0x077c02dd7ee98314ull, 0x658d14f908ad488cull, 0x45081c53423a256full, 0x500804a26e75c7a1ull,
+	 0x823b14f44142bb03ull, 0x11af8ccd3122d582ull, 0x38d445bb4234dca8ull, 0xc789a0d013a82749ull, 0x3cf26ac0f1388fa8ull,
+	 0xa54d32f74d1a5688ull, 0xb1d90621e1e46f82ull, 0x40f34ca2c20ec361ull, 0x40864a59cce8baa5ull, 0x9d51aafad562d415ull,
+	 0x44fd3a57725c5c74ull, 0xf326c97cc9c7969aull, 0xfaec151cdc720bf1ull, 0xe793be1f2c264543ull, 0x6882b041e2f37231ull,
+	 0x058e12fb932c727aull, 0x564bf12b80840c6full, 0xedb88bc26ac7a03eull, 0x8f5266626f682dc4ull, 0xe7444e0f6cbd351cull,
+	 0xb5e87693b40e2e05ull, 0xfd03c2ccbe7a0cebull, 0x886c0b0955e24f7full, 0x464032b1423fbcbdull, 0xb9f2f224017bd10bull,
+	 0x7e74cf600468c789ull, 0xf2d686a4aa86fc69ull, 0x1cc05ed80297f0ccull, 0x47f57a7f0e42fc1dull, 0xe85f161a965184b7ull,
+	 0xb4ecc515b081909dull, 0x8bec5578f15841e3ull, 0xa8ff3da5af920c02ull, 0xa867cd76691af9aaull, 0xb9cdc1359662d64bull,
+	 0x3dfbf6e92b2cea2cull, 0xbf445389bf34accdull, 0xd19c67765412c415ull, 0x61ca94052984e6c0ull, 0xa09c5d63fecc0ee5ull,
+	 0x1f7e2df80c14514bull, 0xfaa31da0ebc75773ull, 0x9f93f5cd8ce1e30aull, 0x0714d2fb3f2b6a36ull, 0x4bd11e0b58cb471eull,
+	 0x306ae3a3a83b0560ull, 0xd3798664f19e9a6aull, 0x1ae33450d6d80f78ull, 0x3a25e325fec63a84ull, 0xdcf1d4867a926b68ull,
+	 0x0f57c396a8a79a85ull, 0x24e4181c618e4800ull, 0x7da216aa885684f8ull, 0x34fc8966b6b6b57bull, 0x18b5dd828f3477beull,
+	 0xffe3b46ed9a1b972ull, 0x88844ecfec0aafd9ull, 0x757f1bf67e54c41eull, 0xa9619f1a043c7d29ull, 0x912c54cf7f54cd10ull,
+	 0x1db39ac1a925f593ull, 0x0a13fc987dfb76bdull, 0x10e6bc4bf2a39e9full, 0xb03c311f3fbc56d6ull, 0x7af3d33559ed650aull,
+	 0x24b83af3c9541099ull, 0x56f9931a35009c92ull, 0x6d542968222c6791ull, 0x30f46868b9665c03ull, 0x262f4f7d1bacfa3cull,
+	 0x8ecc6d3bc6640653ull, 0x65c9a84e2a29d5e4ull, 0xa61d2d8ba4ca1649ull, 0x3669f725bf49e9aeull, 0x30ab496126536839ull,
+	 0xd94a9c55ab7e48eeull, 0xb76f71a6be7e7754ull, 0xb86a7aa74f2b06b1ull, 0x9e5f8a2c28d51956ull, 0x64aae1cc0206e567ull,
+	 0x4ee06f8dd7128512ull, 0xeba6957a3784a990ull, 0xa4bdf3fc4d1296cbull, 0x8ec705767d57455cull, 0x3d8eb70555dc0852ull,
+	 0x2e6b9709f0821415ull, 0x19595d0e84b30337ull, 0x1dbae9ebe00072feull, 0x71ae31317b05bc94ull, 0xee39f580c1128988ull,
+	 0xabfe9e214c9ee7a7ull, 0xb233f50ead23274dull, 0x0c2bea9c3e592879ull, 0x4cc25b52600b2be1ull, 0x72f150b3e5997345ull,
+	 0x4f14478551f17ab6ull, 0xebda129d0724b2c7ull, 0xbbdf8e41ed8a338eull, 0xf3457659d066c8f2ull, 0xdffdff3c3c242ab7ull,
+	 0x818426eccd3cd4ebull, 0x3ddef1ea30d53c8dull, 0x0511a7b1668904b3ull, 0x517fca2dcfe52d8aull, 0x55fc616a59ac9f1dull,
+	 0x6879fe01f84924fcull, 0xf926b7d54b8cd74bull, 0xd7e7a7426e011a1aull, 0xb0247136b6241547ull, 0x954348e3a35ed5ecull,
+	 0xd532feb49d886877ull, 0x3544b60d8a8445b1ull, 0xcb157f4245df9a77ull, 0xe02d0c7f6037e1d6ull, 0x9485a987d218a0afull,
+	 0x4be089aa5cd8f3e0ull, 0xf2f4cb79953a7839ull, 0x172378e521952dbdull, 0x2ef04d3623df4ae9ull, 0xc7221c9d75590b99ull,
+	 0x0bc938dcfceaec3bull, 0x9bda0be0b67d067bull, 0x888ed780e5aece8full, 0x64389c9d9e82408full, 0x188477e7eac571b5ull,
+	 0x2161f556a4961e4cull, 0x8a2da59da1ac8363ull, 0x199d1d476321b7c2ull, 0xb14db5e4596fba55ull, 0x9576471d9823d843ull,
+	 0x243a6333715a5267ull, 0xfbb568e28fbdea76ull, 0xed010d071919bf76ull, 0xcfd9f2132f8eadfcull, 0xb22a2394aaf5a36full,
+	 0x8e0e2f8e6136ca11ull, 0xa7f0deaa67bf2750ull, 0x630aea0945956f9eull, 0x3ea03bdb14a68848ull, 0x0bd7edd339103c0aull,
+	 0x934eea7004578b6eull, 0x56d1f56c894bc8a7ull, 0x52c50ef7f147c9bdull, 0x6337a8056f74784bull, 0xb9e6f93cef9ebb59ull,
+	 0xeb07609e512552cbull, 0x16ff2b06b21f4c72ull, 0x5f2e5afa46501713ull, 0x64b341c384cdf211ull, 0x751603f4d162a185ull,
+	 0xaf92e2025b1e20e7ull, 0xecbd97ea8eafa0b0ull, 0xd0507938284112a9ull, 0x28c94520dfbffae8ull, 0xe22cd91e5ceaa6c7ull,
+	 0x34547934cbd1c16full, 0x7a81d940a420f78full, 0x5e030fe580f80c0dull, 0x90fab42ca779d94full, 0xfa663127aa10a29dull,
+	 0xb6f45075cca953adull, 0xda49de4abffc59c6ull, 0x8aab27bf751756d3ull, 0xd396b3825d4a60f0ull, 0xf836a41fa56a6896ull,
+	 0x9f826c111aea0720ull, 0x5e0179cd80701247ull, 0xb035dab46fcee878ull, 0x70f38123c1ad9513ull, 0xde8e4d156d8332dfull,
+	 0xaefaf9093b3e2a59ull, 0x0ec395f713071affull, 0x7812cd29426dc760ull, 0x668c32aded4ec4ccull, 0x55d0a3c0c705493full,
+	 0x35be805195796592ull, 0x0a935366c7b1b811ull, 0xb95695e4d60ad89full, 0x5ae7ed432523445dull, 0x48bafe2b479882ecull,
+	 0xebac677972e9d56aull, 0x5dfc53990bf344b9ull, 0xa0150779d413447full, 0x87aa4888cdc17aaeull, 0x35ecf6a2b0a859d1ull,
+	 0x59fd312f99679caaull, 0x777698aeb5046d45ull, 0x836d66b59fc986f7ull, 0xbaa701fea15061f0ull, 0x651a5fbcaf6e26f9ull,
+	 0xa3f90275795b3da9ull, 0xef217fb46fa69b1bull, 0x19b6d29af7b86d56ull, 0x5c1f3c91ea55dc7bull, 0xfa93e47895e8287eull,
+	 0x305b71efa5dce8b8ull, 0xc6bb4493aabe38c9ull, 0xdc5af91beb45ac83ull, 0xec5bf667602c9b57ull, 0xee2ae59ec7d487a4ull,
+	 0x2faa73c71a24b197ull, 0x7f271af11a19831eull, 0x0a1275663bac4543ull, 0xc7d0dd906c88aaf4ull, 0xc695d7789d5d40a7ull,
+	 0x6a5ba89c8e062823ull, 0x326862a1bd0e76d7ull, 0xa28f24a977e75451ull, 0xa38f72e5e1b1cf54ull, 0xad5da98996ed7350ull,
+	 0xd76e2aa229e6e812ull, 0x39d45ed642bb2814ull, 0xf2477a29e7a90087ull, 0x781c57ba18a77628ull, 0xae41e1e69180cc6cull,
+	 0xeac3f8a49be2eb28ull, 0x9065b5a84e936393ull, 0x6292bc057f4948d9ull, 0x27b0da955193d20bull, 0x942d22af598f72edull,
+	 0x5635c2cb0ad929caull, 0x65e7027e49f923adull, 0x62e44ad5b465a1e1ull, 0xb7edd179ff9b650aull, 0x7e49fddd84daed93ull,
+	 0xcdd7087c9234d1dbull, 0xdc7d87ff886462f7ull, 0x8c29beacd29347c1ull, 0xed179d668f1ff9e9ull, 0xe93dac83656c10afull,
+	 0x03f0d9710a71e88bull, 0x65110506b9040b3dull, 0xeb75c21fa7d5014eull, 0x4ceada606975ba54ull, 0xb21b17cc2e95077full,
+	 0xcc4d9704f71e2511ull, 0x1dfe600c8a3d5dc0ull, 0xd3dde1a7527757bcull, 0x684c26f866e44600ull, 0xdd8532e0190cc79aull,
+	 0x7a4dfd2d2652f78dull, 0xea89837744193798ull, 0x5689571c97ba105bull, 0x3a90092ab8122b1dull, 0x2af011a2c72975f7ull,
+	 0x2d7d30b061b2e0daull, 0xb178e26a2ad3588bull, 0x29d303619beccbaeull, 0xd5f32c86ba6aaf26ull, 0x02d67dd3e2d6e8b5ull,
+	 0xe17b59e09d1a1390ull, 0xb83db3b297dc7ecdull, 0xa7eee5ba20b4992full, 0xd3a66b9c531c594eull, 0xa940a63d81c7f379ull,
+	 0xb0bb3719d9fa2541ull, 0xa750e7ed4e7fe1ebull, 0xe82a482db362ea81ull, 0x58b5dbab9f2cfa54ull, 0xc5275edd2d3fbaeeull,
+	 0xb3d7d957b60821b8ull, 0xb131bd9642c222bfull, 0xe9085e8da546dd94ull, 0x2fac1805ca490b43ull, 0x0d1b9030af3640bdull,
+	 0x7af2c8a88f87cf5dull, 0x5792fff2d617eb64ull, 0xd06f57d16994a047ull, 0x69a79852955b0bccull, 0x046a76c79e9e307full,
+	 0x6d514e1ef2dfc0fbull, 0x0f7e4eee313b5c1dull, 0xba638080c8afeb10ull, 0x11957832a230a284ull, 0x146c1534dc859f48ull,
+	 0x2fa61d533f6fffaaull, 0xc226b2993d739bc3ull, 0xade57fbfb41de386ull, 0xc849f28f1d494284ull, 0x83cbee3d072c9678ull,
+	 0x10e3c25c0781d0a6ull, 0xa1ba4d184aef4f95ull, 0x3ac8f5cc9c99edd2ull, 0xedae109a61560981ull, 0xb9ce6b23e9aa88b9ull,
+	 0x05cc5d6617970017ull, 0xfd1410d81f684817ull, 0x5db242bbfc0c8e89ull, 0xe49ce57bf36570c1ull, 0x6fb018ad50d3977full,
+	 0x41bbc929f3702476ull, 0xcdec3ee3bec5d693ull, 0x08cbadf2cb8f0a29ull, 0xce54a4add1e6f15dull, 0xbc9ab164e4491b91ull,
+	 0xf4b1c11ee36355d9ull, 0xd371058f79c4ee4eull, 0x23dc80e591b91a87ull, 0x51f30f998db35a95ull, 0x0956a979890dcf0bull,
+	 0x14aeb8feed1b94c0ull, 0x5d486efe930bd843ull, 0x0193e996553b6042ull, 0x487074f75cc218bfull, 0x4d663f79fdedcff0ull,
+	 0x6184f17d2af8d5c5ull, 0x2e1355e482874b6full, 0xd6500a0e23c3d408ull, 0x9f669fccb4fa63aaull, 0x39035e96b7e3b24cull,
+	 0x5f40629c052916bfull, 0x09ec75071cf93c2aull, 0x318fa657688a51eeull, 0xa915d209b22e1f4cull, 0xafa5f760383ce72cull,
+	 0x0ff6bd6fbc8fae02ull, 0x1b7b3126a1c6106dull, 0xad4ceed78dd2fe8bull, 0x365ed20db1b1bf13ull, 0x7f3547562452e598ull,
+	 0x7cff5771732a9684ull, 0xbb78341e34e37b2cull, 0x0a514b83f4fbaa8cull, 0x877cc482bb539b90ull, 0xf7e5e7af867362f6ull,
+	 0x46638cf3f3d1f36aull, 0x100d531a05b42aa5ull, 0x2a16306776f8ec86ull, 0x654a0805a46fc838ull, 0x5cfdacceb999486dull,
+	 0x8749cd00e721e722ull, 0x68559c79e15dd299ull, 0xb427257d077ea712ull, 0x9974d4ab442f8969ull, 0x1c9739266e459cdeull,
+	 0x9a75378ffcd75de2ull, 0xd36cdcf772a334e8ull, 0xa58e6beb285556e0ull, 0x7d48ff39e10b760cull, 0xb1d6521d0102baf4ull,
+	 0x63cbd3c6b97a9eb6ull, 0x33cfd08a9d0ad8ebull, 0x64f763533e12d430ull, 0x95d670586b24224dull, 0x5697ed6631733a9cull,
+	 0x22afd87093c3b2c5ull, 0x3db2c6d6d5e86b9bull, 0x9427285329c87a23ull, 0x972ce49ce8af2b4dull, 0xae72ff8a691026d2ull,
+	 0xe4c3e2730c7bcadfull, 0xfabf59b1f28a8250ull, 0x2a92c87505bfd41eull, 0x9ac1e179895cf652ull, 0x86be1d86dabbc10dull,
+	 0x62d919dcdb7eab15ull, 0xf65323f3ff06e6c0ull, 0x8fc0c0c258332a1eull, 0xb03a2d168a18cc45ull, 0x602525ec25b493f6ull,
+	 0x7b9b6d1c07695038ull, 0x483fb7ac7eef8bf3ull, 0xf74e286b9fb0eef7ull, 0xa52782e0a1bd34dbull, 0x105826c766580c49ull,
+	 0xc6fd630d7e7ff44eull, 0x27351200b4789001ull, 0xac06a6a4f1171632ull, 0x518a2a58aa69a900ull, 0xa8a53a87743b5864ull,
+	 0x294e6161ff1fae96ull, 0x26f04f4ed7028becull, 0xe4306c8c5c788847ull, 0xb93b0be6220e4850ull, 0xa81a58d56d4aae49ull,
+	 0xacbc1a12b5be2374ull, 0x6eda020160ebda71ull, 0x777d9f8f8edd7cf7ull, 0x19584caea27651b9ull, 0xf0e71a3c9245c6dbull,
+	 0x5c8213e048edff47ull, 0x941160fb720a34faull, 0x8f66577f837470ebull, 0x6af350c475342a47ull, 0x5f3d6cebfc5ee95bull,
+	 0x9aa8d34e0815bfabull, 0xb803b9506369b1eeull, 0x9e40b35cdc54eac8ull, 0x4bb9c1abb8c37828ull, 0x104161fe18b1e2c1ull,
+	 0x28481aa926cf11beull, 0x588aeb56987b372bull, 0xa74505539aa92024ull, 0x94c1f771b649251dull, 0x0d590675f67cd71bull,
+	 0x3afb76d11daf35f7ull, 0x14882dacd87b5d9aull, 0xdeb8e5f97d55fe2dull, 0xebf027f1db7c8a23ull, 0x9f40593e3a15f1dbull,
+	 0xee1ea7eb1a9abe5full, 0x263dca9e464a778bull, 0x83d904ffb7b69e5eull, 0xb7a22a3c556b9a5aull, 0x382836196e615394ull,
+	 0xe8098f19245f383eull, 0xd3eba3720f67fe97ull, 0x8db219e8b2ce81abull, 0x8d1d7330233a6f30ull, 0x00259683228b094bull,
+	 0x494986adc5665007ull, 0x3cbbb94c9670592full, 0xdb536fc0411009a7ull, 0xb9416b1ec82ee329ull, 0x14389f3f06237267ull,
+	 0x291db33939018455ull, 0x50027a312060fea0ull, 0x06b42ebb3521bc6cull, 0x1413eb7b066a0c74ull, 0xcee67590b224d541ull,
+	 0x651d02ab01461d6eull, 0x8b392e90e507fcc2ull, 0x89bdca531979a7b7ull, 0x916cb62e96867dd9ull, 0x33ab4a9a642e5e0dull,
+	 0xf821c2d978ffee79ull, 0xcc0f472f2d9e4e80ull, 0x8f669981718bfd07ull, 0xe4e68bbd21dede1cull, 0x8a636b4278ec777full,
+	 0x448083315d632365ull, 0x2b6c9064ad428d3eull, 0xa5c0fc4729f94173ull, 0x1ceb5acf4b171955ull, 0xfafcc7b513687e85ull,
+	 0xa18a5b5239201281ull, 0x33170f3c5fe5c2c4ull, 0x03188361bdb77537ull, 0x50b499ff579e49baull, 0xb6e0d1f79238a93cull,
+	 0x280334ddececed39ull, 0x61db27445fa2d963ull, 0xe1c62bbf29d8037full, 0x3c1c943c0df1e703ull, 0x44f85876090f913bull,
+	 0x06c5c25ccd3fd9d8ull, 0x6c01ff4c736283eaull, 0xbee2ef2199e8f3caull, 0xe3fc2cdc158dc002ull, 0x16421320ea28423dull,
+	 0xb39c78b570ff07a3ull, 0x804142ea8e9edf3cull, 0x52384600a435a6f7ull, 0x35503e4a4dbaa96aull, 0xd1dd9f9550ea43adull,
+	 0x25976a47ee5bdac2ull, 0x3c41611cd7ad5567ull, 0xefc1a00a3d9ac2a4ull, 0x8a15637a964e464cull, 0x4a613821bbbeb4ecull,
+	 0x1263be2efd8f9627ull, 0x0aa800dc4295cbaeull, 0xf024709b6b2ec6efull, 0x1e7d4e4230b8ca53ull, 0xabbe135eaef09f69ull,
+	 0xf0d039b24b8596f6ull, 0xab7f969e3299fbfdull, 0x316740300de3d6e1ull, 0xbec35dea6f616948ull, 0x8831d24cc04b840aull,
+	 0xcb056e9fd655b232ull, 0x623d47cf2d9b5742ull, 0x7646905626fd930aull, 0x5b0d876a27902124ull, 0x6aaaddb3a4c46848ull,
+	 0xf2aca456f09276bdull, 0xcd3c4bb6b12ca533ull, 0x773c25fd3dcf082bull, 0xcfd73468eb5b9e61ull, 0x32823f0350fbb190ull,
+	 0x01a62648512c7180ull, 0x5494743d0fae9e95ull, 0xc0e0228468bd95c7ull, 0x5ceae41fb13dc602ull, 0x1a7a82bdda798833ull,
+	 0x389510838462e6a4ull, 0xb79bfc53c4cd12e9ull, 0x880adbeefe9cc459ull, 0xa21c3552392471b2ull, 0x81fd21fe5a913601ull,
+	 0x4879445bcef87e3dull, 0x989b1aa3c88be730ull, 0xdb3546e54ae01209ull, 0x6fb7e7a587701c2aull, 0x501a385893183ff1ull,
+	 0x7e5c299c5881eaa7ull, 0xbb41d863e28665abull, 0x37cdfabd09965afcull, 0x7dc8131e9d7a6203ull, 0x7a752f32add0b16eull,
+	 0x3f219c04878f54d8ull, 0x5d14582b1dbe5917ull, 0xcc217e55d42773c9ull, 0x66a0d0b0fac4e461ull, 0x3f10d406af4e4cd3ull,
+	 0xa75668d90e7a0ea1ull, 0xa061c4f9128bf04eull, 0x6ce2e10fbc5a1febull, 0x8ffe1b83ad1e2cf3ull, 0x40486f3868e2f158ull,
+	 0x0f838df0b79c4ad8ull, 0x7e03bd7340857d35ull, 0xf89ab2fd66a611f2ull, 0xe666ccb40457b167ull, 0x38cc9008b168260eull,
+	 0x0a3c7ec4c2ee9c98ull, 0x6092fa75628eda84ull, 0x1649045465f01264ull, 0xd6991d12d5cdc3f4ull, 0x848b6bf0841bc7d1ull,
+	 0x1d57ccb1ec68d558ull, 0xf12112431349cab9ull, 0x5f28a6fea1a3deaaull, 0xd4a1b180f3205f9aull, 0xbf3c1e75a4ce3290ull,
+	 0x6f7ca2735d1d1df2ull, 0x84c637b2c50c90ecull, 0x41302331f002480dull, 0x63ed59abc191fb84ull, 0x69dfe371c6dcd2d9ull,
+	 0x2d98fccc4661bf1cull, 0x7101d9108704314cull, 0x4e2bf32284787542ull, 0x6cfd293574596235ull, 0x146954efa6e9d729ull,
+	 0xce87fd5a321a0b50ull, 0x6ae96de9b5f005a7ull, 0xba75706cb6829758ull, 0x5fa0f2155a8db0a3ull, 0x477d65e6c96669dbull,
+	 0x579558334fe3494cull, 0xd11ee7ae1976932aull, 0x446b37e09305bbc3ull, 0x87ef8d5bc936307full, 0x85c877581de78cc0ull,
+	 0x25c5f091a1e782ebull, 0xea6f08e06698d4fdull, 0xa3359cf567b8b3d0ull, 0x379bd8ffd7c78382ull, 0x1ba1b0495dc70fa0ull,
+	 0x9d2d49bdc4533458ull, 0x7686cff99cfa6619ull, 0x57defbc317d71478ull, 0x9f94a67d4e3cb323ull, 0xdaa04ba6bebd48e4ull,
+	 0x23de5be9337584e1ull, 0x36efb81fc4f96affull, 0xdba3214f89c17d7cull, 0x9a791aaa5b73358eull, 0xcdca819edb24c1a7ull,
+	 0x55a47d901291c5dcull, 0x776a22199b52817eull, 0x0490188ea8a4e355ull, 0x07cd126ec1cc7014ull, 0x3ab541fbd056e36eull,
+	 0xf8f1cd0bd71505c5ull, 0x1492db7fe63cc13eull, 0x08f764d908dad173ull, 0x3846b8293ccc3ac4ull, 0x81f3beb6f1dc9acfull,
+	 0xd08569733450e45bull, 0x7193a06f63f551cdull, 0x050ea3872a3ed921ull, 0xc62a26a5953a66d3ull, 0xc097238621969174ull,
+	 0xf2b45c78d990912cull, 0x3af4139e9e44ff38ull, 0xf3f6aa519d26d5d7ull, 0x8db227a3e51fa534ull, 0x8a55b34a2a0fce60ull,
+	 0x42876f9de1c7bca4ull, 0x53bd89593e78f810ull, 0xf88dc39b9dac7a5dull, 0x03ec070193974b34ull, 0x4236dce448929d76ull,
+	 0x0b8d74223eb0db07ull, 0x3d8be3daee29979aull, 0xc1276bf664bd7a12ull, 0x96195d564c159114ull, 0xc3e56eeafb373dd3ull,
+	 0x4f151384869a6918ull, 0x96e2382c2c0ac597ull, 0x1657472cb3880404ull, 0x906799a8d08a68baull, 0x12b8e43a38bd0831ull,
+	 0xcea4f1e86e72e675ull, 0xf995ff180f0cb29eull, 0x6bf6d2f6e6941483ull, 0x78a33498a5402ab4ull, 0xfe69be4cfeb95e23ull,
+	 0x2b0d4058247d76cdull, 0x7a7990f9ad5d7612ull, 0xa989bed6fb22be7eull, 0xbac5cfd7f8aa882eull, 0xfd56149cd51911aaull,
+	 0xc83376757702f390ull, 0xe5d4070a720de643ull, 0x2197468d7406c699ull, 0x3ce8a1c08df6e34aull, 0xb87e46e0fbdc4875ull,
+	 0x40bd3b5bfa131c85ull, 0x502ce71548c5f9e9ull, 0x935895853b87dc6eull, 0x548b9b9f146db42bull, 0xd33c2cb0de2e2c3eull,
+	 0x0c1e680b50c3a5a2ull, 0x394112b4b0107f49ull, 0x4beeb19c57c2382full, 0x7f8a15e84b1cab7cull, 0x67c63a1e1e9fe8afull,
+	 0x3eab48c4c9fa729cull, 0xd3afe5e5c6118311ull, 0x9999158cfdd0b9e7ull, 0xe97a0987de34fb50ull, 0xac730e2be77cba9cull,
+	 0x46d205be47258b55ull, 0x4137dda656c5a227ull, 0xfc0c2c59d7d46e58ull, 0x7ad081a8d0cd4df4ull, 0x2bb4a9fc2b93756dull,
+	 0x11c58d6672e420ecull, 0x982c51621632798eull, 0xec68b68ea73db4dcull, 0xf6c974a9ea9a985dull, 0x86d6b13585affe8dull,
+	 0x77d5c74b12b22d49ull, 0x861815d228a543b6ull, 0x972e5b8cb1fdcbebull, 0x35cae612bba905d5ull, 0x3edb36486e8d87feull,
+	 0x8d1911c7ccb658c5ull, 0xbe4333850b40b015ull, 0x9baed42bcb986416ull, 0xfdc80699bd43d929ull, 0x9566342c859b9abfull,
+	 0x4f23f5f3eaf6bb16ull, 0xa75827174aba4dc7ull, 0x20a5a7d32a1c21cdull, 0x3c0fbbef34ec21d8ull, 0xa1316379a07732ebull,
+	 0xed94f1c7552d2aedull, 0xc5a0f71ca7045004ull, 0x53e6ada6c9f27f1bull, 0xb76d77b569a36964ull, 0x36dfa582643df06eull,
+	 0xc90406237f748fe2ull, 0x9662c1f0d36d2bc9ull, 0xac299783dc6c6716ull, 0xb3078a3b7bdf4080ull, 0x79060229fa87c025ull,
+	 0x0e4792642203fad9ull, 0x6e60194b4e661d63ull, 0xf554467d108f9912ull, 0x05bf47921e234726ull, 0x9d7d2d3ac6f82a60ull,
+	 0x905a868abc619badull, 0x30ce47b3db1beea6ull, 0xf39c576ced2fb7afull, 0xec3dfcf302cd1e07ull, 0x7830f72572dda7f9ull,
+	 0x74cadefa8f76d2f5ull, 0xa6a7da8a610d1d1full, 0xc264c89a3ccf2333ull, 0xaf2feafe941d0dfaull, 0x9bb3221ccebf3d8aull,
+	 0x8e7a608460ec6f25ull, 0xce6dd254b207e54aull, 0x4a8a2bdfb1d7ba31ull, 0xab41b22bac9b6d9full, 0x525c496ba2ee0157ull,
+	 0x0b1f2bb78e0e3b0cull, 0xd26868cc324b1ee8ull, 0x68613fff8637eeacull, 0x1ecd0059ceefb288ull, 0x3b067358fe2afd51ull,
+	 0x2767e43aaa29b91cull, 0xca3b52de97f7aa90ull, 0xde0b7f7682fe9707ull, 0xb2e474511615573dull, 0x63e4b5c2aeb94b1aull,
+	 0xaee3edca92e1f5aeull, 0xe25e0f5a521c3069ull, 0xab13335241dcf391ull, 0x59bf6268ad2845aaull, 0xaeaa87211cd56bdaull,
+	 0x91add6322e5a2f1cull, 0xeac6e237579fc984ull, 0x020116485626c4c8ull, 0x298de566729b4f67ull, 0x4d4bc5078fbc2e48ull,
+	 0x2ffc83f49ee186abull, 0x747ee701be6ebf53ull, 0x839fc6233dc6a675ull, 0xa62816baa48881c2ull, 0x354d4641ee52585dull,
+	 0x2c2aa2e796a2e15cull, 0x7e7f2a00a0a380c0ull, 0xd1bc33faf546d05eull, 0x8e7ba782c287e5f2ull, 0x193a012401024ba3ull,
+	 0xb4767f5dc0e94bc8ull, 0x461c87164aa2091dull, 0x101872c7fe989769ull, 0x006a6ad1e2c4e9e6ull, 0xb042f6d575f1e5a3ull,
+	 0xc80917b2a18205a4ull, 0x141d43d7bec383cdull, 0xb151a79f9b2aaca8ull, 0x93c3d82c313b8c43ull, 0xfee25e4ed1594c6dull,
+	 0x18e30514c0884eefull, 0x730f6c920d427334ull, 0xaf9a6ffdaf9687e9ull, 0x596eb522a0cb837cull, 0x9f2aec03cc83f1deull,
+	 0xdd6f05e3db4ae3a2ull, 0x8fd2728e987af615ull, 0x111248ad5ff5cd36ull, 0xa272089ca2bb2b89ull, 0x6141e1231f94ebabull,
+	 0xe9d21b4fe7a7eff2ull, 0x42ff1f12aa1d82b4ull, 0x4dcc5e7af63fc373ull, 0x5ed90aa9548a702bull, 0x2c535cf41bdd6dceull,
+	 0x781efa97462cb4ffull, 0x592de67c1ad08a66ull, 0x584aee62aeeb2702ull, 0xf5defb5010e59218ull, 0x4cc2f75350cf4915ull,
+	 0x4db12d633cd5ba9cull, 0x65e9d7e33d4c192dull, 0x144ce564a23b0f93ull, 0x3e84227b7b45fd5full, 0x05079c8b2148861eull,
+	 0x125144216fe69f2aull, 0xd2bf5d39386cbf8aull, 0x48704a241e983b25ull, 0x2f204ec9a7f164c0ull, 0x58ed44ca0218d22bull,
+	 0x8bbfef22501c123aull, 0xf238a979b4aac9c3ull, 0x3b1120550ff3b7fbull, 0x10d7de5037f0e71bull, 0x08d57f0fd70b7f24ull,
+	 0x67b3daa0c53b0c06ull, 0x2d94d8de93c0a294ull, 0x4bccaa337a244a9dull, 0x520693f2b657dfc6ull, 0x43cb0022bd51782aull,
+	 0xece0f4a081f60c6dull, 0x91b33508ad30a3eeull, 0xd27181ae3e9585e0ull, 0xfa61ba43f075fad5ull, 0x76e5ed377f7608f1ull,
+	 0xede5cd5c9cda6804ull, 0x40a413c6a5cde814ull, 0xfb5593bb5a7eb5e0ull, 0x0e7385c264ec0708ull, 0x96208bfcee256bdfull,
+	 0x85491c9efb152792ull, 0xdd2c39d7453734d8ull, 0x28af79eacf76b0b5ull, 0xfbb87eec72171c56ull, 0xf380b92df433ae30ull,
+	 0x796d19091869f567ull, 0x460363ac26baf757ull, 0x524f556959ae33d5ull, 0x319bc316a6ef18f7ull, 0x7487580979fcf7deull,
+	 0x6c399cafd4ec065full, 0x30314de2e1b4bbc6ull, 0x4d14da50ee7f9285ull, 0xdc070633cfabf02aull, 0xe7f718c12322dc23ull,
+	 0x06a1715439297dfdull, 0xd47de9a7fc0a1584ull, 0x0798c23631e1493aull, 0xf8184bfd4684e024ull, 0x77f0dee5c335b607ull,
+	 0x707b310d31bcfe67ull, 0x227d2c032b2b62a6ull, 0x3649e2081a9d7045ull, 0x4742b6ab060228f0ull, 0xb9fef863a852273aull,
+	 0x2108117592b46829ull, 0x3d5380b9f5a4725full, 0xfc3018ba52fcb586ull, 0xf028afe3845ef914ull, 0x96841cb845e9f96full,
+	 0xf19f12cd9f85c952ull, 0x421b243f474a4cefull, 0xb808e0bf9ed9e53cull, 0xcd223b0f0c9de457ull, 0x484c80cf5b6960bcull,
+	 0x290f89feb8a8228aull, 0x34a44903fd46f021ull, 0x24dbde957ac15172ull, 0x55b0cca313c18aabull, 0xf0a7b7a494a5a81eull,
+	 0x54a08de4c821f5b8ull, 0x73074c14e9cd28e5ull, 0x666af248b39bae4cull, 0x47cdf6c9e20545aaull, 0xa195348c77e3461dull,
+	 0x7f6e10160b8f0d38ull, 0x6bf50c0b3755f670ull, 0x5a016376eb85b11eull, 0x77bd096cb66f88b9ull, 0xbf0e3cb8ab2306b7ull,
+	 0x668dd91ca8071ea0ull, 0xdd9b69235bca6672ull, 0xa5c84452b48bbf7full, 0xb86c650476ffd76cull, 0x61f212392a62df3cull,
+	 0x3b23b62d5d8e9224ull, 0xe5d643ba6397d8b0ull, 0x2bc86fb7143e6121ull, 0xa17c4417a83860eaull, 0x37e38e4fa95cfe84ull,
+	 0x19fa6ab7206ef791ull, 0x8475c6b13efa159cull, 0x2a0878051974b33aull, 0x680e7a664a20c4bbull, 0x828635ec5f520162ull,
+	 0x1f1beedb34d04278ull, 0xa6f5dfa0b6e7c8b6ull, 0x5644ce78bf5c6c31ull, 0xc6552aea203e1d0eull, 0x93b86915e47dba10ull,
+	 0xa27d0f2aa9a75af2ull, 0xb20f0caf090ef3a9ull, 0x0a3fe7c7a169ce46ull, 0x1019387ae7fd7624ull, 0x81ec8a507dd83350ull,
+	 0xba1d2bf2d25e77f6ull, 0x8fede5d001526daeull, 0x034b6b460ed3305full, 0x4ffbd7f67b6b8653ull, 0x38b651ff7b12496cull,
+	 0xc62da53bd3e0eb71ull, 0x1a2cc5b937f863d2ull, 0xa38142bd74730850ull, 0xa9a2c5898ed5f662ull, 0xd81b2de12c709aeeull,
+	 0x494ebcd25413f084ull, 0x1fffc0f16b670c72ull, 0x2a6296b9e2f344dfull, 0xa8ca233764ec210cull, 0x847377740de795d0ull,
+	 0xb8dd8a9c84411303ull, 0xc6c67a6259a89d42ull, 0x68a481d763d1d70eull, 0x47c10b023f122019ull, 0x753255baaeef9c6cull,
+	 0x987a8435f579592cull, 0x7f653c201685817eull, 0x884d95551972657full, 0xe3c8eb3c3c3bc1e6ull, 0x32229a8c7a8b1ffdull,
+	 0xa7c75fd2f9af7ecaull, 0x022b4e656eb8c318ull, 0x5b287ae1c37d4ad9ull, 0x920ce464dd9c6896ull, 0x049f9076dada9d7bull,
+	 0x3c52922c4aef1a18ull, 0x50f74af58bebb0aaull, 0x3ae9bcc76c7c0b9full, 0xb41e7ad72042a373ull, 0x64594a037a3f62d8ull,
+	 0xe884e602f8b4bf97ull, 0x6038d6130fe98438ull, 0x3bc9b63c64f8b000ull, 0xf65cf1dee01b68b7ull, 0x6a175b9e2ec88355ull,
+	 0x7f0bb4626377a15full, 0xfbff3d88fd048d91ull, 0x6a0bedaa85d7445dull, 0xe4a843d160372ed8ull, 0x1ccb0b3204076405ull,
+	 0x8179ff51d93b57c5ull, 0xe31e0be8c5bf38f3ull, 0xdf89c404d5d8ddd1ull, 0x50fa9108ad06cd32ull, 0xf05e895df9792b23ull,
+	 0x1f4768ab5bbb287dull, 0x91ab853ff7a5aa88ull, 0xe787ea4b9cf1bd2eull, 0x4bed68dbb3b4d78dull, 0x67a3036ffb5a7b7cull,
+	 0xeebfbae21c5f53c7ull, 0xc726c99398bbbb7eull, 0xae381a07ac1d3bd5ull, 0x7d03c0bbe3a14572ull, 0x45c073509173711aull,
+	 0x0686f1cc40c8a636ull, 0xc5a13eac898f4dfaull, 0x737ee95643af33b9ull, 0xf122fa968786bf4aull, 0x49352589eb86b25aull,
+	 0x46994119d8b40098ull, 0xde91f187eb51a809ull, 0x81dbc2c8de47d0bcull, 0x8c5e75368c5431b6ull, 0xf3b63bd24fd90f4full,
+	 0x5bf3aa49c29f7864ull, 0x5e3d469e270982dbull, 0xe66d829d0a2841f8ull, 0x232d0da7936e41b1ull, 0xfe58bd3d76660150ull,
+	 0x1e4753925611ef1aull, 0xdccfdd616f1be5daull, 0x7956c7c7697ede63ull, 0x133b2bf962ccaf31ull, 0x64484a55ab789e7bull,
+	 0xd6bc22d6355a42d4ull, 0x66b0d8ce46abcb87ull, 0x6a7dccd580c666c4ull, 0x42815c544e916d76ull, 0x550a2bb3ab680d64ull,
+	 0xa1e7c14be865fc23ull, 0x0a7abf4d7594f5edull, 0xd026c47c5131faf8ull, 0xaa3c8cee6220a2f4ull, 0x0150d6b3a7a6dd6aull,
+	 0x384dad2fb41deba7ull, 0x047a23830b2490b2ull, 0xa85d41f8f25aa845ull, 0x075fe006902c4532ull, 0xbf8202962f61ee10ull,
+	 0x15da4b952c917b65ull, 0xfbca8a356bb99f2aull, 0x87081ed9e57e2115ull, 0x558e40a0376218d2ull, 0x18735183b446b75bull,
+	 0xf5601e4ce5c8cbdaull, 0x0a454c592af3107bull, 0x56e03748fa344b7eull, 0x512bcdcc03871a86ull, 0x856c3c0b4447f6efull,
+	 0x0725b94159aacdc7ull, 0xe1cf60865749fa0dull, 0x194b1836dcf9b541ull, 0x7ad0ac1e67912a1cull, 0x540b239414bdbeb3ull,
+	 0xabb59014ee895fbbull, 0x0ad190337b118e76ull, 0xe607425314f333d4ull, 0xda8de5ae9d6a9a51ull, 0x9f4e44981b19a8ceull,
+	 0xee886dfbbdecdf6full, 0x6b8e7439a6d48afbull, 0xf43cd24c7b7b9707ull, 0xa64d7c20425b317eull, 0x38b09886a4be41b9ull,
+	 0x7247852d0ec97437ull, 0xe31288ccd8c6707full, 0x7780471b0868ef4aull, 0xfa24d24faa058e1bull, 0xe0d0692d79c7bbbdull,
+	 0xd53b976f6c37e6b7ull, 0xdede17a5a1fc7723ull, 0x1dbd7f72fefb7648ull, 0xacb8bbe5c3b8a666ull, 0x2fcfdc45ab65fbe6ull,
+	 0xd44d57cf4aace746ull, 0xd1b819e0049ef3e2ull, 0x22479e3f02796e22ull, 0x1b759ddd2160d027ull, 0x6d43e89cb4592f71ull,
+	 0x557ffa5b9de14f36ull, 0xeda7105cce77980full, 0x2600df712625cba3ull, 0xbd42f9f1e606eb9dull, 0x0d0e8782f600c22bull,
+	 0xe0b1ec785c8e015full, 0x3920faff30da0b2cull, 0x149ccf864e7a633dull, 0x333a0b06ef67dee6ull, 0xda120bc8bd88d3a4ull,
+	 0x6627b1b68f19adb3ull, 0x083171a1107730d7ull, 0x80491cb169885043ull, 0x0d0d0d2982324832ull, 0x5b623d43444ad34bull,
+	 0x5631c91f472624a1ull, 0x79cd37c0356b1a51ull, 0xe01fdb5f173d67b7ull, 0x8e94adfb1b9ee3d4ull, 0xcebdd16adba10432ull,
+	 0x623135b78530e306ull, 0xb7a5637ed8102e38ull, 0x43ef8b4185b27167ull, 0x48947bddb7d2be1bull, 0x1601036c25073f05ull,
+	 0x8cc96422ac975680ull, 0x35dbd9c0ac815b0aull, 0x085cc19bb09fb134ull, 0xf59fce5de969179aull, 0xa2504655ffe83eadull,
+	 0xd5d3353cbb4e1944ull, 0x02b04f854b871f21ull, 0xa8f517f335fec6d3ull, 0x7a175fd7526b7692ull, 0x9bedd7db166693ffull,
+	 0x5013b03b43a36e63ull, 0x5ae2e11194c8f5b2ull, 0x53b0addee5023e44ull, 0x691f6e4dae8543c7ull, 0xabb70e541f7db138ull,
+	 0x16438eba29a617eaull, 0x6c0b91991223aa34ull, 0xc7e72c91de1e1d30ull, 0x4f2cb590393f7683ull, 0xb75ea261caa54936ull,
+	 0x30e802b84c5ef091ull, 0x2d2e7e0ac661af04ull, 0xfa901c2aa8f1578cull, 0x3c7fcf24ce0b769cull, 0x82b29fba2b192356ull,
+	 0xd05d32f1fdcc7045ull, 0x0d869d642df1fd01ull, 0x8ec1cb02e2422023ull, 0xf2ee446a2ac4d13bull, 0x4d95695e62d19f33ull,
+	 0xbc6de29106c4c61full, 0x19425223e6ce00ccull, 0x62ade4cbb130b627ull, 0x81f2925bb6eadf89ull, 0x49b8f5596a18e682ull,
+	 0xe0e0cc23d59e314cull, 0x57397198c324b3b3ull, 0x3410d2638bb41244ull, 0x92fd20fb11d6f412ull, 0xdace59b69a945c1aull,
+	 0x494ef0726dde98a2ull, 0xa61b9c40faaf1d2eull, 0x1b0755e221282d2aull, 0xdb498f670a34d4f8ull, 0x926e55b0d1d6f771ull,
+	 0x7cee6cfbbf7c4791ull, 0xdcd911d2c8d4132bull, 0xd71d13f92fd454e3ull, 0xea8669671d60c922ull, 0x6a5a0f15d891353cull,
+	 0xebf17490d7f6e357ull, 0x31ca9a98be59aee8ull, 0x7deb4cf1f6041011ull, 0x0d793a3ed9c3b0a4ull, 0xdd1cc61ed74e36dbull,
+	 0xb8213bedd74aec93ull, 0xd30bd5b2d93574ccull, 0x1f828a2ac5f88a17ull, 0x04aa214400350a66ull, 0x1bea8596bb1cd00eull,
+	 0x3a9f102b1f985e28ull, 0x9f190fd3f677d1e4ull, 0x39e33a9fb4b02f20ull, 0x46865ab264950aaeull, 0x65de442cb0de2fe7ull,
+	 0x9f91327a70b1649bull, 0xc71f9ec4cd56f4efull, 0x1ad3c46de4643c91ull, 0xaa952ed3ff1e8d3eull, 0x42e66093034315d9ull,
+	 0x8ed63db3a76544e7ull, 0x6fe8510b950713c5ull, 0x1f31f6299d96a084ull, 0x91037fbaa683e73dull, 0x847991c0fc8e29a8ull,
+	 0x622748720551b2baull, 0xbbd073054728d442ull, 0xa0f15a7a662ccfe2ull, 0x8bbb13a9df71448bull, 0x871bea3324dc42b6ull,
+	 0xa74fe4bb71521cc7ull, 0x6aa108dedd7c5ce4ull, 0x863946c4d7dda75cull, 0x2219577dd15753f5ull, 0x19f7e857c7868f40ull,
+	 0x069553894854516aull, 0x46805c242a9c769dull, 0xb6cb26c09d6137c8ull, 0xd738cd8d20a5f7dbull, 0x79bdf15485dacfb8ull,
+	 0xfe6c8f046c68e436ull, 0x52e732be13e9dadcull, 0xd3feff9707a8877cull, 0x52b925ba0ca190fcull, 0x3c8931bab5ee398eull,
+	 0x8d2f7544e050aa9eull, 0xef81a7db8c40ec7dull, 0x8211a43d8c4e03dbull, 0x3ba8d62703118ac6ull, 0xcc679a22fbdad0cdull,
+	 0x8b6227eede6c6b4bull, 0x4f437c2ca094afc1ull, 0xb458501db8de4106ull, 0x946c2cafaf409efdull, 0x0d398dcdaecb5c33ull,
+	 0x067967e57ed927b1ull, 0xe29df34402439b04ull, 0x6214bcc8efa90a61ull, 0x5d1414ca7614695cull, 0x6d6aacdec6b5a3c1ull,
+	 0x90c803c398e75d4dull, 0x3abcb310eddcdca3ull, 0x731a113a6a96ffc3ull, 0x16027a0d9a030af9ull, 0x418046ee12eb35f2ull,
+	 0xdab200e40fcf3f2bull, 0x97ea52abff1bad85ull, 0x487bbf8205dc8f2bull, 0x0dcc0878166ed670ull, 0x07cfda666db7cf05ull,
+	 0xb3bc13f1b5b50810ull, 0x14d56159db8a4851ull, 0x71d73e816e030c74ull, 0xf1b90f9361625f83ull, 0x8888bdfa21e1be75ull,
+	 0xb04480ea7454603dull, 0xe326c2bfda7c2f99ull, 0x2a30a42b58048f94ull, 0x82c914165cf9ade5ull, 0x75824275edb5ced7ull,
+	 0xbba6078c6fed0466ull, 0x46968f43101af845ull, 0xde5c4c2b3da9b94aull, 0x9e90ffb592468780ull, 0x5b56943b87056ca1ull,
+	 0xd99ce037fa826dc5ull, 0x5d699848ff3b4412ull, 0x23a624e82238ee91ull, 0xc40f5d46fe811a60ull, 0xe41a5debcd200d2dull,
+	 0xcb1e0caf9697679bull, 0x5cb7ba015f8c51feull, 0x114b109205cce86cull, 0x240b96df96c281c5ull, 0x69d69c832e55f3abull,
+	 0x717f2673ffa04eadull, 0x6ac5540fbb907df0ull, 0x36c02488817699a9ull, 0x76883ace9c36592cull, 0x89ac523c534f426cull,
+	 0xa813053ee5ad0b4aull, 0x5579bcc9d303433bull, 0x144ce098de71196bull, 0xf5c0aad999588286ull, 0xc798de670fd3e456ull,
+	 0x0796b218fcc1bdbbull, 0x15defc866bb212a6ull, 0x4239ed9c17d48f51ull, 0xc05356b5680c4631ull, 0x887c69637f21ec66ull,
+	 0x17b86e81550dc95eull, 0xe57eb0ac7e6c38dfull, 0x935d7113c0a334eeull, 0x9dd2a266fdcb5dbfull, 0xaee74e55d5e5c80cull,
+	 0x0ee83877a8ab0c4bull, 0x87b71af0ccd506c3ull, 0x212fd39e67c02f4cull, 0x24739e69c081b050ull, 0x0a84d7c7772c3851ull,
+	 0x0fd5e3fec502b480ull, 0x4242610b68fc8e0eull, 0x2e1322e2d56f6ce0ull, 0xfde93fe53aeb9523ull, 0xa0e01b35f54f7cb5ull,
+	 0x9abf0485d3b4049full, 0xd9fa8de562536671ull, 0xc2c572ba9ca5ffebull, 0x1d5cc36392a7120cull, 0xf1395d05ee4f30d8ull,
+	 0x6b821bce8740f760ull, 0x9e8b19ca0dbfa817ull, 0xe28525c98612276eull, 0xd46370668fa819edull, 0x8843ecacc297caddull,
+	 0xb246209ba4dce967ull, 0x101a338f8f181ee9ull, 0xd12a91a071230163ull, 0x8d4a89a3e04aca82ull, 0xf3915d74810f4816ull,
+	 0x3c0b84d8354bd38eull, 0x7e8f05fc5da1742aull, 0xf1ddcfd78dacaffcull, 0xe3b617a3013937c0ull, 0x78c2fba169fa6482ull,
+	 0x284f6b3aa21cce05ull, 0x163292299fd6c6bfull, 0xd4ee6a54b8592ae3ull, 0xbfe3111438364539ull, 0x936cc251f18f3b75ull,
+	 0xdcc8d05c268f9e75ull, 0x2801bb32409bc438ull, 0x2daf831c3d451c2full, 0x73762a78eb4aa54aull, 0x009e2ef817f8e17dull,
+	 0xcfe5ff3af90bad55ull, 0x1d220af48d5bb1f4ull, 0x288a513671c049cbull, 0x17b5fec7b073af60ull, 0x95fe305f2713074full,
+	 0x94b92b8c0549fb1dull, 0xc5cb343b14766dfdull, 0x6c3cd3f152d55847ull, 0xda7faf66d7846a38ull, 0xc8022738f4d2d7cfull,
+	 0x264cfb760688edf8ull, 0x983f8538596454f9ull, 0x28f974d8b65d81bcull, 0x7f53bd05ca86a2baull, 0xff9e70ab1d51bdf0ull,
+	 0xc86b818de73af17dull, 0xa33e3dfe85853e3aull, 0x310f3fe37b6ace4full, 0x63a71ea40fe7adfcull, 0xba2c76239f9d9c15ull,
+	 0x9a07ddc3872b47c3ull, 0xfd4ccbe573e98ddaull, 0x85463f5e9ee9d2f6ull, 0x475a9759eb118de3ull, 0xe32d91c9ec40d058ull,
+	 0x20fe0038b1a8a160ull, 0xc5be708c9616d07aull, 0x9841362eb01985b8ull, 0xd6f4fbb38ae7c11dull, 0xbdacda3130651debull,
+	 0xd4ca5c99f8b2c13aull, 0x2fb376e3b463d99dull, 0x1629e7c349bc998bull, 0x55cbb2006e7b8e6full, 0x57dc998675652191ull,
+	 0xc407d2150d97472aull, 0x3d60ab9a885e2b4aull, 0xdccc623dde554ae6ull, 0x669b8ddb848dbf71ull, 0xdc9f42f15af3d3eeull,
+	 0x1f1933028a32cd8bull, 0x2c99f51e1ac5e37full, 0xf65f165cc98fd5c3ull, 0x55f75abddce52b3dull, 0xedd5dfe5b046810cull,
+	 0xa7f192465e5ee2a4ull, 0xd765414d64f50e7aull, 0x13baa628fe2dd20dull, 0x88f90639468d3763ull, 0xd29cc64924521a04ull,
+	 0xd32253a851e93415ull, 0x62134d2ea9fb6416ull, 0xf5ae677afc835cb9ull, 0x4aa19f12018e37afull, 0xc1f353dda651858aull,
+	 0x30370d379af519d6ull, 0x0ce93e1e7ca75d93ull, 0x460476ae4acb21abull, 0xea6cabce341a609bull, 0x1fd39b03bff6c9aeull,
+	 0x63483468b281d8b8ull, 0xf60c31107d2bbba4ull, 0xd64f075f631f454bull, 0xe9fa285933b1e080ull, 0x2f27eb77cbea8666ull,
+	 0x096c99348d1be9e7ull, 0x29c6798875a656e7ull, 0x610c0c03a0703a2aull, 0xb40fd3b6b6553eedull, 0xcfa537295c9998bdull,
+	 0x1cd9a0165827d819ull, 0xe016c89586393886ull, 0xaa04ad5a81688951ull, 0x96a60ffa66d3bd98ull, 0x428e9b58df31954full,
+	 0x501fa7e4c8ab5192ull, 0x03cea33547054c4full, 0x70f251849a703587ull, 0xa486e3f65823b429ull, 0x08bc12a81e2f0557ull,
+	 0x571af48eb9d2d26full, 0xb048122c6f33ba4cull, 0x0235256b39e5b864ull, 0x16d6dc52faacf57cull, 0x85ed339083a375faull,
+	 0x756827c42d5c0695ull, 0x346d2d80dfc227dbull, 0x7d79865135313652ull, 0x441a226ee3f42e2dull, 0x16e1319fdb498fa5ull,
+	 0xd99d7f6e8231b849ull, 0x0713c1b953909363ull, 0xcc5c638a6a8fa602ull, 0xc112fd44656a2770ull, 0x06e625497d0885d9ull,
+	 0x9eaa6fed65496427ull, 0x2359b8f2d27dc078ull, 0xae62a8881d9b9257ull, 0xecc148d0a11991cfull, 0x1115ac17b8b0005aull,
+	 0xcb9fc6d4083d9fb6ull, 0x1ed9419d959a36e4ull, 0x796ab4f1fef0eaafull, 0x8d92186a5bf884adull, 0xd36110ecd6f12081ull,
+	 0x6d5b9581535ecb8eull, 0x785977f9be481fc2ull, 0xfe9f8824a30c24eeull, 0x583e2b905d443600ull, 0x6d8afcd52eefec13ull,
+	 0x7ae478acae322fa3ull, 0x279f1d3d69b5b53aull, 0xce8121c33a807d68ull, 0x6ce851b277c47cfaull, 0x5161e2b7427be673ull,
+	 0x9d8df5221ff5fe68ull, 0xe1c7d1c174d323f9ull, 0x7d77599608ded38bull, 0x93419c1dbf88dc1full, 0xebf82ae4ac98e0d4ull,
+	 0x20bd5327e99c85abull, 0x0f22c759a54b7fb0ull, 0xe55429f0a3b43c01ull, 0x0df722f5d45e34ebull, 0x0450ced2f83d1a5eull,
+	 0x04e78054414201c3ull, 0x9760a580ef1eba33ull, 0x44e994995ac246e9ull, 0xf2fbf39c2616d960ull, 0x975ddd8316c553a8ull,
+	 0x97d805ab7be5c715ull, 0x1756c1cbe72ec529ull, 0xce484e1e06f8bd00ull, 0xb1ec4aeb3e5c397dull, 0x2f5642f9bebed97dull,
+	 0xb55f8f51928df83dull, 0x1a3abbfebcc2a0e2ull, 0x90677b6754b9c0adull, 0xa14ad0ada54096abull, 0xc18f9045f905053full,
+	 0xa2b92b5b99be175full, 0x1a6f1aa33c67d435ull, 0xfd9333ab2fe89b39ull, 0x2548e650066d536aull, 0xbd699a2cf3a14330ull,
+	 0xf51e5375435b2bb2ull, 0x8f8677f3ab5a4b14ull, 0xf39bd0acf8ccc011ull, 0xbd0321bf8e97d1feull, 0xecf6b15306dbf6baull,
+	 0x2d9083dc7dcb2a2aull, 0x9c609cedbf3b2a95ull, 0x3a434b84ad4cf6ceull, 0x39878b6db6caf216ull, 0xdc0ba971bada84edull,
+	 0x82cb029e4cac6039ull, 0x27d65624dd0583c2ull, 0x6e98fecdaa14db73ull, 0x1f628023bae0b9ddull, 0x8281c18dd26bb36cull,
+	 0x199d7f2ca6d39990ull, 0xbe15c0ecf18f4700ull, 0x0df0b16ca8c8dd87ull, 0xbfb0ff3e8da57d3full, 0xe6b3ca312039590bull,
+	 0x1a88df56658f457eull, 0x26216323ff65a837ull, 0xa25b9bbd065d226bull, 0x05a43e04c368e231ull, 0x3c8d849c52b0436cull,
+	 0xff1879371d6c7b36ull, 0x3daa0625e5b2d167ull, 0xad99c268ea4691c2ull, 0x60838efcd2ae1f1dull, 0x1220e55a8b222e17ull,
+	 0xd12e83032a0b99aaull, 0x895435264573c64cull, 0xe447e286fc5223b0ull, 0xbc50fe0587e5f87full, 0x9ae75a7066e52364ull,
+	 0xced72a068fa1816cull, 0x15acb664e06dc1b4ull, 0xa69271b2cbe878f2ull, 0x8f8e6bcea9735c24ull, 0xcdc4e6127467c7d3ull,
+	 0xe134f4c6bb85e25bull, 0x22097d6efc81d508ull, 0xcaf9e92068b38ecbull, 0x9f9a5082799b0126ull, 0x5006925f245359d2ull,
+	 0xdbaea7a9c42bb4b8ull, 0xd04cca4d33f3bed1ull, 0xaca0ce20f7d55734ull, 0xb7567d868ed774f0ull, 0x992f04b277b1259dull,
+	 0x535c31640abe7070ull, 0xa6abd4eb81859edaull, 0x4d24a0c8dd3a666full, 0x4442af50f5479d79ull, 0xdb184f4e352d0a61ull,
+	 0x5cf4ee503334f1dcull, 0xd08c4b36b9030c03ull, 0x09d570bd6cdb77d0ull, 0x42a6a8082757df2full, 0x69e58d368d91a471ull,
+	 0x271b3bf3a84b4200ull, 0xeeedcab0ed0e06caull, 0xa8cc5f134af945ecull, 0xe93fc9abeb7f0198ull, 0x38e4c908925be7ddull,
+	 0x0cd1b8cc35c701c6ull, 0x7db1ce6f8123b190ull, 0xa6917a51a8b1d631ull, 0x8681641c3696cd8full, 0xeaa40707c43b7312ull,
+	 0xd5833045843a2722ull, 0x351c7faee746a9b8ull, 0xd1122793994587aeull, 0x15e4f11389efc019ull, 0x37d797d96e69eeb3ull,
+	 0x616e099be774fbfdull, 0x278a579627a161e5ull, 0xe705f2c1b6ef1b00ull, 0xb1f37a7d80fb8861ull, 0xe6cd729808d102a6ull,
+	 0x54e394c4ecbc9ff9ull, 0xb39c775b7ff1a515ull, 0x1cd7170820eecdf5ull, 0xa8d6f013e385b071ull, 0xc101ace9e4d3470full,
+	 0x071f2a3d6c363603ull, 0x28b88f47c3254deeull, 0xf5edbb8a0a25f0f9ull, 0xcb0e51ccb60b886aull, 0xc979ad111071d4ceull,
+	 0xc5b56695c47746deull, 0x008fcb512a1a50e9ull, 0xe5d253c4b6bf61d5ull, 0xd1bef6ec7bc8a7c7ull, 0x9d81935ca8712ee6ull,
+	 0x99c55dd1490eda53ull, 0x5941430ea39bd5b2ull, 0x8fffbd084109a048ull, 0x490b48284c87687cull, 0x56c1defb0e9115b9ull,
+	 0x25739390e7da7a8aull, 0xa1c2b2057df449c7ull, 0xfbe21b2da9769eb0ull, 0x839b387e503117ffull, 0xe31ed86ff1422436ull,
+	 0x0cec27274827e09eull, 0x520637d129592bd3ull, 0x90d073c0867e4d76ull, 0x0505c4c2db15c975ull, 0x2afec6c305d75a1cull,
+	 0xa825c91cc02a6684ull, 0xc13c06a7d49fe14aull, 0x39d49690a318c990ull, 0xed048a9e3e9a2bdbull, 0x27ea0e50bbf7a783ull,
+	 0x45e5740aeaf9b871ull, 0x4f20f55f01d20ef7ull, 0xc55707b54c4d1952ull, 0x8aadaee85287be77ull, 0xa5f4dbf6c965d5a1ull,
+	 0x010298c31c66d2b5ull, 0x8f6b3730956218f2ull, 0x8c7a1eae4610d8ffull, 0x0e93161c447a9754ull, 0x4eced25f7244e55full,
+	 0x5c56b050e144b4c0ull, 0x14baec720f422d4dull, 0x97744550383dc552ull, 0x1e0681fb2ccd12d0ull, 0xd9e39123dd0a23eaull,
+	 0x51bd40de52994d35ull, 0x2923b3b7f5c3bc53ull, 0x81731701343a0d19ull, 0xfec683b104f15be5ull, 0xc0962e4710d5c5bbull,
+	 0x4513ebcb632f22a6ull, 0x29f6dc2f4932d9a1ull, 0x3622fc7a4433b7f4ull, 0x597cb6d3babebc1dull, 0xf148464b1a32c1b8ull,
+	 0x58249d768eae90b7ull, 0x870a4d2c1cd2fb16ull, 0xd0cc6419b283f36bull, 0x4c6d6e8f2578baf1ull, 0x4bfcf92c37f1b949ull,
+	 0x743035ddb027110cull, 0x2228706dce7ef71full, 0xcb3a7f4470b9cbbaull, 0xd7ea712bef4a1c9full, 0x0ac4a6566d0dfdccull,
+	 0x9fe8ec98d08fce14ull, 0xd7c64caecbe16b6full, 0x6aef2150295df317ull, 0x578b4f9a7d5c72dbull, 0x7bf3dbdae2da65edull,
+	 0x727e5f4fc886d4a3ull, 0xd942af98369b35f9ull, 0xf1df99dd6735b67dull, 0x28b5c5ec2f9e8f2bull, 0xe1e03786e4852b5dull,
+	 0x2ed7a77f31998107ull, 0x5cda2b51bb569818ull, 0xc409e6fc46d4be98ull, 0x50c66798a3439e30ull, 0xe8217a360b7cde97ull,
+	 0x3601fb696c2e2111ull, 0x11a8dd4062137ce3ull, 0xb550cbaf3fea471bull, 0x02374ec8213e1a19ull, 0x62087336c5b175c2ull,
+	 0x152f3b6198bb3967ull, 0x5f07d895ce35d69cull, 0xaf9775c999803110ull, 0x27d82e547498788dull, 0x516d8737de425c5aull,
+	 0xa44e17fcee545a22ull, 0x06d28d17ef41086cull, 0xa9c9e0691397427aull, 0xc90c1568a1998645ull, 0x1e0b2fdeb559c514ull,
+	 0x9595f863fe03fee2ull, 0xbc4a52e85852e60eull, 0x6ba7a39876ee1145ull, 0x958d9b0ca430a733ull, 0x4291a3c6882303b4ull,
+	 0x26dd0931f2c92974ull, 0xef659fb64f2e0448ull, 0x5f2ab73ad082b822ull, 0xb7ae91241034c9faull, 0x40c71f264e89f9ecull,
+	 0xa0f53b22bd79e6e4ull, 0x80d25b27c666bbd1ull, 0x210f2fee4dc8b5f9ull, 0x4aef0f3229e23962ull, 0xc50b13793111dd6eull,
+	 0x17a8345d59952b5eull, 0x98b441fff475030dull, 0xdaec66cb3e49a9a1ull, 0xf0f32dc0ac1368eaull, 0xe60b075465bc26b8ull,
+	 0x0d3a8a138a26fd90ull, 0xd29ed7e13aaa276aull, 0x935e50a296b8f22bull, 0x378c6d101791f84aull, 0x18a552a63515e4f3ull,
+	 0xcbad1df1c0e0d97dull, 0x473abeb8d6e7452bull, 0x115283c9f494818dull, 0xfadeb83ea964b830ull, 0xdbe244ae85089fc7ull,
+	 0x180a508fb1877b96ull, 0x8e444e9522194039ull, 0x43b2fc920e323df2ull, 0x368fd99ce0566c14ull, 0xf31d1c5404e82e5cull,
+	 0xb144007dfbef174dull, 0xed9c91632e7abbf5ull, 0xad258c1b589a650eull, 0x9dda206d8d68d4eeull, 0x67b087c6a4bd047bull,
+	 0x0f39bca8070888cfull, 0x1da2cae4f006472cull, 0x05ff0282bdd226eaull, 0x9adb8df417891e0cull, 0x98ba54848ff14ff7ull,
+	 0x3f0fa97ccf3f38cdull, 0x7ee6c5c879fa5520ull, 0xea248d492841545bull, 0xfedd72bef615edefull, 0x70a628d5aa73e789ull,
+	 0x262d7c842d0ccd07ull, 0x6b07884ee09e0651ull, 0x965d86288fff4e82ull, 0x248c0d5dfd347d33ull, 0xcedb0ee9f884bc82ull,
+	 0x2285979ee7640a60ull, 0x8448911908075898ull, 0x6fcdfbf046484af3ull, 0x251d64da09de4a9aull, 0x991d06857310acacull,
+	 0x8be538255d37dff8ull, 0x19a3171e7762b121ull, 0x5debcc95c5c93639ull, 0xeef50f633fd588cdull, 0xa9fd8745a7fde2dbull,
+	 0x1d0f66738b283ed7ull, 0xae61fec510443acfull, 0xa54b8d55a2fbb41aull, 0x63e8dcd984fd2dc2ull, 0xa6ac07244de7d7ccull,
+	 0xb53665bcda46d5f0ull, 0xfcfd0ea584239406ull, 0x6003ffe1572058c2ull, 0xc6e68fe31d853cbcull, 0x641cda4d6c74e86cull,
+	 0x14cfaeca46873cfbull, 0x85fc9abb07e5e200ull, 0xee788d2853a1adb8ull, 0xa57d17032f4fe837ull, 0xe609ea973ebcdf39ull,
+	 0xe6e472e98d84a84full, 0x0676306349fd718dull, 0x2dfddb0a037c51edull, 0x046188befbd69e49ull, 0x1df0172604ea1a99ull,
+	 0x8edd0505d58e8dccull, 0x76db27ef9a9408aeull, 0xa670c8cf15375ca5ull, 0xd392dc2f31df4284ull, 0xc51b74f082013ec5ull,
+	 0xfb5876b80fdf1371ull, 0x57085fabbefdc046ull, 0xd73afed397df389dull, 0xa1048a766dbff9a6ull, 0xa2e0fa9dac581cddull,
+	 0xa9231eb171b5ae4cull, 0x49145a3b1819efe3ull, 0x5dd96955a2b14d4full, 0x6cd1bd83db851d7bull, 0xb1b9184c63868ab0ull,
+	 0xf3d1436a8b692bfdull, 0x52d3bf68362edc8eull, 0x3d73c5d4ef4e79bfull, 0xa851308350f23219ull, 0xf4ecfc948df37bbaull,
+	 0xa08a262b14ac0759ull, 0x714d571ef7b8ba06ull, 0x960fddb8b803316full, 0x9920a1c09060d17cull, 0xabdb64b4ad52c1e0ull,
+	 0x540a20bca8915643ull, 0xdf4b00b16c35123cull, 0x87dc2106b1c6b2acull, 0xdeeeeab57008b53bull, 0x82c0a198ed36b913ull,
+	 0x3d888cd060c5cadaull, 0x1e5ec917223658d6ull, 0x7d7e7812cf7ca8deull, 0xc37d838ff5583cf2ull, 0x527020ea034d8adaull,
+	 0xf2862a032ebfb888ull, 0x9a3520b5af12e6a2ull, 0x81a12c064c77aa18ull, 0x37756e6656e3cd5eull, 0x328885d70711e0e4ull,
+	 0x6c9aa8dbc0a02a84ull, 0xc8b155ae0c21fd36ull, 0x4a916718619ed954ull, 0x3cbebffc1dbaa749ull, 0x90e87a5b4f15609cull,
+	 0x67b77432216a5889ull, 0x7e3d98d34ea211aaull, 0x46f16e0a6e3de4a3ull, 0x7c32b784301c1c58ull, 0x939a1582189abc97ull,
+	 0x02fbb8f4ee6f972bull, 0xa067ce52bac60673ull, 0x79c3d4e2755215fbull, 0xa551eb9fb5927951ull, 0x409eb32e0a8e1f7aull,
+	 0x039808eabb580226ull, 0xb066c37936a979ceull, 0x30c2683498a5edffull, 0x395f899230bf05d1ull, 0x87505b99e4b9b09full,
+	 0x09d2827192a683d9ull, 0x95097518834c8032ull, 0xceedd9ac4b0b0a98ull, 0x6d01d125db3d99a8ull, 0x8a60fd11150fa12eull,
+	 0x46107e27c09f1383ull, 0x282076f273e90726ull, 0x375e92f4b9913885ull, 0x66137c770045f6e7ull, 0xb47df2ce25e4074aull,
+	 0x003d87387a6bb5e0ull, 0xa4abe0fb52694a31ull, 0x65c221beaf6bbfa0ull, 0x7675e2bfecbc3ce2ull, 0xee5208916927dcb8ull,
+	 0xc9a0aac569a5eb3full, 0x80b871d0bfef491bull, 0x16e9b26eb2ea6a17ull, 0x28013e5fcf507051ull, 0x2bb06c9024d9d432ull,
+	 0xbda2ca3b51038a07ull, 0x1c6a606f08940fbeull, 0x77e92a4e2501cd27ull, 0x0082169dd2e3e4e9ull, 0xe5b511811e8c645eull,
+	 0x5d2644845204a9dcull, 0x55529764a047da63ull, 0xe9f5a2482e4ad5c3ull, 0xb1a7376fd5af0316ull, 0xdcba913e66415e4aull,
+	 0xcd01ade824ff7afbull, 0xd583c948bf0da283ull, 0x23bd339daac2064full, 0x24f0b001c2a4f73cull, 0x3caeeb17b66f7e2full,
+	 0x1a353a51fc0ef6b7ull, 0x435f30857b7837e5ull, 0x28f4c85cdbbd799cull, 0xfccc49cb405bb079ull, 0x9ebf9ffceca46a58ull,
+	 0xadfead60cd764de7ull, 0x38392f1ba1ad934eull, 0x0eba8477f320522dull, 0x1b96710536559415ull, 0x8e8217a4020d221eull,
+	 0x89cbe8a142ba2a33ull, 0xf6bc6ec2e4f335edull, 0x8f06789ac4fa6e71ull, 0x3c3bae407d1f5417ull, 0x36065759a705c548ull,
+	 0x61b1d83babf74eb8ull, 0x61da335190a3fb85ull, 0x037872d89a80dbb3ull, 0x9df1449dafdf66a5ull, 0x93276257b7a8ffe2ull,
+	 0x26bff4492e292b44ull, 0xb64369756a518c90ull, 0xed125575e55def07ull, 0x19a74e999da543ebull, 0xc165e358ef3c2f8aull,
+	 0x8fc3ac4e6715e450ull, 0x67a2477859721957ull, 0xe38b9a6f7c0bc5d5ull, 0x58b9e6db162d30ddull, 0xb60cf0c094046131ull,
+	 0xa4ade8011765c6e7ull, 0x461988be356a6b65ull, 0xd87461782f3d1086ull, 0x21df1237c95846aaull, 0x95fa1433af27f109ull,
+	 0x6d7e1fa70643cedfull, 0x75bdb904336ed50eull, 0x502a9b9fdc20c4e2ull, 0xc682d6eab31702d7ull, 0xe3bac0bbabef2e83ull,
+	 0xa87fe9995094da66ull, 0x7b3cd5c374578e00ull, 0x2294f6e6ab49afefull, 0xd28f2730ebfd18cdull, 0x9279c93c41d2e9dbull,
+	 0x688a3a0274444bf3ull, 0x3aae12d3c631e663ull, 0x75dbe1cb50b1c9bbull, 0x4d21192679a2b526ull, 0x75fa85cb76b04ca5ull,
+	 0xf3bedce91a9ea8dbull, 0x93bf8cbc04e32659ull, 0xefdbb62225c0930full, 0x0412245ca7b9b8abull, 0xfb6e2e84134d8092ull,
+	 0x6915b6f3c94e9c27ull, 0x7f253ba4463990fdull, 0x4703f42bd3919518ull, 0x562521117c0fd3deull, 0x0bad6f0d5edff2b0ull,
+	 0x7060dd962b63cf5bull, 0x42d96f1f50591a94ull, 0x456c643d2d16fa15ull, 0x409b65dedcd19f68ull, 0xa8e5d20cb3561438ull,
+	 0xce21559bfcfab54dull, 0xf4be289eb0f438deull, 0x1d99ba56bb8c4812ull, 0x28c4c6a87e57587aull, 0x0552c97d61e00342ull,
+	 0xa5ecae28ef432b7aull, 0x4b2845298bfe44a1ull, 0xd65a8b53c8856922ull, 0x24363d80ccd322c8ull, 0xf1e3cef0d68c9a3eull,
+	 0x685309ecbe0cf376ull, 0x821b6b70ef2c4639ull, 0xadbfb0d0a2c58d96ull, 0x73972b7b43259e63ull, 0xbb485a02a4c64d7bull,
+	 0x88a1cd6f52e61b5eull, 0xaf90b9c3d1e07902ull, 0xd91e3a7bc4e35d45ull, 0x24c0da1616a98e55ull, 0x29a7a899b734ac80ull,
+	 0x41ba87c88de90180ull, 0xb6497f12e1486589ull, 0x9571c290b0d66008ull, 0xb379bd9153ed61caull, 0xe475d726837776daull,
+	 0x92cf9e534604a916ull, 0x054e1a10e9ffceb4ull, 0x6ebcabcff710fa99ull, 0x64a18212ad3417bfull, 0xbc8d8c9d1d096a33ull,
+	 0x9d80639e663e46f2ull, 0x3dd8b331c741a72dull, 0x9066bb5dffa0ded6ull, 0xb5cde8b7c740a756ull, 0x4ca87c577addbda1ull,
+	 0x1dd6319511bc807bull, 0xe64b39180f5daa99ull, 0x0e038976e204130dull, 0x26901859910e9089ull, 0x1f5d772a0bb39414ull,
+	 0x4b7643a8dc96d160ull, 0x02bbb05b4c6af575ull, 0xbbdbc0c3f53473a3ull, 0x2b7bc2c2e41e76baull, 0x48cc395cdd3e13b2ull,
+	 0x5685ad609354ba14ull, 0x375a74b3c1ada42full, 0x53d2d82f0cd689a4ull, 0x9ec805993f871967ull, 0xaa49e0d9abe35512ull,
+	 0xd33905996d1b9fc9ull, 0x471d7d6c89b14d92ull, 0x71fb13b5a2d4bd79ull, 0x8b3960441e8e4eacull, 0xfeff9831d8950aceull,
+	 0x680e2a7861a1af1full, 0x529a72c21091db27ull, 0xa0ac4937a05c1d2bull, 0xa07e453a21295badull, 0x73c76a35710ca5cfull,
+	 0x21aec708c9281a76ull, 0x89dfc175e30e2667ull, 0xfb9026b3a9f78d84ull, 0xa0c9eaf8f2ad28e2ull, 0x4d1533398facf738ull,
+	 0x83563967139b81ddull, 0xae2edee872653af8ull, 0xe8e241f45fd70e5eull, 0xe43ef7770373d176ull, 0x3c3ef3d471da4168ull,
+	 0x266ef75cbbfe8cedull, 0x48b88dcf2832e50cull, 0x7d4340140db0ea5full, 0xb021425564a621dfull, 0x87a0c091485d2498ull,
+	 0xf3abd7d3d721f1b6ull, 0x844849508ba0b767ull, 0xaa9d3bb3fc9e239dull, 0x005645e7a13c790cull, 0x26c0e7cb4c8b089eull,
+	 0x42c5abedc6c4660dull, 0x4ec49510cfb20c1dull, 0x491b538e16664ac2ull, 0x471b215080538379ull, 0xf411e9ef3783e869ull,
+	 0x260e650b6679480bull, 0x47a2343670d0394aull, 0xc50051d8a8a8fc8eull, 0xffd1db353d04d737ull, 0x97dc21b5e055fce9ull,
+	 0x1d8c1b05a786ce54ull, 0x9431d79528bf5febull, 0x374568b760800df7ull, 0xd71c15712c9439f5ull, 0xcabb94357939eda9ull,
+	 0xf1a16ab43bd684c0ull, 0xca9c6fd222680dc5ull, 0x9b540b0ac49d114full, 0xe1d741ffdac3d987ull, 0x734031f1780f40f3ull,
+	 0x56f7c1f12682b365ull, 0xca268fde0b311b91ull, 0x5388f05643bb2aa0ull, 0x5a9bc946fd14ae51ull, 0x7c8088899ceb0ca5ull,
+	 0x5b5fa1c8401c5327ull, 0x5db8fe75ca2645beull, 0x5b57a704484575f3ull, 0xade25afda1f7425dull, 0x61e6e28ce6a5f1d0ull,
+	 0x983b94d23c5ef59full, 0x271bb1d2784eafe9ull, 0xe374701f41d1bb13ull, 0xdc0ff7dc67a765edull, 0x578ef1b536bc9515ull,
+	 0x33853c93564513adull, 0x77e828374de05c7full, 0x2bf7c6357904dcd6ull, 0x31a40274e6183928ull, 0x293150ad7a10d081ull,
+	 0xa78f3b7153235c94ull, 0xabd2bbdd7d7f9fbcull, 0xadaef8b39203b252ull, 0x8cbd7f63aabfa0e2ull, 0xf2787c5ad0d5f70cull,
+	 0x5e65f28a473d7cfeull, 0x93b696144cdefd20ull, 0x5ff1398ac5cd6bcaull, 0x8b52de56d95c97bcull, 0x04b91681dc8f6c53ull,
+	 0xf32efc2418973bedull, 0xd12a94fb728e8a82ull, 0x04f67fd695db0ac8ull, 0x61980887d3ba09f0ull, 0xec11fde18dee471eull,
+	 0xf92f4825c3dd28a6ull, 0x19667a98e7d31df6ull, 0x2e87c6a19bc35aceull, 0xa759220db0773e6bull, 0xac8dc20f84563045ull,
+	 0xa606eb24b3db7c18ull, 0xd7261e5f26c288f5ull, 0x547000988d4031d6ull, 0x50571689a4f77328ull, 0x656f075422e93a9full,
+	 0x5d2c6ef73c693973ull, 0x987669c56bd8dc31ull, 0x2d47653e2ca9bf46ull, 0x4fc926b6ad66215bull, 0xfa23ea98860dc219ull,
+	 0x47937f79fdbf47ffull, 0x1e9d33b3e3207bdaull, 0x4babb3d76a8ab486ull, 0x7baf2c5a8c312fd4ull, 0x4e7b4e48ba227b94ull,
+	 0x7b2fee47d1373554ull, 0x6608fffc852cd56cull, 0xf55eb2161e8cf208ull, 0x6779512abb4218cbull, 0x71e26918c9b78a62ull,
+	 0x450505bc5432c5fbull, 0xf4f20fa3428b9c2bull, 0xbc63280999fd8268ull, 0x1a3b6830ed031dfdull, 0x1b059872c80041cfull,
+	 0x243434e0c7a75690ull, 0xd4f64428e76fa481ull, 0xc8bcd24fb0216184ull, 0x2008520acb9ee0ceull, 0xa279cdcf1caa275cull,
+	 0x07d97c60c3ddde18ull, 0x203346529414b847ull, 0xc9576564f2a976cbull, 0x3df2d1371afd71d4ull, 0x7598f5393747126full,
+	 0x1c462dfbcec0263full, 0xf3aeaf5165afb69dull, 0xd9a80a618dae43b7ull, 0xc2ffefaad468f617ull, 0x645f07aab503fd83ull,
+	 0x23a945eea4a2f34cull, 0xd5dec021e0359e1cull, 0x829ab41c32393ae6ull, 0xd6ed6f201b0c6811ull, 0xb2a7aa7bfe5083b5ull,
+	 0x25bbd05020b5cf2dull, 0x269f544b7ca1929eull, 0xdab8ea5be60da146ull, 0x3536a1b8cab65cc8ull, 0x878db4d607a7a02eull,
+	 0x4526b563dd197750ull, 0x555f604298e60ed7ull, 0xaa7316f6439651a9ull, 0xfb70b0705467fd6aull, 0x37099ea97637a446ull,
+	 0x7f7748238357eaddull, 0xf48577ac74f29ecdull, 0x1012e00ce9a83c9aull, 0x10cb367827224b8dull, 0x5c1cdadf448e7ab9ull,
+	 0x83f47208a12179d2ull, 0x3e32f8eb6a443bbbull, 0x035b3582ea4e12f7ull, 0x9fc4cdd3c707f666ull, 0x5a64914e48341aebull,
+	 0x24fe930d215ede22ull, 0xc891ffc5072d8020ull, 0xb4747dc82a44fa68ull, 0x99cb3c2cf03ab525ull, 0x41c8ec529fce9764ull,
+	 0x3b58736f83253a57ull, 0x7234fc026460ede8ull, 0x463ed206b58f35abull, 0xf756caf42698982aull, 0xc6dc86998371f112ull,
+	 0x731218b5678d78c6ull, 0x5a7daa1064aad21aull, 0x75b71b55e87e4fa7ull, 0x80f4f02deefeaeebull, 0xdd49869e0c9d4620ull,
+	 0x3076956fce4534b3ull, 0xaa2cc996bf7725a4ull, 0xddeb5896741e1790ull, 0x4c90ea5860ba873aull, 0x3431ee5052be5eddull,
+	 0x38d65a6a34530211ull, 0xa600f8af6ec42bb1ull, 0xbce33cf2d24b6412ull, 0xa416d0664028746aull, 0xe0e6c2f5dee4a921ull,
+	 0x0a5b6f83dc227863ull, 0x456aef17af3ac938ull, 0x77a344a9a30ef5feull, 0xa1556eb38581357bull, 0x18a25aa3344ee95bull,
+	 0xff70c5b07c36883aull, 0x268aa801484f6cbdull, 0xf99dcdaecc9717cfull, 0x6121fb58b6eaf52full, 0x5c038a20423fc18full,
+	 0x8d89aeb61731ae7full, 0xfe8256a97d08663cull, 0x53b40c7479c005a6ull, 0x0d113533c85d06e5ull, 0xb0c99c99b829fa95ull,
+	 0x3b49e5b6c3fa74d8ull, 0xcf320708c01431f0ull, 0xf493f455f9b585e2ull, 0xd44df63b22e59fbcull, 0xd207f974e67d1681ull,
+	 0x680ae78df7244674ull, 0x33bdd80d23262d20ull, 0x3abbab2c255b6442ull, 0xf3e7976ce213f12bull, 0x2565f19518dfd33eull,
+	 0x946ba392c1d28d5bull, 0xa192bf3619b808e8ull, 0x1b36a6c0cd64c06cull, 0x0c48be55dea7ac19ull, 0x5356f6f36369380bull,
+	 0xc8a6a508e18af69dull, 0xfd1cb6277bea69f9ull, 0xd458a5531be3331eull, 0xcd9951bf4d8a6e68ull, 0x5811a73ff0e1bf6full,
+	 0xe466fe3998ca2edfull, 0x36cb75c4ba42dc2bull, 0xe3bc72b80a33b74eull, 0xd63a1ef6b1741ff0ull, 0xb8099dad5028ffdeull,
+	 0x1e941c25e67d4799ull, 0x9a487e4af2c43a30ull, 0x2f4301d3bed01856ull, 0x9b7fdbca83955ecdull, 0xaad06916af49ef29ull,
+	 0x02e38ab71cb3d089ull, 0x385b51fddf072eb1ull, 0x5d787a4e7c1dd9acull, 0x792b84d726b0c2caull, 0x96eebf9f650f765cull,
+	 0xe938aaa25893fa11ull, 0x5ecb86b5b7d0a472ull, 0xbb82373c18036274ull, 0x36123757e640e37dull, 0xf9c6e5f364d4b360ull,
+	 0x834521c5f28a51d9ull, 0xaedd0b3d6b250492ull, 0x38d1bd401a0c588bull, 0x6859a04781aa39faull, 0x3582ea461b6e63d0ull,
+	 0x959470aea90d74f0ull, 0x7722cd34174172c3ull, 0x3f426d243a32c989ull, 0x5732b1ea0e11da4cull, 0x029877d9c5db8f6cull,
+	 0x44f6bad8c39a8c4eull, 0xaf7bda7bb9e8fbdaull, 0x8eb1747d30c32728ull, 0x56bd7719bf8e49d8ull, 0xbdd3ce69c5568ec8ull,
+	 0xf093568103121b84ull, 0x7cb63b727ddafe6cull, 0x7458d5e11de35056ull, 0x3b533675c091db2eull, 0xd1e13af185772f42ull,
+	 0x4710c3cb98e63829ull, 0x0f919cdf0bcef1eaull, 0x27f6c2be3201836bull, 0x2460efb8685f7ee8ull, 0x8cbd61f0840fc087ull,
+	 0x75a81eac0bfb5bc6ull, 0x383ee0fa30d0ec2full, 0x6f03b7a2d300440aull, 0xbfd3515617ef8ebbull, 0xd5093b16da892386ull,
+	 0xecf85247b946bb3aull, 0xb5564a2779c7b238ull, 0xf381c7e0304ed158ull, 0x735607e11588f184ull, 0x4ef167a94a50c684ull,
+	 0x4292279a4023c6efull, 0xd9b41935170d8c52ull, 0xc83ec0e1465efe35ull, 0x2d3eaa82ab2a0e91ull, 0x16a81e8fe2df1058ull,
+	 0x1dabe84e8d95e8ecull, 0x2500c6ff49b6df8cull, 0x07d7aa06c66540dbull, 0x7fe420eb2bf20848ull, 0xeb26bc8f268dd385ull,
+	 0x214a994556f35c69ull, 0xaf7613740e673d90ull, 0x864f1eb9e86f1d11ull, 0xed3ee27a12453c1dull, 0xbf85f3400bc71965ull,
+	 0x36648dcdcae168c2ull, 0xe5602a8ed8205770ull, 0xc80e479db9f2e739ull, 0x0e61cf3a74db5642ull, 0xee20297188a03647ull,
+	 0x2bc190880ca18653ull, 0x4ab82430a26f5247ull, 0x8cd6beda1924359cull, 0xda8744d555ee551dull, 0x0ecb8b87fcc34c87ull,
+	 0x1d929b1b248d648cull, 0x8c7a700f23f01b43ull, 0x008b614dae0e4e15ull, 0x340feef22877f653ull, 0xaa8feba161ae1afcull,
+	 0xac452dce4ae7e6a4ull, 0xb397635b5891959aull, 0xa1e3b38fef178d2full, 0x66c0acf4c9d36a6eull, 0x1627c320215c8a90ull,
+	 0xc1f224942b8882e5ull, 0xcffd582d3c1eaea0ull, 0x95d62ac84ace3dadull, 0x031f05e9f6701d8cull, 0x76b963d18876bbd4ull,
+	 0xe231913f19060b50ull, 0x83a1746a9542ec8dull, 0x82c2c5d1611be34cull, 0x4c5f534c066ca7b2ull, 0x9fa247463a15242full,
+	 0x22ec36530bd6829bull, 0x0e21b9156b150d00ull, 0xa7fd73b7b9a37449ull, 0x576e2a231cb9d5d0ull, 0xe75dc7623c20fc0eull,
+	 0x08f1cccfe7b92427ull, 0xcaab654d75743732ull, 0x045d0794607dba29ull, 0x2f6a9fd002d686dbull, 0xb0333422bc3981c4ull,
+	 0x53695f95b2307409ull, 0x1d24015732d711ceull, 0xdac31e975453c2ddull, 0xd6cbf94a0679679dull, 0xca33406258234887ull,
+	 0xd009eacfa5f5ff7eull, 0x0ff8b09340eae589ull, 0xc71438d8d1de71acull, 0x9dcb412dd9c84724ull, 0x926003e28ba6c7cbull,
+	 0x2808722ed057eea3ull, 0x75709ccb2320db7eull, 0x59d8d98ad80c52caull, 0x7302e9b8ebae5de8ull, 0x4c46874970a05badull,
+	 0x6ae73ccc019c01f5ull, 0xf3f7b145b0e9df9eull, 0x4fe7ea176966086aull, 0x42f97aaf4c131779ull, 0x80400160dc8aa263ull,
+	 0xee52ed641d24feccull, 0x59def45908d2e95dull, 0xd76605faaab7063aull, 0x5e48edf2577d7c7bull, 0x1547bff81076c40cull,
+	 0x36238cfe3bb2190full, 0xbbfc09f592e05024ull, 0x1c0f6ca3d2434c3bull, 0xe12839d23686178bull, 0xaea0a49ad7f85e4full,
+	 0xa4ff4e09fd46073full, 0x79da7aadc3d3858dull, 0x2dbac21bdc58d817ull, 0xa5dc1debdfd91373ull, 0x47f18b4eee3bd344ull,
+	 0x446aa97adee5cf10ull, 0x81d3df24369cf1efull, 0xe8d97c4589e06ea1ull, 0x5c93558af83ff479ull, 0xe67dd50fedc5dbc7ull,
+	 0x3b7989fffe798c31ull, 0x958fa7f9bf18e4a5ull, 0x253684402c018deeull, 0x0fa4d688c35b2e12ull, 0x95af6b62f1a8b784ull,
+	 0xdc75608a994615a1ull, 0x116de8a9019aab1full, 0x5cf4d2c4817fffd8ull, 0x22ff28bdee00751cull, 0xa70fa39322e7cad7ull,
+	 0x5d0807555eec0ce1ull, 0x565fc5805131df85ull, 0x27a58fc72555f34eull, 0x0299f146f54bade9ull, 0xe525699e9e164dd1ull,
+	 0xd86dad12aa9b6f9aull, 0x5c11878550b48f54ull, 0x07b8d806c9fa51caull, 0x2b69f69d2ea85f6bull, 0xcde94e8d0056ff8eull,
+	 0x4a1070fa386e4b2cull, 0xf6bac32daf2bc846ull, 0xf2c893df6d682cdeull, 0xfa4554044df74d64ull, 0xbfc73f6ce71c5c58ull,
+	 0xae2b7e3941fc5448ull, 0x100be85276e2745cull, 0x66ed7584caa2740dull, 0x087e64dc5937cc13ull, 0xf3e28cb736cbbb10ull,
+	 0x2f1927be859209fdull, 0x13225165fe56fa8dull, 0x1e715bc043786b5cull, 0x8dd7ca90a18cdae2ull, 0x654139da6b0ae95full,
+	 0xfcca7f965aa2d453ull, 0xf2d7e636d9ec2b3aull, 0x23702d51defb930eull, 0xcc789ea67b447c63ull, 0x4e04345e27c0f84aull,
+	 0x52419717642e8bdbull, 0xd8cad520d125d228ull, 0xa9e1fe25593e35e5ull, 0x31f8a2e787c12f60ull, 0xe1892e5c3665ca58ull,
+	 0xfbd31b66a10865b8ull, 0x980e4205ad2ea42cull, 0xa26a4f04a7e6ad4full, 0x88965d632ac454b9ull, 0x84bf10fddcb25964ull,
+	 0xc79be882d3ecee5dull, 0xb94347cf43ae853eull, 0xc63c35d26d49a219ull, 0x0a96b8b7f6569583ull, 0xb863b0723f78f99full,
+	 0x65eecba259f9319full, 0xd2bc61043320b48cull, 0xc12ebacf7bb08cfcull, 0x4c85e9fbbbba9957ull, 0x7e6e48588e946ddeull,
+	 0xe26aabb7c053fe49ull, 0x6fa4a7756791ea55ull, 0xb64c9d14d5f9e7daull, 0x33e54b51985c1b73ull, 0xe2e5bb61538a423aull,
+	 0xf5336ad6f4a87ffaull, 0xec040748d6ede91bull, 0x22df30d9117a35a4ull, 0x07e78140970cbc90ull, 0x5a4aff880bde0bdcull,
+	 0xa2bebd8f242fd440ull, 0x78400630eaf67dd1ull, 0x7c391bbf58247abfull, 0x4add9a1507afe9d1ull, 0xbfca324ff7e74873ull,
+	 0xc00a1f6ae06b6187ull, 0xf70cfabb2d4ba16bull, 0x1d927beace93cd97ull, 0xfbe16bcff9beb6e3ull, 0x4d02e51aba0743d8ull,
+	 0x4d5bf594f3f0261cull, 0x38a2dcfebf0c047eull, 0xc0a17e5105761354ull, 0x05c5d3acea84ca2dull, 0x10f0d9f832dcd2e8ull,
+	 0x6e1efe6d01fb1f9aull, 0x1577c7d541bcad00ull, 0x81b79f565f79b833ull, 0x9cce5707c96c79c9ull, 0xe4abd73eeb149a05ull,
+	 0xdf207c97b6cb1b15ull, 0x4c0af27b418c8db1ull, 0xf0e8618a43a7ac87ull, 0x4d5b00e285a67156ull, 0x395d2015bfe38b0cull,
+	 0x6516649f7aeca079ull, 0xdc1647a5506e36d4ull, 0x658b542ffa182595ull, 0xda1e2c56c4285c99ull, 0xd6b2eb23ff9ca472ull,
+	 0x282a4f523e6c5500ull, 0xab8c66b320e7a0fbull, 0x282ef98f67b159edull, 0x80efa9209b6dc210ull, 0x5f3c8ee3d967b90cull,
+	 0xa6e54e7a2ff8f78aull, 0xcf3cbf85866c9efeull, 0x0e0fad31c44e7713ull, 0x599852ab72baf79bull, 0xee5e3b5045e5889dull,
+	 0xf319e97853d8f876ull, 0x0867c4f48f41a2fdull, 0x96b139cb5311bd5bull, 0xf6ead8c902083395ull, 0x495d13d745261974ull,
+	 0xe391a8002a56314eull, 0x69a61af5ea8b1e49ull, 0x0d12e49fe979ff06ull, 0x0d39e57c06038e0eull, 0x68ff6e85bcb46305ull,
+	 0x0c69306d3f8d17e6ull, 0xbf2552deb1d94d21ull, 0x701a1321b6511279ull, 0x23619bc27ff941b0ull, 0xe53dd8b6ec81d252ull,
+	 0xf5a67977f0bee849ull, 0xe190f7aafaca21b3ull, 0xb1d1df92d0acc348ull, 0x8ebb654cfda4f491ull, 0x2db7eb909c3660e4ull,
+	 0x6ff2cf2553da1e84ull, 0x09d1a5a7b78c0fc7ull, 0x050dbd4654e28d49ull, 0xf64a0719e66c5c7dull, 0x23c1827652cedf69ull,
+	 0x79cf8177fc16740eull, 0x41be022647fced4bull, 0x9350f53dc19ee918ull, 0x2ef4e2a8b80c6a5aull, 0xd3b8fbf3a840a2e6ull,
+	 0x91eb8d50ae49b470ull, 0x828c04278b5e4b34ull, 0xabe4c1e170e1d649ull, 0xb89c4ff038554071ull, 0x5c1578dfa8f69ebdull,
+	 0xcd019acde3a31198ull, 0x4bb645bba5721bf3ull, 0xcc318a25ef9e384cull, 0xa1901915cd481460ull, 0xf0a15937e5d81edaull,
+	 0xb23402f921ab4263ull, 0x5dc997de18563bb7ull, 0x3c67d86085dd6f8bull, 0xedb1bd663221347eull, 0xcce874832dfc2cf7ull,
+	 0x12397645150a1c7aull, 0xc34c91b5f12445ceull, 0xe358a4568e8c7ba3ull, 0xc8009c8949bacda9ull, 0x4da6374249ce4e83ull,
+	 0x65e329a5fffefed5ull, 0x6a0259be1b81006aull, 0x60d8d6aa2382897full, 0x9eb282221a0596e8ull, 0x09aa1260ee02f20full,
+	 0xa05a91b74e4fe6f9ull, 0x0d3315d925719d16ull, 0xbda50f61b3e6fb2bull, 0x26e14d28d5fe6630ull, 0x9167fe40dd0a9513ull,
+	 0x8dd79a914f3308e4ull, 0x51720177262eca5eull, 0x310647cb6390d3b0ull, 0x7e053a4918b9a6d8ull, 0xf125268261c0f9d5ull,
+	 0x5eb11747fb299f11ull, 0x6db2fd526f90ef71ull, 0xd7a6933b26ffea28ull, 0x6c34f6e77d7135c7ull, 0xfdd697e3144d2b67ull,
+	 0x4fb897375c7cf7b6ull, 0x1887d50f5269f4fcull, 0x7312ae028bd7b28full, 0xc2a417afc354690aull, 0x199529c1f66cf948ull,
+	 0xff5b0125a5cd0d72ull, 0x29c89498d80108a2ull, 0x90038ec3ea67c81eull, 0x734492c7b549b0d8ull, 0xc44907cf0f0e20d1ull,
+	 0xf690181a927cb874ull, 0x42e1ee60130ceb7bull, 0x54fb7ab7bf117641ull, 0x511fdf2b5eb9852full, 0x8498c00f623701e7ull,
+	 0xce523b13a60eb2c7ull, 0x7e1867e3f5e5e6ceull, 0x1f5238cfcca088aeull, 0x10442cab52e13bdaull, 0xa719f4e58b65be88ull,
+	 0x348ad549057457c5ull, 0xd19174fe69652266ull, 0x845f9c1b12b0e916ull, 0x6b16661ec5157c0cull, 0x1dc9e0561ea68cdeull,
+	 0x90b6dcc880329a25ull, 0xe0c588923ec3e6afull, 0xe8efca027369aa44ull, 0x6a9b79c859428761ull, 0x6533ae236fe27ddaull,
+	 0x715dc4d6e48a0b1aull, 0xa47b76f8b89f2409ull, 0x2c52a3ac74fb9a5aull, 0xf536acfa535a7029ull, 0xd2fd0ac7504f3982ull,
+	 0xbc3ad44e24a005e2ull, 0x77ad0b93c75b5d18ull, 0x9878fc8a8a63fd9cull, 0x0a8234cc2a770554ull, 0xe8ba76ef7aa4ecd4ull,
+	 0x74c2d687ab2aa726ull, 0xebf5a1052248c2f2ull, 0xf5334f5150693b0cull, 0x292ddba32216f714ull, 0x1e0daaf4943c7988ull,
+	 0xecbba36b0fdb9e12ull, 0x92c6e60ceac37474ull, 0x27186bf694baed16ull, 0xde360a1a134c1147ull, 0x560559651f7c402eull,
+	 0xf6b2c5776b9e1ba1ull, 0xad25157ae855ee97ull, 0xe5b819fab3b94abfull, 0xf440e5beb632255dull, 0xa02bb1e7781ca776ull,
+	 0x05cfd82015c863fdull, 0x6e422eead82e2c10ull, 0x908e9076a8a7680full, 0x49098a8ee183321full, 0x637beb251e0e54aaull,
+	 0x2ea7dd985b4e7d27ull, 0x3806efa7df94f810ull, 0x143cd3b00a8d37beull, 0xd3a7bc99c90e9f76ull, 0x204cc590a4e9e1ddull,
+	 0x31d8908cb44a2779ull, 0xcbb2884467b205e8ull, 0x714cae9f10927d49ull, 0xe5da44c11be54620ull, 0xa3c37cc942f11f83ull,
+	 0xe4e665ac3a68c238ull, 0xeab31b361ed33d49ull, 0xcf8ea20607b5da8cull, 0xb6e9e057fabfe592ull, 0x94fd8d9d7ea7fc1dull,
+	 0xdf58e103a3cac761ull, 0x5248383e40ff79d8ull, 0x98c0a31e8a5d0e10ull, 0x914b656ee53a091cull, 0xbe7466666ac8b9cfull,
+	 0x2deeb505e155fbeeull, 0xacdd80fbb29e5910ull, 0x6f7be6d0094bc11eull, 0xa8f8e56755217d10ull, 0x21d034602cd09864ull,
+	 0x65bc6f906d572d4cull, 0xc74802c9d7de1094ull, 0x7a82c09670976196ull, 0x44ce01d9c74c8459ull, 0x1431f37569e83e79ull,
+	 0x46c2ae55ff86014bull, 0xad060ccd051dcd19ull, 0x51e46fbd7560b2ffull, 0x10d0abf3457933faull, 0x52f581f62dc65336ull,
+	 0x77ffe7ae657e5554ull, 0x8f97784d7ab7858full, 0x083428d200328eedull, 0xe0c36e3e796f2ea7ull, 0x155f297fe0c7e05eull,
+	 0x0dc5eeb28613b1feull, 0x518d52be3b46b4adull, 0x544866511269a055ull, 0xe505004db305269aull, 0x12ae417621ab7e39ull,
+	 0x7bf1b72adf4f0444ull, 0x97943413f51efda8ull, 0x87bd50985ae39d0aull, 0x5c469313d3df51a9ull, 0x7e93810636165d50ull,
+	 0xde9d3b993f5fade8ull, 0x6367da8919153966ull, 0x0c11f5cdc1918af6ull, 0xed5f9d3c23570d9dull, 0xbb6bc6277ddbab7eull,
+	 0x4048c420f0998a38ull, 0x66651377f0335bdeull, 0x2239d3137550a769ull, 0x9016b491c4bc98c7ull, 0x7c1ff1795df6f45eull,
+	 0x7aad95b4d6ff1ad0ull, 0x9e21bfb518aa72b9ull, 0x9d53a2ba7479b85aull, 0xe9ed641917cfc0caull, 0x4c56bae6dbe20abcull,
+	 0x8ac6bfd15e3ad618ull, 0xe8d95ca30ec258a9ull, 0xd2dc96b0e088b77eull, 0x7cc0b658e1c772f0ull, 0x299afc2330729b62ull,
+	 0x270f6f9ead2f0eb0ull, 0xfc03553c8af51aa7ull, 0x698b9b427dc09c1aull, 0xf2b2458ac39ddd40ull, 0xbbe47dedc7a2ce45ull,
+	 0xd23fe54211fc835cull, 0x2a022231d9020c08ull, 0xbcdd8dbccace752aull, 0x705e083d79aee6ffull, 0x8fecc8aafc4f2c03ull,
+	 0x527c8fff10edf150ull, 0x8d72eb404951e60cull, 0xd5f733b27cd584d9ull, 0x01d93ecacdf949daull, 0xb96935a0e0e62a2full,
+	 0x53f066fbb9a02437ull, 0x31828701d7b520feull, 0x172319a552adfd91ull, 0x7ef04faceef5cdc5ull, 0x9c3771e351e4fbcdull,
+	 0xf79ed9ee59ed1aa9ull, 0x918564f3cbf30b53ull, 0x782fa9f93ad71466ull, 0xf5a7ca47a0a2ce21ull, 0xffaaab8f470a21caull,
+	 0xcf926bfd8ce808c8ull, 0x41a5e02394e20f62ull, 0xa279eca2dec40040ull, 0x2c3bbcf8b921b45eull, 0x65307a6eee15ed56ull,
+	 0x450f2aaa3f9e3bb2ull, 0x71b4ccbcc9183991ull, 0x7c74ab29352b6fa8ull, 0x49d79b3b7e2d30f9ull, 0xf58390e2319d4f92ull,
+	 0x69a940b59d55b4d4ull, 0x96b750c19e60b7c9ull, 0x56670741da8ce75full, 0xf021a4dfcb924688ull, 0x78e019fa07c15e6cull,
+	 0x440b47791cffddd0ull, 0xb6978ffb41e9e200ull, 0x5b2b5bdafaf7f33bull, 0x75beda871d7d14e4ull, 0x61d5a181377a0481ull,
+	 0x9638767aa8f49897ull, 0x33e4fbb165b5494dull, 0x1a85f03504b27f15ull, 0xe6645c29f792c3e4ull, 0x75ca2e721900ccf5ull,
+	 0xd4cebe33c7bd302dull, 0x9ecff6f03e788472ull, 0x18a316bdc33b2d82ull, 0xc6298404859d8451ull, 0xbb1f45b1b17a92ecull,
+	 0x182196095d89ba38ull, 0xc8f4f7f98f5d6587ull, 0xde834c7fa01d4d8full, 0x5a3eb4149fdbed41ull, 0xa4a65752e95488c2ull,
+	 0x9051136e3544e810ull, 0xf52b0a3fe0901362ull, 0xb3143a2053c7751bull, 0x19a0058154b12799ull, 0x88bb102b851e13f3ull,
+	 0x15bd0c06c70751d9ull, 0xddce9f0af41d75e5ull, 0xeb3bba87091ad71bull, 0x841e736390c03640ull, 0x32261183a710da8cull,
+	 0xfa35fa227aa034e6ull, 0xe8b111c37b51f0efull, 0x8c95a8d9f2312ef6ull, 0xdbf3138d3d13fd2dull, 0xe7a3d862eefa0a43ull,
+	 0xf07349fef2ad22bfull, 0x07fbcad46aa622f3ull, 0x5f426382eec00e8aull, 0xd9d1a9a6534fbe24ull, 0x11f3fa18f7d5d863ull,
+	 0xeab776a0542289fbull, 0x7332cc097f495aa0ull, 0x3ef95a06d0aea1c4ull, 0x5638acb0fb549b5full, 0xbe9219d7b1935adbull,
+	 0x7ef734d475ed72c1ull, 0xe2dc11579dac9e83ull, 0x620649a5c855d425ull, 0x14f8b81fc895b6bcull, 0x5f59433910dc1ebcull,
+	 0x44ee2fa02af9fb1bull, 0x38c42cb596c87386ull, 0xa88e409f0d99d70bull, 0xe1f888bf51ad537cull, 0xb79cc252a950b1fbull,
+	 0xdafd635725772fd7ull, 0xa0ec97db82f551d5ull, 0xad9a4a80ba32c28aull, 0x6ec3c4e7a2570571ull, 0x81c6e0e3880e21d7ull,
+	 0xc206577fef5bfd59ull, 0x4cf49358f5245d1aull, 0x37c0df7bfd97d95dull, 0xcbb0488a8f582ac9ull, 0xf9d37d0bbdac69ffull,
+	 0x18e2c4dfd137d974ull, 0x850c87406b794fefull, 0xd078fbe171787454ull, 0x8512169bda351c92ull, 0xc83071cf131f627eull,
+	 0xd4f6dada8b2c7778ull, 0x6db6d2e5d08552ccull, 0x40e32e901a96fddbull, 0x047760a00dafda51ull, 0x1b3397d4a104f9efull,
+	 0x5eccbd87619a7c23ull, 0xf758995c6a1d7b67ull, 0x23077dd961fc4562ull, 0x72e3f87e2315abd6ull, 0xeed8a7b9b76adb3aull,
+	 0xfd118380f6eaea92ull, 0x22735d4a90461047ull, 0x40e6c642c237c0dcull, 0xefee082668312a16ull, 0xfaf67442cbaac7d9ull,
+	 0x8574c7c19739b596ull, 0x2a570382857d8b2cull, 0x968e8d3cedd72246ull, 0xd809ea65e5ea34e7ull, 0x84612df7bb59dca2ull,
+	 0x760e8f0d40a0d5f1ull, 0xdcd6d8f4016df108ull, 0x472be66c6a02e1f5ull, 0x52bdbd4c800c248dull, 0x09a470b5fd232403ull,
+	 0x90e9facda6427487ull, 0x2b63a994d60bb3faull, 0x4264a68279e367d4ull, 0xd5c80fffad7a5316ull, 0xea7fd3e085bd9c8bull,
+	 0xfd2ca408c2670450ull, 0x3bc8f6dc3b82c812ull, 0xdb488c309c2c0ce8ull, 0xb45f157345d0945dull, 0xdb21832dffcb3597ull,
+	 0x2ac81210888f97d9ull, 0xd4e507bab1105b1dull, 0xd452b33f69cbd3f3ull, 0x9e7afd0aad85f8c8ull, 0xfc172504238be6e9ull,
+	 0xc5599a7c1afcc262ull, 0x4dcde25befe52b27ull, 0x9987dae597ab624eull, 0xffa1aa30d315da51ull, 0x4b8e4162749cdca0ull,
+	 0x4631afce412f7190ull, 0x4de9951434fcfafaull, 0x5f0cb6d6bdda413bull, 0x81376baecb8d576dull, 0x162cbec11c19effbull,
+	 0xc26489917179695bull, 0x160206dccc192a0eull, 0xbf2f93f22fa7363eull, 0x25b90da3b51e7258ull, 0x05d5afa44e3a0f89ull,
+	 0xea7ed79d16d832fbull, 0xbad5fcffd9be2e7full, 0x863590d3798ebf7dull, 0xb9b69c5e692bff36ull, 0xcd632d6f4af312b9ull,
+	 0xb4bbf887c9a071e4ull, 0x665fc3fded095c98ull, 0x13d682c8c2d1e294ull, 0xc52431ebfdc7235full, 0x800e33f769306873ull,
+	 0x67a194d9408e10fbull, 0x9c6191802e735595ull, 0x7ec3520ea998b13aull, 0xd3323596239f447dull, 0x84c3f85f5325af00ull,
+	 0x513b4b290896a429ull, 0x5c71a83165903dafull, 0x70c2d382bece2bfbull, 0xdf381c744a94afb8ull, 0x67848ef5aff252f9ull,
+	 0x6ec4aa2b20aa71c6ull, 0xf0e57c10ba6c5bb5ull, 0x5f8091cc61b0bea4ull, 0xe6d80a68c78a72d4ull, 0x6acf59e5932741c3ull,
+	 0x808b4011ec3eb2aeull, 0x513be80c84d40e00ull, 0xd15dca1de57b0c9aull, 0xd60e91bb9e1ac7c7ull, 0xc41dbd75be789417ull,
+	 0x36e89929dc918e1eull, 0xfa6f52fafb02a6e5ull, 0x3d36d9e9f4fa8183ull, 0xa8e679c0d69506a4ull, 0x879e573e771798a8ull,
+	 0x6f4ed2c21917c231ull, 0x1e038c5546e8c6cfull, 0x45a66f749457ccc1ull, 0x4be7f9018a6227f3ull, 0x49489282bf6a8ec7ull,
+	 0xaa35c69b362ed0ebull, 0xd906040270cc1954ull, 0xe249e73b53af1451ull, 0xd79eeda27029f667ull, 0x5ce8428a262e883full,
+	 0xf9843cbf60784fc9ull, 0x5d9e2f9fc46d27c3ull, 0x2b1d50cd427723caull, 0x9318adb2d28ff70bull, 0x75e387dda22ee260ull,
+	 0xbd1e1bf705a28416ull, 0x41722fa64fb84259ull, 0x727d08a59e88a52dull, 0xf7b57e56ce01e7c3ull, 0xd7e0b76d394e51b7ull,
+	 0xe098c11bc5c49544ull, 0xf3332925110028d6ull, 0xcf09284b8eac3c6full, 0xde5fb02fa8430d66ull, 0x9787adcd0d7da5bfull,
+	 0xee6c3a2fe9b7b658ull, 0x9b469d50a99abfb5ull, 0x37599f537b998239ull, 0x03e6d9e93c5a2759ull, 0xc08e3e09d35ca3fbull,
+	 0xebe9cd161a332c44ull, 0xb913dc74c626dbe3ull, 0x50002821f3fb65dcull, 0x41ad956236142253ull, 0x2a66fbaead6f779cull,
+	 0xda07e6287287d9e9ull, 0x8333f718d0e7a2bdull, 0x246bd5e4b97850a3ull, 0x94bb1de5c48ce8a8ull, 0xbd633dd4b01970b9ull,
+	 0x6ecf961dd2c8c0c3ull, 0x8075b0332c78d3f5ull, 0x821b3d01e261f6eeull, 0x516cfb05493cd2baull, 0x8b55e85c7845ea00ull,
+	 0xa12d2e8d4734f37dull, 0xfc64d32ba157f9f2ull, 0x73eeddfb78901073ull, 0x9a803e4174ef1ab3ull, 0xbb52c9c92c5ebd86ull,
+	 0x5653532ea471f94bull, 0x5b9bf536d0090445ull, 0x08733fc673040d46ull, 0x7d9fbe5e5e45dfeaull, 0xf7727bf0216282a9ull,
+	 0xf46d5f6b9caf60b3ull, 0xedeb8d5a63fb8b84ull, 0xaf47cc87ff71acdbull, 0x07ca238bc0a96fd0ull, 0x05497aa2ab56ec29ull,
+	 0x2f9aee9905420b04ull, 0x53e4bf047216e293ull, 0x13319ddc1d629f73ull, 0x8f7782efb3fd4751ull, 0x69fc7fc4de1723a8ull,
+	 0x43789f9b0f00344dull, 0xbd227e90d468d294ull, 0xaaab815ccd0a8025ull, 0xad056dca93760a11ull, 0x7b0ad34296182c16ull,
+	 0x53764851e5768fc6ull, 0x69b4483638a7bd09ull, 0xf977f04683d56da4ull, 0x2482623606811d65ull, 0x6694b8ffe62a1929ull,
+	 0xc918c73b3f210ab7ull, 0x3efc832cac252d55ull, 0xed1c7718a27f3073ull, 0xb3dc91c327bc62eaull, 0xa1b49503839c1803ull,
+	 0xbe918e04b3fa817aull, 0x65c628b0d5181a0cull, 0xc0ff70040b0616d3ull, 0xfd4a6a30ad90837dull, 0x7bd5c8c2badfb27full,
+	 0x7e5f97174141c2f5ull, 0xc71a24aa3234fd1eull, 0x1b660d51611c6cc7ull, 0xb6be51674e2ea04dull, 0x9dde4b18abadb7e8ull,
+	 0x7f2eb9bd1d35261dull, 0xa2cd98f690508e7bull, 0xf3f5706585ac7ee7ull, 0x71004385445be818ull, 0x76243eaf942b9149ull,
+	 0x671c12c27e264b51ull, 0x7dbd7cfdfbe81876ull, 0x0b9069c185ffb915ull, 0x3aaad251e15ac6fcull, 0xed286290a358e48bull,
+	 0xa0a397b157ecedd1ull, 0x63b160e40cefbae1ull, 0xd58e6ee0faf9ad2full, 0x1eb4d8e763e8baf2ull, 0x2997ab8c65fbc23aull,
+	 0xdb010c26ef977016ull, 0xab5d1a9457b0e39full, 0x67083ece6fcfa97bull, 0x3e6d714656dbfa87ull, 0x5b532bf144fff56full,
+	 0xa9b955a5b62d4d5eull, 0xb6eed08703cd497cull, 0xef2b262a11730482ull, 0xa208208a1f9f1c69ull, 0x31e2b157bb236f49ull,
+	 0x258a0369601e3388ull, 0x37ec23c1c3def729ull, 0xeff6428d8a6970c4ull, 0x1d6a68ffbb78635full, 0x06945d884084f8fbull,
+	 0x2493115f497ef7c0ull, 0xde375f95bf0e24cbull, 0x7925a4980082cdd5ull, 0x499e240f58e62287ull, 0xc725660aa1016d70ull,
+	 0x9d56cdc0abd2751bull, 0x4408e245a548576cull, 0x5637e466b4a1bc9full, 0x6d1df36d829087f1ull, 0xc46152dabe14ac43ull,
+	 0x70ea51264481d79bull, 0x901e97e40e105000ull, 0xb05ca6e4ac4defa5ull, 0xd049098e22d1dba1ull, 0xa66e830017c48efcull,
+	 0xa4a12ee87111bbbaull, 0x77de86b100fabd8cull, 0xd5c2923ded18b4b2ull, 0x1f6e191fa12548c0ull, 0xcafabaafc2fa0b5dull,
+	 0x01cf6305c319f875ull, 0xda97e4c97f91f470ull, 0xb0203e466c54d2f8ull, 0x7ed169c4f5484f50ull, 0x25e1fd62306179a7ull,
+	 0x0400a498e41b5e11ull, 0xa5295a55131b8ea6ull, 0x3e632f374199f889ull, 0x8d5326ab11ac16eaull, 0xa4bf9c9dbd8842a7ull,
+	 0xf0205d7298fbfd08ull, 0xd1281976b4638287ull, 0x6b06768a11e57e06ull, 0x25efaf0024c5df12ull, 0xf835f6b24853a87bull,
+	 0xff9c55b728bd54bcull, 0x1516b465ea7953aaull, 0x5b8742e08cca4ddfull, 0x5be3e7144e0827e6ull, 0xbbbb55009ffd2a3aull,
+	 0x4f90a0e0f6728f76ull, 0x12d626154f145e0cull, 0xa5ee765542450df0ull, 0x53f8ce46d9dd490bull, 0xf9a291344aa7d919ull,
+	 0xdcf880297b49930cull, 0x6e7884811db407c5ull, 0xd547ddc1c920ae78ull, 0x981e6612ea096f4cull, 0xffc94413c14c6f45ull,
+	 0xbc0135c5d838d5a3ull, 0x3b2353d2aed2cf1full, 0x84c276a646392183ull, 0x5e41d5b161de5034ull, 0x826b4a96ef39cc83ull,
+	 0xf8cf470b241cfb4eull, 0x8eeafc18e162cc43ull, 0xa87ba2c2e8bb67e8ull, 0x0ebffe852a3ad200ull, 0x3c9b28d987ca8b9aull,
+	 0x69b280afa0bc49c5ull, 0x14f2fa1eaeed1b01ull, 0x594911565246b98dull, 0x172226ee03a6d417ull, 0x0d11a459ec23df7aull,
+	 0xeb9ae740b0d19097ull, 0x0347435719f18d6bull, 0x6c20e64f6c5bb271ull, 0xcd92b54f45931d2bull, 0x4745df36dcfa39a3ull,
+	 0x62d8971141ddf2c4ull, 0xacfcc7ca2456a378ull, 0x2cfb18aa930c1eb1ull, 0x656ca7e816b4c1e1ull, 0x84e23c3794c9424eull,
+	 0x983a8483982ad39dull, 0xd69f93aaa3f59a76ull, 0xc71b89fa0b3c6f10ull, 0x16c0fd44141e6a89ull, 0xc47a0681bec5c6a3ull,
+	 0x6c1862038ccbd5c7ull, 0x9fd4f0e8552c783dull, 0xde4359c09f27408cull, 0xbe4708fe4c8d4f0eull, 0x3754b4b820ceb61bull,
+	 0x354756ca6cae3607ull, 0x1e184d4db8b38d67ull, 0x8fdea249225e85a6ull, 0x805bd6043edfde28ull, 0x72ef008cefa7acd6ull,
+	 0x46da287fddac1bdbull, 0x3fb9c68a9cbf08c3ull, 0x741100f9c1d377b9ull, 0x759b1a50506b34b2ull, 0xc18b3dbe928c27f6ull,
+	 0x1b9d4675e9adb399ull, 0x36dd356384a2a6d4ull, 0x704b018ef68b4f12ull, 0x9d71582a5af611dcull, 0x75fd5bc38d6a2383ull,
+	 0xecf436a91c317960ull, 0x763994a66b604cf5ull, 0x2a8444c7a2cd785dull, 0xf606a822cc0a0ae3ull, 0x4e7b2f457be5032full,
+	 0x1b27d20976ffc854ull, 0x034ccd76c316a1a9ull, 0x919a785ed74965c0ull, 0x8d709654451edeadull, 0x87bf8631c89dc6a0ull,
+	 0x435c01f91e54ea4cull, 0xdd228c14b67eee61ull, 0x23f53ac534f18dfbull, 0x875edd692f488894ull, 0xc652a6114e0c5c05ull,
+	 0x272c072ef5facc81ull, 0x9c56cf879da1a506ull, 0x0b567b551521656eull, 0xd1705ea3da465550ull, 0x73122174f5415303ull,
+	 0x53a7b42d3367286dull, 0x4ddc828e5a6478c5ull, 0x99c629de3c545ab1ull, 0x862fe7cade9873c4ull, 0xa6f88cb483212aceull,
+	 0x380e37d0b795c77eull, 0xaea066bf8a347159ull, 0xf36568e8c162ff7full, 0x8bd48594b8e9d14eull, 0xd6dda42199e75e74ull,
+	 0x99dd0e719119a306ull, 0xb82111ecf985c51aull, 0xed688a09498a31c7ull, 0x07f251379d6ddaddull, 0xaa49ebd251aec7a5ull,
+	 0x70b5bcfbd23b63d0ull, 0x7f4c1ee569b98b92ull, 0x637af7c45658927eull, 0x636cdb4cfa6c8649ull, 0x25c1228479d9d03bull,
+	 0x8ab61d87c704dfddull, 0x7e58af70c2fabd51ull, 0xc20fe0a9979dbd0dull, 0x0918c6eb12f6d4d2ull, 0x17e6782c3260b2a0ull,
+	 0xc8fa6942297b4cc7ull, 0xa4ae1b252f710e17ull, 0x9da362ecff028353ull, 0x4e449e2d7d37d80cull, 0xdb4159ea43b89a3dull,
+	 0xfe466d0b01e09920ull, 0x5ebdf8090b648eb4ull, 0x636c0cd381fbcd16ull, 0x2bd1a67c1f37288dull, 0xe2543f139db96636ull,
+	 0x20833a821b2bb74cull, 0x27a01c7261028446ull, 0x1e611169cc3ddfb6ull, 0x2f639309902fa7bbull, 0x9a9489b3ff8f05dbull,
+	 0x38c0334203c83f7dull, 0x916fe41a9ebeb8adull, 0xac3b663ce1dbdaf7ull, 0x83f7f709871caf93ull, 0x41fa7342e5574dceull,
+	 0x1773f447b45e8d95ull, 0x23b2a18a03eff6deull, 0xc01d9d474caf7bd2ull, 0x206837b405479411ull, 0x714b6a8449d6755bull,
+	 0x8cb42606ccb7b8a2ull, 0xa2d0a23c7c66d7fbull, 0x646ab1d799e10d21ull, 0x9fc48176d00f7063ull, 0x269002d09a826273ull,
+	 0x54ab30bdc510b73bull, 0x71508d5ccfa63a67ull, 0xa1db6a5a881c3d6cull, 0xef86316f73633391ull, 0xcce1d4344773866cull,
+	 0xd9186d2453563b3cull, 0x3999dbf04e05cfa4ull, 0x5c18b608e984f5daull, 0xd3d93da780b5d522ull, 0xc7640e9dcf0453c3ull,
+	 0x243a2ef80957b0bcull, 0xa805ab193e0413e5ull, 0x2cfb091082cb05c1ull, 0x6ed8bd3f87c067c6ull, 0x9938b84cb9bf1bf9ull,
+	 0xe4993a46c2cf364bull, 0xc520a1fc4668868aull, 0x3194f38dff5612a0ull, 0x0af8a0e8ce6b41e6ull, 0xefcd2cf0d744569aull,
+	 0x392f5cc0313e87e7ull, 0x57bfaa3bf6fb2786ull, 0x65f9dc25cfb53240ull, 0xe9126efc22904d61ull, 0x148c6a1e3271f093ull,
+	 0x784b6bb0e97c2df6ull, 0xca01487d158ec205ull, 0x03ad28b8d87b21aaull, 0x0d4ac3898d961f2eull, 0x6be7698878995f23ull,
+	 0x6381f7d1e38d3d74ull, 0xbf5f10404b63cb37ull, 0xd52d5305c83fd628ull, 0xb5a8e41f3d53b4bcull, 0x435d9883c870215aull,
+	 0xaa18db8de973ef95ull, 0x61216073a729a515ull, 0x9e9514b7551a7beeull, 0xa75c2959b1c4b879ull, 0x7113511b81cd352aull,
+	 0x6563a2c6fb8a1816ull, 0x7c66cda258734025ull, 0x51e41786a20dd0faull, 0x6bebc1f72d5a2a0dull, 0x31776d9ffa15f70eull,
+	 0xb651aa592209edafull, 0x58bd7ca14e809544ull, 0x42e35cc30f8d341dull, 0x047308d4058a53a4ull, 0x1f0ba657e6461eefull,
+	 0xfebd00cbe153f485ull, 0xeebb0a4cdd23102bull, 0xe5ee9cbfeac5261bull, 0xfd79ec9f15d1d952ull, 0x2022732a13410c83ull,
+	 0xf7cd2b03f8768f63ull, 0xf3061978125ed551ull, 0xb92734af3d531fb5ull, 0x8b28fcc55dd63e1bull, 0xf1ef2f1dddde8df9ull,
+	 0x895aa9ba401da3d1ull, 0x8e99efd50976e8f6ull, 0x58cc686f3757ac3eull, 0xc482e95054b4cabeull, 0xd6fb85aedcdefb2dull,
+	 0x665e5cf18055ac7bull, 0x22b42a32c16972a5ull, 0xcf2d376c351925faull, 0x9bfae8bd2103c977ull, 0xe15ece98038d17c1ull,
+	 0x94bd5fb2d6c563c0ull, 0x4901fd436fd755f9ull, 0xa728ba70804708abull, 0xdff2c8e1388bc93bull, 0xa1836ae1be74fc29ull,
+	 0x1f76de4b2b352687ull, 0xa7428128aa67d132ull, 0xe6ba5821b9d337d5ull, 0xe7d86676693c3905ull, 0x5cf093cd9c9f45ccull,
+	 0x0290ee51be90d612ull, 0xee5fb17eb21257faull, 0x631db4b82d002c46ull, 0x979096471e44f3e1ull, 0x99e6d09d6a70e99bull,
+	 0x4130cc1736549c1eull, 0xb9d763f047ac52afull, 0xf24327d38ec37403ull, 0x9093badd4d40b4ceull, 0x6998dc603f8c4bfdull,
+	 0xea0ecf7a8dbc698bull, 0x176d00adf24a2cb7ull, 0x85a6f61f84e75f06ull, 0x3b30df75fd6c7a54ull, 0x08d7caf10b42239dull,
+	 0x9bc8ef39c2613698ull, 0x18d6670e9547e1deull, 0x8dd68b2130a4f961ull, 0x878f10e5b1401eafull, 0xc640dededa738733ull,
+	 0x8bb1eb407b8579d8ull, 0x8d3a984112bc8f46ull, 0x55115dd600dde6caull, 0xf76752524df623f7ull, 0x2bb601e285e5606full,
+	 0x3d03c9f8fd4f9851ull, 0x68d14bdcf1a64b97ull, 0x2d1ad5d618127711ull, 0xab4aef9b711483f1ull, 0x76b068491cf75513ull,
+	 0x6d9b0f970ff4229eull, 0x9d27a80c3439fdd0ull, 0x68476c84ce59f1d3ull, 0x5c0545cb8bbd299bull, 0x5b5e9dc56a6063ddull,
+	 0xaf00b28c1a4c306full, 0xd3e76f25f9212409ull, 0x5c4dfd873dc64b3aull, 0x76b16a84d9b4b82cull, 0x1a4e5efbe9b2d946ull,
+	 0xf2ca4fabf72e0231ull, 0x651fc038fe5b162cull, 0x482fe0b9eb22976aull, 0x32204725079a9643ull, 0x445043e1b8bf5b5full,
+	 0x5b9700f7240c2235ull, 0xd9e3d564825e0022ull, 0xcf22e35920e194ddull, 0xc58b8275eff09660ull, 0xbc5c54402cbefebfull,
+	 0xc67ffc6ae8b17bd5ull, 0x7b18edf46f010636ull, 0x8e6e56bfdaefb128ull, 0x81c8c23caf7d2741ull, 0x9c7d5ba72c423923ull,
+	 0xecb97a6ee4b1f86aull, 0x0065a79af7b8ffe3ull, 0xf0e350fa7185f824ull, 0xfe35c6d79a962cddull, 0xf308cc7bee485251ull,
+	 0x7cefe617ec4e42daull, 0xa084625d0f47d0a3ull, 0x226a7b00597ea68eull, 0x0b908268071daf9cull, 0x12892eee684a5516ull,
+	 0x14fb04336e340dc6ull, 0x9e4f73e6c77596f2ull, 0x13ce8a3e2d4aa1a9ull, 0xe8102016f892b741ull, 0xd26c348ef87896acull,
+	 0xd15cab709dad71d7ull, 0x468efe9dc46c5384ull, 0x12f9f6f7b7a30bcfull, 0xf211208ab6177cf9ull, 0x40d9f60bfa33a7f4ull,
+	 0xa092956cc1fd09efull, 0x311f10ccdfb08112ull, 0xeada63f7b246ceeeull, 0xeb30e257c485a0d5ull, 0xc2eb5a966500862aull,
+	 0x9657303d9b563e2aull, 0x35d55cb167f87e41ull, 0x5cfe383807f0ebb1ull, 0xbb53dafb0c4dab80ull, 0x80dd0e5490f25786ull,
+	 0x69adb42aff68044eull, 0x3c5b732b34facbeaull, 0xa3bfb2b3b03593f1ull, 0x8d54c79d982ed3feull, 0xc55c2340538404f4ull,
+	 0xb3160d9ab70de787ull, 0x31615bf6baf5088dull, 0xc7fd72ebde671df7ull, 0xd2c3a95012c40747ull, 0xe87bd3878d86f784ull,
+	 0xd28a42eb12e9493full, 0x6e5da5f1a3fa92d5ull, 0x6cf174cb8963e2aaull, 0x27faa6299420ac48ull, 0xc8989267937a07afull,
+	 0x70c4bd5525d1bffeull, 0x4a67b588efc4e8b1ull, 0xa5f0c343cffbc3f6ull, 0x8be4e3d9de8a3e6bull, 0x492d52699a07591dull,
+	 0xc6be731eea1c0587ull, 0xbd86d0ee6ff66df7ull, 0xc8524e7ca04e9e65ull, 0xfbaf7eaeb65b5053ull, 0xeedd01b4adf2bca1ull,
+	 0x85f967704e427238ull, 0xd58d8a046d14ceccull, 0xe5c205567621b294ull, 0x27262f1c52d0425dull, 0x27cc3f4aa0ade2f9ull,
+	 0x3a4f64a1e86dd3aeull, 0xd0ed5d778abd40efull, 0xf5727a86861c1accull, 0x24d88b33be65ee6cull, 0xb225ed7be102f3d0ull,
+	 0xe8268303588703b7ull, 0x986257172569719eull, 0x3e943eb9829db90dull, 0x70fd2ee19dd22131ull, 0x5c58b0d4af75d147ull,
+	 0x2a3d76bec8c389daull, 0x784173cf785737d0ull, 0xf44da561eb17e56full, 0xb536ffbd4cbeb0d1ull, 0x0224b720ab080fc3ull,
+	 0xa34ae66de2260a2bull, 0x57881816c7eb23a0ull, 0xff5682b6d4135404ull, 0x65fbc8215d29df0bull, 0xf358e1789e0cea78ull,
+	 0xb1c97a862fc224ccull, 0x65911a9d2256cb41ull, 0x23b3f78838603c51ull, 0x7dc2afd9847924dfull, 0x80e3d090d1bc51ffull,
+	 0x53d732f40523bad7ull, 0x145f107cfd1c1168ull, 0x1fc121f2401f3c43ull, 0x16fadb4c0951975dull, 0x231c805f88a91b84ull,
+	 0x61e8a9296d69bedfull, 0x7f5d2efbff783fd9ull, 0xd184a3d25bca089cull, 0x798b0f718726c220ull, 0x1caca53e15b89ad5ull,
+	 0xa302cd280be7973eull, 0xd33402f5c43f2875ull, 0xa8e122a500842689ull, 0x7e50607fbd880b29ull, 0x28b85864d2c7792full,
+	 0xdaa45a6e08f03978ull, 0xa706cd1b60fc64d3ull, 0x0c0674279cf2da12ull, 0x2b0bb00325f90256ull, 0xed668a156a19e76eull,
+	 0x0ffbb1395720f4c5ull, 0xd4c8ffd26ef94182ull, 0xe59cdd41f907827full, 0xfbde06ce09e956bfull, 0x204c0a9064b3238cull,
+	 0xb3f050ec7c1723faull, 0x93490ae047f317feull, 0x89b80c2268b06c3cull, 0x8c17e6a968dcbb68ull, 0x64ea1e5dd9d03761ull,
+	 0xf4e09f3ea49a0833ull, 0x6b21e0c60fdcb0feull, 0x6ff9aa8a8b1f10e6ull, 0x3c8fcf79dd724265ull, 0xe9435dcbf9714ef9ull,
+	 0x5e07f1f0584b74d1ull, 0x531305c5a45d2855ull, 0xc6675cb30d4db7f4ull, 0x053f54d6e2fcd306ull, 0xb469b084fffb70e4ull,
+	 0x9706def0fc676d45ull, 0x92998907854d68d2ull, 0x6ad03ba5bc66a86bull, 0xe060b5be32734fc2ull, 0xf92ffe6eefea2285ull,
+	 0x4e4c7dbb7054d8dbull, 0x10b3c6f01ac259b2ull, 0xb19f346224b480a0ull, 0xd991576629f20ab3ull, 0x57dae902a45ab837ull,
+	 0x4cc73c60d781c487ull, 0x92454b4aeb59067eull, 0x5656ea48baa8c693ull, 0x996205537097ee5bull, 0x6607c39e4f143560ull,
+	 0xcba0db8a8ba1826eull, 0x4a671d4d55b607d9ull, 0xdd4c5bdee95d4c24ull, 0x6bf4d59cf9a871faull, 0xf568aa795e5a5942ull,
+	 0xb323c0283dc6185aull, 0x67b89e5ed8f3c7caull, 0xd3cb238b85beb519ull, 0xebdd7f73dfc23d60ull, 0x4751714de3f10f28ull,
+	 0xdc62999649cbbb4bull, 0x2e1a10dc86039989ull, 0xad9855bcbd04bf6cull, 0x32a6ef982f667c13ull, 0xf674955f09a3ab6cull,
+	 0xfaa30af6cd38ae25ull, 0xdbf3d3b6bcaa229eull, 0x9e8f9e1811dccf38ull, 0x764e844c54ab0e6full, 0xeed09065cf47d0c4ull,
+	 0x0325b49410587b2full, 0x37055a0fbc42026dull, 0xcf25961d64c29a29ull, 0xfaf625f4ce32a3ceull, 0x5ec0e6d919e27b99ull,
+	 0x348ed091c3f8598bull, 0x27ac04ef39a5dbd6ull, 0xa3ac6d64735535d4ull, 0x15341990e678dbe7ull, 0xee88a1c2b94a3bb5ull,
+	 0x028400e3515d082eull, 0xbbdf29500b82b02dull, 0xbecb6cd839bb97a7ull, 0x6814c7150c2985beull, 0xfb22e6b80af12da8ull,
+	 0x01a90d88ecd9d5b0ull, 0x6f0f718035aac743ull, 0x332aa21df2686994ull, 0xb7d34f1743320cf3ull, 0x12d54edc43cdd4a6ull,
+	 0x03b83e9c3a5a5b5eull, 0x17db4c078f4a7501ull, 0x185c3bdfddb4a5cbull, 0xe7c07c4ed84ecbd3ull, 0xbcf348f7ef5856e0ull,
+	 0x11c5eb5a162c4df5ull, 0x720aab0165f4cfadull, 0x869ec6ddeb495310ull, 0x1197d8be300a3f27ull, 0xbec9c63a5a6985fbull,
+	 0x8da6686b9173afe5ull, 0xf6f24a81cc3f14a4ull, 0x318b1b583fbf0700ull, 0x9e69b615f94a53efull, 0x3a61bc3b0c095202ull,
+	 0xb7825eccca1fa09cull, 0x2d7c234a210d1c66ull, 0xbe47cb1de5ad2047ull, 0x10d0763dddab6d28ull, 0x406d4d96884f927full };
@@ -35,9 +35,7 @@ static void zobrist_toggle_field(Board *board, int n)
 {
 	const Field *f = &board->fields[n];
 	unsigned key = (4*f->pieces + 2*f->player + (bool)f->dvonns)*N + n;
-	/* N.B. Key is always positive here, which is why this works: */
-	board->hash ^=
-		(hash_t)zobrist_field_key[key - 1] << 32 | zobrist_field_key[key];
+	board->hash ^= zobrist_field_key[key];
 }
 
 /* Recalculates the Zobrist hash of a board. */
@@ -68,6 +66,8 @@ unsigned long long zobrist_hash(const Board *board_in)
 Move move_null = {  0,  0 };
 Move move_pass = { -1, -1 };
 
+THREAD_LOCAL GameStats game_stats;
+
 void board_clear(Board *board)
 {
 	Field *f;
@@ -80,6 +80,7 @@ void board_clear(Board *board)
 		f->mobile  = 6;
 	}
 	board->dvonns = 0;
+	board->alive = (1LL<<N) - 1;
 	zobrist_init(board);
 }
 
@@ -108,38 +109,40 @@ static void unplace(Board *board, const Move *m)
 	f->dvonns = 0;
 }
 
-/* Temporary space shared by mark_reachable() and remove_reachable(): */
-static bool reachable[N];
-
-static void mark_reachable(Board *board, int n) {
+/* Marks the fields connected to the n-th field in `reachable'. */
+static void mark_reachable(Board *board, int n, bool reachable[N]) {
 	const int *step;
 	int m;
 
+	++game_stats.removal_visits;
 	reachable[n] = true;
 	for (step = board_steps[1][n]; *step; ++step) {
 		m = n + *step;
 		if (!board->fields[m].removed && !reachable[m]) {
-			mark_reachable(board, m);
+			mark_reachable(board, m, reachable);
 		}
 	}
 }
 
 static void remove_unreachable(Board *board)
 {
+	bool reachable[N];
 	int n;
 	Field *f;
 
+	++game_stats.removal_checks;
 	memset(reachable, 0, sizeof(reachable));
 	for (n = 0; n < N; ++n) {
 		f = &board->fields[n];
 		if (!f->removed && f->dvonns && !reachable[n]) {
-			mark_reachable(board, n);
+			mark_reachable(board, n, reachable);
 		}
 	}
 	for (n = 0; n < N; ++n) {
 		f = &board->fields[n];
 		if (!f->removed && !reachable[n]) {
 			f->removed = board->moves;
+			board->alive &= ~(1LL<<n);
 			zobrist_toggle_field(board, n);
 		}
 	}
@@ -179,6 +182,7 @@ static void stack(Board *board, const Move *m)
 	Field *f = &board->fields[n1];
 	Field *g = &board->fields[n2];
 
+	++game_stats.stacks;
 	zobrist_toggle_field(board, n1);
 	zobrist_toggle_field(board, n2);
 	if (f->dvonns) {
@@ -191,6 +195,7 @@ static void stack(Board *board, const Move *m)
 	g->pieces += f->pieces;
 	g->dvonns += f->dvonns;
 	f->removed = board->moves;
+	board->alive &= ~(1LL<<n1);
 	zobrist_toggle_field(board, n2);
 
 	/* We must remove disconnected fields, but since remove_unreachable()
@@ -207,6 +212,7 @@ static void restore_unreachable(Board *board, int n)
 
 	zobrist_toggle_field(board, n);
 	board->fields[n].removed = 0;
+	board->alive |= (1LL<<n);
 	for (step = board_steps[1][n]; *step; ++step) {
 		m = n + *step;
 		if (board->fields[m].removed == board->moves) {
@@ -242,7 +248,6 @@ static void unstack(Board *board, const Move *m)
 	}
 }
 
-/* Used also by IO.c: */
 void update_neighbour_mobility(Board *board, int n, int diff)
 {
 	const int *step;
@@ -306,7 +311,7 @@ static void validate_mobility(const Board *board, int n)
 void board_validate(const Board *board)
 {
 	int n;
-	long long dvonns = 0;
+	long long dvonns = 0, alive = 0;
 
 	for (n = 0; n < N; ++n) {
 		const Field *f = &board->fields[n];
@@ -316,6 +321,7 @@ void board_validate(const Board *board)
 		if (f->dvonns == f->pieces || f->pieces == 0) {
 			assert(f->player == NONE);
 		}
+		if (!f->removed) alive |= (1LL<<n);
 		if (f->removed < 0) continue;
 		if (board->moves < N) {
 			assert(f->pieces == 0 || f->pieces == 1);
@@ -331,12 +337,37 @@ void board_validate(const Board *board)
 	assert(zobrist_hash(board) == board->hash);
 #endif
 	assert(dvonns == board->dvonns);
+	assert(alive == board->alive);
 
 	/* Size checks don't really belong here, but I need to check somewhere: */
 	assert(sizeof(Move) == sizeof(int));
 }
 #endif /* NDEBUG */
 
+bool board_consistent(const Board *board)
+{
+	long long dvonns = 0, alive = 0;
+	int n, mob;
+	const int *step;
+
+	for (n = 0; n < N; ++n) {
+		const Field *f = &board->fields[n];
+		if (f->removed) continue;
+		alive |= (1LL<<n);
+		if (f->dvonns) dvonns |= (1LL<<n);
+		mob = 6;
+		for (step = board_steps[1][n]; *step; ++step) {
+			const Field *g = &board->fields[n + *step];
+			if (board->moves < N ? g->pieces > 0 : !g->removed) --mob;
+		}
+		if (f->mobile != mob) return false;
+	}
+#ifdef ZOBRIST
+	if (zobrist_hash(board) != board->hash) return false;
+#endif
+	return dvonns == board->dvonns && alive == board->alive;
+}
+
 /* Generates a list of possible setup moves. */
 static int gen_places(const Board *board, Move moves[N])
 {
@@ -355,18 +386,17 @@ static int gen_places(const Board *board, Move moves[N])
 static int gen_stacks(const Board *board, Move *moves, Color player)
 {
 	const Field *f;
-	const int *step;
+	long long dsts;
 	int n, nmove = 0;
 
 	for (n = 0; n < N; ++n) {
 		f = &board->fields[n];
 		if (!f->removed && f->mobile && f->player == player)
 		{
-			for (step = board_steps[f->pieces][n]; *step; ++step) {
-				if (!f[*step].removed) {
-					Move new_move = { n, n + *step };
-					moves[nmove++] = new_move;
-				}
+			dsts = board_step_masks[f->pieces][n] & board->alive;
+			for ( ; dsts; dsts &= dsts - 1) {
+				Move new_move = { n, mask_first(dsts) };
+				moves[nmove++] = new_move;
 			}
 		}
 	}
@@ -375,7 +405,7 @@ static int gen_stacks(const Board *board, Move *moves, Color player)
 
 int generate_all_moves(const Board *board, Move moves[2*M])
 {
-	static Move dummy_moves[2*M];
+	static THREAD_LOCAL Move dummy_moves[2*M];
 
 	if (!moves) moves = dummy_moves;
 
@@ -391,7 +421,7 @@ int generate_all_moves(const Board *board, Move moves[2*M])
 
 int generate_moves(const Board *board, Move moves[M])
 {
-	static Move dummy_moves[M];
+	static THREAD_LOCAL Move dummy_moves[M];
 
 	if (!moves) moves = dummy_moves;
 
@@ -406,14 +436,23 @@ int generate_moves(const Board *board, Move moves[M])
 
 bool valid_move(const Board *board, const Move *move)
 {
-	Move moves[M];
-	int i, nmove;
+	const Field *f;
 
-	nmove = generate_moves(board, moves);
-	for (i = 0; i < nmove; ++i) {
-		if (move_compare(&moves[i], move) == 0) return true;
+	if (board->moves < N) {  /* placement phase */
+		return move->src >= 0 && move->src < N && move->dst == -1 &&
+			!board->fields[move->src].pieces;
+	}
+	if (move_passes(move)) {
+		/* Passing is only allowed if no stacking moves are available: */
+		Move moves[M];
+		return move_compare(move, &move_pass) == 0 &&
+			generate_moves(board, moves) == 1 && move_passes(&moves[0]);
 	}
-	return false;
+	if (move->src >= N || move->dst < 0 || move->dst >= N) return false;
+	f = &board->fields[move->src];
+	return !f->removed && f->mobile && f->player == next_player(board) &&
+		(board_step_masks[f->pieces][move->src] & board->alive
+			& (1LL<<move->dst)) != 0;
 }
 
 void board_scores(const Board *board, int scores[2])
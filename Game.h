@@ -1,6 +1,7 @@
 #ifndef GAME_H_INCLUDED
 #define GAME_H_INCLUDED
 
+#include "Threads.h"
 #include <stdbool.h>
 #include <stdlib.h>
 
@@ -33,6 +34,7 @@ typedef struct Board
 	hash_t         hash;        /* hash code for the board */
 #endif
 	long long      dvonns;      /* bitmask of positions of Dvonns */
+	long long      alive;       /* bitmask of fields not (yet) removed */
 } Board;
 
 /* Index of possible moves which can be made with stacks of different heights
@@ -42,6 +44,15 @@ typedef struct Board
    step of size 3 to field 18. */
 extern const int *board_steps[50][N];
 
+/* The same index as a bitmask: board_step_masks[height][field] has a bit set
+   for each field that can be reached from `field' with a stack of the given
+   height. e.g. board_step_masks[3][11] has bit 18 set. Combined with
+   board->alive this gives the possible destinations of a stack directly. */
+extern const long long board_step_masks[50][N];
+
+/* Returns the index of the lowest set bit in a nonzero field bitmask: */
+#define mask_first(mask) __builtin_ctzll(mask)
+
 /* Minimum distance (using single-step moves) between pairs of fields. */
 extern const char board_distance[N][N];
 #define distance(f, g) (board_distance[(f)][(g)])
@@ -89,6 +100,20 @@ void board_clear(Board *board);
 unsigned long long zobrist_hash(const Board *board);
 #endif
 
+/* Counters of the work done by board_do() to remove disconnected fields,
+   which are updated by every call (so they can be used for profiling): */
+typedef struct GameStats {
+	long long stacks;          /* number of stacking moves executed */
+	long long removal_checks;  /* searches for disconnected fields */
+	long long removal_visits;  /* fields visited during those searches */
+} GameStats;
+
+extern THREAD_LOCAL GameStats game_stats;
+
+/* Adds `diff' to the mobility of all fields adjacent to the n-th field. Used
+   to set up mobility when building a board directly (e.g. from a state). */
+void update_neighbour_mobility(Board *board, int n, int diff);
+
 /* Do/undo moves (which must be valid, e.g. returned by generate_moves()) */
 void board_do(Board *board, const Move *m);
 void board_undo(Board *board, const Move *m);
@@ -101,6 +126,12 @@ void board_validate(const Board *board);
 #define board_validate(board)
 #endif
 
+/* Recomputes the state that is maintained incrementally by board_do() and
+   board_undo() (mobility, the Dvonn and alive masks, and the Zobrist hash, if
+   enabled) and returns whether it matches the board. Unlike board_validate(),
+   this is available when NDEBUG is defined and does not abort the program. */
+bool board_consistent(const Board *board);
+
 /* Generates a list of all moves for both players and returns it length.
    This list does not include passes for either player. */
 int generate_all_moves(const Board *board, Move moves[2*M]);
@@ -111,8 +142,9 @@ int generate_all_moves(const Board *board, Move moves[2*M]);
 int generate_moves(const Board *board, Move moves[M]);
 
 /* Determines if the given `board' allows the current player to play `move'.
-   Note that this is a relatively costly function because it first generates
-   all possible moves! (This is necessary to check if passing is allowed.) */
+   Placing and stacking moves are checked directly against the board, which
+   takes constant time, but checking a pass requires generating all moves
+   (because passing is only allowed when no other moves are available). */
 bool valid_move(const Board *board, const Move *move);
 
 /* Calculates the score for both players: */
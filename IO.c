@@ -52,7 +52,7 @@ const char *format_move(const Move *move)
 	if (move_passes(move)) {  /* pass */
 		return "PASS";
 	} else {  /* place or stack */
-		static char buf[5];
+		static THREAD_LOCAL char buf[5];
 		char *p = buf;
 
 		*p++ = 'A' + field_col[move->src];
@@ -69,8 +69,6 @@ const char *format_move(const Move *move)
 static const char *digits =
 	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
 
-extern void update_neighbour_mobility(Board *board, int n, int diff);
-
 bool parse_state(const char *descr, Board *board, Color *next_player)
 {
 	int vals[N + 1], n;
@@ -110,6 +108,7 @@ bool parse_state(const char *descr, Board *board, Color *next_player)
 				f->removed = N;
 				f->pieces = 1;
 				f->player = 0;
+				board->alive &= ~(1LL<<n);
 				++board->moves;
 			}
 		} else if (vals[n + 1] == 1) {
@@ -145,7 +144,7 @@ bool parse_state(const char *descr, Board *board, Color *next_player)
 
 const char *format_state(const Board *board)
 {
-	static char buf[N + 2];
+	static THREAD_LOCAL char buf[N + 2];
 	int n;
 
 	if (board->moves < N) {  /* placement phase */
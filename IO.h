@@ -13,11 +13,13 @@ bool parse_move(const char *text, Move *move);
 bool parse_state(const char *descr, Board *board, Color *next_player);
 
 /* Returns a string representation of the given move. The result should not be
-   freed by the caller; it remains valid until the next call to format_move() */
+   freed by the caller; it remains valid until the next call to format_move()
+   in the same thread. */
 const char *format_move(const Move *move);
 
 /* Returns a string representation of the given board. The result should not be
-   freed by the caller; it remains valid until the next call to format_move() */
+   freed by the caller; it remains valid until the next call to format_state()
+   in the same thread. */
 const char *format_state(const Board *board);
 
 #endif /* ndef IO_H_INCLUDED */
@@ -0,0 +1,346 @@
+#include "Index.h"
+#include "IO.h"
+#include "Record.h"
+#include "Time.h"
+#include "TT.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Minimum size of the hash table: */
+#define INDEX_MIN_BUCKETS 1024
+
+/* A position reached in a game, collected while building the index: */
+typedef struct IndexItem {
+	hash_t          hash;
+	IndexOccurrence occ;
+} IndexItem;
+
+/* Growable arrays of games and positions collected while building: */
+typedef struct IndexBuilder {
+	IndexGame *games;
+	size_t    ngame, game_cap;
+	IndexItem *items;
+	size_t    nitem, item_cap;
+	int       skipped;  /* number of invalid games skipped */
+} IndexBuilder;
+
+/* Rounds `size' up to a multiple of 8 (the alignment of the index arrays): */
+static size_t index_align(size_t size)
+{
+	return (size + 7)&~(size_t)7;
+}
+
+/* Computes the offsets of the arrays in an index with the given header. */
+static void index_layout( const IndexHeader *header, size_t *games,
+	size_t *entries, size_t *occurrences, size_t *end )
+{
+	*games       = index_align(sizeof(IndexHeader));
+	*entries     = index_align(*games + header->games*sizeof(IndexGame));
+	*occurrences = *entries + header->buckets*sizeof(IndexEntry);
+	*end         = *occurrences + header->occurrences*sizeof(IndexOccurrence);
+}
+
+/* Orders items by hash code, then by game and ply: */
+static int index_item_cmp(const void *a, const void *b)
+{
+	const IndexItem *p = a, *q = b;
+
+	if (p->hash != q->hash) return p->hash < q->hash ? -1 : 1;
+	if (p->occ.game != q->occ.game) return p->occ.game < q->occ.game ? -1 : 1;
+	return (int)p->occ.ply - (int)q->occ.ply;
+}
+
+/* Adds an occurrence of the given position to the builder. */
+static bool index_add_item( IndexBuilder *ib, const Board *board,
+	unsigned game, int move )
+{
+	IndexItem *item;
+
+	if (ib->nitem == ib->item_cap) {
+		size_t cap = ib->item_cap ? 2*ib->item_cap : 65536;
+		IndexItem *items = realloc(ib->items, cap*sizeof(IndexItem));
+		if (items == NULL) return false;
+		ib->items    = items;
+		ib->item_cap = cap;
+	}
+	item = &ib->items[ib->nitem++];
+	item->hash         = hash_board(board);
+	item->occ.game     = game;
+	item->occ.ply      = (unsigned char)board->moves;
+	item->occ.move     = (unsigned char)move;
+	item->occ.reserved = 0;
+	return true;
+}
+
+/* Replays a game and adds it and all positions reached to the builder. An
+   invalid game is added without positions (so that later games keep their
+   numbers). Returns false if memory runs out. */
+static bool index_add_game(IndexBuilder *ib, const RecordGame *rg)
+{
+	unsigned game = (unsigned)ib->ngame;
+	IndexGame *ig;
+	Board board;
+	Move move;
+	int n, scores[2];
+
+	if (ib->ngame == ib->game_cap) {
+		size_t cap = ib->game_cap ? 2*ib->game_cap : 1024;
+		IndexGame *games = realloc(ib->games, cap*sizeof(IndexGame));
+		if (games == NULL) return false;
+		ib->games    = games;
+		ib->game_cap = cap;
+	}
+	ig = &ib->games[ib->ngame++];
+	memset(ig, 0, sizeof(IndexGame));
+	if (rg->plies > RECORD_MAX_PLIES) {
+		++ib->skipped;
+		return true;
+	}
+	board_clear(&board);
+	for (n = 0; n < rg->plies; ++n) {
+		if (!index_add_item(ib, &board, game, rg->moves[n])) return false;
+		if (!record_move(&board, rg->moves[n], &move)) {
+			ib->nitem -= n + 1;  /* discard the game's positions */
+			++ib->skipped;
+			return true;
+		}
+		board_do(&board, &move);
+	}
+	if (!index_add_item(ib, &board, game, INDEX_NO_MOVE)) return false;
+	board_scores(&board, scores);
+	ig->scores[0] = (unsigned char)scores[0];
+	ig->scores[1] = (unsigned char)scores[1];
+	ig->finished  = generate_all_moves(&board, NULL) == 0;
+	ig->plies     = (unsigned char)rg->plies;
+	return true;
+}
+
+/* Writes `size' zero bytes to `fp' (to align the next array). */
+static bool index_pad(FILE *fp, size_t size)
+{
+	static const char zeros[8];
+
+	return size == 0 || fwrite(zeros, size, 1, fp) == 1;
+}
+
+/* Builds the hash table and writes the index collected in `ib' to `fp'. */
+static bool index_write(IndexBuilder *ib, FILE *fp)
+{
+	IndexHeader header;
+	IndexEntry *entries, *e;
+	size_t off_games, off_entries, off_occ, end, i, j;
+	bool ok;
+
+	qsort(ib->items, ib->nitem, sizeof(IndexItem), index_item_cmp);
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, INDEX_MAGIC, 4);
+	header.version     = INDEX_VERSION;
+	header.games       = (unsigned)ib->ngame;
+	header.occurrences = (unsigned)ib->nitem;
+	for (i = 0; i < ib->nitem; ++i) {
+		if (i == 0 || ib->items[i].hash != ib->items[i - 1].hash) {
+			++header.positions;
+		}
+	}
+	header.buckets = INDEX_MIN_BUCKETS;
+	while (header.buckets < 2*header.positions) header.buckets *= 2;
+
+	entries = calloc(header.buckets, sizeof(IndexEntry));
+	if (entries == NULL) return false;
+	for (i = 0; i < ib->nitem; i = j) {
+		hash_t hash = ib->items[i].hash;
+		size_t b = hash & (header.buckets - 1);
+
+		while (entries[b].hash != 0) b = (b + 1) & (header.buckets - 1);
+		e = &entries[b];
+		e->hash  = hash;
+		e->first = (unsigned)i;
+		for (j = i; j < ib->nitem && ib->items[j].hash == hash; ++j) {
+			const IndexGame *g = &ib->games[ib->items[j].occ.game];
+
+			++e->count;
+			if (g->finished) {
+				if (g->scores[0] > g->scores[1]) ++e->won[0];
+				if (g->scores[1] > g->scores[0]) ++e->won[1];
+				if (g->scores[0] == g->scores[1]) ++e->tied;
+			}
+		}
+	}
+
+	index_layout(&header, &off_games, &off_entries, &off_occ, &end);
+	ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+	     index_pad(fp, off_games - sizeof(header)) &&
+	     fwrite(ib->games, sizeof(IndexGame), ib->ngame, fp) == ib->ngame &&
+	     index_pad(fp, off_entries - off_games -
+	                   ib->ngame*sizeof(IndexGame)) &&
+	     fwrite(entries, sizeof(IndexEntry), header.buckets, fp) ==
+	         header.buckets;
+	for (i = 0; ok && i < ib->nitem; ++i) {
+		ok = fwrite(&ib->items[i].occ, sizeof(IndexOccurrence), 1, fp) == 1;
+	}
+	free(entries);
+	return ok;
+}
+
+bool index_build(const char *output, char *const paths[], int npath)
+{
+	IndexBuilder ib;
+	RecordFile rf;
+	RecordGame rg;
+	FILE *fp;
+	int n;
+	double start = time_used(), used;
+	bool ok = true;
+
+	memset(&ib, 0, sizeof(ib));
+	for (n = 0; ok && n < npath; ++n) {
+		if (!record_open(&rf, paths[n])) {
+			ok = false;
+			break;
+		}
+		while (record_next(&rf, &rg)) {
+			if (!index_add_game(&ib, &rg)) {
+				fprintf(stderr, "Out of memory!\n");
+				ok = false;
+				break;
+			}
+		}
+		record_close(&rf);
+	}
+	if (ok) {
+		fp = fopen(output, "wb");
+		ok = fp != NULL && index_write(&ib, fp);
+		if (fp != NULL && fclose(fp) != 0) ok = false;
+		if (!ok) perror(output);
+	}
+	used = time_used() - start;
+	if (ok) {
+		printf("%d games (%lu positions) indexed in %.3fs; "
+			"%d games skipped\n", (int)ib.ngame - ib.skipped,
+			(unsigned long)ib.nitem, used, ib.skipped);
+	}
+	free(ib.games);
+	free(ib.items);
+	return ok;
+}
+
+bool index_open(PosIndex *index, const char *path)
+{
+	size_t off_games, off_entries, off_occ, end;
+	struct stat st;
+	void *data;
+	int fd;
+
+	memset(index, 0, sizeof(PosIndex));
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) != 0) {
+		perror(path);
+		if (fd >= 0) close(fd);
+		return false;
+	}
+	if ( st.st_size < (off_t)sizeof(IndexHeader) ||
+	     (data = mmap( NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+	                   fd, 0 )) == MAP_FAILED ) {
+		fprintf(stderr, "%s: could not map index!\n", path);
+		close(fd);
+		return false;
+	}
+	close(fd);
+	index->data   = data;
+	index->size   = (size_t)st.st_size;
+	index->header = data;
+	if ( memcmp(index->header->magic, INDEX_MAGIC, 4) != 0 ||
+	     index->header->version != INDEX_VERSION ) {
+		fprintf(stderr, "%s: not a position index!\n", path);
+		index_close(index);
+		return false;
+	}
+	index_layout(index->header, &off_games, &off_entries, &off_occ, &end);
+	if (end != index->size) {
+		fprintf(stderr, "%s: index has the wrong size!\n", path);
+		index_close(index);
+		return false;
+	}
+	index->games       = (const IndexGame*)(index->data + off_games);
+	index->entries     = (const IndexEntry*)(index->data + off_entries);
+	index->occurrences = (const IndexOccurrence*)(index->data + off_occ);
+	return true;
+}
+
+void index_close(PosIndex *index)
+{
+	if (index->data != NULL) munmap((void*)index->data, index->size);
+	memset(index, 0, sizeof(PosIndex));
+}
+
+const IndexEntry *index_lookup(const PosIndex *index, hash_t hash)
+{
+	unsigned mask = index->header->buckets - 1, b;
+
+	if (hash == 0) return NULL;
+	for (b = hash & mask; index->entries[b].hash != 0; b = (b + 1) & mask) {
+		if (index->entries[b].hash == hash) return &index->entries[b];
+	}
+	return NULL;
+}
+
+bool index_query(const PosIndex *index, const Board *board, FILE *out)
+{
+	const IndexEntry *e = index_lookup(index, hash_board(board));
+	const IndexOccurrence *occ;
+	int games[M], decided[M], points[M];  /* per move: games, finished
+	                                         games and half points won */
+	int player = next_player(board);
+	unsigned n, finished;
+	Move move;
+
+	if (e == NULL) {
+		fprintf(out, "Position not found.\n");
+		return false;
+	}
+	finished = e->won[0] + e->won[1] + e->tied;
+	fprintf(out, "Position occurs in %u games (%u finished): "
+		"white won %u (%.1f%%), black won %u (%.1f%%), tied %u (%.1f%%)\n",
+		e->count, finished,
+		e->won[0], finished ? 100.0*e->won[0]/finished : 0.0,
+		e->won[1], finished ? 100.0*e->won[1]/finished : 0.0,
+		e->tied,   finished ? 100.0*e->tied/finished   : 0.0);
+
+	/* Aggregate results by move played: */
+	memset(games, 0, sizeof(games));
+	memset(decided, 0, sizeof(decided));
+	memset(points, 0, sizeof(points));
+	for (n = 0; n < e->count; ++n) {
+		const IndexGame *g;
+
+		occ = &index->occurrences[e->first + n];
+		if (occ->move >= M) continue;
+		g = &index->games[occ->game];
+		++games[occ->move];
+		if (g->finished) {
+			++decided[occ->move];
+			if (g->scores[player] >= g->scores[1 - player]) ++points[occ->move];
+			if (g->scores[player] > g->scores[1 - player]) ++points[occ->move];
+		}
+	}
+	for (n = 0; n < M; ++n) {
+		if (games[n] > 0 && record_move(board, n, &move)) {
+			fprintf(out, "%-6s %6d games, score %.1f%%\n", format_move(&move),
+				games[n], decided[n] ? 50.0*points[n]/decided[n] : 0.0);
+		}
+	}
+
+	/* List the games that reached the position: */
+	fprintf(out, "Games:");
+	for (n = 0; n < e->count; ++n) {
+		occ = &index->occurrences[e->first + n];
+		fprintf(out, " %u", occ->game + 1);
+	}
+	fprintf(out, "\n");
+	return true;
+}
@@ -0,0 +1,96 @@
+#ifndef INDEX_H_INCLUDED
+#define INDEX_H_INCLUDED
+
+#include "Game.h"
+#include <stdio.h>
+
+/* A position index records, for every position reached in a collection of
+   games (read from record files; see Record.h), in which games it occurred,
+   after how many moves, and which move was played next, along with the number
+   of those games won by either player. Positions are identified by their hash
+   code (see hash_board()), so positions reached by different move orders are
+   merged, and collisions are not detected.
+
+   The index is built once and written to a file that is mapped into memory
+   to answer queries, which take constant time (apart from enumerating the
+   occurrences of a position). The file consists of an IndexHeader, followed
+   by an array of IndexGame, an open-addressing hash table of IndexEntry, and
+   an array of IndexOccurrence (grouped by position, and ordered by game within
+   each group). The file uses the host's byte order and alignment, and can be
+   rebuilt from the record files at any time. */
+
+#define INDEX_MAGIC    "DVNX"
+#define INDEX_VERSION  1
+#define INDEX_NO_MOVE  255   /* move of an occurrence at the end of a game */
+
+typedef struct IndexHeader {
+	char     magic[4];      /* INDEX_MAGIC */
+	unsigned version;       /* INDEX_VERSION */
+	unsigned games;         /* number of games */
+	unsigned buckets;       /* size of the hash table (a power of 2) */
+	unsigned positions;     /* number of distinct positions */
+	unsigned occurrences;   /* total number of positions reached */
+	unsigned reserved[2];
+} IndexHeader;
+
+/* A game in the index (numbered from 0, in the order of the record files;
+   invalid games are included, but have no positions and are not finished): */
+typedef struct IndexGame {
+	unsigned char  scores[2];  /* scores of white and black at the end */
+	unsigned char  finished;   /* whether the game was played to the end */
+	unsigned char  plies;      /* number of moves played */
+} IndexGame;
+
+/* A position in the index (unused entries have hash 0): */
+typedef struct IndexEntry {
+	hash_t   hash;          /* hash code of the position */
+	unsigned first;         /* index of its first occurrence */
+	unsigned count;         /* number of occurrences */
+	unsigned won[2];        /* finished games won by white and black */
+	unsigned tied;          /* finished games tied */
+	unsigned reserved;
+} IndexEntry;
+
+/* An occurrence of a position in a game: */
+typedef struct IndexOccurrence {
+	unsigned       game;    /* game number */
+	unsigned char  ply;     /* number of moves played before the position */
+	unsigned char  move;    /* index of the move played next (as stored in
+	                           record files), or INDEX_NO_MOVE */
+	unsigned short reserved;
+} IndexOccurrence;
+
+/* A position index that has been mapped into memory: */
+typedef struct PosIndex {
+	const unsigned char   *data;         /* contents of the file */
+	size_t                size;          /* size of the file */
+	const IndexHeader     *header;
+	const IndexGame       *games;
+	const IndexEntry      *entries;
+	const IndexOccurrence *occurrences;
+} PosIndex;
+
+/* Replays all games in the record files at the given paths, and writes an
+   index of the positions reached to `output'. Returns false if a record file
+   could not be read, or the index could not be written. */
+bool index_build(const char *output, char *const paths[], int npath);
+
+/* Maps the index at `path' into memory and verifies its header. Returns false
+   (and reports the reason) if the file could not be opened. */
+bool index_open(PosIndex *index, const char *path);
+
+/* Unmaps an index opened with index_open(). */
+void index_close(PosIndex *index);
+
+/* Returns the entry of the position with the given hash code, or NULL if the
+   position does not occur in the index. */
+const IndexEntry *index_lookup(const PosIndex *index, hash_t hash);
+
+/* Looks up the given position, and prints to `out' the number of games in
+   which it occurred, the results of those games, and for each move played in
+   the position the number of games and the score of the player who played it
+   (counting ties as half a win), followed by the numbers of the games (from
+   1) that reached the position. Returns false if the position was not found. */
+bool index_query(const PosIndex *index, const Board *board, FILE *out);
+
+#endif /* ndef INDEX_H_INCLUDED */
@@ -1,6 +1,7 @@
 #include "MO.h"
 #include "AI.h"
 #include "Eval.h"
+#include "Threads.h"
 
 static void swap_moves(Move *a, Move *b)
 {
@@ -9,10 +10,10 @@ static void swap_moves(Move *a, Move *b)
 	*b = tmp;
 }
 
-void shuffle_moves(Move *moves, int n)
+void shuffle_moves(Move *moves, int n, unsigned *rng_state)
 {
 	while (n > 1) {
-		int m = rand()%n--;
+		int m = rand_r(rng_state)%n--;
 		swap_moves(&moves[m], &moves[n]);
 	}
 }
@@ -61,19 +62,22 @@ static void order_heuristically(const Board *board, Move *moves, int nmove)
 
 /* New ordering function that execute all moves and directly evaluates the
    resulting positions. This is relatively expensive but gives good ordering. */
-static void order_evaluated(Board *board, Move *moves, int nmove)
+static void order_evaluated( Board *board, Move *moves, int nmove,
+	const EvalWeights *weights )
 {
-	val_t values[M];
+	/* Not recursive, so a single buffer suffices (and keeps it off the
+	   search stack): */
+	static THREAD_LOCAL val_t values[M];
 	int i, j;
 	Move m;
 	val_t v;
+	bool exact;
 
 	/* Evaluate successors: */
 	for (i = 0; i < nmove; ++i)
 	{
-		extern val_t ai_evaluate(const Board *board);
 		board_do(board, &moves[i]);
-		values[i] = ai_evaluate(board);
+		values[i] = eval_position(board, weights, &exact);
 		board_undo(board, &moves[i]);
 	}
 
@@ -93,8 +97,38 @@ static void order_evaluated(Board *board, Move *moves, int nmove)
 	}
 }
 
-void order_moves(const Board *board, Move *moves, int nmove)
+void order_moves( const Board *board, Move *moves, int nmove,
+	int method, const EvalWeights *weights )
 {
-	if (ai_use_mo == 1) return order_heuristically(board, moves, nmove);
-	if (ai_use_mo == 2) return order_evaluated((Board*)board, moves, nmove);
+	if (method == 1) return order_heuristically(board, moves, nmove);
+	if (method == 2) {
+		return order_evaluated((Board*)board, moves, nmove, weights);
+	}
+}
+
+int generate_stage(const Board *board, Move *moves, int stage, Move killer)
+{
+	int i, n, nmove;
+
+	switch (stage) {
+	case STAGE_KILLER:
+		/* Passes are left to STAGE_REST; validating them is expensive: */
+		if (!move_stacks(&killer) || !valid_move(board, &killer)) return 0;
+		moves[0] = killer;
+		return 1;
+	case STAGE_REST:
+		nmove = generate_moves(board, moves);
+		order_heuristically(board, moves, nmove);
+		break;
+	default:
+		return 0;
+	}
+
+	/* Remove the killer move (if it was generated before), keeping the other
+	   moves in order, as move_to_front() would: */
+	if (!move_stacks(&killer)) return nmove;
+	for (i = n = 0; i < nmove; ++i) {
+		if (move_compare(&moves[i], &killer) != 0) moves[n++] = moves[i];
+	}
+	return n;
 }
@@ -2,15 +2,36 @@
 #define MOVE_ORDERING_H_INCLUDED
 
 #include "Game.h"
+#include "Eval.h"
 
-/* Shuffle moves randomly using rand() */
-void shuffle_moves(Move *moves, int nmove);
+/* Shuffle moves randomly using rand_r() with the given RNG state (so that
+   engines in different threads do not share the state of rand()) */
+void shuffle_moves(Move *moves, int nmove, unsigned *rng_state);
 
 /* Moves the given killer move to the front of the list (if it is found) and
    leaves all other moves in the same order. */
 void move_to_front(Move *moves, int nmove, Move killer);
 
-/* Heuristically (but quickly) orders moves from best-to-worst. */
-void order_moves(const Board *board, Move *moves, int nmove);
+/* Orders moves from best-to-worst, using the given method: 1 to order
+   heuristically (but quickly), or 2 to order by evaluating the resulting
+   positions with the given weights (which is slower, but more accurate). */
+void order_moves( const Board *board, Move *moves, int nmove,
+	int method, const EvalWeights *weights );
+
+/* Stages of staged move generation, in the order in which they are tried.
+   Together they produce the same moves as generate_moves() in the stacking
+   phase, ordered heuristically like order_moves() with the killer move in
+   front, but the other moves are generated only if the killer move is invalid
+   or fails to cause a cut-off. */
+enum MoveStage {
+	STAGE_KILLER,   /* the killer move (if it is valid) */
+	STAGE_REST,     /* all other moves, ordered heuristically */
+	STAGE_DONE
+};
+
+/* Generates the moves for the given stage in `moves' and returns how many were
+   generated. `killer' is the killer move (or move_null if there is none); it is
+   generated in the STAGE_KILLER stage only, and excluded from later stages. */
+int generate_stage(const Board *board, Move *moves, int stage, Move killer);
 
 #endif /* ndef MOVE_ORDERING_H_INCLUDED */
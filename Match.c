@@ -0,0 +1,311 @@
+#include "Match.h"
+#include "Budget.h"
+#include "Threads.h"
+#include "Time.h"
+#include "Workers.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Competition points awarded for winning or tying a game, in addition to the
+   number of stones (as awarded by the arbiter): */
+#define MATCH_POINTS_WON  90
+#define MATCH_POINTS_TIED 45
+
+/* Result of a single game, indexed by side: */
+typedef struct GameResult {
+	int    score[2];   /* final number of stones */
+	double time[2];    /* time used */
+	bool   failed[2];  /* whether the side failed (no move or out of time) */
+} GameResult;
+
+/* Accumulated results of one side: */
+typedef struct SideResults {
+	int       points;    /* competition points */
+	int       won, tied, lost, failed;
+	long long stones;    /* total number of stones at the end of games */
+	double    time;      /* total time used */
+	double    max_time;  /* maximum time used in a single game */
+} SideResults;
+
+/* State of a match, shared by its threads: */
+typedef struct Match {
+	const MatchSide *sides;
+	int             games;       /* number of games to play */
+	int             next;        /* index of the next game (atomic) */
+	int             finished;    /* number of games finished */
+	AI_Limit        limit;       /* fixed search limits (if any) */
+	double          game_time;   /* time on each side's game clock */
+	int             seed;        /* base RNG seed */
+	SideResults     results[2];  /* results so far, indexed by side */
+	const MatchSprt *sprt;       /* test used to stop early (or NULL) */
+	double          llr;         /* log-likelihood ratio of the test */
+	int             verdict;     /* hypothesis accepted (0 or 1, or -1) */
+	volatile bool   stopping;    /* whether to stop starting games */
+#ifdef THREADS
+	pthread_mutex_t mutex;       /* protects finished and results */
+#endif
+} Match;
+
+/* Returns the RNG seed used by the player of the given color in a game. Both
+   games of a pair use the same seeds. */
+static int game_seed(const Match *match, int game, Color color)
+{
+	return workers_seed(match->seed, 2u*(game/2) + color);
+}
+
+/* Plays a single game between the two engines (indexed by side). Side 0 plays
+   white in even-numbered games, and black in odd-numbered games. Like the
+   arbiter, once a side fails, its remaining moves are chosen at random, so
+   that the game is scored on a finished board. */
+static void play_game( const Match *match, AI_Engine engines[2], int game,
+	GameResult *res )
+{
+	bool clocked = !match->limit.depth && !match->limit.eval;
+	unsigned seed = (unsigned)game_seed(match, game, WHITE);
+	int side, nmove, scores[2];
+	Move moves[2*M];
+	Board board;
+
+	board_clear(&board);
+	for (side = 0; side < 2; ++side) {
+		ai_reset(&engines[side]);
+		engines[side].rng_seed =
+			game_seed(match, game, (Color)(side ^ (game&1)));
+		res->time[side]   = 0;
+		res->failed[side] = false;
+	}
+	while ((nmove = generate_all_moves(&board, moves)) > 0) {
+		AI_Limit limit = match->limit;
+		AI_Result result;
+		Budget budget;
+
+		side = (int)next_player(&board) ^ (game&1);
+		if (res->failed[side]) {
+			board_do(&board, &moves[rand_r(&seed)%nmove]);
+			continue;
+		}
+		if (board.moves < N || clocked) {
+			budget_limit( &board, match->game_time - res->time[side],
+			              &limit, &budget );
+		}
+		if (!ai_select_move(&engines[side], &board, &limit, &result)) {
+			res->failed[side] = true;
+			continue;
+		}
+		res->time[side] += result.time;
+		if (clocked && res->time[side] > match->game_time) {
+			res->failed[side] = true;
+			continue;
+		}
+		board_do(&board, &result.move);
+	}
+	board_scores(&board, scores);
+	for (side = 0; side < 2; ++side) {
+		res->score[side] = scores[side ^ (game&1)];
+	}
+}
+
+/* Returns the expected score of a player that is `elo' Elo points stronger
+   than its opponent, in the logistic model. */
+static double elo_score(double elo)
+{
+	return 1/(1 + pow(10, -elo/400));
+}
+
+/* Returns the Elo difference corresponding to an expected score. */
+static double score_elo(double score)
+{
+	if (score <= 0) return -HUGE_VAL;
+	if (score >= 1) return HUGE_VAL;
+	return -400*log10(1/score - 1);
+}
+
+/* Returns the log-likelihood ratio of the hypotheses of the test, given the
+   games won, tied and lost by side 1. This uses the normal approximation of
+   the generalized SPRT that is common in engine testing, in which ties count
+   as half a win and the variance of the score is estimated from the games.
+   The variance is estimated with half a game won and half a game lost added,
+   so that it is positive even when every game ended the same way (otherwise
+   a match in which one side wins every game would never be stopped). */
+static double sprt_llr(const MatchSprt *sprt, const SideResults *r)
+{
+	double n = r->won + r->tied + r->lost, s, m, var, s0, s1;
+
+	if (n == 0) return 0;
+	s   = (r->won + 0.5*r->tied)/n;
+	m   = (r->won + 0.5*r->tied + 0.5)/(n + 1);
+	var = ( (r->won + 0.5)*(1 - m)*(1 - m) + r->tied*(0.5 - m)*(0.5 - m) +
+	        (r->lost + 0.5)*m*m )/(n + 1);
+	s0 = elo_score(sprt->elo0);
+	s1 = elo_score(sprt->elo1);
+	return n*(s1 - s0)*(2*s - s0 - s1)/(2*var);
+}
+
+/* Bounds on the log-likelihood ratio at which H0 or H1 is accepted: */
+static double sprt_lower(const MatchSprt *sprt)
+{
+	return log(sprt->beta/(1 - sprt->alpha));
+}
+
+static double sprt_upper(const MatchSprt *sprt)
+{
+	return log((1 - sprt->beta)/sprt->alpha);
+}
+
+/* Adds the result of a game to the match results, and reports it. A side
+   that failed is scored as in the arbiter (no points, but its stones count),
+   but the game is counted as lost, also by the test, whatever the stones.
+   If a hypothesis of the test is accepted, the match is stopped. */
+static void record_result(Match *match, int game, const GameResult *res)
+{
+	int side;
+
+#ifdef THREADS
+	pthread_mutex_lock(&match->mutex);
+#endif
+	for (side = 0; side < 2; ++side) {
+		SideResults *r = &match->results[side];
+		int mine = res->score[side], theirs = res->score[1 - side];
+		int outcome = (mine > theirs) - (mine < theirs);
+
+		if (res->failed[side]) {
+			++r->failed;
+		} else {
+			r->points += mine;
+			if (mine > theirs) r->points += MATCH_POINTS_WON;
+			if (mine == theirs) r->points += MATCH_POINTS_TIED;
+		}
+		if (res->failed[side] != res->failed[1 - side]) {
+			outcome = res->failed[side] ? -1 : 1;
+		}
+		if (outcome > 0) ++r->won;
+		if (outcome == 0) ++r->tied;
+		if (outcome < 0) ++r->lost;
+		r->stones += mine;
+		r->time += res->time[side];
+		if (res->time[side] > r->max_time) r->max_time = res->time[side];
+	}
+	++match->finished;
+	fprintf(stderr, "Game %d: %s - %s: %d - %d%s\n", game + 1,
+		match->sides[game&1].name, match->sides[1 - (game&1)].name,
+		res->score[game&1], res->score[1 - (game&1)],
+		res->failed[0] || res->failed[1] ? " (failed)" : "");
+	if (match->sprt) {
+		const MatchSprt *sprt = match->sprt;
+
+		match->llr = sprt_llr(sprt, &match->results[1]);
+		if (match->verdict < 0) {
+			if (match->llr <= sprt_lower(sprt)) match->verdict = 0;
+			if (match->llr >= sprt_upper(sprt)) match->verdict = 1;
+			if (match->verdict >= 0) match->stopping = true;
+		}
+		fprintf(stderr, "LLR %.3f [%.3f:%.3f] after %d games\n",
+			match->llr, sprt_lower(sprt), sprt_upper(sprt), match->finished);
+	}
+#ifdef THREADS
+	pthread_mutex_unlock(&match->mutex);
+#endif
+}
+
+/* Thread function: plays games until all games have been started. */
+static void *play_games(void *arg)
+{
+	Match *match = arg;
+	AI_Engine engines[2];
+	TTable tables[2];
+	GameResult res;
+	int side, game;
+
+	for (side = 0; side < 2; ++side) {
+		workers_clone( &engines[side], &tables[side],
+		               match->sides[side].engine, match->sides[side].tt_size );
+	}
+	while ( !match->stopping &&
+	        (game = __sync_fetch_and_add(&match->next, 1)) < match->games ) {
+		play_game(match, engines, game, &res);
+		record_result(match, game, &res);
+	}
+	for (side = 0; side < 2; ++side) tt_fini(&tables[side]);
+	return NULL;
+}
+
+/* Prints the results of the match, in the format used by the arbiter. */
+static void print_results(const Match *match, double used, int nthread)
+{
+	const SideResults *results = match->results;
+	int games = match->finished;
+	int first = (results[1].points > results[0].points) ? 1 : 0;
+	int n;
+
+	printf("No Player                         Points  Won Tied Lost Fail"
+		" Avg Time Max Time\n");
+	printf("-- ------------------------------ ------ ---- ---- ---- ----"
+		" -------- --------\n");
+	for (n = 0; n < 2; ++n) {
+		int side = n ^ first;
+		const SideResults *r = &results[side];
+
+		printf("%2d %-30.30s %6d %4d %4d %4d %4d %7.3fs %7.3fs\n", n + 1,
+			match->sides[side].name, r->points, r->won, r->tied, r->lost,
+			r->failed, games > 0 ? r->time/games : 0.0, r->max_time);
+	}
+	printf("-- ------------------------------ ------ ---- ---- ---- ----"
+		" -------- --------\n");
+	printf("   Score difference: %.2f\n", games > 0 ?
+		(double)(results[first].stones - results[1 - first].stones)/games :
+		0.0);
+	if (match->sprt) {
+		const MatchSprt *sprt = match->sprt;
+		const SideResults *r = &results[1];
+
+		printf("   Elo difference of %s: %+.1f\n", match->sides[1].name,
+			games > 0 ? score_elo((r->won + 0.5*r->tied)/games) : 0.0);
+		printf("   SPRT (elo0=%g elo1=%g alpha=%g beta=%g): LLR %.3f "
+			"[%.3f:%.3f], %s\n", sprt->elo0, sprt->elo1, sprt->alpha,
+			sprt->beta, match->llr, sprt_lower(sprt), sprt_upper(sprt),
+			match->verdict == 1 ? "H1 accepted" :
+			match->verdict == 0 ? "H0 accepted" : "inconclusive");
+	}
+	printf("%d games in %.3fs using %d thread%s: %.2f games/second\n",
+		games, used, nthread, nthread == 1 ? "" : "s",
+		used > 0 ? games/used : 0.0);
+}
+
+bool match_run( const MatchSide sides[2], int games, const AI_Limit *limit,
+	double game_time, int nthread, int seed, const MatchSprt *sprt )
+{
+	Match match;
+	double start = time_used();
+
+	if (games < 1) {
+		fprintf(stderr, "No games to play!\n");
+		return false;
+	}
+	if ( sprt && !( sprt->elo0 < sprt->elo1 &&
+	                sprt->alpha > 0 && sprt->alpha < 1 &&
+	                sprt->beta > 0 && sprt->beta < 1 ) ) {
+		fprintf(stderr, "Invalid SPRT parameters!\n");
+		return false;
+	}
+	memset(&match, 0, sizeof(match));
+	match.sides       = sides;
+	match.games       = games;
+	match.limit.depth = limit->depth;
+	match.limit.eval  = limit->eval;
+	match.game_time   = game_time;
+	match.seed        = seed;
+	match.sprt        = sprt;
+	match.verdict     = -1;
+	if (nthread > games) nthread = games;
+#ifdef THREADS
+	pthread_mutex_init(&match.mutex, NULL);
+#endif
+	nthread = workers_run(play_games, &match, nthread);
+#ifdef THREADS
+	pthread_mutex_destroy(&match.mutex);
+#endif
+	print_results(&match, time_used() - start, nthread);
+	return true;
+}
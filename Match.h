@@ -0,0 +1,53 @@
+#ifndef MATCH_H_INCLUDED
+#define MATCH_H_INCLUDED
+
+#include "AI.h"
+
+/* A match plays many games between two engine configurations in a single
+   process, several games at a time, to measure the effect of a change in
+   search parameters or evaluation weights. Games are played in pairs, with
+   colors swapped and the same random seeds for each color, so that both sides
+   get to play the same openings. */
+
+/* One of the two configurations playing a match: */
+typedef struct MatchSide {
+	const char      *name;     /* name shown in the results */
+	const AI_Engine *engine;   /* engine copied for each thread (its
+	                              transposition table is not used) */
+	size_t          tt_size;   /* entries in the transposition table used by
+	                              each thread (0 to disable) */
+} MatchSide;
+
+/* Parameters of a sequential probability ratio test, which stops a match as
+   soon as it is clear whether side 1 is at most `elo0' Elo points stronger
+   than side 0 (H0) or at least `elo1' Elo points stronger (H1), with error
+   probabilities `alpha' (of accepting H1 when H0 holds) and `beta' (of
+   accepting H0 when H1 holds). For example, to test whether a change is an
+   improvement, side 0 is the original and side 1 the changed configuration,
+   with elo0 = 0 and elo1 = 5. */
+typedef struct MatchSprt {
+	double elo0, elo1;    /* Elo differences of the hypotheses */
+	double alpha, beta;   /* error probabilities */
+} MatchSprt;
+
+/* Plays `games' games between the two sides, using `nthread' threads that
+   each play one game at a time, and prints the results to standard output,
+   in the format used by the arbiter: points, games won, tied, lost and failed,
+   time used per game, and the average stone difference, followed by the
+   number of games played per second.
+
+   If `limit' limits the search depth or the number of evaluations, every
+   move in the stacking phase is searched with those limits. Otherwise, each
+   side has a game clock of `game_time' seconds, and time is allocated as in
+   real matches (see budget_limit()); a side that exceeds its time fails the
+   game. `seed' determines the random seeds of the games.
+
+   If `sprt' is not NULL, the log-likelihood ratio of the test is reported
+   after each game, and no more games are started once a hypothesis has been
+   accepted (so `games' is the maximum number of games played).
+
+   Returns false if the match could not be started. */
+bool match_run( const MatchSide sides[2], int games, const AI_Limit *limit,
+	double game_time, int nthread, int seed, const MatchSprt *sprt );
+
+#endif /* ndef MATCH_H_INCLUDED */
@@ -0,0 +1,403 @@
+#include "Perft.h"
+#include "AI.h"
+#include "IO.h"
+#include "Threads.h"
+#include "Time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum depth for which reference counts are recorded: */
+#define PERFT_MAX_REF 12
+
+/* Reference positions with their node counts at depths 1 through
+   PERFT_MAX_REF (or 0 where not recorded). The positions cover the placement
+   phase, the transition to the stacking phase (including the unique N'th
+   move), the stacking phase, and the end of the game (including passes). The
+   counts were obtained with the original (list-based) move generator. */
+static const struct PerftReference {
+	const char *state;  /* state description, as per ENCODING.txt */
+	long long counts[PERFT_MAX_REF];
+} perft_references[] = {
+	{ "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA",
+	  { 49, 2352, 110544, 5085024 } },
+	{ "BDACCCCCACCDDDACCCBCCBDDDDDCDDCDDDCCCDBDCADDDCCDDC",
+	  { 4, 12, 24, 24, 1380, 47740, 2705320 } },
+	{ "CDADCCDDDCACHCDCCCDDDGBDDCCCBDCCDDCBDDDCCAHGADCCCD",
+	  { 47, 1919, 90160, 3912255 } },
+	{ "CAAAACADDAAAKAGLHCADAABKAHCCBDCHDDCBDGKHCAHGADCACA",
+	  { 35, 1071, 35250, 987387 } },
+	{ "CAAAACAAAAAAKAGaAAAAAABKAHCCBAAHDDCBDGTHAAHGAAHACA",
+	  { 26, 481, 9645, 141417, 2104622 } },
+	{ "CAAAACAAAAAAKAAaAAAAAABTATACBAAHDDCBKPWAAAAGAAAAAA",
+	  { 12, 113, 928, 3470, 19040, 41930, 153732, 216828, 501196, 453764,
+	    745854, 422812 } } };
+
+#define PERFT_REFERENCES \
+	(int)(sizeof(perft_references)/sizeof(*perft_references))
+
+/* Maximum number of failures reported in detail: */
+#define MAX_REPORTS 10
+
+/* Number of failures detected by PERFT_CHECK (updated atomically): */
+static int failures = 0;
+
+#ifdef THREADS
+/* Serializes reporting of failures (format_state() is not thread-safe): */
+static pthread_mutex_t report_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Counts and reports a failed check for the given board. */
+static void report_failure(const Board *board, const char *what)
+{
+	if (__sync_fetch_and_add(&failures, 1) >= MAX_REPORTS) return;
+#ifdef THREADS
+	pthread_mutex_lock(&report_mutex);
+#endif
+	printf("Check failed (%s) in state: %s\n", what, format_state(board));
+#ifdef THREADS
+	pthread_mutex_unlock(&report_mutex);
+#endif
+}
+
+/* Returns whether the game is over, given the moves generated for the next
+   player: that is the case when neither player can move. */
+static bool game_over(const Board *board, const Move *moves, int nmove)
+{
+	return nmove == 1 && move_passes(&moves[0]) &&
+		generate_all_moves(board, NULL) == 0;
+}
+
+/* Verifies the board state and the moves generated for it. */
+static void check_position(const Board *board, const Move *moves, int nmove)
+{
+	int n;
+
+	if (!board_consistent(board)) report_failure(board, "inconsistent state");
+	for (n = 0; n < nmove; ++n) {
+		if (!valid_move(board, &moves[n])) {
+			report_failure(board, "generated move not valid");
+		}
+	}
+}
+
+/* Verifies that undoing a move restored the board to its original state. */
+static void check_undo(const Board *board, const Board *orig)
+{
+	if (memcmp(board, orig, sizeof(Board)) != 0) {
+		report_failure(orig, "undo did not restore state");
+	}
+}
+
+long long perft(Board *board, int depth, int flags)
+{
+	Move moves[M];
+	Board orig;
+	long long count = 0;
+	int n, nmove;
+
+	if (depth == 0) return 1;
+	nmove = generate_moves(board, moves);
+	if (game_over(board, moves, nmove)) return 0;
+	if ((flags & PERFT_CHECK)) {
+		check_position(board, moves, nmove);
+		memcpy(&orig, board, sizeof(Board));
+	}
+	if ((flags & PERFT_BULK) && depth == 1) return nmove;
+	for (n = 0; n < nmove; ++n) {
+		board_do(board, &moves[n]);
+		count += perft(board, depth - 1, flags);
+		board_undo(board, &moves[n]);
+		if ((flags & PERFT_CHECK)) check_undo(board, &orig);
+	}
+	return count;
+}
+
+/* Work shared by the threads of perft_parallel() and perft_playouts(): */
+typedef struct PerftTask {
+	const Board *board;  /* initial board */
+	const Move  *moves;  /* moves at the root (perft_parallel() only) */
+	int         count;   /* number of root moves or games */
+	int         next;    /* index of the next root move or game (atomic) */
+	int         depth;   /* search depth (perft_parallel() only) */
+	int         flags;   /* search flags (perft_parallel() only) */
+	unsigned    seed;    /* first RNG seed (perft_playouts() only) */
+} PerftTask;
+
+/* Result of a single thread: */
+typedef struct PerftWork {
+	PerftTask   *task;
+	long long   nodes;   /* number of leaf nodes or positions checked */
+} PerftWork;
+
+/* Runs one or more threads executing `func' on `task', and returns the sum of
+   the nodes counted by all threads. */
+static long long run_threads( void *(*func)(void *), PerftTask *task,
+	int nthread )
+{
+	PerftWork work[AI_MAX_THREADS];
+	long long nodes = 0;
+	int t;
+#ifdef THREADS
+	pthread_t threads[AI_MAX_THREADS];
+	bool running[AI_MAX_THREADS];
+#endif
+
+	if (nthread < 1) nthread = 1;
+	if (nthread > AI_MAX_THREADS) nthread = AI_MAX_THREADS;
+	for (t = 0; t < nthread; ++t) {
+		work[t].task  = task;
+		work[t].nodes = 0;
+	}
+#ifdef THREADS
+	for (t = 1; t < nthread; ++t) {
+		running[t] = pthread_create(&threads[t], NULL, func, &work[t]) == 0;
+	}
+	func(&work[0]);
+	for (t = 1; t < nthread; ++t) {
+		if (running[t]) {
+			pthread_join(threads[t], NULL);
+		} else {
+			func(&work[t]);  /* thread creation failed; run it here */
+		}
+	}
+#else
+	for (t = 0; t < nthread; ++t) func(&work[t]);
+#endif
+	for (t = 0; t < nthread; ++t) nodes += work[t].nodes;
+	return nodes;
+}
+
+/* Thread function for perft_parallel(): searches root moves. */
+static void *perft_worker(void *arg)
+{
+	PerftWork *work = arg;
+	PerftTask *task = work->task;
+	Board board;
+	int n;
+
+	memcpy(&board, task->board, sizeof(Board));
+	while ((n = __sync_fetch_and_add(&task->next, 1)) < task->count) {
+		board_do(&board, &task->moves[n]);
+		work->nodes += perft(&board, task->depth - 1, task->flags);
+		board_undo(&board, &task->moves[n]);
+	}
+	return NULL;
+}
+
+long long perft_parallel(const Board *board, int depth, int flags, int nthread)
+{
+	Move moves[M];
+	Board copy;
+	PerftTask task;
+
+	memcpy(&copy, board, sizeof(Board));
+	if (nthread <= 1 || depth <= 1) return perft(&copy, depth, flags);
+	task.count = generate_moves(&copy, moves);
+	if (game_over(&copy, moves, task.count)) return 0;
+	if ((flags & PERFT_CHECK)) check_position(&copy, moves, task.count);
+	task.board = board;
+	task.moves = moves;
+	task.next  = 0;
+	task.depth = depth;
+	task.flags = flags;
+	return run_threads(perft_worker, &task, nthread);
+}
+
+int perft_failures(void)
+{
+	return failures;
+}
+
+/* Returns the reference position for the given board, or NULL if none. */
+static const struct PerftReference *find_reference(const Board *board)
+{
+	const char *state = format_state(board);
+	int n;
+
+	for (n = 0; n < PERFT_REFERENCES; ++n) {
+		if (strcmp(perft_references[n].state, state) == 0) {
+			return &perft_references[n];
+		}
+	}
+	return NULL;
+}
+
+bool perft_run(const Board *board, int depth, int flags, int nthread)
+{
+	const struct PerftReference *ref = find_reference(board);
+	int old_failures = failures;
+	bool ok = true;
+	int d;
+
+	for (d = 1; d <= depth; ++d) {
+		double start = time_used(), used;
+		long long count = perft_parallel(board, d, flags, nthread);
+		long long expected = 0;
+
+		used = time_used() - start;
+		if (ref && d <= PERFT_MAX_REF) expected = ref->counts[d - 1];
+		printf("depth %2d: %12lld nodes in %8.3fs: %10.0f nodes/second%s\n",
+			d, count, used, used > 0 ? count/used : 0.0,
+			expected == 0 ? "" : expected == count ? " (ok)" : " (FAILED)");
+		if (expected != 0 && expected != count) ok = false;
+	}
+	return ok && failures == old_failures;
+}
+
+bool perft_check(int flags, int nthread)
+{
+	bool ok = true;
+	int n, depth;
+
+	for (n = 0; n < PERFT_REFERENCES; ++n) {
+		const struct PerftReference *ref = &perft_references[n];
+		Board board;
+		Color next_player;
+
+		if (!parse_state(ref->state, &board, &next_player)) {
+			printf("Couldn't parse state: `%s'!\n", ref->state);
+			ok = false;
+			continue;
+		}
+		depth = PERFT_MAX_REF;
+		while (depth > 0 && ref->counts[depth - 1] == 0) --depth;
+		printf("%s\n", ref->state);
+		if (!perft_run(&board, depth, flags, nthread)) ok = false;
+	}
+	printf("%s\n", ok ? "All counts verified." : "Verification FAILED!");
+	return ok;
+}
+
+/* Thread function for perft_playouts(): plays random games, and checks every
+   position reached and the result of every move available. */
+static void *playout_worker(void *arg)
+{
+	PerftWork *work = arg;
+	PerftTask *task = work->task;
+	Move moves[M];
+	Board board, orig;
+	unsigned seed;
+	int n, nmove, game;
+
+	while ((game = __sync_fetch_and_add(&task->next, 1)) < task->count) {
+		seed = task->seed + game;
+		memcpy(&board, task->board, sizeof(Board));
+		for (;;) {
+			nmove = generate_moves(&board, moves);
+			if (game_over(&board, moves, nmove)) break;
+			check_position(&board, moves, nmove);
+			memcpy(&orig, &board, sizeof(Board));
+			for (n = 0; n < nmove; ++n) {
+				board_do(&board, &moves[n]);
+				if (!board_consistent(&board)) {
+					report_failure(&orig, "inconsistent state after move");
+				}
+				board_undo(&board, &moves[n]);
+				check_undo(&board, &orig);
+			}
+			board_do(&board, &moves[rand_r(&seed)%nmove]);
+			++work->nodes;
+		}
+	}
+	return NULL;
+}
+
+bool perft_playouts(const Board *board, int games, unsigned seed, int nthread)
+{
+	int old_failures = failures;
+	double start = time_used(), used;
+	long long nodes;
+	PerftTask task;
+
+	task.board = board;
+	task.count = games;
+	task.next  = 0;
+	task.seed  = seed;
+	nodes = run_threads(playout_worker, &task, nthread);
+	used = time_used() - start;
+	printf("%d games (%lld positions) checked in %.3fs using %d thread%s: "
+		"%.0f positions/second\n", games, nodes, used, nthread,
+		nthread == 1 ? "" : "s", used > 0 ? nodes/used : 0.0);
+	if (failures != old_failures) {
+		printf("%d checks FAILED!\n", failures - old_failures);
+		return false;
+	}
+	printf("All checks passed.\n");
+	return true;
+}
+
+#ifdef ZOBRIST
+/* A position reached by perft_hashes(), with its Zobrist hash: */
+typedef struct PerftHash {
+	hash_t        hash;
+	unsigned char data[50];  /* serialized board */
+} PerftHash;
+
+/* Orders positions by the lower 32 bits of their hash, then by the upper
+   bits, then by contents, so that positions sharing either the full hash or
+   its lower half are adjacent. */
+static int perft_hash_cmp(const void *a, const void *b)
+{
+	const PerftHash *p = a, *q = b;
+	unsigned lo_p = (unsigned)p->hash, lo_q = (unsigned)q->hash;
+
+	if (lo_p != lo_q) return lo_p < lo_q ? -1 : 1;
+	if (p->hash != q->hash) return p->hash < q->hash ? -1 : 1;
+	return memcmp(p->data, q->data, 50);
+}
+
+bool perft_hashes(int games, unsigned seed)
+{
+	PerftHash *positions;
+	Move moves[M];
+	Board board;
+	size_t npos = 0, cap = (size_t)games*(N + N), i, distinct = 0;
+	long long collisions64 = 0, collisions32 = 0;
+	double start = time_used(), used;
+	int game, nmove;
+
+	positions = malloc(cap*sizeof(PerftHash));
+	if (positions == NULL) {
+		fprintf(stderr, "Failed to allocate memory for %d games!\n", games);
+		return false;
+	}
+	for (game = 0; game < games; ++game) {
+		unsigned game_seed = seed + game;
+
+		board_clear(&board);
+		for (;;) {
+			nmove = generate_moves(&board, moves);
+			if (game_over(&board, moves, nmove)) break;
+			if (!move_passes(&moves[0])) {  /* passes repeat the position */
+				positions[npos].hash = zobrist_hash(&board);
+				serialize_board(&board, positions[npos++].data);
+			}
+			board_do(&board, &moves[rand_r(&game_seed)%nmove]);
+		}
+	}
+	used = time_used() - start;
+	qsort(positions, npos, sizeof(PerftHash), perft_hash_cmp);
+
+	/* Count distinct positions, and those that share their hash (or its
+	   lower half) with a different position that precedes them: */
+	for (i = 0; i < npos; ++i) {
+		if (i > 0 && memcmp(positions[i].data, positions[i - 1].data, 50) == 0) {
+			continue;
+		}
+		++distinct;
+		if (i > 0 && (unsigned)positions[i].hash ==
+		             (unsigned)positions[i - 1].hash) {
+			++collisions32;
+			if (positions[i].hash == positions[i - 1].hash) ++collisions64;
+		}
+	}
+	free(positions);
+	printf("%d games (%lu positions, %lu distinct) played in %.3fs\n",
+		games, (unsigned long)npos, (unsigned long)distinct, used);
+	printf("Collisions: %lld with 64-bit hashes, %lld with 32-bit hashes "
+		"(%.1f expected)\n", collisions64, collisions32,
+		0.5*distinct*(distinct - 1)/4294967296.0);
+	return collisions64 == 0;
+}
+#endif /* def ZOBRIST */
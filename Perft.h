@@ -0,0 +1,61 @@
+#ifndef PERFT_H_INCLUDED
+#define PERFT_H_INCLUDED
+
+#include "Game.h"
+
+/* Flags for the functions below: */
+#define PERFT_BULK   1  /* count moves at the last ply without executing them */
+#define PERFT_CHECK  2  /* verify the board state at every node */
+
+/* Counts the number of move sequences of exactly `depth' moves that can be
+   played from the given board (i.e. the number of leaf nodes of the game tree
+   truncated at the given depth). Passes count as moves, but sequences that end
+   the game before `depth' moves have been played are not counted.
+
+   With PERFT_BULK, the moves at the last ply are counted without executing
+   them, which is much faster, but exercises board_do()/board_undo() less.
+
+   With PERFT_CHECK, every interior node is verified: the incrementally updated
+   state must match the recomputed state (see board_consistent()), all moves
+   generated must be accepted by valid_move(), and board_undo() must restore
+   the board exactly. Failures are reported on stdout and counted (see
+   perft_failures()).
+
+   The board is restored to its original state before returning. */
+long long perft(Board *board, int depth, int flags);
+
+/* Same as perft(), but divides the moves at the root between `nthread'
+   threads (if the program was compiled with THREADS). */
+long long perft_parallel(const Board *board, int depth, int flags, int nthread);
+
+/* Returns the number of failures detected with PERFT_CHECK so far. */
+int perft_failures(void);
+
+/* Runs perft_parallel() on the given board for depths 1 through `depth',
+   printing the node count, time used and nodes per second for each depth. If
+   the board is one of the reference positions used by perft_check(), the
+   counts are verified too. Returns false if verification failed. */
+bool perft_run(const Board *board, int depth, int flags, int nthread);
+
+/* Verifies perft() against precomputed node counts for a set of reference
+   positions, and prints the results. Returns false if any count differed. */
+bool perft_check(int flags, int nthread);
+
+/* Plays `games' random games from the given board (each using its own RNG
+   seed, starting from `seed') divided between `nthread' threads, and verifies
+   every position reached and every move available, as perft() does with
+   PERFT_CHECK. Prints the number of positions checked per second, and returns
+   false if any check failed. */
+bool perft_playouts(const Board *board, int games, unsigned seed, int nthread);
+
+#ifdef ZOBRIST
+/* Plays `games' random games (using RNG seeds starting from `seed') and checks
+   the Zobrist hashes of all distinct positions reached for collisions, both
+   with the full 64-bit hashes and with their lower 32 bits (as a table of
+   32-bit keys would give), and prints the number of collisions found and the
+   number expected for random 32-bit hashes. Returns false if any positions
+   share a 64-bit hash. */
+bool perft_hashes(int games, unsigned seed);
+#endif
+
+#endif /* ndef PERFT_H_INCLUDED */
@@ -0,0 +1,59 @@
+#include "Predict.h"
+#include <math.h>
+
+/* Prior estimate of the ratio and the standard deviation of its logarithm: */
+#define PRIOR_RATIO    4.0
+#define PRIOR_LOG_SD   0.7
+
+/* Weight of the prior, and maximum weight of past observations (so that the
+   model adapts to changes in the game): */
+#define PRIOR_WEIGHT   2.0
+#define MAX_WEIGHT    20.0
+
+/* Number of standard deviations used for the upper bound of the confidence
+   interval (1.28 gives a one-sided 90% interval): */
+#define CONFIDENCE     1.28
+
+/* Returns the index of the game phase of the given board. */
+static int predict_phase(const Board *board)
+{
+	return __builtin_popcountll(board->alive)*PREDICT_PHASES/(N + 1);
+}
+
+void predict_reset(Predictor *model)
+{
+	int p, q;
+
+	for (p = 0; p < 2; ++p) {
+		for (q = 0; q < PREDICT_PHASES; ++q) {
+			model->estimates[p][q].weight = PRIOR_WEIGHT;
+			model->estimates[p][q].mean   = log(PRIOR_RATIO);
+			model->estimates[p][q].var    = PRIOR_LOG_SD*PRIOR_LOG_SD;
+		}
+	}
+}
+
+void predict_update( Predictor *model, const Board *board, int depth,
+	double ratio )
+{
+	PredictEstimate *e;
+	double x, delta;
+
+	if (!(ratio > 0)) return;
+	x = log(ratio);
+	e = &model->estimates[depth&1][predict_phase(board)];
+	delta = x - e->mean;
+	if (e->weight < MAX_WEIGHT) e->weight += 1;
+	e->mean += delta/e->weight;
+	e->var  += (delta*(x - e->mean) - e->var)/e->weight;
+}
+
+double predict_ratio( const Predictor *model, const Board *board, int depth,
+	double *upper )
+{
+	const PredictEstimate *e =
+		&model->estimates[depth&1][predict_phase(board)];
+
+	if (upper) *upper = exp(e->mean + CONFIDENCE*sqrt(e->var));
+	return exp(e->mean);
+}
@@ -0,0 +1,48 @@
+#ifndef PREDICT_H_INCLUDED
+#define PREDICT_H_INCLUDED
+
+#include "Game.h"
+
+/* Model of the growth of the search tree between consecutive iterations of
+   iterative deepening, used to predict how long the next iteration will take.
+
+   The model keeps a running estimate of the mean and variance of the logarithm
+   of the ratio between the number of nodes searched by consecutive iterations
+   (i.e. of the effective branching factor), separately for odd and even depths
+   (since alpha-beta search trees grow unevenly) and for different phases of
+   the game (measured by the number of fields left). Estimates start from a
+   prior and are updated online after every completed iteration, with older
+   observations gradually forgotten.
+
+   Each engine has its own model, since the growth of the tree depends on the
+   search parameters; a model must not be used by several threads at once. */
+
+/* Number of game phases distinguished by the model: */
+#define PREDICT_PHASES 5
+
+/* Running estimate for one combination of depth parity and game phase: */
+typedef struct PredictEstimate {
+	double weight;  /* total weight of observations */
+	double mean;    /* mean of the logarithm of the ratio */
+	double var;     /* variance of the logarithm of the ratio */
+} PredictEstimate;
+
+typedef struct Predictor {
+	PredictEstimate estimates[2][PREDICT_PHASES];
+} Predictor;
+
+/* Resets the model to the prior. */
+void predict_reset(Predictor *model);
+
+/* Records that searching `board' to depth `depth' took `ratio' times as many
+   nodes as searching it to depth `depth - 1'. */
+void predict_update( Predictor *model, const Board *board, int depth,
+	double ratio );
+
+/* Predicts the ratio between the number of nodes searched to depth `depth'
+   and to depth `depth - 1' for the given board. Returns the expected ratio,
+   and stores the upper bound of its confidence interval in *upper. */
+double predict_ratio( const Predictor *model, const Board *board, int depth,
+	double *upper );
+
+#endif /* ndef PREDICT_H_INCLUDED */
@@ -0,0 +1,319 @@
+#include "Record.h"
+#include "IO.h"
+#include "Time.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Maximum length of a line in a game log: */
+#define RECORD_MAX_LINE 1024
+
+bool record_write_header(FILE *fp)
+{
+	unsigned char header[RECORD_HEADER_SIZE] = { 0 };
+
+	memcpy(header, RECORD_MAGIC, 4);
+	header[4] = RECORD_VERSION;
+	return fwrite(header, RECORD_HEADER_SIZE, 1, fp) == 1;
+}
+
+bool record_write_game(FILE *fp, const Move *moves, int nmove)
+{
+	unsigned char data[RECORD_GAME_HEADER_SIZE + RECORD_MAX_PLIES];
+	Move options[M];
+	Board board;
+	int n, i, noption, scores[2];
+
+	if (nmove > RECORD_MAX_PLIES) return false;
+	board_clear(&board);
+	for (n = 0; n < nmove; ++n) {
+		if (generate_all_moves(&board, NULL) == 0) return false;
+		noption = generate_moves(&board, options);
+		for (i = 0; i < noption; ++i) {
+			if (move_compare(&options[i], &moves[n]) == 0) break;
+		}
+		if (i == noption) return false;
+		data[RECORD_GAME_HEADER_SIZE + n] = (unsigned char)i;
+		board_do(&board, &moves[n]);
+	}
+	board_scores(&board, scores);
+	data[0] = (unsigned char)(nmove & 255);
+	data[1] = (unsigned char)(nmove >> 8);
+	data[2] = (unsigned char)scores[WHITE];
+	data[3] = (unsigned char)scores[BLACK];
+	return fwrite(data, RECORD_GAME_HEADER_SIZE + nmove, 1, fp) == 1;
+}
+
+/* Reads the moves of a game log from `fp' into `moves' (which has room for
+   RECORD_MAX_PLIES moves) and returns their number, or -1 if the log contains
+   a word that is not a valid move string, or too many moves. */
+static int record_read_log(FILE *fp, Move *moves)
+{
+	char line[RECORD_MAX_LINE], *word;
+	int nmove = 0;
+
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		if (line[0] == '#') continue;
+		for ( word = strtok(line, " \t\r\n"); word != NULL;
+		      word = strtok(NULL, " \t\r\n") ) {
+			if (nmove == RECORD_MAX_PLIES) return -1;
+			if (!parse_move(word, &moves[nmove++])) return -1;
+		}
+	}
+	return nmove;
+}
+
+bool record_convert(const char *output, char *const paths[], int npath)
+{
+	Move moves[RECORD_MAX_PLIES];
+	FILE *out, *fp;
+	int n, nmove, games = 0, skipped = 0;
+	long long plies = 0;
+
+	out = fopen(output, "wb");
+	if (out == NULL || !record_write_header(out)) {
+		perror(output);
+		if (out != NULL) fclose(out);
+		return false;
+	}
+	for (n = 0; n < npath; ++n) {
+		fp = fopen(paths[n], "rt");
+		if (fp == NULL) {
+			perror(paths[n]);
+			++skipped;
+			continue;
+		}
+		nmove = record_read_log(fp, moves);
+		fclose(fp);
+		if (nmove < 0 || !record_write_game(out, moves, nmove)) {
+			fprintf(stderr, "%s: invalid game log!\n", paths[n]);
+			++skipped;
+			continue;
+		}
+		++games;
+		plies += nmove;
+	}
+	if (fclose(out) != 0) {
+		perror(output);
+		return false;
+	}
+	printf("%d games (%lld moves) written to %s; %d logs skipped\n",
+		games, plies, output, skipped);
+	return true;
+}
+
+bool record_open(RecordFile *rf, const char *path)
+{
+	struct stat st;
+	void *data;
+	int fd;
+
+	memset(rf, 0, sizeof(RecordFile));
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) != 0) {
+		perror(path);
+		if (fd >= 0) close(fd);
+		return false;
+	}
+	if ( st.st_size < RECORD_HEADER_SIZE ||
+	     (data = mmap( NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+	                   fd, 0 )) == MAP_FAILED ) {
+		fprintf(stderr, "%s: could not map record file!\n", path);
+		close(fd);
+		return false;
+	}
+	close(fd);
+	rf->data = data;
+	rf->size = (size_t)st.st_size;
+	rf->pos  = RECORD_HEADER_SIZE;
+	if ( memcmp(rf->data, RECORD_MAGIC, 4) != 0 ||
+	     rf->data[4] != RECORD_VERSION ) {
+		fprintf(stderr, "%s: not a record file!\n", path);
+		record_close(rf);
+		return false;
+	}
+	/* Games are read sequentially: */
+	madvise((void*)rf->data, rf->size, MADV_SEQUENTIAL);
+	return true;
+}
+
+void record_close(RecordFile *rf)
+{
+	if (rf->data != NULL) munmap((void*)rf->data, rf->size);
+	memset(rf, 0, sizeof(RecordFile));
+}
+
+bool record_next(RecordFile *rf, RecordGame *game)
+{
+	const unsigned char *p = rf->data + rf->pos;
+
+	if (rf->size - rf->pos < RECORD_GAME_HEADER_SIZE) return false;
+	game->plies     = p[0] | (p[1] << 8);
+	game->scores[0] = p[2];
+	game->scores[1] = p[3];
+	game->moves     = p + RECORD_GAME_HEADER_SIZE;
+	if ( (size_t)game->plies >
+	     rf->size - rf->pos - RECORD_GAME_HEADER_SIZE ) return false;
+	rf->pos += RECORD_GAME_HEADER_SIZE + game->plies;
+	return true;
+}
+
+bool record_move(const Board *board, int index, Move *move)
+{
+	Move moves[M];
+
+	if (index >= generate_moves(board, moves)) return false;
+	*move = moves[index];
+	return true;
+}
+
+bool record_replay(const RecordGame *game, Board *board)
+{
+	Move move;
+	int n;
+
+	board_clear(board);
+	for (n = 0; n < game->plies; ++n) {
+		if (!record_move(board, game->moves[n], &move)) return false;
+		board_do(board, &move);
+	}
+	return true;
+}
+
+bool record_check(const char *path)
+{
+	RecordFile rf;
+	RecordGame game;
+	Board board;
+	int scores[2], games = 0, failures = 0;
+	long long plies = 0;
+	double start = time_used(), used;
+
+	if (!record_open(&rf, path)) return false;
+	while (record_next(&rf, &game)) {
+		if (!record_replay(&game, &board)) {
+			fprintf(stderr, "Game %d: invalid move index after %d moves!\n",
+				games + 1, board.moves);
+			++failures;
+		} else {
+			board_scores(&board, scores);
+			if (scores[0] != game.scores[0] || scores[1] != game.scores[1]) {
+				fprintf(stderr, "Game %d: scores differ!\n", games + 1);
+				++failures;
+			}
+		}
+		++games;
+		plies += game.plies;
+	}
+	used = time_used() - start;
+	if (rf.pos != rf.size) {
+		fprintf(stderr, "%s: truncated game at offset %lu!\n",
+			path, (unsigned long)rf.pos);
+		++failures;
+	}
+	record_close(&rf);
+	printf("%d games (%lld moves) replayed in %.3fs: %.0f moves/second\n",
+		games, plies, used, used > 0 ? plies/used : 0.0);
+	if (failures > 0) {
+		printf("%d games FAILED!\n", failures);
+		return false;
+	}
+	printf("All games verified.\n");
+	return true;
+}
+
+/* Plays a game for record_test() and stores its moves in `moves' (which has
+   room for RECORD_MAX_PLIES moves). With `prolong' set, each player picks
+   a move that removes as few fields as possible, which makes for longer games
+   than random play. Returns the number of moves, or -1 if the game did not
+   fit in RECORD_MAX_PLIES moves. */
+static int record_test_game(Move *moves, bool prolong, unsigned *seed)
+{
+	Move options[M];
+	Board board;
+	int nmove = 0, noption, n, best, alive, best_alive;
+
+	board_clear(&board);
+	while (generate_all_moves(&board, NULL) > 0) {
+		if (nmove == RECORD_MAX_PLIES) return -1;
+		noption = generate_moves(&board, options);
+		best = rand_r(seed)%noption;
+		if (prolong && board.moves >= N) {
+			best_alive = -1;
+			for (n = 0; n < noption; ++n) {
+				board_do(&board, &options[(best + n)%noption]);
+				alive = __builtin_popcountll(board.alive);
+				board_undo(&board, &options[(best + n)%noption]);
+				if (alive > best_alive) {
+					best_alive = alive;
+					best = (best + n)%noption;
+				}
+			}
+		}
+		moves[nmove++] = options[best];
+		board_do(&board, &options[best]);
+	}
+	return nmove;
+}
+
+bool record_test(int games, unsigned seed)
+{
+	Move moves[RECORD_MAX_PLIES], longest[RECORD_MAX_PLIES], move;
+	char path[] = "/tmp/record-test-XXXXXX";
+	RecordFile rf;
+	RecordGame game;
+	Board board;
+	FILE *fp;
+	int n, nmove, nlongest = 0, scores[2], fd;
+	bool ok;
+
+	/* Find the longest game: */
+	for (n = 0; n < games; ++n) {
+		nmove = record_test_game(moves, n%2 == 0, &seed);
+		if (nmove < 0) {
+			printf("Game %d is longer than %d moves!\n", n + 1,
+				RECORD_MAX_PLIES);
+			return false;
+		}
+		if (nmove > nlongest) {
+			memcpy(longest, moves, nmove*sizeof(Move));
+			nlongest = nmove;
+		}
+	}
+	printf("Longest of %d games has %d moves (at most %d allowed).\n",
+		games, nlongest, RECORD_MAX_PLIES);
+
+	/* Write it to a temporary record file, and read it back: */
+	fd = mkstemp(path);
+	if (fd < 0 || (fp = fdopen(fd, "wb")) == NULL) {
+		perror(path);
+		if (fd >= 0) close(fd);
+		return false;
+	}
+	ok = record_write_header(fp) && record_write_game(fp, longest, nlongest);
+	if (fclose(fp) != 0) ok = false;
+	if (!ok) {
+		perror(path);
+	} else if (record_open(&rf, path)) {
+		ok = record_next(&rf, &game) && game.plies == nlongest;
+		board_clear(&board);
+		for (n = 0; ok && n < game.plies; ++n) {
+			ok = record_move(&board, game.moves[n], &move) &&
+			     move_compare(&move, &longest[n]) == 0;
+			if (ok) board_do(&board, &move);
+		}
+		board_scores(&board, scores);
+		ok = ok && scores[0] == game.scores[0] &&
+		     scores[1] == game.scores[1] && !record_next(&rf, &game);
+		record_close(&rf);
+		printf("%s\n", ok ? "Record verified." : "Record FAILED!");
+	} else {
+		ok = false;
+	}
+	unlink(path);
+	return ok;
+}
@@ -0,0 +1,100 @@
+#ifndef RECORD_H_INCLUDED
+#define RECORD_H_INCLUDED
+
+#include "Game.h"
+#include <stdio.h>
+
+/* Game records are stored in a compact binary format, so that large numbers
+   of games can be replayed quickly (e.g. to generate training data or to build
+   an opening book) without parsing move strings. A record file starts with a
+   file header:
+
+	"DVNR"      magic number (4 bytes)
+	<version>   format version (1 byte, currently RECORD_VERSION)
+	<reserved>  3 bytes, zero
+
+   followed by any number of games, each consisting of a game header:
+
+	<plies>     number of moves played (2 bytes, little-endian)
+	<scores>    final scores of white and black (1 byte each)
+
+   and one byte per move: the index of the move in the list returned by
+   generate_moves() in the position in which it was played. That list is
+   ordered by source and destination field (and contains only a pass when the
+   player must pass), so all indices are less than M. Games start from the
+   empty board, but need not be finished (e.g. if a player failed); the scores
+   are those of the last position. */
+
+#define RECORD_MAGIC            "DVNR"
+#define RECORD_VERSION          1
+#define RECORD_HEADER_SIZE      8   /* size of the file header */
+#define RECORD_GAME_HEADER_SIZE 4   /* size of a game header */
+
+/* Upper bound on the number of moves in a game: N placing moves, fewer than
+   N stacking moves (each of which reduces the number of stacks) and at most
+   one pass before each stacking move and at the end. */
+#define RECORD_MAX_PLIES (3*N)
+
+/* A record file that has been mapped into memory for reading: */
+typedef struct RecordFile {
+	const unsigned char *data;  /* contents of the file */
+	size_t              size;   /* size of the file */
+	size_t              pos;    /* offset of the next game */
+} RecordFile;
+
+/* A game read from a record file: */
+typedef struct RecordGame {
+	int                 plies;      /* number of moves played */
+	int                 scores[2];  /* scores of white and black at the end */
+	const unsigned char *moves;     /* move indices (in the mapped file) */
+} RecordGame;
+
+/* Writes the file header of a record file to `fp'. Returns false if writing
+   failed. */
+bool record_write_header(FILE *fp);
+
+/* Encodes the game consisting of the `nmove' moves given (played from the
+   empty board) and writes it to `fp'. Returns false if one of the moves is not
+   valid, or if writing failed. */
+bool record_write_game(FILE *fp, const Move *moves, int nmove);
+
+/* Converts games logs in the format written by the arbiter (moves separated
+   by whitespace, with lines starting with '#' ignored) at the given paths to
+   a record file written at `output', with one game per log. Logs that cannot
+   be read or contain invalid moves are reported and skipped. Returns false if
+   the output file could not be written. */
+bool record_convert(const char *output, char *const paths[], int npath);
+
+/* Maps the record file at `path' into memory and verifies its header. Returns
+   false (and reports the reason) if the file could not be opened. */
+bool record_open(RecordFile *rf, const char *path);
+
+/* Unmaps a record file opened with record_open(). */
+void record_close(RecordFile *rf);
+
+/* Reads the next game from a record file. Returns false at the end of the
+   file, or if the rest of the file does not contain a complete game. */
+bool record_next(RecordFile *rf, RecordGame *game);
+
+/* Decodes the move with the given index in the position `board', and stores
+   it in `*move'. Returns false if the index is out of range. */
+bool record_move(const Board *board, int index, Move *move);
+
+/* Replays all moves of `game' on `board', which is cleared first. Returns false
+   if a move index is invalid (in which case the board is left at the position
+   in which it occurred). */
+bool record_replay(const RecordGame *game, Board *board);
+
+/* Replays all games in the record file at `path', verifies their scores, and
+   prints the number of games and moves replayed per second. Returns false if
+   the file could not be read or contains invalid games. */
+bool record_check(const char *path);
+
+/* Plays `games' games (alternately random ones, and ones in which players
+   avoid removing fields, which last longer; using RNG seed `seed'), verifies
+   that each fits in RECORD_MAX_PLIES moves, and writes the longest one to a
+   temporary record file, which is read back and verified. Returns false if
+   any check failed. */
+bool record_test(int games, unsigned seed);
+
+#endif /* ndef RECORD_H_INCLUDED */
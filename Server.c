@@ -0,0 +1,257 @@
+#include "Server.h"
+#include "AI.h"
+#include "Budget.h"
+#include "IO.h"
+#include "Telemetry.h"
+#include "Time.h"
+#include <signal.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/* Characters separating the words of a command: */
+#define SEPARATORS " \t\r\n"
+
+/* State of a single session: */
+typedef struct Session {
+	AI_Engine *engine;     /* engine used to search */
+	FILE      *out;        /* replies are written here */
+	Board     board;       /* current game state */
+	double    game_time;   /* default time on the game clock */
+} Session;
+
+/* Writes a reply line to the client. */
+static void reply(Session *session, const char *fmt, ...)
+	__attribute__((format(printf, 2, 3)));
+
+static void reply(Session *session, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(session->out, fmt, ap);
+	va_end(ap);
+	fputc('\n', session->out);
+	fflush(session->out);
+}
+
+/* Parses and executes a move on `board' (the session's board, or a copy). */
+static bool execute_move(Session *session, Board *board, const char *text)
+{
+	Move move;
+
+	if (!parse_move(text, &move)) {
+		reply(session, "error could not parse move: %s", text);
+		return false;
+	}
+	if (!valid_move(board, &move)) {
+		reply(session, "error invalid move: %s", text);
+		return false;
+	}
+	board_do(board, &move);
+	return true;
+}
+
+/* Handles "newgame [time=<s>]". */
+static void cmd_newgame(Session *session)
+{
+	double game_time = session->game_time;
+	const char *arg;
+
+	while ((arg = strtok(NULL, SEPARATORS)) != NULL) {
+		if (sscanf(arg, "time=%lf", &game_time) != 1) {
+			reply(session, "error invalid argument: %s", arg);
+			return;
+		}
+	}
+	time_limit = game_time;
+	ai_reset(session->engine);
+	board_clear(&session->board);
+	time_new_game();
+	reply(session, "ok");
+}
+
+/* Handles "position <state> [moves <move>..]". The session's board is only
+   changed if the state and all moves are valid. */
+static void cmd_position(Session *session)
+{
+	const char *arg = strtok(NULL, SEPARATORS);
+	Color next_player;
+	Board board;
+
+	if (arg == NULL) {
+		reply(session, "error missing state");
+		return;
+	}
+	if (!parse_state(arg, &board, &next_player)) {
+		reply(session, "error could not parse state: %s", arg);
+		return;
+	}
+	arg = strtok(NULL, SEPARATORS);
+	if (arg != NULL) {
+		if (strcmp(arg, "moves") != 0) {
+			reply(session, "error invalid argument: %s", arg);
+			return;
+		}
+		while ((arg = strtok(NULL, SEPARATORS)) != NULL) {
+			if (!execute_move(session, &board, arg)) return;
+		}
+	}
+	memcpy(&session->board, &board, sizeof(Board));
+	reply(session, "ok");
+}
+
+/* Handles "move <move>". */
+static void cmd_move(Session *session)
+{
+	const char *arg = strtok(NULL, SEPARATORS);
+
+	if (arg == NULL) {
+		reply(session, "error missing move");
+	} else if (execute_move(session, &session->board, arg)) {
+		reply(session, "ok");
+	}
+}
+
+/* Handles "go [depth=<d>] [eval=<n>] [time=<s>] [left=<s>]". */
+static void cmd_go(Session *session)
+{
+	Board *board = &session->board;
+	AI_Limit limit = { 0, 0, 0.0 };
+	AI_Result result;
+	Budget budget;
+	double left = -1;
+	const char *arg;
+
+	while ((arg = strtok(NULL, SEPARATORS)) != NULL) {
+		if (sscanf(arg, "depth=%d", &limit.depth) == 1) continue;
+		if (sscanf(arg, "eval=%d", &limit.eval) == 1) continue;
+		if (sscanf(arg, "time=%lf", &limit.time) == 1) continue;
+		if (sscanf(arg, "left=%lf", &left) == 1) continue;
+		reply(session, "error invalid argument: %s", arg);
+		return;
+	}
+	if (generate_all_moves(board, NULL) == 0) {
+		reply(session, "error game over");
+		return;
+	}
+	if (!limit.time && !limit.depth && !limit.eval) {
+		if (left < 0) left = time_left();
+		if (budget_limit(board, left, &limit, &budget)) {
+			telemetry_budget(board, &budget);
+		}
+	}
+	if (!ai_select_move(session->engine, board, &limit, &result)) {
+		reply(session, "error no move selected");
+		return;
+	}
+	telemetry_search(session->engine, board, &limit, &result);
+	board_do(board, &result.move);
+	reply(session, "bestmove %s value "VAL_FMT" depth %d nodes %d time %.3f",
+		format_move(&result.move), result.value, result.depth, result.nodes,
+		result.time);
+}
+
+bool server_run(AI_Engine *engine, FILE *in, FILE *out, double game_time)
+{
+	Session session;
+	char line[1024];
+	const char *cmd;
+
+	session.engine = engine;
+	session.out = out;
+	session.game_time = game_time;
+	time_limit = game_time;
+	ai_reset(engine);
+	board_clear(&session.board);
+	time_new_game();
+	for (;;) {
+		time_stop();
+		if (fgets(line, sizeof(line), in) == NULL) return true;
+		time_start();
+		cmd = strtok(line, SEPARATORS);
+		if (cmd == NULL) continue;
+		if (strcmp(cmd, "newgame") == 0) {
+			cmd_newgame(&session);
+		} else if (strcmp(cmd, "position") == 0) {
+			cmd_position(&session);
+		} else if (strcmp(cmd, "move") == 0) {
+			cmd_move(&session);
+		} else if (strcmp(cmd, "go") == 0) {
+			cmd_go(&session);
+		} else if (strcmp(cmd, "state") == 0) {
+			reply(&session, "state %s", format_state(&session.board));
+		} else if (strcmp(cmd, "quit") == 0) {
+			return true;
+		} else if (strcmp(cmd, "shutdown") == 0) {
+			return false;
+		} else {
+			reply(&session, "error unknown command: %s", cmd);
+		}
+	}
+}
+
+int server_socket(const char *path)
+{
+	struct sockaddr_un addr;
+	int fd;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "Socket path too long: %s!\n", path);
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		perror("socket");
+		return -1;
+	}
+	unlink(path);
+	if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+		listen(fd, 8) != 0) {
+		perror(path);
+		close(fd);
+		return -1;
+	}
+	signal(SIGPIPE, SIG_IGN);  /* clients may disconnect at any time */
+	fprintf(stderr, "Listening on %s.\n", path);
+	return fd;
+}
+
+bool server_listen(AI_Engine *engine, const char *path, double game_time)
+{
+	int fd = server_socket(path), conn;
+	bool running = true;
+
+	if (fd < 0) return false;
+	while (running) {
+		FILE *in, *out;
+
+		conn = accept(fd, NULL, NULL);
+		if (conn < 0) {
+			perror("accept");
+			continue;
+		}
+		in  = fdopen(conn, "r");
+		out = fdopen(dup(conn), "w");
+		if (in == NULL || out == NULL) {
+			perror("fdopen");
+			if (in != NULL) fclose(in);
+			if (out != NULL) fclose(out);
+			continue;
+		}
+		fprintf(stderr, "Session started.\n");
+		running = server_run(engine, in, out, game_time);
+		fprintf(stderr, "Session ended.\n");
+		fclose(in);
+		fclose(out);
+	}
+	close(fd);
+	unlink(path);
+	return true;
+}
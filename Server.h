@@ -0,0 +1,52 @@
+#ifndef SERVER_H_INCLUDED
+#define SERVER_H_INCLUDED
+
+#include "AI.h"
+#include <stdio.h>
+
+/* Server mode plays any number of games in a single process, so that the
+   transposition table and other tables are allocated and initialized only
+   once. Commands are read one per line, and each is answered with one line:
+   either a result as described below, or "error <message>".
+
+	newgame [time=<s>]      Starts a new game from the initial position, with
+	                        a game clock of <s> seconds (default: the time
+	                        passed to the server). Resets the engine and
+	                        clears its transposition table. Answers "ok".
+	position <state> [moves <move>..]
+	                        Sets up the board as described by <state> (see
+	                        ENCODING.txt) and then executes the given moves.
+	                        Answers "ok".
+	move <move>             Executes a move on the board. Answers "ok".
+	go [depth=<d>] [eval=<n>] [time=<s>] [left=<s>]
+	                        Searches for the best move with the given limits,
+	                        executes it, and answers "bestmove <move> value
+	                        <value> depth <depth> nodes <nodes> time <time>".
+	                        Without depth, eval or time limits, the limits are
+	                        those used in matches (see budget_limit()), based
+	                        on the time left on the game clock, or <s> if left
+	                        is given.
+	state                   Answers "state <state>" for the current board.
+	quit                    Ends the session.
+	shutdown                Ends the session and stops the server.
+
+   The game clock runs only while commands are being processed, like the
+   clock of the player during a match. Each session starts as if "newgame"
+   had been given. */
+
+/* Serves a single session, searching with `engine', reading commands from `in'
+   and writing replies to `out', with `game_time' seconds on the game clock by
+   default. Returns false if the session ended with "shutdown". */
+bool server_run(AI_Engine *engine, FILE *in, FILE *out, double game_time);
+
+/* Listens on a UNIX domain socket created at `path' and serves one session
+   per connection (one at a time) with the given engine, until a session ends
+   with "shutdown". Returns false if the socket could not be set up. */
+bool server_listen(AI_Engine *engine, const char *path, double game_time);
+
+/* Creates a UNIX domain socket at `path' (replacing any existing file) and
+   listens on it. Returns the socket's file descriptor, or -1 on failure (after
+   printing an error message). */
+int server_socket(const char *path);
+
+#endif /* ndef SERVER_H_INCLUDED */
@@ -1,44 +1,42 @@
 #include "TT.h"
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
-TTEntry *tt;
-#ifndef FIXED_PARAMS
-size_t tt_size;
-#endif
-
 #ifdef TT_DEBUG
 TTStats tt_stats;
 #endif
 
-void tt_init(size_t size)
+void tt_init(TTable *tt, size_t size)
 {
 	assert(size > 0);
-	assert(tt == NULL);
 	assert((size & (size - 1)) == 0);  /* size should be a power of 2 */
 	if (size < 1024) size = 1024;
-	while (tt == NULL && size >= 1024) {
-		tt = calloc(size, sizeof(TTEntry));
-		if (tt == NULL) {
+	tt->entries = NULL;
+	while (tt->entries == NULL && size >= 1024) {
+		tt->entries = calloc(size, sizeof(TTEntry));
+		if (tt->entries == NULL) {
 			fprintf(stderr, "Failed to allocate %lld bytes for the "
 				"transposition table!\n", (long long)(size*sizeof(TTEntry)));
 			size /= 2;
 		}
 	}
-#ifndef FIXED_PARAMS
-	tt_size = size;
-#else
-	if (tt_size != size) abort();
-#endif
+	tt->size = tt->entries ? size : 0;
+	tt->used = 0;
 }
 
-void tt_fini(void)
+void tt_clear(TTable *tt)
 {
-	free(tt);
-	tt = NULL;
-#ifndef FIXED_PARAMS
-	tt_size = 0;
-#endif
+	memset(tt->entries, 0, tt->size*sizeof(TTEntry));
+	tt->used = 0;
+}
+
+void tt_fini(TTable *tt)
+{
+	free(tt->entries);
+	tt->entries = NULL;
+	tt->size = 0;
+	tt->used = 0;
 }
 
 void serialize_board(const Board *board, unsigned char output[50])
@@ -58,6 +56,54 @@ void serialize_board(const Board *board, unsigned char output[50])
 	}
 }
 
+bool deserialize_board(const unsigned char input[50], Board *board)
+{
+	int n;
+
+	if (input[0] > 3) return false;
+	board_clear(board);
+	if (input[0] >= 2) board->moves = N;
+	for (n = 0; n < N; ++n) {
+		Field *f = &board->fields[n];
+		int val = input[n + 1];
+
+		if (val == 0) {
+			if (board->moves >= N) {
+				f->removed = N;
+				f->pieces = 1;
+				f->player = 0;
+				board->alive &= ~(1LL<<n);
+				++board->moves;
+			}
+			continue;
+		}
+		if (val == 3) {  /* lone Dvonn piece (these never move) */
+			f->pieces = 1;
+			f->dvonns = 1;
+		} else {
+			f->pieces = val/4;
+			f->player = val/2%2;
+			f->dvonns = val%2;
+			if (f->pieces == 0 || f->pieces > N) return false;
+		}
+		if (f->dvonns) board->dvonns |= (1LL<<n);
+		if (board->moves < N) ++board->moves;
+		update_neighbour_mobility(board, n, -1);
+	}
+
+	/* Restore the parity of the move counter (see parse_state() in IO.c): */
+	if (board->moves%2 != input[0]%2) {
+		if (board->moves <= N) return false;
+		--board->moves;
+	}
+
+#ifdef ZOBRIST
+	board->hash = zobrist_hash(board);
+#endif
+
+	return true;
+}
+
 #ifndef ZOBRIST
 
 #define FNV64_OFFSET_BASIS 14695981039346656037ULL
@@ -106,10 +152,10 @@ hash_t hash_board(const Board *board)
 #endif  /* ndef ZOBRIST */
 
 #ifdef TT_DEBUG
-size_t tt_population_count(void)
+size_t tt_population_count(const TTable *tt)
 {
 	size_t i, res = 0;
-	for (i = 0; i < tt_size; ++i) res += tt[i].hash != 0;
+	for (i = 0; i < tt->size; ++i) res += tt->entries[i].hash != 0;
 	return res;
 }
 #endif
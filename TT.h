@@ -1,7 +1,8 @@
 #ifndef TT_H_INCLUDED
+#define TT_H_INCLUDED
 
 #include "Game.h"
-#include "AI.h"
+#include "Eval.h"
 
 /* Transposition table entry.
    (See dfs() in AI.c for the interpretation of these fields.) */
@@ -32,23 +33,35 @@ typedef struct TTStats {
 TTStats tt_stats;
 #endif
 
-/* Transposition table: */
-extern TTEntry *tt;
-#ifdef FIXED_PARAMS
-#define tt_size ((size_t)1 << ai_use_tt)
-#else
-extern size_t tt_size;
-#endif
+/* Transposition table. A table may be shared by several engines (see
+   ai_engine_init() in AI.h), even when they search concurrently. */
+typedef struct TTable {
+	TTEntry *entries;  /* array of entries (NULL if not allocated) */
+	size_t  size;      /* number of entries (a power of 2) */
+	size_t  used;      /* number of entries in use */
+} TTable;
 
-/* Allocates a transposition table with `size' entries. */
-void tt_init(size_t size);
+/* Allocates a transposition table with `size' entries (or fewer, if there is
+   not enough memory; check tt->size afterwards). */
+void tt_init(TTable *tt, size_t size);
 
-/* Frees the currently allocated transposition table. */
-void tt_fini(void);
+/* Clears all entries of the given transposition table. */
+void tt_clear(TTable *tt);
+
+/* Frees the entries of the given transposition table. */
+void tt_fini(TTable *tt);
 
 /* Serializes the board state into a unique 50-byte descriptor. */
 void serialize_board(const Board *board, unsigned char output[50]);
 
+/* Reconstructs a board from a descriptor written by serialize_board(),
+   including mobility and (if enabled) the Zobrist hash, so that the result can
+   be evaluated or searched directly. Since the descriptor does not record how
+   many Dvonn pieces a stack contains, or when fields were removed, these are
+   filled in the same way as by parse_state(). Returns false if the descriptor
+   is invalid. */
+bool deserialize_board(const unsigned char input[50], Board *board);
+
 #ifdef ZOBRIST
 #define hash_board(board) ((board)->hash)
 #else
@@ -58,7 +71,7 @@ hash_t hash_board(const Board *board);
 
 #ifdef TT_DEBUG
 /* Counts the number of valid entries in the transposition table. */
-size_t tt_population_count(void);
+size_t tt_population_count(const TTable *tt);
 #endif
 
 #endif /* ndef TT_H_INCLUDED */
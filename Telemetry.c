@@ -0,0 +1,92 @@
+#include "Telemetry.h"
+#include "IO.h"
+#include "Threads.h"
+#include "TT.h"
+#include <stdio.h>
+
+/* Telemetry output stream (NULL if disabled): */
+static FILE *fp_telemetry = NULL;
+
+/* Number of searches reported so far: */
+static int search_count = 0;
+
+#ifdef THREADS
+/* Keeps the events of concurrent searches from being interleaved: */
+static pthread_mutex_t telemetry_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+bool telemetry_open(int fd)
+{
+	fp_telemetry = fdopen(fd, "w");
+	return fp_telemetry != NULL;
+}
+
+void telemetry_close(void)
+{
+	if (fp_telemetry) fclose(fp_telemetry);
+	fp_telemetry = NULL;
+}
+
+/* Returns the fraction of transposition table entries in use. */
+static double tt_fill(const TTable *tt)
+{
+	return (tt && tt->size > 0) ? (double)tt->used/tt->size : 0.0;
+}
+
+void telemetry_budget(const Board *board, const Budget *budget)
+{
+	if (!fp_telemetry) return;
+#ifdef THREADS
+	pthread_mutex_lock(&telemetry_mutex);
+#endif
+	fprintf(fp_telemetry, "{\"event\":\"budget\",\"search\":%d"
+		",\"state\":\"%s\"", search_count + 1, format_state(board));
+	fprintf(fp_telemetry, ",\"moves_left\":%d,\"moves\":%d,\"threats\":%d"
+		",\"base\":%.6f,\"factor\":%.3f,\"time\":%.6f}\n",
+		budget->moves_left, budget->moves, budget->threats, budget->base,
+		budget->factor, budget->time);
+#ifdef THREADS
+	pthread_mutex_unlock(&telemetry_mutex);
+#endif
+}
+
+void telemetry_search( const AI_Engine *engine, const Board *board,
+	const AI_Limit *limit, const AI_Result *result )
+{
+	const AI_Stats *stats = &engine->stats;
+	int n;
+
+	if (!fp_telemetry) return;
+#ifdef THREADS
+	pthread_mutex_lock(&telemetry_mutex);
+#endif
+	++search_count;
+	for (n = 0; n < stats->iteration_count; ++n) {
+		const AI_Iteration *it = &stats->iteration_log[n];
+		fprintf(fp_telemetry, "{\"event\":\"iteration\",\"search\":%d"
+			",\"depth\":%d", search_count, it->depth);
+		if (!it->aborted) {
+			fprintf(fp_telemetry, ",\"move\":\"%s\",\"value\":"VAL_FMT
+				",\"exact\":%s", format_move(&it->move), it->value,
+				it->exact ? "true" : "false");
+		}
+		fprintf(fp_telemetry, ",\"aborted\":%s,\"nodes\":%d,\"evals\":%d"
+			",\"time\":%.6f,\"predicted\":%.6f}\n",
+			it->aborted ? "true" : "false", it->nodes, it->eval, it->time,
+			it->predicted);
+	}
+	fprintf(fp_telemetry, "{\"event\":\"move\",\"search\":%d,\"state\":\"%s\"",
+		search_count, format_state(board));
+	fprintf(fp_telemetry, ",\"move\":\"%s\",\"value\":"VAL_FMT",\"depth\":%d"
+		",\"exact\":%s,\"aborted\":%s", format_move(&result->move),
+		result->value, result->depth, result->exact ? "true" : "false",
+		result->aborted ? "true" : "false");
+	fprintf(fp_telemetry, ",\"nodes\":%d,\"evals\":%d,\"time\":%.6f"
+		",\"budget\":%.6f,\"tt_fill\":%.6f,\"ebf\":%.3f}\n",
+		result->nodes, result->eval, result->time,
+		limit ? limit->time : 0.0, tt_fill(engine->tt), ai_stats_ebf(stats));
+	fflush(fp_telemetry);
+#ifdef THREADS
+	pthread_mutex_unlock(&telemetry_mutex);
+#endif
+}
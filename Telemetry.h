@@ -0,0 +1,32 @@
+#ifndef TELEMETRY_H_INCLUDED
+#define TELEMETRY_H_INCLUDED
+
+#include "AI.h"
+#include "Budget.h"
+
+/* Telemetry is a stream of JSON objects, one per line, describing the searches
+   performed by the AI. For each search, one "iteration" event is written per
+   iteration of iterative deepening, followed by one "move" event summarizing
+   the search (preceded by a "budget" event if time was allocated dynamically).
+   Events are formatted from the statistics recorded by the engine after the
+   search has finished, so they do not affect search timing. The events of a
+   search are written together, even if other threads are searching too. */
+
+/* Starts writing telemetry to the given file descriptor. Returns false if the
+   file descriptor could not be opened for writing. */
+bool telemetry_open(int fd);
+
+/* Stops writing telemetry, flushing any pending output. */
+void telemetry_close(void);
+
+/* Writes a "budget" event describing the time allocated for the next search
+   on `board'. Does nothing if telemetry is disabled. */
+void telemetry_budget(const Board *board, const Budget *budget);
+
+/* Writes the events for a search of `board' with the given limits and result,
+   using the statistics in engine->stats. Does nothing if telemetry is
+   disabled. */
+void telemetry_search( const AI_Engine *engine, const Board *board,
+	const AI_Limit *limit, const AI_Result *result );
+
+#endif /* ndef TELEMETRY_H_INCLUDED */
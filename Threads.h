@@ -0,0 +1,16 @@
+#ifndef THREADS_H_INCLUDED
+#define THREADS_H_INCLUDED
+
+/* Optional support for multithreading. If THREADS is defined, pthreads are
+   available and THREAD_LOCAL marks variables that must be private to each
+   thread; otherwise, everything runs in the main thread and THREAD_LOCAL
+   expands to nothing (so the CodeCup submission needs no extra libraries). */
+
+#ifdef THREADS
+#include <pthread.h>
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+
+#endif /* ndef THREADS_H_INCLUDED */
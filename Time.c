@@ -1,32 +1,51 @@
 #include "Time.h"
-#include "Signal.h"
-#include <assert.h>
-#include <math.h>
-#include <stdlib.h>
 #include <stdbool.h>
-#include <sys/time.h>
+#include <time.h>
 
 static bool started;
-static struct timeval used, start;
+static double used, start;
+static double startup_cpu, base_cpu;
 double time_limit;
+double time_margin = TIME_DEFAULT_MARGIN;
 
-/* Alarm data: */
-static signal_handler_t old_handler;
-static void (*callback_func)(void *);
-static void *callback_arg;
+/* Returns the current value of the given clock in seconds. */
+static double clock_seconds(clockid_t clock)
+{
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+/* Returns the current time (in seconds since some unspecified point in the
+   past) according to the monotonic clock, which is unaffected by changes to
+   the system time. */
+static double time_now(void)
+{
+	return clock_seconds(CLOCK_MONOTONIC);
+}
 
 void time_restart(void)
 {
-	used.tv_sec  = 0;
-	used.tv_usec = 0;
-	gettimeofday(&start, NULL);
+	used = 0;
+	start = time_now();
+	started = true;
+	startup_cpu = time_cpu_used();
+	base_cpu = 0;
+}
+
+void time_new_game(void)
+{
+	used = 0;
+	start = time_now();
 	started = true;
+	startup_cpu = 0;
+	base_cpu = time_cpu_used();
 }
 
 void time_start(void)
 {
 	if (!started) {
-		gettimeofday(&start, NULL);
+		start = time_now();
 		started = true;
 	}
 }
@@ -34,73 +53,33 @@ void time_start(void)
 void time_stop(void)
 {
 	if (started) {
-		struct timeval now;
-		gettimeofday(&now, NULL);
-		used.tv_sec  += now.tv_sec - start.tv_sec;
-		used.tv_usec += now.tv_usec - start.tv_usec;
-		if (used.tv_usec < 0) {
-			--used.tv_sec;
-			used.tv_usec += 1000000;
-		} else if (used.tv_usec >= 1000000) {
-			++used.tv_sec;
-			used.tv_usec -= 1000000;
-		}
+		used += time_now() - start;
 		started = false;
 	}
 }
 
 double time_used(void)
 {
-	struct timeval res = used;
-	if (started) {
-		struct timeval now;
-		gettimeofday(&now, NULL);
-		res.tv_sec  += now.tv_sec - start.tv_sec;
-		res.tv_usec += now.tv_usec - start.tv_usec;
-		/* N.B. no need to normalize `res' */
-	}
-	return res.tv_sec + 1e-6*res.tv_usec;
+	return started ? used + (time_now() - start) : used;
 }
 
-double time_left(void)
+double time_cpu_used(void)
 {
-	return time_limit - time_used();
+	return clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
 }
 
-static void alarm_callback(int signum)
+double time_startup(void)
 {
-	(void)signum;  /* ignored */
-
-	callback_func(callback_arg);
+	return startup_cpu;
 }
 
-void set_alarm(double time, void(*callback)(void*), void *arg)
+double time_charged(void)
 {
-	struct itimerval new_timer, old_timer;
-	signal_handler_t new_handler;
-
-	/* Record callback handler function and argument: */
-	callback_func = callback;
-	callback_arg  = arg;
-
-	/* Install signal handler */
-	signal_handler_init(&new_handler, alarm_callback);
-	signal_swap_handlers(SIGALRM, &new_handler, &old_handler);
-
-	/* Set timer with setitimer */
-	new_timer.it_interval.tv_sec  = 0;
-	new_timer.it_interval.tv_usec = 0;
-	new_timer.it_value.tv_sec  = (time_t)floor(time);
-	new_timer.it_value.tv_usec = (suseconds_t)floor((time - floor(time))*1e6);
-	setitimer(ITIMER_REAL, &new_timer, &old_timer);
-	assert(old_timer.it_value.tv_sec == 0 && old_timer.it_value.tv_usec == 0);
+	double wall = time_used() + startup_cpu, cpu = time_cpu_used() - base_cpu;
+	return wall > cpu ? wall : cpu;
 }
 
-void clear_alarm(void)
+double time_left(void)
 {
-	struct itimerval stop_timer = { { 0, 0 }, { 0, 0 } };
-	setitimer(ITIMER_REAL, &stop_timer, NULL);
-	signal_swap_handlers(SIGALRM, &old_handler, NULL);
-	callback_func = NULL;
-	callback_arg  = NULL;
+	return time_limit - time_margin - time_charged();
 }
@@ -1,11 +1,25 @@
 #ifndef TIME_H_INCLUDED
 #define TIME_H_INCLUDED
 
+/* Default safety margin (see time_margin below): */
+#define TIME_DEFAULT_MARGIN 0.050
+
+/* Total time available to the player (i.e. the limit imposed by the judge): */
 extern double time_limit;
 
+/* Part of time_limit that is kept in reserve, to account for errors in the
+   estimate of time charged by the judge (see time_charged()): */
+extern double time_margin;
+
 /* Resets the timer, and starts it. */
 void time_restart(void);
 
+/* Resets the timer for a new game played by a process that keeps running
+   between games, and starts it. Unlike time_restart(), the CPU time used so
+   far is attributed to earlier games instead of to startup, so neither counts
+   towards time_charged() for the new game. */
+void time_new_game(void);
+
 /* Resumes the timer, if it is paused. */
 void time_start(void);
 
@@ -13,18 +27,27 @@ void time_start(void);
 void time_stop(void);
 
 /* Returns how much time has been used; i.e. for how long the timer was running
-   since the last reset, not counting the time it was paused.*/
+   since the last reset, not counting the time it was paused. Time is measured
+   with the monotonic clock, and reading it is cheap enough to poll often. */
 double time_used(void);
 
-/* Returns how much time is left; which is basically time_limit - time_used() */
-double time_left(void);
+/* Returns the CPU time used by the process so far, including the time spent
+   starting up before time_restart() was first called. */
+double time_cpu_used(void);
+
+/* Returns the CPU time that had been used when time_restart() was called,
+   which is an estimate of the startup cost of the process that the timer
+   itself does not see. */
+double time_startup(void);
 
-/* Schedules the given callback function to be called after `time' seconds.
-   Only one alarm can be active at any given time! */
-void set_alarm(double time, void(*callback)(void *arg), void *arg);
+/* Returns an estimate of the time charged by the judge so far: the time
+   measured by the timer plus the startup cost, or the CPU time used if that is
+   larger (e.g. because the wall clock missed work done while paused). After
+   time_new_game(), only CPU time used since then is counted. */
+double time_charged(void);
 
-/* Cancels the current alarm, if any is currently set. Note that the alarm may
-   still go off before this function returns! */
-void clear_alarm(void);
+/* Returns how much time is left; i.e. time_limit - time_margin - time_charged()
+   (which may be negative, if the time limit has been exceeded). */
+double time_left(void);
 
 #endif /* ndef TIME_H_INCLUDED */
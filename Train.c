@@ -0,0 +1,152 @@
+#include "Train.h"
+#include "Threads.h"
+#include "Time.h"
+#include "Workers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* State of a training data generator, shared by its threads: */
+typedef struct Trainer {
+	const AI_Engine *engine;      /* engine copied for each thread */
+	size_t          tt_size;      /* entries in each thread's table */
+	FILE            *fp;          /* output file */
+	int             games;        /* number of games to play */
+	int             next;         /* index of the next game (atomic) */
+	AI_Limit        limit;        /* search limits */
+	int             sample;       /* inverse of the sampling probability */
+	int             seed;         /* base RNG seed */
+	long long       positions;    /* number of positions written */
+	bool            failed;       /* whether writing failed */
+#ifdef THREADS
+	pthread_mutex_t mutex;        /* protects fp, positions and failed */
+#endif
+} Trainer;
+
+/* Plays a single game and stores the records of the positions sampled in
+   `records' (which has room for one record per stacking move), of which the
+   number is returned. */
+static int train_game( const Trainer *trainer, AI_Engine *engine, int game,
+	unsigned char (*records)[TRAIN_RECORD_SIZE] )
+{
+	unsigned seed = (unsigned)workers_seed(trainer->seed, (unsigned)game);
+	Color players[N];  /* player to move in each record */
+	int n, nrecord = 0, nmove, scores[2];
+	Move moves[M];
+	Board board;
+
+	ai_reset(engine);
+	engine->rng_seed = (int)seed;
+	board_clear(&board);
+	while (generate_all_moves(&board, NULL) > 0) {
+		AI_Result result;
+		unsigned char *rec;
+		int value;
+
+		nmove = generate_moves(&board, moves);
+		if (board.moves < N || move_passes(&moves[0])) {
+			board_do(&board, &moves[rand_r(&seed)%nmove]);
+			continue;
+		}
+		if (!ai_select_move(engine, &board, &trainer->limit, &result)) break;
+		if (rand_r(&seed)%trainer->sample == 0) {
+			rec = records[nrecord];
+			players[nrecord++] = next_player(&board);
+			serialize_board(&board, rec);
+			value = result.value;
+			rec[50] = (unsigned char)(value & 255);
+			rec[51] = (unsigned char)((value >> 8) & 255);
+			rec[52] = (unsigned char)((value >> 16) & 255);
+			rec[53] = (unsigned char)((value >> 24) & 255);
+		}
+		board_do(&board, &result.move);
+	}
+
+	/* Label the positions sampled with the final result: */
+	board_scores(&board, scores);
+	for (n = 0; n < nrecord; ++n) {
+		int diff = scores[players[n]] - scores[1 - players[n]];
+
+		records[n][54] = (unsigned char)(signed char)
+			(diff > 0 ? 1 : diff < 0 ? -1 : 0);
+		records[n][55] = (unsigned char)(signed char)diff;
+	}
+	return nrecord;
+}
+
+/* Thread function: plays games until all games have been started. */
+static void *train_games(void *arg)
+{
+	Trainer *trainer = arg;
+	unsigned char records[N][TRAIN_RECORD_SIZE];
+	AI_Engine engine;
+	TTable tt;
+	int game, nrecord;
+
+	workers_clone(&engine, &tt, trainer->engine, trainer->tt_size);
+	while ((game = __sync_fetch_and_add(&trainer->next, 1)) < trainer->games) {
+		nrecord = train_game(trainer, &engine, game, records);
+#ifdef THREADS
+		pthread_mutex_lock(&trainer->mutex);
+#endif
+		if ( nrecord > 0 && fwrite( records, TRAIN_RECORD_SIZE, nrecord,
+		                            trainer->fp ) != (size_t)nrecord ) {
+			trainer->failed = true;
+		}
+		trainer->positions += nrecord;
+#ifdef THREADS
+		pthread_mutex_unlock(&trainer->mutex);
+#endif
+	}
+	tt_fini(&tt);
+	return NULL;
+}
+
+bool train_run( const AI_Engine *engine, size_t tt_size, const char *path,
+	int games, const AI_Limit *limit, int sample, int nthread, int seed )
+{
+	Trainer trainer;
+	double start = time_used(), used;
+
+	if (games < 1) {
+		fprintf(stderr, "No games to play!\n");
+		return false;
+	}
+	if (!limit->depth && !limit->eval) {
+		fprintf(stderr, "No search depth or evaluation limit given!\n");
+		return false;
+	}
+	memset(&trainer, 0, sizeof(trainer));
+	trainer.engine      = engine;
+	trainer.tt_size     = tt_size;
+	trainer.games       = games;
+	trainer.limit.depth = limit->depth;
+	trainer.limit.eval  = limit->eval;
+	trainer.sample      = (sample > 1) ? sample : 1;
+	trainer.seed        = seed;
+	trainer.fp          = fopen(path, "ab");
+	if (trainer.fp == NULL) {
+		perror(path);
+		return false;
+	}
+	if (nthread > games) nthread = games;
+#ifdef THREADS
+	pthread_mutex_init(&trainer.mutex, NULL);
+#endif
+	nthread = workers_run(train_games, &trainer, nthread);
+#ifdef THREADS
+	pthread_mutex_destroy(&trainer.mutex);
+#endif
+	if (fclose(trainer.fp) != 0) trainer.failed = true;
+	if (trainer.failed) {
+		perror(path);
+		return false;
+	}
+	used = time_used() - start;
+	printf("%d games (%lld positions) in %.3fs using %d thread%s: "
+		"%.0f positions/second (%.0f per thread)\n", games,
+		trainer.positions, used, nthread, nthread == 1 ? "" : "s",
+		used > 0 ? trainer.positions/used : 0.0,
+		used > 0 ? trainer.positions/used/nthread : 0.0);
+	return true;
+}
@@ -0,0 +1,36 @@
+#ifndef TRAIN_H_INCLUDED
+#define TRAIN_H_INCLUDED
+
+#include "AI.h"
+
+/* Training data for tuning or learning the evaluation function is generated
+   by self-play: the engine plays games against itself from random placements,
+   with a small fixed search limit, and a sample of the positions reached in
+   the stacking phase is written to a file, labelled with the value found by
+   the search and the final result of the game. Each position is written as a
+   record of TRAIN_RECORD_SIZE bytes:
+
+	<board>     serialized board (50 bytes; see serialize_board())
+	<value>     value found by the search (4 bytes, signed, little-endian)
+	<result>    result of the game (1 byte, signed: -1 lost, 0 tied, 1 won)
+	<score>     final score difference (1 byte, signed)
+
+   where the value, result and score difference are from the perspective of
+   the player to move. Records are written as soon as a game has finished, so
+   the file can be read while it is being generated. */
+
+#define TRAIN_RECORD_SIZE 56
+
+/* Plays `games' games of self-play using `nthread' threads, each with its own
+   copy of `engine' and its own transposition table of `tt_size' entries (0 to
+   disable), and appends the positions sampled to the file at `path'. In the
+   placement phase, moves are chosen uniformly at random; in the stacking
+   phase, moves are selected by searching with the given limits, which must
+   limit the depth or the number of evaluations. Each position searched is
+   sampled with probability 1/`sample'. `seed' determines the random seeds of
+   the games. Prints the number of positions generated per second (in total
+   and per thread). Returns false if the file could not be written. */
+bool train_run( const AI_Engine *engine, size_t tt_size, const char *path,
+	int games, const AI_Limit *limit, int sample, int nthread, int seed );
+
+#endif /* ndef TRAIN_H_INCLUDED */
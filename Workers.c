@@ -0,0 +1,43 @@
+#include "Workers.h"
+#include "Threads.h"
+#include <string.h>
+
+int workers_run(void *(*func)(void *), void *arg, int nthread)
+{
+#ifdef THREADS
+	pthread_t threads[AI_MAX_THREADS];
+	bool running[AI_MAX_THREADS];
+	int t;
+
+	if (nthread < 1) nthread = 1;
+	if (nthread > AI_MAX_THREADS) nthread = AI_MAX_THREADS;
+	if (nthread > 1) ai_interruptible = false;
+	for (t = 1; t < nthread; ++t) {
+		running[t] = pthread_create(&threads[t], NULL, func, arg) == 0;
+	}
+	func(arg);
+	for (t = 1; t < nthread; ++t) {
+		if (running[t]) pthread_join(threads[t], NULL);
+	}
+	return nthread;
+#else
+	(void)nthread;  /* ignored */
+	func(arg);
+	return 1;
+#endif
+}
+
+void workers_clone( AI_Engine *engine, TTable *tt, const AI_Engine *source,
+	size_t tt_size )
+{
+	ai_engine_clone(engine, source);
+	memset(tt, 0, sizeof(TTable));
+	if (tt_size > 0) tt_init(tt, tt_size);
+	engine->tt = (tt->size > 0) ? tt : NULL;
+	if (engine->tt == NULL) engine->use_killer = 0;
+}
+
+int workers_seed(int seed, unsigned n)
+{
+	return (int)(((unsigned)seed*1000003u + n)%2147483646u) + 1;
+}
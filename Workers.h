@@ -0,0 +1,28 @@
+#ifndef WORKERS_H_INCLUDED
+#define WORKERS_H_INCLUDED
+
+#include "AI.h"
+
+/* Helpers for the tools that play or analyze many positions in several
+   threads, each with its own copy of an engine (see Analysis.c, Match.c and
+   Train.c). */
+
+/* Calls `func' with `arg' in `nthread' threads at once (the calling thread
+   being one of them), and returns when all calls have returned. The number of
+   threads is limited to AI_MAX_THREADS (and to 1 if threads are not
+   supported), and ai_interruptible is disabled if more than one is used.
+   Returns the number of threads used. */
+int workers_run(void *(*func)(void *), void *arg, int nthread);
+
+/* Initializes `engine' with the same parameters as `source', but with its own
+   transposition table `tt' of `tt_size' entries. If `tt_size' is 0 (or the
+   table cannot be allocated), the engine has no table, which also disables
+   the killer heuristic. The table must be released with tt_fini(). */
+void workers_clone( AI_Engine *engine, TTable *tt, const AI_Engine *source,
+	size_t tt_size );
+
+/* Returns the RNG seed (which is never 0) of the n-th game played with the
+   base seed `seed'. */
+int workers_seed(int seed, unsigned n);
+
+#endif /* ndef WORKERS_H_INCLUDED */
@@ -6,6 +6,7 @@ import (
 	"exec"
 	"flag"
 	"fmt"
+	"io/ioutil"
 	"os"
 	"rand"
 	"sort"
@@ -16,6 +17,8 @@ import (
 var logPath = ""
 var msgPath = ""
 var quiet = false
+var jobs = 1
+var cpus []int // CPUs that job slots are pinned to
 
 type Result struct {
 	player [2]int   // 0-based player indices
@@ -49,8 +52,65 @@ func (ips IntPairSlice) Reverse() {
 	}
 }
 
-func runPlayer(command string, msgPath string) (*exec.Cmd, os.Error) {
-	if argv := strings.Fields(command); len(argv) == 0 {
+// Returns the CPUs this process may run on, as listed in /proc/self/status
+// (e.g. "0-3,8"), or nil if they cannot be determined.
+func allowedCPUs() []int {
+	data, err := ioutil.ReadFile("/proc/self/status")
+	if err != nil {
+		return nil
+	}
+	s := string(data)
+	key := "Cpus_allowed_list:"
+	i := strings.Index(s, key)
+	if i < 0 {
+		return nil
+	}
+	s = s[i+len(key):]
+	if j := strings.Index(s, "\n"); j >= 0 {
+		s = s[0:j]
+	}
+	var res []int
+	lo, n, inRange, digits := 0, 0, false, false
+	for i := 0; i <= len(s); i++ {
+		c := byte(',')
+		if i < len(s) {
+			c = s[i]
+		}
+		switch {
+		case c >= '0' && c <= '9':
+			n = 10*n + int(c-'0')
+			digits = true
+		case c == '-':
+			lo, n, inRange, digits = n, 0, true, false
+		default:
+			if digits {
+				if !inRange {
+					lo = n
+				}
+				for cpu := lo; cpu <= n; cpu++ {
+					res = append(res, cpu)
+				}
+			}
+			n, inRange, digits = 0, false, false
+		}
+	}
+	return res
+}
+
+// Prefixes the command line argv so that it runs pinned to the given CPU,
+// unless cpu is negative.
+func pinArgs(argv []string, cpu int) []string {
+	if len(argv) == 0 || cpu < 0 {
+		return argv
+	}
+	res := make([]string, len(argv)+3)
+	res[0], res[1], res[2] = "taskset", "-c", fmt.Sprint(cpu)
+	copy(res[3:], argv)
+	return res
+}
+
+func runPlayer(command string, msgPath string, cpu int) (*exec.Cmd, os.Error) {
+	if argv := pinArgs(strings.Fields(command), cpu); len(argv) == 0 {
 		return nil, os.EINVAL
 	} else if name, err := exec.LookPath(argv[0]); err != nil {
 		return nil, err
@@ -101,14 +161,14 @@ func runPlayer(command string, msgPath string) (*exec.Cmd, os.Error) {
 	return nil, nil // should never get here
 }
 
-func runMatch(players [2]int, commands [2]string, logPath string, msgPath [2]string) Result {
+func runMatch(players [2]int, commands [2]string, logPath string, msgPath [2]string, cpu int) Result {
 	result := Result{player: players}
 
 	var cmds [2]*exec.Cmd
 	var reader [2]*bufio.Reader
 
 	for i := range players {
-		if cmd, err := runPlayer(commands[i], msgPath[i]); err != nil {
+		if cmd, err := runPlayer(commands[i], msgPath[i], cpu); err != nil {
 			fmt.Fprintf(os.Stderr, "Couldn't run '%s': %s\n", commands[i], err)
 			result.failed[i] = true
 		} else {
@@ -233,6 +293,44 @@ func toYesNo(v bool) string {
 	return "no"
 }
 
+// Plays game n (0-based) of a tournament between the given players, with
+// both players pinned to the given CPU (unless cpu is negative).
+func runGame(n int, players [2]int, commands []string, cpu int) Result {
+	logFilePath := ""
+	if logPath != "" {
+		logFilePath = fmt.Sprintf("%s%04d.log", logPath, n+1)
+	}
+	msgFilePath := [2]string{}
+	if msgPath != "" {
+		if msgPath == "-" {
+			msgFilePath[0] = "-"
+			msgFilePath[1] = "-"
+		} else {
+			msgFilePath[0] = fmt.Sprintf("%s%04d.1.log", msgPath, n+1)
+			msgFilePath[1] = fmt.Sprintf("%s%04d.2.log", msgPath, n+1)
+		}
+	}
+	i, j := players[0], players[1]
+	return runMatch(players, [2]string{commands[i], commands[j]}, logFilePath, msgFilePath, cpu)
+}
+
+func printResult(n int, res Result, commands []string) {
+	player1 := shorten(commands[res.player[0]], 30)
+	player2 := shorten(commands[res.player[1]], 30)
+	if res.score[0] > res.score[1] {
+		player1 = strings.ToUpper(player1)
+	} else if res.score[1] > res.score[0] {
+		player2 = strings.ToUpper(player2)
+	}
+	fmt.Printf(
+		"%4d %-30s %-30s  %2d %2d  %3d %3d  %-3s %-3s  %7.3fs %7.3fs\n",
+		n+1, player1, player2,
+		res.score[0], res.score[1],
+		res.points[0], res.points[1],
+		toYesNo(res.failed[0]), toYesNo(res.failed[1]),
+		res.time[0], res.time[1])
+}
+
 func runTournament(commands []string, rounds int, firstOnly bool) []Result {
 	if !quiet {
 		fmt.Printf(" Id             Player 1                       Player 2             Score   Points  Failed       Time used\n")
@@ -243,45 +341,14 @@ func runTournament(commands []string, rounds int, firstOnly bool) []Result {
 	if firstOnly {
 		numResults = 1
 	}
-	results := make([]Result, numResults)
+	games := make([][2]int, numResults)
 	n := 0
 outermost:
 	for r := 0; r < rounds; r++ {
 		for i := range commands {
 			for j := range commands {
 				if i != j {
-					logFilePath := ""
-					if logPath != "" {
-						logFilePath = fmt.Sprintf("%s%04d.log", logPath, n+1)
-					}
-					msgFilePath := [2]string{}
-					if msgPath != "" {
-						if msgPath == "-" {
-							msgFilePath[0] = "-"
-							msgFilePath[1] = "-"
-						} else {
-							msgFilePath[0] = fmt.Sprintf("%s%04d.1.log", msgPath, n+1)
-							msgFilePath[1] = fmt.Sprintf("%s%04d.2.log", msgPath, n+1)
-						}
-					}
-					res := runMatch([2]int{i, j}, [2]string{commands[i], commands[j]}, logFilePath, msgFilePath)
-					player1 := shorten(commands[i], 30)
-					player2 := shorten(commands[j], 30)
-					if res.score[0] > res.score[1] {
-						player1 = strings.ToUpper(player1)
-					} else if res.score[1] > res.score[0] {
-						player2 = strings.ToUpper(player2)
-					}
-					if !quiet {
-						fmt.Printf(
-							"%4d %-30s %-30s  %2d %2d  %3d %3d  %-3s %-3s  %7.3fs %7.3fs\n",
-							n+1, player1, player2,
-							res.score[0], res.score[1],
-							res.points[0], res.points[1],
-							toYesNo(res.failed[0]), toYesNo(res.failed[1]),
-							res.time[0], res.time[1])
-					}
-					results[n] = res
+					games[n] = [2]int{i, j}
 					n++
 					if firstOnly {
 						break outermost
@@ -290,6 +357,43 @@ outermost:
 			}
 		}
 	}
+
+	// Play up to `jobs' games at a time. Each job slot is pinned to its own
+	// allowed CPU (when playing more than one game at a time), so that
+	// concurrent games do not take time from each other's players:
+	results := make([]Result, numResults)
+	slots := make(chan int, jobs)
+	done := make(chan int)
+	for s := 0; s < jobs; s++ {
+		slots <- s
+	}
+	go func() {
+		for n := range games {
+			slot := <-slots
+			go func(n, slot int) {
+				cpu := -1
+				if jobs > 1 {
+					cpu = cpus[slot]
+				}
+				results[n] = runGame(n, games[n], commands, cpu)
+				slots <- slot
+				done <- n
+			}(n, slot)
+		}
+	}()
+
+	// Print results in order, as soon as all earlier games have finished:
+	finished := make([]bool, numResults)
+	next := 0
+	for _ = range games {
+		finished[<-done] = true
+		for next < numResults && finished[next] {
+			if !quiet {
+				printResult(next, results[next], commands)
+			}
+			next++
+		}
+	}
 	if !quiet {
 		fmt.Printf("---- ------------------------------ ------------------------------  -----  -------  -------  -----------------\n")
 	}
@@ -314,6 +418,7 @@ func main() {
 	flag.BoolVar(&quiet, "quiet", quiet, "print only plain-text results")
 	flag.BoolVar(&single, "single", single, "play only a single game")
 	flag.IntVar(&rounds, "rounds", rounds, "number of rounds to play")
+	flag.IntVar(&jobs, "jobs", jobs, "number of games to play concurrently (each pinned to a CPU)")
 	flag.StringVar(&msgPath, "msg", msgPath, "path to player message log files")
 	flag.StringVar(&logPath, "log", logPath, "path to game log files")
 	flag.Parse()
@@ -323,6 +428,10 @@ func main() {
 		flag.PrintDefaults()
 	} else if rounds < 1 {
 		fmt.Fprintln(os.Stderr, "Invalid number of rounds passed!")
+	} else if jobs < 1 {
+		fmt.Fprintln(os.Stderr, "Invalid number of jobs passed!")
+	} else if cpus = allowedCPUs(); jobs > 1 && jobs > len(cpus) {
+		fmt.Fprintf(os.Stderr, "Too many jobs passed: only %d CPUs available!\n", len(cpus))
 	} else if single && (flag.NArg() > 2 || rounds > 1) {
 		fmt.Fprintln(os.Stderr, "Single game requires two players and one round!")
 	} else {
@@ -1,8 +1,20 @@
 #include "Game.h"
 #include "AI.h"
+#include "Budget.h"
 #include "Time.h"
 #include "TT.h"
 #include "IO.h"
+#ifdef TOOLS
+#include "Analysis.h"
+#include "Bench.h"
+#include "Index.h"
+#include "Match.h"
+#include "Perft.h"
+#include "Record.h"
+#include "Server.h"
+#include "Telemetry.h"
+#include "Train.h"
+#endif
 #include <assert.h>
 #include <ctype.h>
 #include <stdbool.h>
@@ -12,10 +24,10 @@
 #include <time.h>
 #include <unistd.h>
 
-/* Default player time when none is given on the command line.  This is used
-   during official matches, and is slightly below the official limit of 5s
-   to account for startup delays and small errors in timekeeping. */
-#define default_player_time 4.95
+/* Default player time when none is given on the command line.  This is the
+   official limit used during matches; startup delays and small errors in
+   timekeeping are accounted for by time_charged() and time_margin. */
+#define default_player_time 5.0
 
 /* Command line arguments: */
 static int         arg_seed      = 0;         /* Random number generator seed */
@@ -23,6 +35,41 @@ static const char *arg_state     = NULL;         /* Initial state description */
 static int         arg_color     = -1;           /* Color(s) played by the AI */
 static bool        arg_analyze   = false; /* Analyze board instead of playing */
 static AI_Limit    arg_limit     = { 0, 0, 0.0 };         /* AI search limits */
+static bool        arg_stats_json = false;  /* Print search statistics */
+#ifdef TOOLS
+static char        arg_engine[256] = "";  /* Engine options given */
+static const char *arg_analyze_file = NULL;  /* File of states to analyze */
+static int         arg_threads   = 1;      /* Threads used by batch functions */
+static int         arg_bench_eval = 0;  /* Positions to evaluate as benchmark */
+static bool        arg_bench     = false;  /* Run search benchmark and exit */
+static int         arg_perft     = 0;   /* Depth of move generation test */
+static bool        arg_perft_check = false;  /* Verify move generation */
+static bool        arg_bulk      = false;  /* Count last ply in bulk (perft) */
+static bool        arg_check     = false;  /* Verify every node (perft) */
+static int         arg_playouts  = 0;  /* Random games to verify board state */
+static int         arg_hash_check = 0;  /* Random games to check hashes */
+static int         arg_telemetry_fd = -1;  /* File descriptor for telemetry */
+static bool        arg_server    = false;  /* Run in server mode */
+static const char *arg_socket    = NULL;  /* Socket path for server mode */
+static int         arg_match     = 0;   /* Number of games to play in a match */
+static const char *arg_vs        = NULL;  /* Engine options of the opponent */
+static MatchSprt   arg_sprt      = { 0, 0, 0.05, 0.05 };  /* Match SPRT */
+static bool        arg_use_sprt  = false;  /* Stop match early by SPRT */
+static const char *arg_record    = NULL;  /* Record file to convert logs to */
+static const char *arg_replay    = NULL;  /* Record file to replay */
+static int         arg_record_test = 0;  /* Games to test record files */
+static const char *arg_index     = NULL;  /* Position index to build */
+static const char *arg_lookup    = NULL;  /* Position index to query */
+static const char *arg_train     = NULL;  /* Training data file to write */
+static int         arg_games     = 100;   /* Games to play for training */
+static int         arg_sample    = 1;     /* Training positions sampled */
+static char      **arg_files     = NULL;  /* Input files (logs or records) */
+static int         arg_nfile     = 0;     /* Number of input files */
+#endif /* def TOOLS */
+
+/* Transposition table and search engine: */
+static TTable      tt;
+static AI_Engine   engine;
 
 /* Removes leading and trailing whitespace from `s' and returns it again. */
 static char *trim(char *s)
@@ -56,7 +103,9 @@ static const char *read_line(void)
 					fputs(line, stderr);
 				}
 				*/
-				fprintf(stderr, "%.3fs\nQuit received! Exiting.\n", time_used());
+				fprintf(stderr, "%.3fs (cpu: %.3fs, charged: %.3fs, "
+					"margin: %.3fs)\nQuit received! Exiting.\n", time_used(),
+					time_cpu_used(), time_charged(), time_margin);
 				fflush(stderr);
 				exit(EXIT_SUCCESS);
 			} else {
@@ -86,49 +135,31 @@ static void parse_and_execute_move(Board *board, const char *line)
 	board_validate(board);
 }
 
-/* Estimates the number of moves left in the game. This is not a strict
-   upperbound, but overestimates more often than not. Used to allocate time. */
-static int max_moves_left(const Board *board)
-{
-	int n, res = 0;
-
-	if (board->moves < N) {  /* placement phase */
-		return N + (N - 1) - board->moves; 
-	}
-	for (n = 0; n < N; ++n) {
-		/* Assume stacks of at most five pieces can move. */
-		if (!board->fields[n].removed && board->fields[n].pieces <= 5) ++res;
-	}
-	return res;
-}
-
 /* Uses the AI to select the best move for the given game state. */
 static bool select_move(Board *board, Move *move)
 {
 	bool ok;
 	AI_Result result;
 	AI_Limit limit = arg_limit;
+	Budget budget;
 
-	if (board->moves < N) {  /* placement phase */
-		limit.eval  = 1000;
-		limit.depth = N - board->moves;
-		limit.time  = 0;
-		ok = ai_select_move(board, &limit, &result);
-	} else {  /* stacking phase */
-		if (!limit.time && !limit.depth && !limit.eval)
-		{
-			/* Dynamically allocate some time for the computation. This is used
-			   during official matches. The number of moves in the game is
-			   divided by 2 because I play half of the moves (and my opponent
-			   the other half) and 10 is subtracted for overestimation in
-			   max_moves_left() and the fact that last few moves are trivial. */
-			int d = max_moves_left(board)/2 - 10;
-			if (d < 2) d = 2;
-			limit.time = time_left()/d;
-			fprintf(stderr, "%.3fs+%.3fs\n", time_used(), limit.time);
-		}
-		ok = ai_select_move(board, &limit, &result);
+	if (board->moves < N || (!limit.time && !limit.depth && !limit.eval)) {
+		/* Dynamically allocate some time for the computation, depending on
+		   the complexity of the position. This is used during official
+		   matches. */
+		if (budget_limit(board, time_left(), &limit, &budget)) {
+			fprintf(stderr, "%.3fs+%.3fs (x%.2f)\n", time_used(), limit.time,
+				budget.factor);
+#ifdef TOOLS
+			telemetry_budget(board, &budget);
+#endif
+		}
 	}
+	ok = ai_select_move(&engine, board, &limit, &result);
+	if (ok && arg_stats_json) ai_stats_print_json(stderr, &engine.stats);
+#ifdef TOOLS
+	if (ok) telemetry_search(&engine, board, &limit, &result);
+#endif
 	if (ok) *move = result.move;
 	return ok;
 }
@@ -174,12 +205,16 @@ static void analyze(Board *board)
 	int n, npv;
 
 	fprintf(stderr, "Intermediate value: "VAL_FMT"\n", ai_evaluate(board));
-	if (!ai_select_move(board, &arg_limit, &result)) {
+	if (!ai_select_move(&engine, board, &arg_limit, &result)) {
 		fprintf(stderr, "Internal error: no move selected!\n");
 		exit(EXIT_FAILURE);
 	}
+	if (arg_stats_json) ai_stats_print_json(stderr, &engine.stats);
+#ifdef TOOLS
+	telemetry_search(&engine, board, &arg_limit, &result);
+#endif
 	board_validate(board);
-	npv = ai_extract_pv(board, pv, AI_MAX_DEPTH);
+	npv = ai_extract_pv(&engine, board, pv, AI_MAX_DEPTH);
 	fprintf(stderr, "Principal variation:");
 	for (n = 0; n < npv; ++n) {
 		fprintf(stderr, " %s", format_move(&pv[n]));
@@ -209,8 +244,77 @@ static void print_usage(void)
 		"\t--eval=<count>    "
 	"stop after evaluating given number of positions\n"
 		"\t--time=<time>     "
-	"maximum time to use (default when playing: %.2fs)\n",
-		default_player_time );
+	"maximum time to use (default when playing: %.2fs)\n"
+		"\t--margin=<time>   "
+	"time kept in reserve when playing (default: %.3fs)\n"
+		"\t--stats=json      "
+	"print search statistics as JSON after each search\n",
+		default_player_time, TIME_DEFAULT_MARGIN );
+#ifdef TOOLS
+	printf(
+		"\t--analyze-file=<path>\n"
+		"\t                  "
+	"analyze the positions in a file (one per line)\n"
+		"\t--telemetry-fd=<fd> "
+	"write JSON-lines telemetry to file descriptor fd\n"
+		"\t--server          "
+	"play games using commands from standard input\n"
+		"\t--server=<path>   "
+	"play games using commands from a UNIX socket\n"
+		"\t--analyze --server[=<path>]\n"
+		"\t                  "
+	"analyze positions requested on standard input or socket\n"
+		"\t--match=<games>   "
+	"play games against another configuration and exit\n"
+		"\t--vs=<options>    "
+	"engine options of the other configuration (e.g. --pvs=0)\n"
+		"\t--sprt=<elo0>:<elo1>[:<alpha>:<beta>]\n"
+		"\t                  "
+	"stop the match when the other configuration is shown\n"
+		"\t                  "
+	"to be at most elo0 or at least elo1 Elo points stronger\n"
+		"\t--bench           "
+	"benchmark search of fixed positions and exit\n"
+		"\t--bench-eval=<n>  "
+	"benchmark evaluation of n random positions\n"
+		"\t--perft=<depth>   "
+	"count move sequences up to given depth and exit\n"
+		"\t--perft-check     "
+	"verify move generation on reference positions\n"
+		"\t--bulk            "
+	"count moves at the last ply without executing them\n"
+		"\t--check           "
+	"verify board state at every node during perft\n"
+		"\t--playouts=<n>    "
+	"verify board state during n random games and exit\n"
+#ifdef ZOBRIST
+		"\t--hash-check=<n>  "
+	"check hashes of positions in n random games for collisions\n"
+#endif
+		"\t--record=<path> <log>..\n"
+		"\t                  "
+	"convert game logs to a binary record file and exit\n"
+		"\t--replay=<path>   "
+	"replay and verify all games in a record file and exit\n"
+		"\t--record-test=<n> "
+	"round-trip the longest of n games through a record file\n"
+		"\t--index=<path> <record>..\n"
+		"\t                  "
+	"index the positions reached in record files and exit\n"
+		"\t--lookup=<path>   "
+	"look up the initial state in a position index and exit\n"
+		"\t--train=<path>    "
+	"write training data from self-play (with --depth or --eval)\n"
+		"\t--games=<n>       "
+	"number of self-play games for training (default: 100)\n"
+		"\t--sample=<n>      "
+	"sample one in n positions for training (default: 1)\n" );
+#ifdef THREADS
+	printf(
+		"\t--threads=<n>     "
+	"number of threads to use in batch functions (0: all cores)\n" );
+#endif
+#endif /* def TOOLS */
 #ifndef FIXED_PARAMS
 	printf(
 		"\t--tt=<size>       transposition table size "
@@ -224,11 +328,44 @@ static void print_usage(void)
 		"\t--mtdf=<val>      MTD(f) "
 			"(0: off, 1: on)\n"
 		"\t--deep=<val>      iterative deepening increment (1 or 2)\n"
+		"\t--poll=<nodes>    nodes searched between checks of the time\n"
 		"\t--weights=a:..:d  set evaluation function weights\n"
 		"\t--wfields=a:b:c   set additional field distance weights \n" );
 #endif /* ndef FIXED_PARAMS */
 }
 
+/* Parses a command line argument that sets a default search parameter or
+   evaluation weight (see ai_engine_init()). Returns false if the argument is
+   not such an option. */
+static bool parse_engine_arg(const char *arg)
+{
+#ifndef FIXED_PARAMS
+	if (sscanf(arg, "--tt=%d", &ai_use_tt) == 1) return true;
+	if (sscanf(arg, "--mo=%d", &ai_use_mo) == 1) return true;
+	if (sscanf(arg, "--killer=%d", &ai_use_killer) == 1) return true;
+	if (sscanf(arg, "--pvs=%d", &ai_use_pvs) == 1) return true;
+	if (sscanf(arg, "--mtdf=%d", &ai_use_mtdf) == 1) return true;
+	if (sscanf(arg, "--deep=%d", &ai_use_deepening) == 1) return true;
+	if (sscanf(arg, "--poll=%d", &ai_poll_nodes) == 1) {
+		if (ai_poll_nodes < 1) ai_poll_nodes = 1;
+		return true;
+	}
+	if (sscanf(arg, "--weights=" VAL_FMT":"VAL_FMT":"VAL_FMT":"VAL_FMT,
+		&eval_weights.stacks, &eval_weights.moves,
+		&eval_weights.to_life, &eval_weights.to_enemy) == 4) {
+		return true;
+	}
+	if (sscanf(arg, "--wfields=" VAL_FMT":"VAL_FMT":"VAL_FMT,
+		&eval_weights.field_base, &eval_weights.field_bonus,
+		&eval_weights.field_shift) == 3) {
+		return true;
+	}
+#else
+	(void)arg;  /* unused */
+#endif
+	return false;
+}
+
 /* Parses command line arguments passed to the program. */
 static void parse_args(int argc, char *argv[])
 {
@@ -256,26 +393,116 @@ static void parse_args(int argc, char *argv[])
 		if (sscanf(argv[pos], "--depth=%d", &arg_limit.depth) == 1) continue;
 		if (sscanf(argv[pos], "--eval=%d", &arg_limit.eval) == 1) continue;
 		if (sscanf(argv[pos], "--time=%lf", &arg_limit.time) == 1) continue;
-#ifndef FIXED_PARAMS
-		if (sscanf(argv[pos], "--tt=%d", &ai_use_tt) == 1) continue;
-		if (sscanf(argv[pos], "--mo=%d", &ai_use_mo) == 1) continue;
-		if (sscanf(argv[pos], "--killer=%d", &ai_use_killer) == 1) continue;
-		if (sscanf(argv[pos], "--pvs=%d", &ai_use_pvs) == 1) continue;
-		if (sscanf(argv[pos], "--mtdf=%d", &ai_use_mtdf) == 1) continue;
-		if (sscanf(argv[pos], "--deep=%d", &ai_use_deepening) == 1) continue;
-		if (sscanf(argv[pos], "--weights=" VAL_FMT":"VAL_FMT":"VAL_FMT":"VAL_FMT,
-			&eval_weights.stacks, &eval_weights.moves,
-			&eval_weights.to_life, &eval_weights.to_enemy) == 4) {
+		if (sscanf(argv[pos], "--margin=%lf", &time_margin) == 1) continue;
+		if (strcmp(argv[pos], "--stats=json") == 0) {
+			arg_stats_json = true;
 			continue;
 		}
-		if (sscanf(argv[pos], "--wfields=" VAL_FMT":"VAL_FMT":"VAL_FMT,
-			&eval_weights.field_base, &eval_weights.field_bonus,
-			&eval_weights.field_shift) == 3) {
+#ifdef TOOLS
+		if (strncmp(argv[pos], "--analyze-file=", 15) == 0) {
+			arg_analyze_file = argv[pos] + 15;
+			continue;
+		}
+		if (sscanf(argv[pos], "--telemetry-fd=%d", &arg_telemetry_fd) == 1) {
+			continue;
+		}
+		if (strcmp(argv[pos], "--server") == 0) {
+			arg_server = true;
+			continue;
+		}
+		if (strncmp(argv[pos], "--server=", 9) == 0) {
+			arg_server = true;
+			arg_socket = argv[pos] + 9;
+			continue;
+		}
+		if (strcmp(argv[pos], "--bench") == 0) {
+			arg_bench = true;
+			continue;
+		}
+		if (sscanf(argv[pos], "--bench-eval=%d", &arg_bench_eval) == 1) {
+			continue;
+		}
+		if (sscanf(argv[pos], "--perft=%d", &arg_perft) == 1) continue;
+		if (strcmp(argv[pos], "--perft-check") == 0) {
+			arg_perft_check = true;
+			continue;
+		}
+		if (strcmp(argv[pos], "--bulk") == 0) {
+			arg_bulk = true;
+			continue;
+		}
+		if (strcmp(argv[pos], "--check") == 0) {
+			arg_check = true;
+			continue;
+		}
+		if (sscanf(argv[pos], "--playouts=%d", &arg_playouts) == 1) continue;
+#ifdef ZOBRIST
+		if (sscanf(argv[pos], "--hash-check=%d", &arg_hash_check) == 1) {
+			continue;
+		}
+#endif
+		if (strncmp(argv[pos], "--record=", 9) == 0) {
+			arg_record = argv[pos] + 9;
+			continue;
+		}
+		if (sscanf(argv[pos], "--record-test=%d", &arg_record_test) == 1) {
+			continue;
+		}
+		if (strncmp(argv[pos], "--replay=", 9) == 0) {
+			arg_replay = argv[pos] + 9;
+			continue;
+		}
+		if (strncmp(argv[pos], "--index=", 8) == 0) {
+			arg_index = argv[pos] + 8;
+			continue;
+		}
+		if (strncmp(argv[pos], "--lookup=", 9) == 0) {
+			arg_lookup = argv[pos] + 9;
+			continue;
+		}
+		if (strncmp(argv[pos], "--train=", 8) == 0) {
+			arg_train = argv[pos] + 8;
+			continue;
+		}
+		if (sscanf(argv[pos], "--games=%d", &arg_games) == 1) continue;
+		if (sscanf(argv[pos], "--sample=%d", &arg_sample) == 1) continue;
+#ifdef THREADS
+		if (sscanf(argv[pos], "--threads=%d", &arg_threads) == 1) {
+			if (arg_threads < 1) arg_threads = sysconf(_SC_NPROCESSORS_ONLN);
+			if (arg_threads < 1) arg_threads = 1;
+			if (arg_threads > AI_MAX_THREADS) arg_threads = AI_MAX_THREADS;
+			continue;
+		}
+#endif
+		if (sscanf(argv[pos], "--match=%d", &arg_match) == 1) continue;
+		if (sscanf(argv[pos], "--sprt=%lf:%lf:%lf:%lf", &arg_sprt.elo0,
+			&arg_sprt.elo1, &arg_sprt.alpha, &arg_sprt.beta) >= 2) {
+			arg_use_sprt = true;
+			continue;
+		}
+		if (strncmp(argv[pos], "--vs=", 5) == 0) {
+			arg_vs = argv[pos] + 5;
+			continue;
+		}
+#endif /* def TOOLS */
+		if (parse_engine_arg(argv[pos])) {
+#ifdef TOOLS
+			size_t len = strlen(arg_engine);
+			snprintf( arg_engine + len, sizeof(arg_engine) - len,
+			          " %s", argv[pos] );
+#endif
 			continue;
 		}
-#endif /* ndef FIXED_PARAMS */
 		break;
 	}
+#ifdef TOOLS
+	if ((arg_record || arg_index) && pos < argc && argv[pos][0] != '-') {
+		/* Remaining arguments are the files to convert or index: */
+		arg_files = argv + pos;
+		arg_nfile = argc - pos;
+		pos = argc;
+	}
+#endif
 	if (pos < argc) {
 		printf("Invalid command line argument: `%s'!\n\n", argv[pos]);
 		print_usage();
@@ -283,6 +510,152 @@ static void parse_args(int argc, char *argv[])
 	}
 }
 
+/* Returns the number of transposition table entries selected by --tt (or 0
+   if the table is disabled). */
+static size_t tt_entries(void)
+{
+	if (ai_use_tt <= 0) return 0;
+#ifndef FIXED_PARAMS
+	if (ai_use_tt < 10) ai_use_tt = 10;
+	if (ai_use_tt > 28) ai_use_tt = 28;
+#endif
+	return (size_t)1 << ai_use_tt;
+}
+
+/* Returns whether the global transposition table is used, which is the case
+   when the global engine searches: when playing, analyzing, serving or
+   benchmarking the search. Matches and self-play allocate a table for each
+   engine, and the other tools do not search at all. */
+static bool uses_global_tt(void)
+{
+#ifdef TOOLS
+	/* Same order as in run_tool(): */
+	if ( arg_perft_check || arg_perft > 0 || arg_playouts > 0 ||
+	     arg_hash_check > 0 || arg_record || arg_replay ||
+	     arg_record_test > 0 || arg_index || arg_lookup ) return false;
+	if (arg_analyze_file) return true;
+	if (arg_train || arg_match > 0) return false;
+	if (arg_server || arg_bench) return true;
+	if (arg_bench_eval > 0) return false;
+#endif
+	return true;
+}
+
+#ifdef TOOLS
+/* Plays a match between the engine configured on the command line and one
+   configured by additionally applying the options given with --vs (separated
+   by spaces or commas). */
+static bool run_match(void)
+{
+	char names[2][512], opts[256], *opt;
+	double game_time = (arg_limit.time > 0) ? arg_limit.time
+	                                        : default_player_time;
+	AI_Engine opponent;
+	MatchSide sides[2];
+
+	snprintf(names[0], sizeof(names[0]), "player%s", arg_engine);
+	sides[0].name    = names[0];
+	sides[0].engine  = &engine;
+	sides[0].tt_size = tt_entries();
+
+	snprintf(names[1], sizeof(names[1]), "player%s", arg_engine);
+	snprintf(opts, sizeof(opts), "%s", arg_vs ? arg_vs : "");
+	for (opt = strtok(opts, " ,"); opt != NULL; opt = strtok(NULL, " ,")) {
+		size_t len = strlen(names[1]);
+		if (!parse_engine_arg(opt)) {
+			fprintf(stderr, "Invalid engine option: `%s'!\n", opt);
+			return false;
+		}
+		snprintf(names[1] + len, sizeof(names[1]) - len, " %s", opt);
+	}
+	ai_engine_init(&opponent, &tt);  /* table is replaced by match_run() */
+	sides[1].name    = names[1];
+	sides[1].engine  = &opponent;
+	sides[1].tt_size = tt_entries();
+
+	return match_run( sides, arg_match, &arg_limit, game_time,
+	                  arg_threads, arg_seed, arg_use_sprt ? &arg_sprt : NULL );
+}
+
+/* Runs the tool selected on the command line (if any) on the initial game
+   state `board'. Returns the exit status of the tool, or -1 if no tool was
+   selected. */
+static int run_tool(Board *board)
+{
+	if (arg_perft_check || arg_perft > 0 || arg_playouts > 0) {
+		int flags = (arg_bulk ? PERFT_BULK : 0) | (arg_check ? PERFT_CHECK : 0);
+		bool ok;
+
+		if (arg_playouts > 0) {
+			ok = perft_playouts(board, arg_playouts, arg_seed, arg_threads);
+		} else if (arg_perft_check) {
+			ok = perft_check(flags, arg_threads);
+		} else {
+			ok = perft_run(board, arg_perft, flags, arg_threads);
+		}
+		if (!ok) return EXIT_FAILURE;
+#ifdef ZOBRIST
+	} else if (arg_hash_check > 0) {
+		if (!perft_hashes(arg_hash_check, arg_seed)) return EXIT_FAILURE;
+#endif
+	} else if (arg_record) {
+		if (!record_convert(arg_record, arg_files, arg_nfile)) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_replay) {
+		if (!record_check(arg_replay)) return EXIT_FAILURE;
+	} else if (arg_record_test > 0) {
+		if (!record_test(arg_record_test, arg_seed)) return EXIT_FAILURE;
+	} else if (arg_index) {
+		if (!index_build(arg_index, arg_files, arg_nfile)) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_lookup) {
+		PosIndex index;
+		bool found;
+
+		if (!index_open(&index, arg_lookup)) return EXIT_FAILURE;
+		found = index_query(&index, board, stdout);
+		index_close(&index);
+		if (!found) return EXIT_FAILURE;
+	} else if (arg_analyze_file) {
+		if (!analysis_file( &engine, arg_analyze_file, stdout,
+		                    &arg_limit, arg_threads )) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_train) {
+		if (!train_run( &engine, tt_entries(), arg_train, arg_games,
+		                &arg_limit, arg_sample, arg_threads, arg_seed )) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_match > 0) {
+		if (!run_match()) return EXIT_FAILURE;
+	} else if (arg_server && arg_analyze) {
+		if (arg_socket == NULL) {
+			analysis_run(&engine, stdin, stdout, &arg_limit, arg_threads);
+		} else if (!analysis_listen( &engine, arg_socket,
+		                             &arg_limit, arg_threads )) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_server) {
+		double game_time = (arg_limit.time > 0) ? arg_limit.time
+		                                        : default_player_time;
+		if (arg_socket == NULL) {
+			server_run(&engine, stdin, stdout, game_time);
+		} else if (!server_listen(&engine, arg_socket, game_time)) {
+			return EXIT_FAILURE;
+		}
+	} else if (arg_bench) {
+		bench_search(&engine);
+	} else if (arg_bench_eval > 0) {
+		bench_eval(arg_bench_eval, arg_threads);
+	} else {
+		return -1;
+	}
+	return EXIT_SUCCESS;
+}
+#endif /* def TOOLS */
+
 /* Prints total amount of memory mapped by the process by quering procfs.
    Completely Linux-specific, but only used for debugging. */
 static void print_memory_use(void)
@@ -313,6 +686,9 @@ int main(int argc, char *argv[])
 {
 	Board board;
 	Color next_player;
+#ifdef TOOLS
+	int status;
+#endif
 
 	/* Initialize timer, as early as possible! */
 	time_restart();
@@ -332,42 +708,55 @@ int main(int argc, char *argv[])
 	srand(arg_seed);
 	fprintf(stderr, "RNG seed %d.\n", arg_seed);
 
-	/* Initialize transposition table: */
-	if (ai_use_tt > 0) {
-#ifndef FIXED_PARAMS
-		if (ai_use_tt < 10) ai_use_tt = 10;
-		if (ai_use_tt > 28) ai_use_tt = 28;
+#ifdef TOOLS
+	/* Open telemetry output: */
+	if (arg_telemetry_fd >= 0 && !telemetry_open(arg_telemetry_fd)) {
+		fprintf(stderr, "Couldn't open file descriptor %d for telemetry!\n",
+			arg_telemetry_fd);
+		exit(EXIT_FAILURE);
+	}
 #endif
-		tt_init(1<<ai_use_tt);  /* 2 M entries = 48 MB at 24 bytes per entry */
+
+	/* Initialize transposition table (only if the global engine searches;
+	   matches and self-play allocate a table for each engine they use): */
+	if (tt_entries() > 0 && uses_global_tt()) {
+		/* 2 M entries = 48 MB at 24 bytes per entry */
+		tt_init(&tt, tt_entries());
+	}
+	if (tt.size > 0) {
 		fprintf(stderr, "%.3f MB transposition table is enabled.\n",
-			1.0*tt_size*sizeof(TTEntry)/1024/1024);
-	} else {
+			1.0*tt.size*sizeof(TTEntry)/1024/1024);
+	} else if (uses_global_tt()) {
 		fprintf(stderr, "Transposition table is disabled.\n");
-#ifndef FIXED_PARAMS
-		ai_use_killer = 0;  /* implicit */
-#endif
 	}
 
-	/* Print other parameters: */
+	/* Initialize the search engine (the killer heuristic is implicitly
+	   disabled without a transposition table), and print its parameters.
+	   Where the global table is not used, the engine refers to it anyway if
+	   tables are enabled; its users replace it with their own tables. */
+	ai_engine_init( &engine, tt.size > 0 || ( tt_entries() > 0 &&
+	                !uses_global_tt() ) ? &tt : NULL );
 	fprintf(stderr, "Move ordering is %s.\n",
-		ai_use_mo == 0 ? "disabled" :
-		ai_use_mo == 1 ? "heuristic" :
-		ai_use_mo == 2 ? "evaluated" : "invalid");
+		engine.use_mo == 0 ? "disabled" :
+		engine.use_mo == 1 ? "heuristic" :
+		engine.use_mo == 2 ? "evaluated" : "invalid");
 	fprintf(stderr, "Killer heuristic is %s.\n",
-		ai_use_killer == 0 ? "disabled" :
-		ai_use_killer == 1 ? "one ply" :
-		ai_use_killer == 2 ? "two ply" : "invalid");
+		engine.use_killer == 0 ? "disabled" :
+		engine.use_killer == 1 ? "one ply" :
+		engine.use_killer == 2 ? "two ply" : "invalid");
 	fprintf(stderr, "Principal variation search is %s.\n",
-		ai_use_pvs == 0 ? "disabled" :
-		ai_use_pvs == 1 ? "enabled" : "invalid" );
+		engine.use_pvs == 0 ? "disabled" :
+		engine.use_pvs == 1 ? "enabled" : "invalid" );
 	fprintf(stderr, "MTD(f) is %s.\n",
-		ai_use_mtdf == 0 ? "disabled" :
-		ai_use_mtdf == 1 ? "enabled" : "invalid" );
+		engine.use_mtdf == 0 ? "disabled" :
+		engine.use_mtdf == 1 ? "enabled" : "invalid" );
 	fprintf(stderr, "Iterative deepening increments with %d.\n",
-		ai_use_deepening );
+		engine.use_deepening );
 	print_memory_use();
 
-	fprintf(stderr, "Initialization took %.3fs.\n", time_used());
+	fprintf(stderr, "Initialization took %.3fs (startup: %.3fs).\n",
+		time_used(), time_startup());
+	fprintf(stderr, "Time margin is %.3fs.\n", time_margin);
 
 	/* Set-up initial game state */
 	board_clear(&board);
@@ -381,6 +770,14 @@ int main(int argc, char *argv[])
 	board_validate(&board);
 	
 	/* Run main program: */
+#ifdef TOOLS
+	status = run_tool(&board);
+	if (status >= 0) {
+		telemetry_close();
+		tt_fini(&tt);
+		return status;
+	}
+#endif
 	if (arg_analyze) {
 		if (next_player == NONE) {
 			fprintf(stderr, "Game already finished!\n");
@@ -401,7 +798,10 @@ int main(int argc, char *argv[])
 	}
 
 	/* Clean up: */
-	if (ai_use_tt) tt_fini();
+#ifdef TOOLS
+	telemetry_close();
+#endif
+	tt_fini(&tt);
 
 	return EXIT_SUCCESS;
 }
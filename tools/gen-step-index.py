@@ -60,6 +60,27 @@ def print_steps_index():
 		print line
 	print '};'
 
+def print_step_masks():
+	print 'const long long board_step_masks[50][49] = {'
+	for n in range(50):
+		line = "\t{ "
+		for i, (r,c) in enumerate(id_rc):
+			mask = 0
+			for step in get_steps(n, r, c):
+				mask |= 1 << (i + step)
+			line += "0x%013xLL"%mask
+			if i + 1 < len(id_rc):
+				if (i+1)%4 == 0:
+					line += ",\n\t  "
+				else:
+					line += ", "
+		line += ' }'
+		if n + 1 < 50:
+			line += ','
+		line += '  /* ' + str(n) + ' */'
+		print line
+	print '};'
+
 def print_distance():
 	print 'const char board_distance[49][49] = {'
 	for f, (r1,c1) in enumerate(id_rc):
@@ -103,6 +124,8 @@ print_steps_data()
 print
 print_steps_index()
 print
+print_step_masks()
+print
 print_distance()
 print
 print_neighbours()
@@ -1,23 +1,25 @@
-#!/usr/bin/env python2
+#!/usr/bin/env python3
+
+# Generates Game-zobrist-keys.c. The keys are drawn from a fixed seed (which
+# may be overridden on the command line), so that running this script without
+# arguments reproduces the table that is checked in.
 
 import random
+import sys
 
 N = 49
-X = 10  # number of values per line
-
-def keys():
-	while True:
-		yield "" % random.getrandbits(64)
+X = 5   # number of values per line
+SEED = 20260814
 
-it = keys()
+random.seed(int(sys.argv[1]) if len(sys.argv) > 1 else SEED)
 
 num_field_keys = 4*(N+1)*N
-print 'static const unsigned long long zobrist_init_key = 0x%016xull;' % random.getrandbits(64)
-print 'static const unsigned long long zobrist_player_key = 0x%016xull;' % random.getrandbits(64)
-print 'static const unsigned long long zobrist_phase_key = 0x%016xull;' % random.getrandbits(64)
-print 'static const unsigned zobrist_field_key[4*(N+1)*N] = {'
+print('static const unsigned long long zobrist_init_key = 0x%016xull;' % random.getrandbits(64))
+print('static const unsigned long long zobrist_player_key = 0x%016xull;' % random.getrandbits(64))
+print('static const unsigned long long zobrist_phase_key = 0x%016xull;' % random.getrandbits(64))
+print('static const unsigned long long zobrist_field_key[4*(N+1)*N] = {')
 for n in range(num_field_keys//X):
 	values = []
 	for c in range(X):
-		values.append("0x%08xu" % random.getrandbits(32))
-	print "\t " + ', '.join(values) + (" };", ",")[n + 1 < num_field_keys//X]
+		values.append("0x%016xull" % random.getrandbits(64))
+	print("\t " + ', '.join(values) + (" };", ",")[n + 1 < num_field_keys//X])